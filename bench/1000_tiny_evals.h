@@ -0,0 +1,9 @@
+#include <metalang99.h>
+
+#define _10                                                                                        \
+    ML99_EVAL(v(;)) ML99_EVAL(v(;)) ML99_EVAL(v(;)) ML99_EVAL(v(;)) ML99_EVAL(v(;))                \
+        ML99_EVAL(v(;)) ML99_EVAL(v(;)) ML99_EVAL(v(;)) ML99_EVAL(v(;)) ML99_EVAL(v(;))
+#define _100  _10 _10 _10 _10 _10 _10 _10 _10 _10 _10
+#define _1000 _100 _100 _100 _100 _100 _100 _100 _100 _100 _100
+
+_1000
@@ -0,0 +1,16 @@
+// `examples/ackermann.c` on `ack(2, N)`, which takes a number of calls quadratic in `N`.
+
+#include "stress.h"
+
+#ifndef N
+#define N 8
+#endif
+
+#define ack(m, n) ML99_natMatchWithArgs(m, v(ack_), n)
+
+#define ack_Z_IMPL(n)      ML99_inc(v(n))
+#define ack_S_IMPL(m, n)   ML99_natMatchWithArgs(v(n), v(ack_S_), v(m))
+#define ack_S_Z_IMPL(m)    ack(v(m), v(1))
+#define ack_S_S_IMPL(n, m) ack(v(m), ack(ML99_inc(v(m)), v(n)))
+
+STRESS(ack(v(2), v(N)))
@@ -0,0 +1,22 @@
+// `examples/binary_tree.c` on a full binary tree of depth `N` (`2^(N + 1) - 1` nodes), built by the
+// metaprogram itself. Every node holds 1, so that the sum, the number of nodes, fits into
+// `ML99_NAT_MAX` for `N` up to 7.
+
+#include "stress.h"
+
+#ifndef N
+#define N 5
+#endif
+
+#define Leaf(x)              ML99_choice(v(Leaf), x)
+#define Node(lhs, data, rhs) ML99_choice(v(Node), lhs, data, rhs)
+
+#define TREE(depth)        ML99_natMatch(depth, v(TREE_))
+#define TREE_Z_IMPL(...)   Leaf(v(1)) // `...` due to a TCC's bug.
+#define TREE_S_IMPL(depth) Node(TREE(v(depth)), v(1), TREE(v(depth)))
+
+#define SUM(tree)                     ML99_match(tree, v(SUM_))
+#define SUM_Leaf_IMPL(x)              v(x)
+#define SUM_Node_IMPL(lhs, data, rhs) ML99_add3(SUM(v(lhs)), v(data), SUM(v(rhs)))
+
+STRESS(SUM(TREE(v(N))))
@@ -0,0 +1,12 @@
+#include <metalang99.h>
+#include <metalang99/identset.h>
+
+#define KEYWORDS                                                                                   \
+    auto, break, case, char, const, continue, default, do, double, else, enum, extern, float, for, \
+        goto, if, inline, int, long, register, restrict, return, short, signed, sizeof, static,    \
+        struct, switch, typedef, union, unsigned, void, volatile, while
+
+ML99_ASSERT(ML99_listEqIdent(
+    v(ML99_C_KEYWORD_DETECTOR),
+    ML99_listDedup(v(ML99_C_KEYWORD_DETECTOR), ML99_list(v(KEYWORDS, KEYWORDS))),
+    ML99_list(v(KEYWORDS))));
@@ -0,0 +1,19 @@
+// `examples/factorial.c` on `N!`, computed on big naturals by repeated addition since it exceeds
+// `ML99_NAT_MAX` from `N = 6` on.
+
+#include "stress.h"
+
+#ifndef N
+#define N 10
+#endif
+
+#define factorial(n)          ML99_natMatch(n, v(factorial_))
+#define factorial_Z_IMPL(...) ML99_bigNat(v(1)) // `...` due to a TCC's bug.
+#define factorial_S_IMPL(n)   mul(factorial(v(n)), ML99_inc(v(n)))
+
+// `x * k` for a big natural `x` and a natural `k`.
+#define mul(x, k)        ML99_natMatchWithArgs(k, v(mul_), x)
+#define mul_Z_IMPL(x)    ML99_bigNat(v(0))
+#define mul_S_IMPL(k, x) ML99_bigNatAdd(v(x), mul(v(x), v(k)))
+
+STRESS(factorial(v(N)))
@@ -0,0 +1,5 @@
+#include <metalang99.h>
+
+#define CELL(i, j) ((i)*128 + (j))
+
+static const int table[] = ML99_EVAL(ML99_braced(ML99_genTable(v(32), v(128), v(CELL))));
@@ -0,0 +1 @@
+#include <metalang99.h>
@@ -0,0 +1,85 @@
+// `examples/lambda_calculus.c` on `N + N` in Church numerals, where `N` is written as `N`
+// applications of `SUCC` to `ZERO`, so that the term to normalise grows with `N`.
+
+#include "stress.h"
+
+#ifndef N
+#define N 4
+#endif
+
+// Syntactic terms {
+
+#define Var(i)     ML99_call(Var, i)
+#define Appl(M, N) ML99_call(Appl, M, N)
+#define Lam(M)     ML99_call(Lam, M)
+
+#define Var_IMPL(i)     v(VAR(i))
+#define Appl_IMPL(M, N) v(APPL(M, N))
+#define Lam_IMPL(M)     v(LAM(M))
+
+#define VAR(i)     ML99_CHOICE(Var, i)
+#define APPL(M, N) ML99_CHOICE(Appl, M, N)
+#define LAM(M)     ML99_CHOICE(Lam, M)
+// } (Syntactic terms)
+
+// Variable substitution: `M[1=x]` {
+
+#define subst(M, x) ML99_call(subst, M, x)
+
+#define subst_IMPL(M, x)           substAux_IMPL(M, x, 1)
+#define substAux_IMPL(M, x, depth) ML99_callUneval(ML99_matchWithArgs, M, substAux_, x, depth)
+
+#define substAux_Var_IMPL(i, x, depth)                                                             \
+    ML99_IF(                                                                                       \
+        ML99_NAT_EQ(i, depth),                                                                     \
+        v(x),                                                                                      \
+        ML99_call(ML99_if, ML99_callUneval(ML99_greater, i, depth), v(VAR(ML99_DEC(i)), VAR(i))))
+#define substAux_Appl_IMPL(M, N, x, depth)                                                         \
+    Appl(substAux_IMPL(M, x, depth), substAux_IMPL(N, x, depth))
+#define substAux_Lam_IMPL(M, x, depth)                                                             \
+    Lam(ML99_call(substAux, v(M), incFreeVars_IMPL(x), v(ML99_INC(depth))))
+// } (Variable substitution)
+
+// Increment free variables in `M` {
+
+#define incFreeVars(M) ML99_call(incFreeVars, M)
+
+#define incFreeVars_IMPL(M)           incFreeVarsAux_IMPL(M, 1)
+#define incFreeVarsAux_IMPL(M, depth) ML99_callUneval(ML99_matchWithArgs, M, incFreeVarsAux_, depth)
+
+#define incFreeVarsAux_Var_IMPL(i, depth)                                                          \
+    ML99_call(ML99_if, ML99_callUneval(ML99_greaterEq, i, depth), v(VAR(ML99_INC(i)), VAR(i)))
+#define incFreeVarsAux_Appl_IMPL(M, N, depth)                                                      \
+    Appl(incFreeVarsAux_IMPL(M, depth), incFreeVarsAux_IMPL(N, depth))
+#define incFreeVarsAux_Lam_IMPL(M, depth) Lam(incFreeVarsAux_IMPL(M, ML99_INC(depth)))
+// } (Increment free variables)
+
+// Evaluation {
+
+#define eval(M) ML99_call(eval, M)
+
+#define eval_IMPL(M)         ML99_callUneval(ML99_match, M, eval_)
+#define eval_Var_IMPL(i)     v(VAR(i))
+#define eval_Appl_IMPL(M, N) ML99_callUneval(ML99_matchWithArgs, M, eval_Appl_, N)
+#define eval_Lam_IMPL(M)     Lam(eval_IMPL(M))
+
+#define eval_Appl_Var_IMPL(i, N) Appl(v(VAR(i)), eval_IMPL(N))
+#define eval_Appl_Appl_IMPL(M, N, N1)                                                              \
+    ML99_call(ML99_matchWithArgs, eval(Appl_IMPL(M, N)), v(eval_Appl_Appl_, N1))
+#define eval_Appl_Lam_IMPL(M, N) eval(subst_IMPL(M, N))
+
+#define eval_Appl_Appl_Var_IMPL            eval_Appl_Var_IMPL
+#define eval_Appl_Appl_Appl_IMPL(M, N, N1) Appl(Appl_IMPL(M, N), eval_IMPL(N1))
+#define eval_Appl_Appl_Lam_IMPL            eval_Appl_Lam_IMPL
+// } (Evaluation)
+
+#define ZERO LAM(LAM(VAR(1)))
+#define SUCC LAM(LAM(LAM(APPL(VAR(2), APPL(APPL(VAR(3), VAR(2)), VAR(1))))))
+#define ADD  LAM(LAM(LAM(LAM(APPL(APPL(VAR(4), VAR(2)), APPL(APPL(VAR(3), VAR(2)), VAR(1)))))))
+
+// `SUCC (SUCC (... ZERO))`, `n` times.
+#define church(n)          ML99_natMatch(n, v(church_))
+#define church_Z_IMPL(...) v(ZERO) // `...` due to a TCC's bug.
+#define church_S_IMPL(n)   Appl(v(SUCC), church(v(n)))
+
+STRESS(eval(Appl(Appl(v(ADD), church(v(N))), church(v(N)))))
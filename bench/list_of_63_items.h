@@ -5,4 +5,4 @@
         27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48,    \
         49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63
 
-ML99_EVAL(ML99_empty(ML99_list(v(NUMBERS))))
+static const int is_nil = ML99_EVAL(ML99_isNil(ML99_list(v(NUMBERS))));
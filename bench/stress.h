@@ -0,0 +1,17 @@
+// The end-to-end benchmarks adapted from `examples/` evaluate a single metaprogram by `STRESS`, so
+// that `scripts/bench.py` can also count its reduction steps: with `ML99_PROFILE` defined, `STRESS`
+// yields the steps as `ml99_bench_steps` instead of the result. Their input size is `N`, which the
+// script passes by `-DN=...`.
+
+#ifndef ML99_BENCH_STRESS_H
+#define ML99_BENCH_STRESS_H
+
+#include <metalang99.h>
+
+#ifdef ML99_PROFILE
+#define STRESS(...) static const int ml99_bench_steps = ML99_EVAL_STEPS(__VA_ARGS__);
+#else
+#define STRESS(...) static const char ml99_bench_result[] = ML99_STRINGIFY(ML99_EVAL(__VA_ARGS__));
+#endif
+
+#endif // ML99_BENCH_STRESS_H
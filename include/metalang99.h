@@ -8,6 +8,7 @@
 #include <metalang99/assert.h>
 #include <metalang99/choice.h>
 #include <metalang99/control.h>
+#include <metalang99/div.h>
 #include <metalang99/gen.h>
 #include <metalang99/ident.h>
 #include <metalang99/lang.h>
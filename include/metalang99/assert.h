@@ -12,6 +12,8 @@
 #define ML99_ASSERT_H
 
 #include <metalang99/priv/compiler_specific.h>
+#include <metalang99/priv/logical.h>
+#include <metalang99/priv/util.h>
 
 #include <metalang99/lang.h>
 #include <metalang99/logical.h>
@@ -40,11 +42,14 @@
  * ML99_ASSERT(v(123 == 123));
  * @endcode
  */
-#define ML99_ASSERT(expr) ML99_ASSERT_EQ(expr, ML99_true())
+#define ML99_ASSERT(expr) ML99_ASSERT_EQ(expr, v(ML99_TRUE()))
 
 /**
  * Asserts `ML99_EVAL(lhs) == ML99_EVAL(rhs)` at compile-time.
  *
+ * An operand that is a literal `v(...)` term is not evaluated by the interpreter, so that
+ * `ML99_ASSERT_EQ(v(x), v(y))` is as cheap as `ML99_ASSERT_UNEVAL((x) == (y))`.
+ *
  * # Examples
  *
  * @code
@@ -53,7 +58,27 @@
  * ML99_ASSERT_EQ(v(123), v(123));
  * @endcode
  */
-#define ML99_ASSERT_EQ(lhs, rhs) ML99_ASSERT_UNEVAL((ML99_EVAL(lhs)) == (ML99_EVAL(rhs)))
+#define ML99_ASSERT_EQ(lhs, rhs)                                                                   \
+    ML99_ASSERT_UNEVAL((ML99_PRIV_ASSERT_OPERAND(lhs)) == (ML99_PRIV_ASSERT_OPERAND(rhs)))
+
+/**
+ * Asserts `ML99_EVAL e1`, `ML99_EVAL e2`, ..., `ML99_EVAL eN` at compile-time, where each `ei` is
+ * a parenthesised expression.
+ *
+ * The expressions are evaluated by a single #ML99_EVAL_MANY and checked by a single assertion, so
+ * it may fail without saying which of the expressions is false. At most 63 expressions are
+ * acceptable.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/assert.h>
+ * #include <metalang99/nat.h>
+ *
+ * ML99_ASSERTS((v(123 == 123)), (ML99_natEq(v(5), v(5))), (ML99_true()));
+ * @endcode
+ */
+#define ML99_ASSERTS(...) ML99_ASSERT_UNEVAL(ML99_PRIV_ASSERTS(__VA_ARGS__))
 
 /**
  * Asserts the C constant expression @p expr; <a
@@ -72,6 +97,8 @@
 /**
  * Asserts that `ML99_EVAL(expr)` is emptiness.
  *
+ * If @p expr is a literal `v(...)` term, it is not evaluated by the interpreter.
+ *
  * # Examples
  *
  * @code
@@ -84,7 +111,7 @@
  * ML99_ASSERT_EMPTY(v(123));
  * @endcode
  */
-#define ML99_ASSERT_EMPTY(expr) ML99_ASSERT_EMPTY_UNEVAL(ML99_EVAL(expr))
+#define ML99_ASSERT_EMPTY(expr) ML99_ASSERT_EMPTY_UNEVAL(ML99_PRIV_ASSERT_OPERAND(expr))
 
 /**
  * Asserts that @p expr is emptiness.
@@ -121,6 +148,36 @@
 
 #define ML99_PRIV_ASSERT_EMPTY_ 1
 
+/* The term `(0v, x)` evaluates to `x` itself, so a literal operand of an assertion is unwrapped in
+ * place instead of starting a machine. Two non-literal operands are still evaluated by two
+ * machines: evaluating both by `ML99_assertEq` within a single one is slower, since the call
+ * evaluates its arguments through the continuation stack. */
+// Literal operands {
+
+#define ML99_PRIV_ASSERT_IS_V(x)                                                                   \
+    ML99_PRIV_IF(ML99_PRIV_IS_TUPLE_FAST(x), ML99_PRIV_ASSERT_IS_V_HEAD, ML99_PRIV_ASSERT_FALSE)(x)
+#define ML99_PRIV_ASSERT_IS_V_HEAD(x)                                                              \
+    ML99_PRIV_SND(ML99_PRIV_CAT(ML99_PRIV_ASSERT_IS_V_, ML99_PRIV_HEAD x), 0)
+#define ML99_PRIV_ASSERT_IS_V_0v   ~, 1
+#define ML99_PRIV_ASSERT_FALSE(_x) 0
+
+#define ML99_PRIV_ASSERT_OPERAND(x)                                                                \
+    ML99_PRIV_IF(ML99_PRIV_ASSERT_IS_V(x), ML99_PRIV_ASSERT_V, ML99_PRIV_ASSERT_EVAL)(x)
+#define ML99_PRIV_ASSERT_V(x)    ML99_PRIV_TAIL x
+#define ML99_PRIV_ASSERT_EVAL(x) ML99_EVAL(x)
+// } (Literal operands)
+
+// ML99_ASSERTS {
+
+#define ML99_PRIV_ASSERTS(...)         ML99_PRIV_ASSERTS_AUX(ML99_EVAL_MANY(__VA_ARGS__))
+#define ML99_PRIV_ASSERTS_AUX(results) 1 ML99_PRIV_CAT(ML99_PRIV_ASSERTS_AND_A results, _END)
+
+#define ML99_PRIV_ASSERTS_AND_A(x) &&(x)ML99_PRIV_ASSERTS_AND_B
+#define ML99_PRIV_ASSERTS_AND_B(x) &&(x)ML99_PRIV_ASSERTS_AND_A
+#define ML99_PRIV_ASSERTS_AND_A_END
+#define ML99_PRIV_ASSERTS_AND_B_END
+// } (ML99_ASSERTS)
+
 // Arity specifiers {
 
 #define ML99_assert_ARITY   1
@@ -0,0 +1,906 @@
+/**
+ * @file
+ * Big natural numbers.
+ *
+ * A big natural number is a natural number of any magnitude, not bounded by #ML99_NAT_MAX. The
+ * operations on big naturals take a number of reduction steps proportional to the number of
+ * decimal digits, not to the magnitude, so they are suitable for counts such as 1000 or 50000.
+ *
+ * The representation of a big natural is unspecified: construct one with #ML99_bigNat,
+ * #ML99_bigNatFromDigits, or #ML99_BIG_NAT and turn it into a C literal with #ML99_BIG_NAT_LIT.
+ *
+ * `metalang99.h` does not include this header.
+ */
+
+#ifndef ML99_BIGNAT_H
+#define ML99_BIGNAT_H
+
+#include <metalang99/nat/dec.h>
+#include <metalang99/nat/digits.h>
+#include <metalang99/nat/eq.h>
+#include <metalang99/nat/inc.h>
+
+#include <metalang99/priv/util.h>
+
+#include <metalang99/lang.h>
+
+/**
+ * Converts the natural number @p x to a big natural.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/bignat.h>
+ *
+ * // The big natural 123.
+ * ML99_bigNat(v(123))
+ * @endcode
+ */
+#define ML99_bigNat(x) ML99_call(ML99_bigNat, x)
+
+/**
+ * Constructs a big natural from its decimal digits, the most significant one first.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/bignat.h>
+ *
+ * // The big natural 1024.
+ * ML99_bigNatFromDigits(v(1, 0, 2, 4))
+ * @endcode
+ */
+#define ML99_bigNatFromDigits(...) ML99_call(ML99_bigNatFromDigits, __VA_ARGS__)
+
+/**
+ * \f$x + 1\f$
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/bignat.h>
+ *
+ * // The big natural 1000.
+ * ML99_bigNatInc(ML99_bigNatFromDigits(v(9, 9, 9)))
+ * @endcode
+ */
+#define ML99_bigNatInc(x) ML99_call(ML99_bigNatInc, x)
+
+/**
+ * \f$x - 1\f$
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/bignat.h>
+ *
+ * // The big natural 999.
+ * ML99_bigNatDec(ML99_bigNatFromDigits(v(1, 0, 0, 0)))
+ * @endcode
+ *
+ * @note A compile-time error if @p x is 0.
+ */
+#define ML99_bigNatDec(x) ML99_call(ML99_bigNatDec, x)
+
+/**
+ * \f$x + y\f$
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/bignat.h>
+ *
+ * // The big natural 1255.
+ * ML99_bigNatAdd(ML99_bigNatFromDigits(v(1, 0, 0, 0)), ML99_bigNat(v(255)))
+ * @endcode
+ */
+#define ML99_bigNatAdd(x, y) ML99_call(ML99_bigNatAdd, x, y)
+
+/**
+ * \f$x - y\f$
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/bignat.h>
+ *
+ * // The big natural 745.
+ * ML99_bigNatSub(ML99_bigNatFromDigits(v(1, 0, 0, 0)), ML99_bigNat(v(255)))
+ * @endcode
+ *
+ * @note A compile-time error if @p y is greater than @p x.
+ */
+#define ML99_bigNatSub(x, y) ML99_call(ML99_bigNatSub, x, y)
+
+/**
+ * \f$x = y\f$
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/bignat.h>
+ *
+ * // 1
+ * ML99_bigNatEq(ML99_bigNatFromDigits(v(0, 2, 5, 5)), ML99_bigNat(v(255)))
+ *
+ * // 0
+ * ML99_bigNatEq(ML99_bigNatFromDigits(v(1, 2, 5, 5)), ML99_bigNat(v(255)))
+ * @endcode
+ */
+#define ML99_bigNatEq(x, y) ML99_call(ML99_bigNatEq, x, y)
+
+/**
+ * \f$x < y\f$
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/bignat.h>
+ *
+ * // 1
+ * ML99_bigNatLesser(ML99_bigNat(v(255)), ML99_bigNatFromDigits(v(1, 0, 0, 0)))
+ *
+ * // 0
+ * ML99_bigNatLesser(ML99_bigNatFromDigits(v(1, 0, 0, 0)), ML99_bigNat(v(255)))
+ * @endcode
+ */
+#define ML99_bigNatLesser(x, y) ML99_call(ML99_bigNatLesser, x, y)
+
+/**
+ * Like #ML99_repeat but @p n and the iteration indices are big naturals.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/bignat.h>
+ * #include <metalang99/util.h>
+ *
+ * #define F_IMPL(i) v(int ML99_CAT(x, ML99_BIG_NAT_LIT(i));)
+ * #define F_ARITY   1
+ *
+ * // int x0; int x1; ... int x999;
+ * ML99_bigNatRepeat(ML99_bigNatFromDigits(v(1, 0, 0, 0)), v(F))
+ * @endcode
+ */
+#define ML99_bigNatRepeat(n, f) ML99_call(ML99_bigNatRepeat, n, f)
+
+/**
+ * Like #ML99_times but @p n is a big natural.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/bignat.h>
+ *
+ * // ~ ~ ~ ... ~ (1000 times)
+ * ML99_bigNatTimes(ML99_bigNatFromDigits(v(1, 0, 0, 0)), v(~))
+ * @endcode
+ */
+#define ML99_bigNatTimes(n, ...) ML99_call(ML99_bigNatTimes, n, __VA_ARGS__)
+
+/**
+ * The plain version of #ML99_bigNat.
+ */
+#define ML99_BIG_NAT(x) ML99_PRIV_BIG_NAT(ML99_PRIV_NAT_TO_DIGITS(x))
+
+/**
+ * Turns the big natural @p x into a C integer literal.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/bignat.h>
+ *
+ * // 1024
+ * ML99_BIG_NAT_LIT(ML99_EVAL(ML99_bigNatFromDigits(v(1, 0, 2, 4))))
+ * @endcode
+ *
+ * @note @p x must have at most 8 digits.
+ */
+#define ML99_BIG_NAT_LIT(x) ML99_PRIV_BIG_NAT_LIT x
+
+#ifndef DOXYGEN_IGNORE
+
+/* A big natural is a tuple of its decimal digits, the least significant one first, without
+ * leading zeros, e.g., `(4, 2, 0, 1)` is 1024 and `(0)` is 0. The digits are added and subtracted
+ * by the digit tables below, one digit per reduction step. An accumulator of
+ * the resulting digits takes the form `(, d0, d1, ...)`, so that appending to an empty accumulator
+ * does not require a special case. */
+
+#define ML99_bigNat_IMPL(x) v(ML99_BIG_NAT(x))
+
+#define ML99_PRIV_BIG_NAT(...) ML99_PRIV_BIG_NAT_AUX(__VA_ARGS__)
+#define ML99_PRIV_BIG_NAT_AUX(h, t, o)                                                             \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_NAT_EQ(h, 0),                                                                    \
+        ML99_PRIV_IF(ML99_PRIV_NAT_EQ(t, 0), (o), (o, t)),                                         \
+        (o, t, h))
+
+// ML99_bigNatFromDigits_IMPL {
+
+#define ML99_bigNatFromDigits_IMPL(...)                                                            \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_AND(                                                                             \
+            ML99_PRIV_CONTAINS_COMMA(__VA_ARGS__),                                                 \
+            ML99_PRIV_NAT_EQ(ML99_PRIV_HEAD(__VA_ARGS__), 0)),                                     \
+        ML99_PRIV_bigNatFromDigitsSkip,                                                            \
+        ML99_PRIV_bigNatFromDigitsStart)                                                           \
+    (__VA_ARGS__)
+
+#define ML99_PRIV_bigNatFromDigitsSkip(_zero, ...)                                                 \
+    ML99_callUneval(ML99_bigNatFromDigits, __VA_ARGS__)
+#define ML99_PRIV_bigNatFromDigitsStart(...)                                                       \
+    ML99_PRIV_bigNatFromDigitsAux_IMPL((ML99_PRIV_HEAD(__VA_ARGS__)), __VA_ARGS__)
+
+// Prepends each digit after the first one to `acc`.
+#define ML99_PRIV_bigNatFromDigitsAux_IMPL(acc, ...)                                               \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_CONTAINS_COMMA(__VA_ARGS__),                                                     \
+        ML99_PRIV_bigNatFromDigitsNext,                                                            \
+        ML99_PRIV_bigNatFromDigitsDone)                                                            \
+    (acc, __VA_ARGS__)
+
+#define ML99_PRIV_bigNatFromDigitsNext(acc, _d, ...)                                               \
+    ML99_callUneval(                                                                               \
+        ML99_PRIV_bigNatFromDigitsAux,                                                             \
+        (ML99_PRIV_HEAD(__VA_ARGS__), ML99_PRIV_EXPAND acc),                                       \
+        __VA_ARGS__)
+#define ML99_PRIV_bigNatFromDigitsDone(acc, _d) v(acc)
+// } (ML99_bigNatFromDigits_IMPL)
+
+// ML99_bigNatInc_IMPL, ML99_bigNatDec_IMPL {
+
+#define ML99_bigNatInc_IMPL(x)                                                                     \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_NAT_EQ(ML99_PRIV_HEAD x, 9),                                                     \
+        ML99_PRIV_IF(                                                                              \
+            ML99_PRIV_BIG_NAT_IS_MULTI(x),                                                         \
+            ML99_PRIV_BIG_NAT_INC_CARRY,                                                           \
+            ML99_PRIV_BIG_NAT_INC_NEW_DIGIT),                                                      \
+        ML99_PRIV_BIG_NAT_INC_DIGIT)                                                               \
+    (x)
+
+#define ML99_PRIV_BIG_NAT_INC_DIGIT(x) v((ML99_PRIV_INC(ML99_PRIV_HEAD x) ML99_PRIV_BIG_NAT_REST(x)))
+#define ML99_PRIV_BIG_NAT_INC_NEW_DIGIT(_x) v((0, 1))
+#define ML99_PRIV_BIG_NAT_INC_CARRY(x)                                                             \
+    ML99_call(                                                                                     \
+        ML99_PRIV_bigNatPrepend,                                                                   \
+        v(0),                                                                                      \
+        ML99_callUneval(ML99_bigNatInc, ML99_PRIV_BIG_NAT_NEXT(x)))
+
+#define ML99_bigNatDec_IMPL(x)                                                                     \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_NAT_EQ(ML99_PRIV_HEAD x, 0),                                                     \
+        ML99_PRIV_IF(                                                                              \
+            ML99_PRIV_BIG_NAT_IS_MULTI(x),                                                         \
+            ML99_PRIV_IF(                                                                          \
+                ML99_PRIV_BIG_NAT_IS_ONE(ML99_PRIV_BIG_NAT_NEXT(x)),                               \
+                ML99_PRIV_BIG_NAT_DEC_LAST_DIGIT,                                                  \
+                ML99_PRIV_BIG_NAT_DEC_BORROW),                                                     \
+            ML99_PRIV_BIG_NAT_DEC_ZERO),                                                           \
+        ML99_PRIV_BIG_NAT_DEC_DIGIT)                                                               \
+    (x)
+
+#define ML99_PRIV_BIG_NAT_DEC_DIGIT(x) v((ML99_PRIV_DEC(ML99_PRIV_HEAD x) ML99_PRIV_BIG_NAT_REST(x)))
+#define ML99_PRIV_BIG_NAT_DEC_LAST_DIGIT(_x) v((9))
+#define ML99_PRIV_BIG_NAT_DEC_ZERO(_x)       ML99_fatal(ML99_bigNatDec, 0 has no predecessor)
+#define ML99_PRIV_BIG_NAT_DEC_BORROW(x)                                                            \
+    ML99_call(                                                                                     \
+        ML99_PRIV_bigNatPrepend,                                                                   \
+        v(9),                                                                                      \
+        ML99_callUneval(ML99_bigNatDec, ML99_PRIV_BIG_NAT_NEXT(x)))
+
+#define ML99_PRIV_bigNatPrepend_IMPL(d, x) v((d, ML99_PRIV_EXPAND x))
+// } (ML99_bigNatInc_IMPL, ML99_bigNatDec_IMPL)
+
+// ML99_bigNatAdd_IMPL {
+
+#define ML99_bigNatAdd_IMPL(x, y) ML99_PRIV_bigNatAdd_IMPL(0, (), x, y)
+#define ML99_PRIV_bigNatAdd_IMPL(c, acc, x, y)                                                     \
+    ML99_PRIV_BIG_NAT_ADD_DIGIT(c, ML99_PRIV_HEAD x, ML99_PRIV_HEAD y, acc, x, y)
+
+#define ML99_PRIV_BIG_NAT_ADD_DIGIT(c, xd, yd, ...)                                                \
+    ML99_PRIV_BIG_NAT_ADD_DIGIT_AUX(c, xd, yd, __VA_ARGS__)
+#define ML99_PRIV_BIG_NAT_ADD_DIGIT_AUX(c, xd, yd, ...)                                            \
+    ML99_PRIV_BIG_NAT_ADD_STEP(ML99_PRIV_BIG_NAT_DIGIT_ADD_##c##_##xd##_##yd, __VA_ARGS__)
+
+#define ML99_PRIV_BIG_NAT_ADD_STEP(...) ML99_PRIV_BIG_NAT_ADD_STEP_AUX(__VA_ARGS__)
+#define ML99_PRIV_BIG_NAT_ADD_STEP_AUX(c, d, acc, x, y)                                            \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_BIG_NAT_IS_MULTI_ANY(x, y),                                                      \
+        ML99_callUneval(                                                                           \
+            ML99_PRIV_bigNatAdd,                                                                   \
+            c,                                                                                     \
+            (ML99_PRIV_EXPAND acc, d),                                                             \
+            ML99_PRIV_BIG_NAT_NEXT(x),                                                             \
+            ML99_PRIV_BIG_NAT_NEXT(y)),                                                            \
+        v(ML99_PRIV_IF(                                                                            \
+            c,                                                                                     \
+            (ML99_PRIV_TAIL(ML99_PRIV_EXPAND acc, d, 1)),                                          \
+            (ML99_PRIV_TAIL(ML99_PRIV_EXPAND acc, d)))))
+// } (ML99_bigNatAdd_IMPL)
+
+// ML99_bigNatSub_IMPL {
+
+// The zero digits just computed are kept in `zeros` until a non-zero digit is computed, so that
+// the result has no leading zeros.
+#define ML99_bigNatSub_IMPL(x, y) ML99_PRIV_bigNatSub_IMPL(0, (), (), x, y)
+#define ML99_PRIV_bigNatSub_IMPL(b, acc, zeros, x, y)                                              \
+    ML99_PRIV_BIG_NAT_SUB_DIGIT(b, ML99_PRIV_HEAD x, ML99_PRIV_HEAD y, acc, zeros, x, y)
+
+#define ML99_PRIV_BIG_NAT_SUB_DIGIT(b, xd, yd, ...)                                                \
+    ML99_PRIV_BIG_NAT_SUB_DIGIT_AUX(b, xd, yd, __VA_ARGS__)
+#define ML99_PRIV_BIG_NAT_SUB_DIGIT_AUX(b, xd, yd, ...)                                            \
+    ML99_PRIV_BIG_NAT_SUB_STEP(ML99_PRIV_BIG_NAT_DIGIT_SUB_##b##_##xd##_##yd, __VA_ARGS__)
+
+#define ML99_PRIV_BIG_NAT_SUB_STEP(...) ML99_PRIV_BIG_NAT_SUB_STEP_AUX(__VA_ARGS__)
+#define ML99_PRIV_BIG_NAT_SUB_STEP_AUX(b, d, acc, zeros, x, y)                                     \
+    ML99_PRIV_BIG_NAT_SUB_NEXT(b, ML99_PRIV_BIG_NAT_SUB_PUSH(d, acc, zeros), x, y)
+
+#define ML99_PRIV_BIG_NAT_SUB_PUSH(d, acc, zeros)                                                  \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_NAT_EQ(d, 0),                                                                    \
+        (acc, (ML99_PRIV_EXPAND zeros, 0)),                                                        \
+        ((ML99_PRIV_EXPAND acc ML99_PRIV_EXPAND zeros, d), ()))
+
+#define ML99_PRIV_BIG_NAT_SUB_NEXT(b, acc_zeros, x, y)                                             \
+    ML99_PRIV_BIG_NAT_SUB_NEXT_AUX(b, ML99_PRIV_EXPAND acc_zeros, x, y)
+#define ML99_PRIV_BIG_NAT_SUB_NEXT_AUX(...) ML99_PRIV_BIG_NAT_SUB_NEXT_AUX_AUX(__VA_ARGS__)
+#define ML99_PRIV_BIG_NAT_SUB_NEXT_AUX_AUX(b, acc, zeros, x, y)                                    \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_BIG_NAT_IS_MULTI_ANY(x, y),                                                      \
+        ML99_callUneval(                                                                           \
+            ML99_PRIV_bigNatSub,                                                                   \
+            b,                                                                                     \
+            acc,                                                                                   \
+            zeros,                                                                                 \
+            ML99_PRIV_BIG_NAT_NEXT(x),                                                             \
+            ML99_PRIV_BIG_NAT_NEXT(y)),                                                            \
+        ML99_PRIV_IF(                                                                              \
+            b,                                                                                     \
+            ML99_fatal(ML99_bigNatSub, the subtrahend is greater than the minuend),                \
+            v(ML99_PRIV_BIG_NAT_FROM_ACC(acc))))
+// } (ML99_bigNatSub_IMPL)
+
+// ML99_bigNatEq_IMPL {
+
+#define ML99_bigNatEq_IMPL(x, y) ML99_PRIV_BIG_NAT_EQ(ML99_PRIV_HEAD x, ML99_PRIV_HEAD y, x, y)
+#define ML99_PRIV_BIG_NAT_EQ(xd, yd, x, y)                                                         \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_NAT_EQ(xd, yd),                                                                  \
+        ML99_PRIV_IF(                                                                              \
+            ML99_PRIV_AND(ML99_PRIV_BIG_NAT_IS_MULTI(x), ML99_PRIV_BIG_NAT_IS_MULTI(y)),           \
+            ML99_callUneval(ML99_bigNatEq, ML99_PRIV_BIG_NAT_NEXT(x), ML99_PRIV_BIG_NAT_NEXT(y)),  \
+            v(ML99_PRIV_NOT(ML99_PRIV_BIG_NAT_IS_MULTI_ANY(x, y)))),                               \
+        v(0))
+// } (ML99_bigNatEq_IMPL)
+
+// ML99_bigNatLesser_IMPL {
+
+// `x < y` is the final borrow of `x - y`.
+#define ML99_bigNatLesser_IMPL(x, y) ML99_PRIV_bigNatLesser_IMPL(0, x, y)
+#define ML99_PRIV_bigNatLesser_IMPL(b, x, y)                                                       \
+    ML99_PRIV_BIG_NAT_LESSER_DIGIT(b, ML99_PRIV_HEAD x, ML99_PRIV_HEAD y, x, y)
+
+#define ML99_PRIV_BIG_NAT_LESSER_DIGIT(b, xd, yd, x, y)                                            \
+    ML99_PRIV_BIG_NAT_LESSER_DIGIT_AUX(b, xd, yd, x, y)
+#define ML99_PRIV_BIG_NAT_LESSER_DIGIT_AUX(b, xd, yd, x, y)                                        \
+    ML99_PRIV_BIG_NAT_LESSER_STEP(ML99_PRIV_BIG_NAT_DIGIT_SUB_##b##_##xd##_##yd, x, y)
+
+#define ML99_PRIV_BIG_NAT_LESSER_STEP(...) ML99_PRIV_BIG_NAT_LESSER_STEP_AUX(__VA_ARGS__)
+#define ML99_PRIV_BIG_NAT_LESSER_STEP_AUX(b, _d, x, y)                                             \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_BIG_NAT_IS_MULTI_ANY(x, y),                                                      \
+        ML99_callUneval(                                                                           \
+            ML99_PRIV_bigNatLesser,                                                                \
+            b,                                                                                     \
+            ML99_PRIV_BIG_NAT_NEXT(x),                                                             \
+            ML99_PRIV_BIG_NAT_NEXT(y)),                                                            \
+        v(b))
+// } (ML99_bigNatLesser_IMPL)
+
+// ML99_bigNatRepeat_IMPL, ML99_bigNatTimes_IMPL {
+
+// The number of the remaining iterations is decremented and the index is incremented, each taking
+// a constant number of reduction steps on average.
+#define ML99_bigNatRepeat_IMPL(n, f) ML99_PRIV_bigNatRepeat_IMPL((0), n, f)
+#define ML99_PRIV_bigNatRepeat_IMPL(i, n, f)                                                       \
+    ML99_PRIV_IF(ML99_PRIV_BIG_NAT_IS_ZERO(n), ML99_PRIV_BIG_NAT_DONE, ML99_PRIV_BIG_NAT_REPEAT)   \
+    (i, n, f)
+#define ML99_PRIV_BIG_NAT_REPEAT(i, n, f)                                                          \
+    ML99_TERMS(                                                                                    \
+        ML99_appl_IMPL(f, i),                                                                      \
+        ML99_call(                                                                                 \
+            ML99_PRIV_bigNatRepeat,                                                                \
+            ML99_bigNatInc_IMPL(i),                                                                \
+            ML99_bigNatDec_IMPL(n),                                                                \
+            v(f)))
+
+#define ML99_bigNatTimes_IMPL(n, ...)                                                              \
+    ML99_PRIV_IF(ML99_PRIV_BIG_NAT_IS_ZERO(n), ML99_PRIV_BIG_NAT_DONE, ML99_PRIV_BIG_NAT_TIMES)    \
+    (n, __VA_ARGS__)
+#define ML99_PRIV_BIG_NAT_TIMES(n, ...)                                                            \
+    ML99_TERMS(v(__VA_ARGS__), ML99_call(ML99_bigNatTimes, ML99_bigNatDec_IMPL(n), v(__VA_ARGS__)))
+
+#define ML99_PRIV_BIG_NAT_DONE(...) v(ML99_PRIV_EMPTY())
+// } (ML99_bigNatRepeat_IMPL, ML99_bigNatTimes_IMPL)
+
+// Digits {
+
+#define ML99_PRIV_BIG_NAT_IS_MULTI(x) ML99_PRIV_CONTAINS_COMMA(ML99_PRIV_EXPAND x)
+#define ML99_PRIV_BIG_NAT_IS_MULTI_ANY(x, y)                                                       \
+    ML99_PRIV_OR(ML99_PRIV_BIG_NAT_IS_MULTI(x), ML99_PRIV_BIG_NAT_IS_MULTI(y))
+
+#define ML99_PRIV_BIG_NAT_IS_ZERO(x)                                                               \
+    ML99_PRIV_AND(                                                                                 \
+        ML99_PRIV_NOT(ML99_PRIV_BIG_NAT_IS_MULTI(x)),                                              \
+        ML99_PRIV_NAT_EQ(ML99_PRIV_HEAD x, 0))
+#define ML99_PRIV_BIG_NAT_IS_ONE(x)                                                                \
+    ML99_PRIV_AND(                                                                                 \
+        ML99_PRIV_NOT(ML99_PRIV_BIG_NAT_IS_MULTI(x)),                                              \
+        ML99_PRIV_NAT_EQ(ML99_PRIV_HEAD x, 1))
+
+// The digits after the first one, or 0 if there are none.
+#define ML99_PRIV_BIG_NAT_NEXT(x)                                                                  \
+    (ML99_PRIV_IF(ML99_PRIV_BIG_NAT_IS_MULTI(x), ML99_PRIV_TAIL, ML99_PRIV_BIG_NAT_0) x)
+#define ML99_PRIV_BIG_NAT_0(...) 0
+
+// A comma followed by the digits after the first one, or emptiness if there are none.
+#define ML99_PRIV_BIG_NAT_REST(x)                                                                  \
+    ML99_PRIV_IF(ML99_PRIV_BIG_NAT_IS_MULTI(x), ML99_PRIV_BIG_NAT_COMMA_TAIL, ML99_PRIV_EMPTY) x
+#define ML99_PRIV_BIG_NAT_COMMA_TAIL(_d, ...) , __VA_ARGS__
+
+#define ML99_PRIV_BIG_NAT_FROM_ACC(acc)                                                            \
+    (ML99_PRIV_IF(                                                                                 \
+        ML99_PRIV_CONTAINS_COMMA(ML99_PRIV_EXPAND acc),                                            \
+        ML99_PRIV_TAIL,                                                                            \
+        ML99_PRIV_BIG_NAT_0) acc)
+// } (Digits)
+
+// ML99_BIG_NAT_LIT {
+
+#define ML99_PRIV_BIG_NAT_LIT(...)                                                                 \
+    ML99_PRIV_CAT(                                                                                 \
+        ML99_PRIV_BIG_NAT_LIT_,                                                                    \
+        ML99_PRIV_BIG_NAT_LIT_COUNT(__VA_ARGS__, 8, 7, 6, 5, 4, 3, 2, 1, ~))                       \
+    (__VA_ARGS__)
+#define ML99_PRIV_BIG_NAT_LIT_COUNT(_1, _2, _3, _4, _5, _6, _7, _8, n, ...) n
+
+#define ML99_PRIV_BIG_NAT_LIT_1(d0)                             d0
+#define ML99_PRIV_BIG_NAT_LIT_2(d0, d1)                         d1##d0
+#define ML99_PRIV_BIG_NAT_LIT_3(d0, d1, d2)                     d2##d1##d0
+#define ML99_PRIV_BIG_NAT_LIT_4(d0, d1, d2, d3)                 d3##d2##d1##d0
+#define ML99_PRIV_BIG_NAT_LIT_5(d0, d1, d2, d3, d4)             d4##d3##d2##d1##d0
+#define ML99_PRIV_BIG_NAT_LIT_6(d0, d1, d2, d3, d4, d5)         d5##d4##d3##d2##d1##d0
+#define ML99_PRIV_BIG_NAT_LIT_7(d0, d1, d2, d3, d4, d5, d6)     d6##d5##d4##d3##d2##d1##d0
+#define ML99_PRIV_BIG_NAT_LIT_8(d0, d1, d2, d3, d4, d5, d6, d7) d7##d6##d5##d4##d3##d2##d1##d0
+// } (ML99_BIG_NAT_LIT)
+
+// The digit tables {
+
+/* `ML99_PRIV_BIG_NAT_DIGIT_ADD_c_a_b` is the carry and the digit of `c + a + b`, and
+ * `ML99_PRIV_BIG_NAT_DIGIT_SUB_b_a_c` is the borrow and the digit of `a - c - b`. */
+
+// Generated by scripts/gen-tables.py.
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_0_0 0, 0
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_0_1 0, 1
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_0_2 0, 2
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_0_3 0, 3
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_0_4 0, 4
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_0_5 0, 5
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_0_6 0, 6
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_0_7 0, 7
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_0_8 0, 8
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_0_9 0, 9
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_1_0 0, 1
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_1_1 0, 2
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_1_2 0, 3
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_1_3 0, 4
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_1_4 0, 5
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_1_5 0, 6
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_1_6 0, 7
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_1_7 0, 8
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_1_8 0, 9
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_1_9 1, 0
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_2_0 0, 2
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_2_1 0, 3
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_2_2 0, 4
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_2_3 0, 5
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_2_4 0, 6
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_2_5 0, 7
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_2_6 0, 8
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_2_7 0, 9
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_2_8 1, 0
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_2_9 1, 1
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_3_0 0, 3
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_3_1 0, 4
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_3_2 0, 5
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_3_3 0, 6
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_3_4 0, 7
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_3_5 0, 8
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_3_6 0, 9
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_3_7 1, 0
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_3_8 1, 1
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_3_9 1, 2
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_4_0 0, 4
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_4_1 0, 5
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_4_2 0, 6
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_4_3 0, 7
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_4_4 0, 8
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_4_5 0, 9
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_4_6 1, 0
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_4_7 1, 1
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_4_8 1, 2
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_4_9 1, 3
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_5_0 0, 5
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_5_1 0, 6
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_5_2 0, 7
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_5_3 0, 8
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_5_4 0, 9
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_5_5 1, 0
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_5_6 1, 1
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_5_7 1, 2
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_5_8 1, 3
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_5_9 1, 4
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_6_0 0, 6
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_6_1 0, 7
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_6_2 0, 8
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_6_3 0, 9
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_6_4 1, 0
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_6_5 1, 1
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_6_6 1, 2
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_6_7 1, 3
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_6_8 1, 4
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_6_9 1, 5
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_7_0 0, 7
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_7_1 0, 8
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_7_2 0, 9
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_7_3 1, 0
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_7_4 1, 1
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_7_5 1, 2
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_7_6 1, 3
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_7_7 1, 4
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_7_8 1, 5
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_7_9 1, 6
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_8_0 0, 8
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_8_1 0, 9
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_8_2 1, 0
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_8_3 1, 1
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_8_4 1, 2
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_8_5 1, 3
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_8_6 1, 4
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_8_7 1, 5
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_8_8 1, 6
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_8_9 1, 7
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_9_0 0, 9
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_9_1 1, 0
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_9_2 1, 1
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_9_3 1, 2
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_9_4 1, 3
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_9_5 1, 4
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_9_6 1, 5
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_9_7 1, 6
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_9_8 1, 7
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_0_9_9 1, 8
+
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_0_0 0, 1
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_0_1 0, 2
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_0_2 0, 3
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_0_3 0, 4
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_0_4 0, 5
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_0_5 0, 6
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_0_6 0, 7
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_0_7 0, 8
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_0_8 0, 9
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_0_9 1, 0
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_1_0 0, 2
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_1_1 0, 3
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_1_2 0, 4
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_1_3 0, 5
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_1_4 0, 6
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_1_5 0, 7
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_1_6 0, 8
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_1_7 0, 9
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_1_8 1, 0
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_1_9 1, 1
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_2_0 0, 3
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_2_1 0, 4
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_2_2 0, 5
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_2_3 0, 6
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_2_4 0, 7
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_2_5 0, 8
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_2_6 0, 9
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_2_7 1, 0
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_2_8 1, 1
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_2_9 1, 2
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_3_0 0, 4
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_3_1 0, 5
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_3_2 0, 6
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_3_3 0, 7
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_3_4 0, 8
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_3_5 0, 9
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_3_6 1, 0
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_3_7 1, 1
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_3_8 1, 2
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_3_9 1, 3
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_4_0 0, 5
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_4_1 0, 6
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_4_2 0, 7
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_4_3 0, 8
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_4_4 0, 9
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_4_5 1, 0
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_4_6 1, 1
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_4_7 1, 2
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_4_8 1, 3
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_4_9 1, 4
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_5_0 0, 6
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_5_1 0, 7
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_5_2 0, 8
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_5_3 0, 9
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_5_4 1, 0
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_5_5 1, 1
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_5_6 1, 2
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_5_7 1, 3
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_5_8 1, 4
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_5_9 1, 5
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_6_0 0, 7
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_6_1 0, 8
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_6_2 0, 9
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_6_3 1, 0
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_6_4 1, 1
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_6_5 1, 2
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_6_6 1, 3
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_6_7 1, 4
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_6_8 1, 5
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_6_9 1, 6
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_7_0 0, 8
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_7_1 0, 9
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_7_2 1, 0
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_7_3 1, 1
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_7_4 1, 2
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_7_5 1, 3
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_7_6 1, 4
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_7_7 1, 5
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_7_8 1, 6
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_7_9 1, 7
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_8_0 0, 9
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_8_1 1, 0
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_8_2 1, 1
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_8_3 1, 2
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_8_4 1, 3
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_8_5 1, 4
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_8_6 1, 5
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_8_7 1, 6
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_8_8 1, 7
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_8_9 1, 8
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_9_0 1, 0
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_9_1 1, 1
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_9_2 1, 2
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_9_3 1, 3
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_9_4 1, 4
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_9_5 1, 5
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_9_6 1, 6
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_9_7 1, 7
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_9_8 1, 8
+#define ML99_PRIV_BIG_NAT_DIGIT_ADD_1_9_9 1, 9
+
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_0_0 0, 0
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_0_1 1, 9
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_0_2 1, 8
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_0_3 1, 7
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_0_4 1, 6
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_0_5 1, 5
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_0_6 1, 4
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_0_7 1, 3
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_0_8 1, 2
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_0_9 1, 1
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_1_0 0, 1
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_1_1 0, 0
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_1_2 1, 9
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_1_3 1, 8
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_1_4 1, 7
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_1_5 1, 6
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_1_6 1, 5
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_1_7 1, 4
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_1_8 1, 3
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_1_9 1, 2
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_2_0 0, 2
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_2_1 0, 1
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_2_2 0, 0
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_2_3 1, 9
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_2_4 1, 8
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_2_5 1, 7
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_2_6 1, 6
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_2_7 1, 5
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_2_8 1, 4
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_2_9 1, 3
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_3_0 0, 3
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_3_1 0, 2
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_3_2 0, 1
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_3_3 0, 0
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_3_4 1, 9
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_3_5 1, 8
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_3_6 1, 7
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_3_7 1, 6
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_3_8 1, 5
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_3_9 1, 4
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_4_0 0, 4
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_4_1 0, 3
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_4_2 0, 2
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_4_3 0, 1
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_4_4 0, 0
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_4_5 1, 9
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_4_6 1, 8
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_4_7 1, 7
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_4_8 1, 6
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_4_9 1, 5
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_5_0 0, 5
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_5_1 0, 4
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_5_2 0, 3
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_5_3 0, 2
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_5_4 0, 1
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_5_5 0, 0
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_5_6 1, 9
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_5_7 1, 8
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_5_8 1, 7
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_5_9 1, 6
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_6_0 0, 6
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_6_1 0, 5
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_6_2 0, 4
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_6_3 0, 3
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_6_4 0, 2
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_6_5 0, 1
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_6_6 0, 0
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_6_7 1, 9
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_6_8 1, 8
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_6_9 1, 7
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_7_0 0, 7
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_7_1 0, 6
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_7_2 0, 5
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_7_3 0, 4
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_7_4 0, 3
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_7_5 0, 2
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_7_6 0, 1
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_7_7 0, 0
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_7_8 1, 9
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_7_9 1, 8
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_8_0 0, 8
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_8_1 0, 7
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_8_2 0, 6
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_8_3 0, 5
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_8_4 0, 4
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_8_5 0, 3
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_8_6 0, 2
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_8_7 0, 1
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_8_8 0, 0
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_8_9 1, 9
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_9_0 0, 9
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_9_1 0, 8
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_9_2 0, 7
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_9_3 0, 6
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_9_4 0, 5
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_9_5 0, 4
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_9_6 0, 3
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_9_7 0, 2
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_9_8 0, 1
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_0_9_9 0, 0
+
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_0_0 1, 9
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_0_1 1, 8
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_0_2 1, 7
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_0_3 1, 6
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_0_4 1, 5
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_0_5 1, 4
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_0_6 1, 3
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_0_7 1, 2
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_0_8 1, 1
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_0_9 1, 0
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_1_0 0, 0
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_1_1 1, 9
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_1_2 1, 8
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_1_3 1, 7
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_1_4 1, 6
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_1_5 1, 5
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_1_6 1, 4
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_1_7 1, 3
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_1_8 1, 2
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_1_9 1, 1
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_2_0 0, 1
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_2_1 0, 0
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_2_2 1, 9
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_2_3 1, 8
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_2_4 1, 7
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_2_5 1, 6
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_2_6 1, 5
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_2_7 1, 4
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_2_8 1, 3
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_2_9 1, 2
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_3_0 0, 2
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_3_1 0, 1
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_3_2 0, 0
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_3_3 1, 9
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_3_4 1, 8
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_3_5 1, 7
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_3_6 1, 6
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_3_7 1, 5
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_3_8 1, 4
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_3_9 1, 3
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_4_0 0, 3
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_4_1 0, 2
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_4_2 0, 1
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_4_3 0, 0
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_4_4 1, 9
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_4_5 1, 8
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_4_6 1, 7
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_4_7 1, 6
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_4_8 1, 5
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_4_9 1, 4
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_5_0 0, 4
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_5_1 0, 3
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_5_2 0, 2
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_5_3 0, 1
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_5_4 0, 0
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_5_5 1, 9
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_5_6 1, 8
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_5_7 1, 7
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_5_8 1, 6
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_5_9 1, 5
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_6_0 0, 5
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_6_1 0, 4
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_6_2 0, 3
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_6_3 0, 2
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_6_4 0, 1
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_6_5 0, 0
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_6_6 1, 9
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_6_7 1, 8
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_6_8 1, 7
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_6_9 1, 6
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_7_0 0, 6
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_7_1 0, 5
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_7_2 0, 4
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_7_3 0, 3
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_7_4 0, 2
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_7_5 0, 1
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_7_6 0, 0
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_7_7 1, 9
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_7_8 1, 8
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_7_9 1, 7
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_8_0 0, 7
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_8_1 0, 6
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_8_2 0, 5
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_8_3 0, 4
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_8_4 0, 3
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_8_5 0, 2
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_8_6 0, 1
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_8_7 0, 0
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_8_8 1, 9
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_8_9 1, 8
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_9_0 0, 8
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_9_1 0, 7
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_9_2 0, 6
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_9_3 0, 5
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_9_4 0, 4
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_9_5 0, 3
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_9_6 0, 2
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_9_7 0, 1
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_9_8 0, 0
+#define ML99_PRIV_BIG_NAT_DIGIT_SUB_1_9_9 1, 9
+// } (The digit tables)
+
+// Arity specifiers {
+
+#define ML99_bigNat_ARITY           1
+#define ML99_bigNatFromDigits_ARITY 1
+#define ML99_bigNatInc_ARITY        1
+#define ML99_bigNatDec_ARITY        1
+#define ML99_bigNatAdd_ARITY        2
+#define ML99_bigNatSub_ARITY        2
+#define ML99_bigNatEq_ARITY         2
+#define ML99_bigNatLesser_ARITY     2
+#define ML99_bigNatRepeat_ARITY     2
+#define ML99_bigNatTimes_ARITY      2
+// } (Arity specifiers)
+
+#endif // DOXYGEN_IGNORE
+
+#endif // ML99_BIGNAT_H
@@ -76,6 +76,47 @@
 #define ML99_matchWithArgs(choice, matcher, ...)                                                   \
     ML99_call(ML99_matchWithArgs, choice, matcher, __VA_ARGS__)
 
+/**
+ * Matches the instances @p choice and @p other of choice types at once.
+ *
+ * This macro results in `ML99_call(ML99_cat4(matcher, ML99_choiceTag(choice), v(_),
+ * ML99_choiceTag(other)), <choice data>, <other data>)`, so that a single reduction step
+ * dispatches on both tags.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/choice.h>
+ *
+ * #define MATCH_A_A_IMPL(x, y) v(x ~ y)
+ * #define MATCH_A_B_IMPL(x, y) v(x y)
+ *
+ * // 123 456
+ * ML99_match2(ML99_choice(v(A), v(123)), ML99_choice(v(B), v(456)), v(MATCH_))
+ * @endcode
+ */
+#define ML99_match2(choice, other, matcher) ML99_call(ML99_match2, choice, other, matcher)
+
+/**
+ * The same as #ML99_match2 but supplies additional arguments to all branches.
+ *
+ * This macro results in `ML99_call(ML99_cat4(matcher, ML99_choiceTag(choice), v(_),
+ * ML99_choiceTag(other)), <choice data>, <other data>, args...)`.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/choice.h>
+ *
+ * #define MATCH_A_B_IMPL(x, y, z) v(x ~ y ~ z)
+ *
+ * // 123 ~ 456 ~ 789
+ * ML99_match2WithArgs(ML99_choice(v(A), v(123)), ML99_choice(v(B), v(456)), v(MATCH_), v(789))
+ * @endcode
+ */
+#define ML99_match2WithArgs(choice, other, matcher, ...)                                           \
+    ML99_call(ML99_match2WithArgs, choice, other, matcher, __VA_ARGS__)
+
 #define ML99_CHOICE(tag, ...)   (tag, __VA_ARGS__)
 #define ML99_CHOICE_TAG(choice) ML99_PRIV_HEAD_AUX choice
 
@@ -92,15 +133,31 @@
         ML99_PRIV_CAT(matcher, ML99_PRIV_HEAD_AUX choice),                                         \
         ML99_PRIV_CHOICE_DATA choice,                                                              \
         __VA_ARGS__)
+#define ML99_match2_IMPL(choice, other, matcher)                                                   \
+    ML99_callUneval(                                                                               \
+        ML99_PRIV_MATCH2_NAME(matcher, choice, other),                                             \
+        ML99_PRIV_CHOICE_DATA choice,                                                              \
+        ML99_PRIV_CHOICE_DATA other)
+#define ML99_match2WithArgs_IMPL(choice, other, matcher, ...)                                      \
+    ML99_callUneval(                                                                               \
+        ML99_PRIV_MATCH2_NAME(matcher, choice, other),                                             \
+        ML99_PRIV_CHOICE_DATA choice,                                                              \
+        ML99_PRIV_CHOICE_DATA other,                                                               \
+        __VA_ARGS__)
+
+#define ML99_PRIV_MATCH2_NAME(matcher, choice, other)                                              \
+    ML99_PRIV_CAT(ML99_PRIV_CAT3(matcher, ML99_PRIV_HEAD_AUX choice, _), ML99_PRIV_HEAD_AUX other)
 
 #define ML99_PRIV_CHOICE_DATA ML99_PRIV_TAIL_AUX
 
 // Arity specifiers {
 
-#define ML99_choice_ARITY        2
-#define ML99_choiceTag_ARITY     1
-#define ML99_match_ARITY         2
-#define ML99_matchWithArgs_ARITY 3
+#define ML99_choice_ARITY         2
+#define ML99_choiceTag_ARITY      1
+#define ML99_match_ARITY          2
+#define ML99_matchWithArgs_ARITY  3
+#define ML99_match2_ARITY         3
+#define ML99_match2WithArgs_ARITY 4
 // } (Arity specifiers)
 
 #endif // DOXYGEN_IGNORE
@@ -8,9 +8,13 @@
 
 #include <metalang99/priv/util.h>
 
+#include <metalang99/nat/bits.h>
+#include <metalang99/nat/eq.h>
+#include <metalang99/nat/inc.h>
+#include <metalang99/variadics/count.h>
+#include <metalang99/variadics/slice.h>
+
 #include <metalang99/lang.h>
-#include <metalang99/nat.h>
-#include <metalang99/tuple.h>
 
 /**
  * If @p cond is true, evaluates to @p x, otherwise @p y.
@@ -33,6 +37,8 @@
 /**
  * Invokes @p f @p n times, providing an iteration index each time.
  *
+ * Sixteen invocations are emitted per reduction step, besides the steps that @p f takes.
+ *
  * # Examples
  *
  * @code
@@ -48,6 +54,8 @@
 /**
  * Pastes provided arguments @p n times.
  *
+ * This macro takes a constant number of reduction steps regardless of @p n.
+ *
  * # Examples
  *
  * @code
@@ -59,6 +67,36 @@
  */
 #define ML99_times(n, ...) ML99_call(ML99_times, n, __VA_ARGS__)
 
+/**
+ * Computes the recursive function @p f at the index @p n, memoising its results at the smaller
+ * indices.
+ *
+ * @p f is applied as `f(self, i)` to each index `i` from 0 up to @p n in turn, and
+ * `ML99_appl(v(self), v(k))` results in its result at an index `k` lesser than `i` in a single
+ * reduction step. Thus, a recurrence whose calls overlap takes one application of @p f per index
+ * instead of exponentially many.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/control.h>
+ * #include <metalang99/nat.h>
+ *
+ * #define FIB_IMPL(self, i) \
+ *     ML99_IF( \
+ *         ML99_NAT_LESSER(i, 2), \
+ *         v(i), \
+ *         ML99_add( \
+ *             ML99_appl(v(self), v(ML99_DEC(i))), \
+ *             ML99_appl(v(self), v(ML99_DEC(ML99_DEC(i))))))
+ * #define FIB_ARITY 2
+ *
+ * // 55
+ * ML99_fixMemo(v(FIB), v(10))
+ * @endcode
+ */
+#define ML99_fixMemo(f, n) ML99_call(ML99_fixMemo, f, n)
+
 /**
  * Overloads @p f on a number of arguments.
  *
@@ -88,6 +126,30 @@
  */
 #define ML99_OVERLOAD(f, ...) ML99_PRIV_CAT(f, ML99_PRIV_VARIADICS_COUNT(__VA_ARGS__))(__VA_ARGS__)
 
+/**
+ * Like #ML99_OVERLOAD, but counts at most @p n arguments, as #ML99_VARIADICS_COUNT_UPTO does.
+ *
+ * Prefer it for macros with few overloads that are expanded many times.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/control.h>
+ *
+ * #define X(...)    ML99_OVERLOAD_UPTO(2, X_, __VA_ARGS__)
+ * #define X_1(a)    Billie & a
+ * #define X_2(a, b) Jean & a & b
+ *
+ * // Billie & 4
+ * X(4)
+ *
+ * // Jean & 5 & 6
+ * X(5, 6)
+ * @endcode
+ */
+#define ML99_OVERLOAD_UPTO(n, f, ...)                                                              \
+    ML99_PRIV_CAT(f, ML99_PRIV_CAT(ML99_PRIV_VARIADICS_COUNT_UPTO_, n)(__VA_ARGS__))(__VA_ARGS__)
+
 /**
  * The plain version of #ML99_if.
  *
@@ -100,25 +162,157 @@
  * @note @p x and @p y can possibly expand to commas. It means that you can supply `ML99_TERMS(...)`
  * as a branch, for example.
  */
-#define ML99_IF(cond, x, y) ML99_UNTUPLE(ML99_PRIV_IF(cond, (x), (y)))
+#define ML99_IF(cond, x, y) ML99_PRIV_UNTUPLE(ML99_PRIV_IF(cond, (x), (y)))
 
 #ifndef DOXYGEN_IGNORE
 
 #define ML99_if_IMPL(cond, x, y) v(ML99_PRIV_IF(cond, x, y))
 
-#define ML99_repeat_IMPL(n, f)        ML99_natMatchWithArgs_IMPL(n, ML99_PRIV_repeat_, f)
-#define ML99_PRIV_repeat_Z_IMPL(...)  v(ML99_PRIV_EMPTY())
-#define ML99_PRIV_repeat_S_IMPL(i, f) ML99_TERMS(ML99_repeat_IMPL(i, f), ML99_appl_IMPL(f, i))
+// ML99_repeat_IMPL {
+
+/* The binary digits of `n` split it into `q` chunks of sixteen indices and `r` other ones, both
+ * below 16. The chunk `c`, which starts at the index `16 * c`, is emitted per reduction step, and
+ * then the `r` other indices in a single step, so that no index is ever added or subtracted. */
+
+#define ML99_repeat_IMPL(n, f)      ML99_PRIV_REPEAT_SPLIT(f, ML99_PRIV_NAT_TO_BITS(n))
+#define ML99_PRIV_REPEAT_SPLIT(...) ML99_PRIV_REPEAT_SPLIT_AUX(__VA_ARGS__)
+#define ML99_PRIV_REPEAT_SPLIT_AUX(f, b7, b6, b5, b4, b3, b2, b1, b0)                              \
+    ML99_PRIV_repeatAux_IMPL(                                                                      \
+        0,                                                                                         \
+        ML99_PRIV_REPEAT_NIBBLE_##b7##b6##b5##b4,                                                  \
+        ML99_PRIV_REPEAT_NIBBLE_##b3##b2##b1##b0,                                                  \
+        f)
+
+#define ML99_PRIV_repeatAux_IMPL(c, q, r, f)                                                       \
+    ML99_PRIV_IF(ML99_PRIV_NAT_LESSER(c, q), ML99_PRIV_repeatChunk, ML99_PRIV_repeatDone)          \
+    (c, q, r, f)
+
+#define ML99_PRIV_repeatDone(_c, q, r, f)                                                          \
+    ML99_PRIV_CAT(ML99_PRIV_REPEAT_, r)(f, ML99_PRIV_REPEAT_START_##q)
+#define ML99_PRIV_repeatChunk(c, q, r, f)                                                          \
+    ML99_TERMS(                                                                                    \
+        ML99_PRIV_REPEAT_16(f, ML99_PRIV_REPEAT_START_##c),                                        \
+        ML99_callUneval(ML99_PRIV_repeatAux, ML99_PRIV_INC(c), q, r, f))
+
+#define ML99_PRIV_REPEAT_NIBBLE_0000 0
+#define ML99_PRIV_REPEAT_NIBBLE_0001 1
+#define ML99_PRIV_REPEAT_NIBBLE_0010 2
+#define ML99_PRIV_REPEAT_NIBBLE_0011 3
+#define ML99_PRIV_REPEAT_NIBBLE_0100 4
+#define ML99_PRIV_REPEAT_NIBBLE_0101 5
+#define ML99_PRIV_REPEAT_NIBBLE_0110 6
+#define ML99_PRIV_REPEAT_NIBBLE_0111 7
+#define ML99_PRIV_REPEAT_NIBBLE_1000 8
+#define ML99_PRIV_REPEAT_NIBBLE_1001 9
+#define ML99_PRIV_REPEAT_NIBBLE_1010 10
+#define ML99_PRIV_REPEAT_NIBBLE_1011 11
+#define ML99_PRIV_REPEAT_NIBBLE_1100 12
+#define ML99_PRIV_REPEAT_NIBBLE_1101 13
+#define ML99_PRIV_REPEAT_NIBBLE_1110 14
+#define ML99_PRIV_REPEAT_NIBBLE_1111 15
 
-#define ML99_times_IMPL(n, ...)        ML99_natMatchWithArgs_IMPL(n, ML99_PRIV_times_, __VA_ARGS__)
-#define ML99_PRIV_times_Z_IMPL(...)    v(ML99_PRIV_EMPTY())
-#define ML99_PRIV_times_S_IMPL(i, ...) ML99_TERMS(v(__VA_ARGS__), ML99_times_IMPL(i, __VA_ARGS__))
+#define ML99_PRIV_REPEAT_START_0  0
+#define ML99_PRIV_REPEAT_START_1  16
+#define ML99_PRIV_REPEAT_START_2  32
+#define ML99_PRIV_REPEAT_START_3  48
+#define ML99_PRIV_REPEAT_START_4  64
+#define ML99_PRIV_REPEAT_START_5  80
+#define ML99_PRIV_REPEAT_START_6  96
+#define ML99_PRIV_REPEAT_START_7  112
+#define ML99_PRIV_REPEAT_START_8  128
+#define ML99_PRIV_REPEAT_START_9  144
+#define ML99_PRIV_REPEAT_START_10 160
+#define ML99_PRIV_REPEAT_START_11 176
+#define ML99_PRIV_REPEAT_START_12 192
+#define ML99_PRIV_REPEAT_START_13 208
+#define ML99_PRIV_REPEAT_START_14 224
+#define ML99_PRIV_REPEAT_START_15 240
+
+#define ML99_PRIV_REPEAT_0(f, i)  v(ML99_PRIV_EMPTY())
+#define ML99_PRIV_REPEAT_1(f, i)  ML99_appl_IMPL(f, i)
+#define ML99_PRIV_REPEAT_2(f, i)  ML99_appl_IMPL(f, i), ML99_PRIV_REPEAT_1(f, ML99_PRIV_INC(i))
+#define ML99_PRIV_REPEAT_3(f, i)  ML99_appl_IMPL(f, i), ML99_PRIV_REPEAT_2(f, ML99_PRIV_INC(i))
+#define ML99_PRIV_REPEAT_4(f, i)  ML99_appl_IMPL(f, i), ML99_PRIV_REPEAT_3(f, ML99_PRIV_INC(i))
+#define ML99_PRIV_REPEAT_5(f, i)  ML99_appl_IMPL(f, i), ML99_PRIV_REPEAT_4(f, ML99_PRIV_INC(i))
+#define ML99_PRIV_REPEAT_6(f, i)  ML99_appl_IMPL(f, i), ML99_PRIV_REPEAT_5(f, ML99_PRIV_INC(i))
+#define ML99_PRIV_REPEAT_7(f, i)  ML99_appl_IMPL(f, i), ML99_PRIV_REPEAT_6(f, ML99_PRIV_INC(i))
+#define ML99_PRIV_REPEAT_8(f, i)  ML99_appl_IMPL(f, i), ML99_PRIV_REPEAT_7(f, ML99_PRIV_INC(i))
+#define ML99_PRIV_REPEAT_9(f, i)  ML99_appl_IMPL(f, i), ML99_PRIV_REPEAT_8(f, ML99_PRIV_INC(i))
+#define ML99_PRIV_REPEAT_10(f, i) ML99_appl_IMPL(f, i), ML99_PRIV_REPEAT_9(f, ML99_PRIV_INC(i))
+#define ML99_PRIV_REPEAT_11(f, i) ML99_appl_IMPL(f, i), ML99_PRIV_REPEAT_10(f, ML99_PRIV_INC(i))
+#define ML99_PRIV_REPEAT_12(f, i) ML99_appl_IMPL(f, i), ML99_PRIV_REPEAT_11(f, ML99_PRIV_INC(i))
+#define ML99_PRIV_REPEAT_13(f, i) ML99_appl_IMPL(f, i), ML99_PRIV_REPEAT_12(f, ML99_PRIV_INC(i))
+#define ML99_PRIV_REPEAT_14(f, i) ML99_appl_IMPL(f, i), ML99_PRIV_REPEAT_13(f, ML99_PRIV_INC(i))
+#define ML99_PRIV_REPEAT_15(f, i) ML99_appl_IMPL(f, i), ML99_PRIV_REPEAT_14(f, ML99_PRIV_INC(i))
+#define ML99_PRIV_REPEAT_16(f, i) ML99_appl_IMPL(f, i), ML99_PRIV_REPEAT_15(f, ML99_PRIV_INC(i))
+// } (ML99_repeat_IMPL)
+
+// ML99_times_IMPL {
+
+/* The arguments are pasted `2^k` times for each bit `k` set in `n`, each `2^k` copies being two
+ * `2^(k - 1)` copies, so that the whole result is produced in a single reduction step. */
+
+#define ML99_times_IMPL(n, ...) v(ML99_PRIV_TIMES(ML99_PRIV_NAT_TO_BITS(n), __VA_ARGS__))
+
+#define ML99_PRIV_TIMES(...) ML99_PRIV_TIMES_AUX(__VA_ARGS__)
+#define ML99_PRIV_TIMES_AUX(b7, b6, b5, b4, b3, b2, b1, b0, ...)                                   \
+    ML99_PRIV_IF(b7, ML99_PRIV_TIMES_128, ML99_PRIV_EMPTY)(__VA_ARGS__)                            \
+    ML99_PRIV_IF(b6, ML99_PRIV_TIMES_64, ML99_PRIV_EMPTY)(__VA_ARGS__)                             \
+    ML99_PRIV_IF(b5, ML99_PRIV_TIMES_32, ML99_PRIV_EMPTY)(__VA_ARGS__)                             \
+    ML99_PRIV_IF(b4, ML99_PRIV_TIMES_16, ML99_PRIV_EMPTY)(__VA_ARGS__)                             \
+    ML99_PRIV_IF(b3, ML99_PRIV_TIMES_8, ML99_PRIV_EMPTY)(__VA_ARGS__)                              \
+    ML99_PRIV_IF(b2, ML99_PRIV_TIMES_4, ML99_PRIV_EMPTY)(__VA_ARGS__)                              \
+    ML99_PRIV_IF(b1, ML99_PRIV_TIMES_2, ML99_PRIV_EMPTY)(__VA_ARGS__)                              \
+    ML99_PRIV_IF(b0, ML99_PRIV_TIMES_1, ML99_PRIV_EMPTY)(__VA_ARGS__)
+
+#define ML99_PRIV_TIMES_1(...)   __VA_ARGS__
+#define ML99_PRIV_TIMES_2(...)   ML99_PRIV_TIMES_1(__VA_ARGS__) ML99_PRIV_TIMES_1(__VA_ARGS__)
+#define ML99_PRIV_TIMES_4(...)   ML99_PRIV_TIMES_2(__VA_ARGS__) ML99_PRIV_TIMES_2(__VA_ARGS__)
+#define ML99_PRIV_TIMES_8(...)   ML99_PRIV_TIMES_4(__VA_ARGS__) ML99_PRIV_TIMES_4(__VA_ARGS__)
+#define ML99_PRIV_TIMES_16(...)  ML99_PRIV_TIMES_8(__VA_ARGS__) ML99_PRIV_TIMES_8(__VA_ARGS__)
+#define ML99_PRIV_TIMES_32(...)  ML99_PRIV_TIMES_16(__VA_ARGS__) ML99_PRIV_TIMES_16(__VA_ARGS__)
+#define ML99_PRIV_TIMES_64(...)  ML99_PRIV_TIMES_32(__VA_ARGS__) ML99_PRIV_TIMES_32(__VA_ARGS__)
+#define ML99_PRIV_TIMES_128(...) ML99_PRIV_TIMES_64(__VA_ARGS__) ML99_PRIV_TIMES_64(__VA_ARGS__)
+// } (ML99_times_IMPL)
+
+// ML99_fixMemo_IMPL {
+
+/* The results at the indices before `i` are accumulated as `(~, (r0), ..., (r{i-1}))`, and `self`
+ * is the closure `(1, ML99_PRIV_fixMemoGet, i, table)` that drops `k + 1` of them. */
+
+#define ML99_fixMemo_IMPL(f, n) ML99_PRIV_fixMemoProgress(f, 0, n, (~))
+
+#define ML99_PRIV_fixMemoProgress(f, i, n, table)                                                  \
+    ML99_call(                                                                                     \
+        ML99_PRIV_fixMemoNext,                                                                     \
+        v(f, i, n, table),                                                                         \
+        ML99_appl2_IMPL(f, (1, ML99_PRIV_fixMemoGet, i, table), i))
+
+#define ML99_PRIV_fixMemoNext_IMPL(f, i, n, table, ...)                                            \
+    ML99_PRIV_IF(ML99_PRIV_NAT_EQ(i, n), ML99_PRIV_fixMemoDone, ML99_PRIV_fixMemoPush)             \
+    (f, i, n, table, __VA_ARGS__)
+#define ML99_PRIV_fixMemoDone(_f, _i, _n, _table, ...) v(__VA_ARGS__)
+#define ML99_PRIV_fixMemoPush(f, i, n, table, ...)                                                 \
+    ML99_PRIV_fixMemoProgress(f, ML99_PRIV_INC(i), n, (ML99_PRIV_EXPAND table, (__VA_ARGS__)))
+
+#define ML99_PRIV_fixMemoGet_IMPL(i, table, k)                                                     \
+    ML99_PRIV_IF(ML99_PRIV_NAT_LESSER(k, i), ML99_PRIV_fixMemoGetAt, ML99_PRIV_fixMemoGetError)    \
+    (table, k)
+#define ML99_PRIV_fixMemoGetAt(table, k)                                                           \
+    v(ML99_PRIV_UNTUPLE(                                                                           \
+        ML99_PRIV_HEAD(ML99_PRIV_VARIADICS_DROP(ML99_PRIV_INC(k), ML99_PRIV_EXPAND table, ~))))
+#define ML99_PRIV_fixMemoGetError(_table, k)                                                       \
+    ML99_fatal(ML99_fixMemo, index k is not computed yet)
+// } (ML99_fixMemo_IMPL)
 
 // Arity specifiers {
 
-#define ML99_if_ARITY     3
-#define ML99_repeat_ARITY 2
-#define ML99_times_ARITY  2
+#define ML99_if_ARITY      3
+#define ML99_repeat_ARITY  2
+#define ML99_times_ARITY   2
+#define ML99_fixMemo_ARITY 2
+
+#define ML99_PRIV_repeatAux_ARITY 3
 // } (Arity specifiers)
 
 #endif // DOXYGEN_IGNORE
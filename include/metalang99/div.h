@@ -0,0 +1,151 @@
+/**
+ * @file
+ * Division of natural numbers.
+ *
+ * It is separate from `nat.h` because its tables are large and not needed by most metaprograms;
+ * `metalang99.h` includes it as well.
+ */
+
+#ifndef ML99_DIV_H
+#define ML99_DIV_H
+
+#include <metalang99/nat/div.h>
+
+#include <metalang99/lang.h>
+#include <metalang99/nat.h>
+
+/**
+ * \f$\lfloor \frac{x}{y} \rfloor\f$
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/div.h>
+ *
+ * // 3
+ * ML99_div(v(12), v(4))
+ *
+ * // 3
+ * ML99_div(v(14), v(4))
+ * @endcode
+ *
+ * @note A compile-time error if @p y is 0.
+ */
+#define ML99_div(x, y) ML99_call(ML99_div, x, y)
+
+/**
+ * Like #ML99_div but returns `ML99_nothing()` is @p x is not divisible by @p y,
+ * otherwise `ML99_just(result)`.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/div.h>
+ *
+ * // ML99_just(3)
+ * ML99_divChecked(v(12), v(4))
+ *
+ * // ML99_nothing()
+ * ML99_divChecked(v(14), v(5))
+ *
+ * // ML99_nothing()
+ * ML99_divChecked(v(1), v(0))
+ * @endcode
+ */
+#define ML99_divChecked(x, y) ML99_call(ML99_divChecked, x, y)
+
+/**
+ * Computes the remainder of division.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/div.h>
+ *
+ * // 2
+ * ML99_mod(v(8), v(3))
+ * @endcode
+ *
+ * @note A compile-time error if @p y is 0.
+ */
+#define ML99_mod(x, y) ML99_call(ML99_mod, x, y)
+
+/**
+ * Computes the quotient and the remainder of division at once, as a tuple.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/div.h>
+ *
+ * // (4, 2)
+ * ML99_divMod(v(14), v(3))
+ * @endcode
+ *
+ * @note A compile-time error if @p y is 0.
+ */
+#define ML99_divMod(x, y) ML99_call(ML99_divMod, x, y)
+
+/**
+ * \f$\frac{(\frac{x}{y})}{z}\f$
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/div.h>
+ *
+ * // 5
+ * ML99_div3(v(30), v(3), v(2))
+ * @endcode
+ *
+ * @note A compile-time error if @p y or @p z is 0.
+ */
+#define ML99_div3(x, y, z) ML99_call(ML99_div3, x, y, z)
+
+/**
+ * Like #ML99_divChecked but a plain macro, which takes literals.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/div.h>
+ *
+ * // ML99_just(3)
+ * ML99_DIV_CHECKED(12, 4)
+ * @endcode
+ */
+#define ML99_DIV_CHECKED(x, y) ML99_PRIV_DIV_CHECKED(x, y)
+
+#ifndef DOXYGEN_IGNORE
+
+#define ML99_div_IMPL(x, y)                                                                        \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_NAT_EQ(y, 0),                                                                         \
+        ML99_fatal(ML99_div, division by 0),                                                       \
+        v(ML99_PRIV_HEAD(ML99_PRIV_DIV_MOD(x, y))))
+#define ML99_mod_IMPL(x, y)                                                                        \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_NAT_EQ(y, 0),                                                                         \
+        ML99_fatal(ML99_mod, modulo by 0),                                                         \
+        v(ML99_PRIV_SND(ML99_PRIV_DIV_MOD(x, y))))
+#define ML99_divMod_IMPL(x, y)                                                                     \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_NAT_EQ(y, 0),                                                                         \
+        ML99_fatal(ML99_divMod, division by 0),                                                    \
+        v((ML99_PRIV_DIV_MOD(x, y))))
+
+#define ML99_divChecked_IMPL(x, y) v(ML99_DIV_CHECKED(x, y))
+#define ML99_div3_IMPL(x, y, z) ML99_div(ML99_div_IMPL(x, y), v(z))
+
+// Arity specifiers {
+
+#define ML99_div_ARITY        2
+#define ML99_divChecked_ARITY 2
+#define ML99_mod_ARITY        2
+#define ML99_divMod_ARITY     2
+#define ML99_div3_ARITY       3
+// } (Arity specifiers)
+
+#endif // DOXYGEN_IGNORE
+
+#endif // ML99_DIV_H
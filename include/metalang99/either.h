@@ -111,6 +111,32 @@
  */
 #define ML99_unwrapRight(either) ML99_call(ML99_unwrapRight, either)
 
+/**
+ * Applies @p f to the right value on `ML99_right(x)`, yielding the either that @p f returns, or
+ * returns `ML99_left(y)` as it is without applying @p f.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/control.h>
+ * #include <metalang99/either.h>
+ * #include <metalang99/nat.h>
+ *
+ * #define TRY_DEC_IMPL(x) ML99_IF(ML99_NAT_EQ(x, 0), ML99_left(v(x)), ML99_right(ML99_dec(v(x))))
+ * #define TRY_DEC_ARITY   1
+ *
+ * // ML99_right(v(4))
+ * ML99_eitherBind(ML99_right(v(5)), v(TRY_DEC))
+ *
+ * // ML99_left(v(0))
+ * ML99_eitherBind(ML99_right(v(0)), v(TRY_DEC))
+ *
+ * // ML99_left(v(123))
+ * ML99_eitherBind(ML99_left(v(123)), v(TRY_DEC))
+ * @endcode
+ */
+#define ML99_eitherBind(either, f) ML99_call(ML99_eitherBind, either, f)
+
 #define ML99_LEFT(x)          ML99_CHOICE(left, x)
 #define ML99_RIGHT(x)         ML99_CHOICE(right, x)
 #define ML99_IS_LEFT(either)  ML99_PRIV_IS_LEFT(either)
@@ -143,6 +169,11 @@
     ML99_fatal(ML99_unwrapRight, expected ML99_right but found ML99_left)
 #define ML99_PRIV_unwrapRight_right_IMPL(x) v(x)
 
+#define ML99_eitherBind_IMPL(either, f)                                                            \
+    ML99_matchWithArgs_IMPL(either, ML99_PRIV_eitherBind_, f)
+#define ML99_PRIV_eitherBind_left_IMPL(x, _f) v(ML99_LEFT(x))
+#define ML99_PRIV_eitherBind_right_IMPL(x, f) ML99_appl_IMPL(f, x)
+
 #define ML99_PRIV_EITHER_TAGS_ARE_EQUAL(either, other)                                             \
     ML99_OR(                                                                                       \
         ML99_AND(ML99_IS_LEFT(either), ML99_IS_LEFT(other)),                                       \
@@ -157,6 +188,7 @@
 #define ML99_eitherEq_ARITY    3
 #define ML99_unwrapLeft_ARITY  1
 #define ML99_unwrapRight_ARITY 1
+#define ML99_eitherBind_ARITY  2
 // } (Arity specifiers)
 
 #endif // DOXYGEN_IGNORE
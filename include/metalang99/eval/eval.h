@@ -11,28 +11,235 @@
 #include <metalang99/eval/syntax_checker.h>
 #include <metalang99/eval/term.h>
 
-#define ML99_PRIV_EVAL(...)                                                                        \
-    ML99_PRIV_REC_UNROLL(ML99_PRIV_EVAL_MATCH(                                                     \
-        ML99_PRIV_REC_STOP,                                                                        \
-        (~),                                                                                       \
-        0fspace,                                                                                   \
+#define ML99_PRIV_EVAL(...) ML99_PRIV_EVAL_WITH_K(ML99_PRIV_EVAL_TOP_K, 0femit, __VA_ARGS__)
+
+#ifdef ML99_PROFILE
+#define ML99_PRIV_EVAL_STEPS(...)                                                                  \
+    ML99_PRIV_EVAL_WITH_K(ML99_PRIV_EVAL_PROFILE_STEPS, 0fspace, __VA_ARGS__)
+#define ML99_PRIV_EVAL_TRACE(...)                                                                  \
+    ML99_PRIV_EVAL_WITH_K(ML99_PRIV_EVAL_PROFILE_TRACE, 0fspace, __VA_ARGS__)
+#endif
+
+#define ML99_PRIV_EVAL_WITH_K(k, folder, ...)                                                      \
+    ML99_PRIV_EVAL_OUTPUT(ML99_PRIV_REC_UNROLL(ML99_PRIV_EVAL_MATCH(                               \
+        k,                                                                                         \
+        ML99_PRIV_EVAL_TOP_K_CX,                                                                   \
+        folder,                                                                                    \
         ML99_PRIV_EVAL_ACC,                                                                        \
         __VA_ARGS__,                                                                               \
         (0end, ~),                                                                                 \
-        ~))
+        ~)))
+
+#define ML99_PRIV_EVAL_WITH_FUEL(n, ...)                                                           \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_EVAL_FUEL_IS_VALID(n),                                                           \
+        ML99_PRIV_EVAL_WITH_FUEL_AUX,                                                              \
+        ML99_PRIV_EVAL_FUEL_INVALID)                                                               \
+    (n, __VA_ARGS__)
+
+// `n` is valid if the recursion engine has the level `ML99_PRIV_REC_n`, which results in `()` when
+// it is told to stop; `ML99_PRIV_REC_0` takes different parameters, so 0 is rejected beforehand.
+#define ML99_PRIV_EVAL_FUEL_IS_VALID(n)                                                            \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_IS_TUPLE_FAST(ML99_PRIV_CAT(ML99_PRIV_EVAL_FUEL_ZERO_, n)),                      \
+        ML99_PRIV_EVAL_FUEL_IS_ZERO,                                                               \
+        ML99_PRIV_EVAL_FUEL_HAS_LEVEL)                                                             \
+    (n)
+#define ML99_PRIV_EVAL_FUEL_ZERO_0      ()
+#define ML99_PRIV_EVAL_FUEL_IS_ZERO(_n) 0
+#define ML99_PRIV_EVAL_FUEL_HAS_LEVEL(n)                                                           \
+    ML99_PRIV_IS_TUPLE_FAST(ML99_PRIV_CAT(ML99_PRIV_REC_, n)(~, 0stop, ()))
+
+#define ML99_PRIV_EVAL_FUEL_INVALID(_n, ...)                                                       \
+    ML99_PRIV_FATAL_ERROR(ML99_EVAL_WITH_FUEL, "n must be within [1; 1023]")
+
+#define ML99_PRIV_EVAL_WITH_FUEL_AUX(n, ...)                                                       \
+    ML99_PRIV_EVAL_OUTPUT_WITH(                                                                    \
+        ML99_PRIV_EVAL_FUEL_EXHAUSTED,                                                             \
+        ML99_PRIV_REC_UNROLL_FUEL(                                                                 \
+            n,                                                                                     \
+            ML99_PRIV_EVAL_MATCH(                                                                  \
+                ML99_PRIV_EVAL_TOP_K,                                                              \
+                ML99_PRIV_EVAL_TOP_K_CX,                                                           \
+                0femit,                                                                            \
+                ML99_PRIV_EVAL_ACC,                                                                \
+                __VA_ARGS__,                                                                       \
+                (0end, ~),                                                                         \
+                ~)))
+
+/* `ML99_EVAL_STREAM` evaluates each top-level term in a separate machine, so that neither the
+ * results of the previous terms nor the terms yet to be evaluated are passed between reduction
+ * steps. `ML99_EVAL_MANY` does the same for whole metaprograms: running them within a single
+ * machine would make every reduction step pass around the metaprograms yet to be evaluated, which
+ * costs much more than starting a new machine. The chain is unrolled, up to 63 items; `f` is either
+ * `ML99_PRIV_EVAL_STREAM_TERM` or `ML99_PRIV_EVAL_STREAM_PROGRAM`. */
+// Streaming evaluation {
+
+#define ML99_PRIV_EVAL_STREAM(...)                                                                 \
+    ML99_PRIV_EVAL_STREAM_1(ML99_PRIV_EVAL_STREAM_TERM, __VA_ARGS__, ~)
+#define ML99_PRIV_EVAL_MANY(...)                                                                   \
+    ML99_PRIV_EVAL_STREAM_1(ML99_PRIV_EVAL_STREAM_PROGRAM, __VA_ARGS__, ~)
+
+#define ML99_PRIV_EVAL_STREAM_TERM(term)       ML99_PRIV_EVAL(term)
+#define ML99_PRIV_EVAL_STREAM_PROGRAM(program) (ML99_PRIV_EVAL program)
+
+#define ML99_PRIV_EVAL_STREAM_TERM_OVERFLOW                                                        \
+    ML99_PRIV_EVAL((0fatal, ML99_EVAL_STREAM, "at most 63 terms are acceptable"))
+#define ML99_PRIV_EVAL_STREAM_PROGRAM_OVERFLOW                                                     \
+    ML99_PRIV_EVAL((0fatal, ML99_EVAL_MANY, "at most 63 metaprograms are acceptable"))
+
+#define ML99_PRIV_EVAL_STREAM_NEXT(n, ...)                                                         \
+    ML99_PRIV_IF(ML99_PRIV_CONTAINS_COMMA(__VA_ARGS__), ML99_PRIV_EVAL_STREAM_##n, ML99_PRIV_EMPTY)
+
+#define ML99_PRIV_EVAL_STREAM_1(f, x, ...)                                                         \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(2, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_2(f, x, ...)                                                         \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(3, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_3(f, x, ...)                                                         \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(4, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_4(f, x, ...)                                                         \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(5, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_5(f, x, ...)                                                         \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(6, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_6(f, x, ...)                                                         \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(7, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_7(f, x, ...)                                                         \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(8, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_8(f, x, ...)                                                         \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(9, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_9(f, x, ...)                                                         \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(10, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_10(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(11, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_11(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(12, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_12(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(13, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_13(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(14, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_14(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(15, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_15(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(16, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_16(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(17, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_17(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(18, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_18(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(19, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_19(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(20, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_20(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(21, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_21(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(22, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_22(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(23, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_23(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(24, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_24(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(25, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_25(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(26, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_26(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(27, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_27(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(28, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_28(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(29, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_29(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(30, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_30(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(31, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_31(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(32, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_32(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(33, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_33(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(34, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_34(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(35, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_35(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(36, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_36(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(37, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_37(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(38, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_38(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(39, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_39(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(40, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_40(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(41, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_41(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(42, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_42(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(43, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_43(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(44, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_44(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(45, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_45(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(46, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_46(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(47, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_47(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(48, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_48(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(49, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_49(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(50, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_50(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(51, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_51(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(52, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_52(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(53, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_53(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(54, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_54(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(55, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_55(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(56, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_56(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(57, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_57(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(58, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_58(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(59, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_59(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(60, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_60(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(61, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_61(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(62, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_62(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(63, __VA_ARGS__)(f, __VA_ARGS__)
+#define ML99_PRIV_EVAL_STREAM_63(f, x, ...)                                                        \
+    f(x) ML99_PRIV_EVAL_STREAM_NEXT(64, __VA_ARGS__)(f, __VA_ARGS__)
+
+#define ML99_PRIV_EVAL_STREAM_64(f, ...) f##_OVERFLOW
+// } (Streaming evaluation)
 
 // Recursion hooks {
 
-#define ML99_PRIV_EVAL_MATCH_HOOK()         ML99_PRIV_EVAL_MATCH
-#define ML99_PRIV_EVAL_0v_K_HOOK()          ML99_PRIV_EVAL_0v_K
-#define ML99_PRIV_EVAL_0args_K_HOOK()       ML99_PRIV_EVAL_0args_K
-#define ML99_PRIV_EVAL_0op_K_HOOK()         ML99_PRIV_EVAL_0op_K
-#define ML99_PRIV_EVAL_0callUneval_K_HOOK() ML99_PRIV_EVAL_0callUneval_K
+#define ML99_PRIV_EVAL_MATCH_HOOK()            ML99_PRIV_EVAL_MATCH
+#define ML99_PRIV_EVAL_0v_K_HOOK()             ML99_PRIV_EVAL_0v_K
+#define ML99_PRIV_EVAL_0vEnd_K_HOOK()          ML99_PRIV_EVAL_0vEnd_K
+#define ML99_PRIV_EVAL_0args_K_HOOK()          ML99_PRIV_EVAL_0args_K
+#define ML99_PRIV_EVAL_0op_K_HOOK()            ML99_PRIV_EVAL_0op_K
+#define ML99_PRIV_EVAL_0callUneval_K_HOOK()    ML99_PRIV_EVAL_0callUneval_K
+#define ML99_PRIV_EVAL_0callUnevalEnd_K_HOOK() ML99_PRIV_EVAL_0callUnevalEnd_K
 // } (Recursion hooks)
 
 #define ML99_PRIV_EVAL_MATCH(k, k_cx, folder, acc, head, ...)                                      \
     ML99_PRIV_CHECK_TERM(head, ML99_PRIV_TERM_MATCH)                                               \
-    (head, ML99_PRIV_EVAL_)(k, k_cx, folder, acc, (__VA_ARGS__), ML99_PRIV_EVAL_TERM_DATA head)
+    (head, ML99_PRIV_EVAL_RULES_##folder)                                                          \
+    (k, k_cx, folder, acc, (__VA_ARGS__), ML99_PRIV_EVAL_TERM_DATA head)
+
+#define ML99_PRIV_EVAL_RULES_0fspace ML99_PRIV_EVAL_
+#define ML99_PRIV_EVAL_RULES_0fcomma ML99_PRIV_EVAL_
+#define ML99_PRIV_EVAL_RULES_0femit  ML99_PRIV_EVAL_FLUSH_
 
 // Reduction rules {
 
@@ -43,7 +250,7 @@
 
 #define ML99_PRIV_EVAL_0fatal(...) ML99_PRIV_EVAL_0fatal_AUX(__VA_ARGS__)
 #define ML99_PRIV_EVAL_0fatal_AUX(_k, _k_cx, _folder, _acc, _tail, f, message)                     \
-    ML99_PRIV_REC_CONTINUE(ML99_PRIV_REC_STOP)((~), ML99_PRIV_FATAL_ERROR(f, message))
+    ML99_PRIV_REC_CONTINUE(ML99_PRIV_REC_STOP)((~), , (ML99_PRIV_FATAL_ERROR(f, message)))
 
 #ifdef ML99_PRIV_EMIT_ERROR
 #define ML99_PRIV_FATAL_ERROR(f, message) ML99_PRIV_EMIT_ERROR(#f ": " message);
@@ -54,69 +261,579 @@
 #endif
 
 #define ML99_PRIV_EVAL_0abort(_k, k_cx, folder, acc, _tail, ...)                                   \
-    ML99_PRIV_REC_CONTINUE(ML99_PRIV_EVAL_MATCH)                                                   \
-    (ML99_PRIV_REC_STOP, (~), 0fspace, ML99_PRIV_EVAL_ACC, __VA_ARGS__, (0end, ~), ~)
+    ML99_PRIV_REC_EMIT(ML99_PRIV_EVAL_MATCH, , )                                                   \
+    (ML99_PRIV_EVAL_TOP_K,                                                                        \
+     ML99_PRIV_EVAL_TOP_K_CX,                                                                      \
+     0femit,                                                                                       \
+     ML99_PRIV_EVAL_FORK acc,                                                                      \
+     __VA_ARGS__,                                                                                  \
+     (0end, ~),                                                                                    \
+     ~)
 
 #define ML99_PRIV_EVAL_0end(k, k_cx, _folder, acc, _tail, _)                                       \
     ML99_PRIV_REC_CONTINUE(k)                                                                      \
-    (ML99_PRIV_EXPAND k_cx, ML99_PRIV_EVAL_ACC_UNWRAP acc)
+    (ML99_PRIV_EVAL_JOIN(acc, k_cx), ML99_PRIV_EVAL_ACC_UNWRAP acc)
 // } (Reduction rules)
 
+/* The rules of the top-level machine of `ML99_EVAL` (the `0femit` folder). Prior to each reduction
+ * step, the accumulated results are emitted to the output and the accumulator is emptied, so that
+ * the results are not passed from one step to another (see `ML99_PRIV_EVAL_OUTPUT`). */
+// Top-level reduction rules {
+
+#define ML99_PRIV_EVAL_FLUSH_0v(k, k_cx, folder, acc, ...)                                         \
+    ML99_PRIV_REC_EMIT(ML99_PRIV_EVAL_0v_K, (ML99_PRIV_EVAL_ACC_UNWRAP acc))                       \
+    (k, k_cx, folder, ML99_PRIV_EVAL_ACC_FLUSH acc, __VA_ARGS__)
+#define ML99_PRIV_EVAL_FLUSH_0args(k, k_cx, folder, acc, ...)                                      \
+    ML99_PRIV_REC_EMIT(ML99_PRIV_EVAL_0args_K, (ML99_PRIV_EVAL_ACC_UNWRAP acc))                    \
+    (k, k_cx, folder, ML99_PRIV_EVAL_ACC_FLUSH acc, __VA_ARGS__)
+#define ML99_PRIV_EVAL_FLUSH_0op(k, k_cx, folder, acc, ...)                                        \
+    ML99_PRIV_REC_EMIT(ML99_PRIV_EVAL_0op_K, (ML99_PRIV_EVAL_ACC_UNWRAP acc))                      \
+    (k, k_cx, folder, ML99_PRIV_EVAL_ACC_FLUSH acc, __VA_ARGS__)
+#define ML99_PRIV_EVAL_FLUSH_0callUneval(k, k_cx, folder, acc, ...)                                \
+    ML99_PRIV_REC_EMIT(ML99_PRIV_EVAL_0callUneval_K, (ML99_PRIV_EVAL_ACC_UNWRAP acc))              \
+    (k, k_cx, folder, ML99_PRIV_EVAL_ACC_FLUSH acc, __VA_ARGS__)
+
+#define ML99_PRIV_EVAL_FLUSH_0fatal ML99_PRIV_EVAL_0fatal
+#define ML99_PRIV_EVAL_FLUSH_0abort ML99_PRIV_EVAL_0abort
+#define ML99_PRIV_EVAL_FLUSH_0end   ML99_PRIV_EVAL_0end
+// } (Top-level reduction rules)
+
+/* The output of the top-level machine is a sequence `(results1)(results2)...`, with a comma emitted
+ * each time the evaluation is aborted (either by `ML99_abort` or an error). Only the part after the
+ * last comma is the result of evaluation, and it is flattened in one pass. */
+// Output {
+
+#define ML99_PRIV_EVAL_STOP(_k_cx, ...) 0stop, (__VA_ARGS__)
+#define ML99_PRIV_EVAL_STOP_HOOK()      ML99_PRIV_EVAL_STOP
+
+#define ML99_PRIV_EVAL_OUTPUT(...)                                                                 \
+    ML99_PRIV_EVAL_OUTPUT_WITH(ML99_PRIV_EVAL_OUTPUT_LAST_SUSPENDED, __VA_ARGS__)
+
+// `on_suspended` is invoked with `(on_suspended, seq, tag, k_hook, args)` if the engine has run out
+// of rounds.
+#define ML99_PRIV_EVAL_OUTPUT_WITH(on_suspended, ...)                                              \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_CONTAINS_COMMA(__VA_ARGS__),                                                     \
+        ML99_PRIV_EVAL_OUTPUT_ABORTED,                                                             \
+        ML99_PRIV_EVAL_OUTPUT_COMPLETED)                                                           \
+    (on_suspended, __VA_ARGS__)
+
+#define ML99_PRIV_EVAL_OUTPUT_COMPLETED(_on_suspended, seq) ML99_PRIV_EVAL_OUTPUT_FLATTEN(seq)
+#define ML99_PRIV_EVAL_OUTPUT_ABORTED(on_suspended, ...)                                           \
+    ML99_PRIV_EVAL_OUTPUT_FLATTEN(                                                                 \
+        ML99_PRIV_REC_UNROLL(ML99_PRIV_EVAL_OUTPUT_LAST(on_suspended, __VA_ARGS__)))
+#define ML99_PRIV_EVAL_OUTPUT_LAST(on_suspended, seq, ...)                                         \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_EVAL_IS_SUSPENDED(ML99_PRIV_HEAD(__VA_ARGS__)),                                  \
+        on_suspended,                                                                              \
+        ML99_PRIV_EVAL_OUTPUT_LAST_NEXT)                                                           \
+    (on_suspended, seq, __VA_ARGS__)
+#define ML99_PRIV_EVAL_OUTPUT_LAST_NEXT(on_suspended, _seq, ...)                                   \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_CONTAINS_COMMA(__VA_ARGS__),                                                     \
+        ML99_PRIV_EVAL_OUTPUT_LAST_PROGRESS,                                                       \
+        ML99_PRIV_EVAL_OUTPUT_LAST_DONE)                                                           \
+    (on_suspended, __VA_ARGS__)
+#define ML99_PRIV_EVAL_OUTPUT_LAST_PROGRESS(...)                                                   \
+    ML99_PRIV_REC_CONTINUE(ML99_PRIV_EVAL_OUTPUT_LAST)(__VA_ARGS__)
+#define ML99_PRIV_EVAL_OUTPUT_LAST_DONE(_on_suspended, seq) 0stop, seq
+#define ML99_PRIV_EVAL_OUTPUT_LAST_HOOK()    ML99_PRIV_EVAL_OUTPUT_LAST
+
+// The engine has run out of rounds: the live sequence and the pending continuation are kept in the
+// `(ML99_PRIV_REC_SUSPENDED, seq, k_hook, args)` state, which is accepted by
+// `ML99_PRIV_EVAL_RESUME`.
+#define ML99_PRIV_EVAL_OUTPUT_LAST_SUSPENDED(_on_suspended, seq, _tag, k_hook, args)              \
+    0stop, ((ML99_PRIV_REC_SUSPENDED, seq, k_hook, args))
+
+// A segment is either a sequence of chunks or the `ML99_PRIV_REC_SUSPENDED` tag: the chunks are
+// skipped, and then `_END` is pasted to what is left.
+#define ML99_PRIV_EVAL_IS_SUSPENDED(x)                                                             \
+    ML99_PRIV_EVAL_IS_SUSPENDED_AUX(ML99_PRIV_EVAL_IS_SUSPENDED_A x)
+#define ML99_PRIV_EVAL_IS_SUSPENDED_AUX(...)        ML99_PRIV_EVAL_IS_SUSPENDED_TEST(__VA_ARGS__)
+#define ML99_PRIV_EVAL_IS_SUSPENDED_TEST(...)       ML99_PRIV_SND(__VA_ARGS__##_END, 0)
+#define ML99_PRIV_EVAL_IS_SUSPENDED_A(...)          ML99_PRIV_EVAL_IS_SUSPENDED_B
+#define ML99_PRIV_EVAL_IS_SUSPENDED_B(...)          ML99_PRIV_EVAL_IS_SUSPENDED_A
+#define ML99_PRIV_EVAL_IS_SUSPENDED_A_END
+#define ML99_PRIV_EVAL_IS_SUSPENDED_B_END
+#define ML99_PRIV_REC_SUSPENDED_END                 ~, 1
+
+#define ML99_PRIV_EVAL_OUTPUT_FLATTEN(seq)                                                         \
+    ML99_PRIV_EVAL_OUTPUT_FLATTEN_END(ML99_PRIV_EVAL_OUTPUT_FLATTEN_A seq)
+#define ML99_PRIV_EVAL_OUTPUT_FLATTEN_END(...) ML99_PRIV_EVAL_OUTPUT_FLATTEN_END_AUX(__VA_ARGS__)
+#define ML99_PRIV_EVAL_OUTPUT_FLATTEN_END_AUX(...) __VA_ARGS__##_END
+
+#define ML99_PRIV_EVAL_OUTPUT_FLATTEN_A(...) __VA_ARGS__ ML99_PRIV_EVAL_OUTPUT_FLATTEN_B
+#define ML99_PRIV_EVAL_OUTPUT_FLATTEN_B(...) __VA_ARGS__ ML99_PRIV_EVAL_OUTPUT_FLATTEN_A
+#define ML99_PRIV_EVAL_OUTPUT_FLATTEN_A_END
+#define ML99_PRIV_EVAL_OUTPUT_FLATTEN_B_END
+// } (Output)
+
+/* When `ML99_EVAL_WITH_FUEL` runs out of fuel, the metafunction to blame is found in the suspended
+ * continuation: either it is about to call (or evaluate the arguments of) a metafunction `op`, or
+ * it belongs to a nested machine, whose context `k_cx` has the same layout as the arguments of the
+ * parent continuation `k`, so we look there. */
+// Fuel {
+
+#define ML99_PRIV_EVAL_FUEL_EXHAUSTED(_on_suspended, _seq, _tag, k_hook, args)                     \
+    ML99_PRIV_EVAL_FUEL_OP(k_hook, args)
+
+#define ML99_PRIV_EVAL_FUEL_OP(k_hook, args)                                                       \
+    ML99_PRIV_EVAL_FUEL_OP_AUX(                                                                    \
+        ML99_PRIV_CAT(                                                                             \
+            ML99_PRIV_EVAL_FUEL_OP_,                                                               \
+            ML99_PRIV_SND(ML99_PRIV_EVAL_FUEL_KIND_##k_hook, unknown)),                            \
+        ML99_PRIV_EXPAND args)
+#define ML99_PRIV_EVAL_FUEL_OP_AUX(f, ...) f(__VA_ARGS__, ~)
+#define ML99_PRIV_EVAL_FUEL_OP_HOOK() ML99_PRIV_EVAL_FUEL_OP
+
+#define ML99_PRIV_EVAL_FUEL_OP_op(_k, _k_cx, _folder, _acc, _tail, op, ...)                        \
+    ML99_PRIV_EVAL_FUEL_ERROR(op)
+#define ML99_PRIV_EVAL_FUEL_OP_cx(k, k_cx, ...)                                                    \
+    ML99_PRIV_REC_CONTINUE(ML99_PRIV_EVAL_FUEL_OP)(k##_HOOK, k_cx)
+
+// If a value is about to be folded, the metafunction is the one called by the next term, if any.
+#define ML99_PRIV_EVAL_FUEL_OP_v(k, k_cx, _folder, _acc, tail, ...)                                \
+    ML99_PRIV_EVAL_FUEL_NEXT(ML99_PRIV_HEAD tail, k, k_cx)
+#define ML99_PRIV_EVAL_FUEL_NEXT(term, k, k_cx)                                                    \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_EVAL_FUEL_IS_CALL(term),                                                         \
+        ML99_PRIV_EVAL_FUEL_NEXT_CALL,                                                             \
+        ML99_PRIV_EVAL_FUEL_NEXT_CX)                                                               \
+    (term, k, k_cx)
+#define ML99_PRIV_EVAL_FUEL_NEXT_CALL(term, _k, _k_cx)                                             \
+    ML99_PRIV_EVAL_FUEL_ERROR(ML99_PRIV_EVAL_FUEL_CALLEE term)
+#define ML99_PRIV_EVAL_FUEL_NEXT_CX(_term, k, k_cx) ML99_PRIV_EVAL_FUEL_OP_cx(k, k_cx)
+#define ML99_PRIV_EVAL_FUEL_CALLEE(_kind, op, ...)  op
+#define ML99_PRIV_EVAL_FUEL_IS_CALL(term)                                                          \
+    ML99_PRIV_SND(ML99_PRIV_CAT(ML99_PRIV_EVAL_FUEL_IS_CALL_, ML99_PRIV_EVAL_TERM_KIND term), 0)
+#define ML99_PRIV_EVAL_FUEL_IS_CALL_0args ~, 1,
+
+#define ML99_PRIV_EVAL_FUEL_OP_unknown(...) ML99_PRIV_EVAL_FUEL_ERROR(ML99_EVAL_WITH_FUEL)
+
+#define ML99_PRIV_EVAL_FUEL_ERROR(f) 0stop, (ML99_PRIV_FATAL_ERROR(f, "ran out of fuel"))
+
+#define ML99_PRIV_EVAL_FUEL_KIND_ML99_PRIV_EVAL_0args_K_HOOK          ~, op
+#define ML99_PRIV_EVAL_FUEL_KIND_ML99_PRIV_EVAL_0callUneval_K_HOOK    ~, op
+#define ML99_PRIV_EVAL_FUEL_KIND_ML99_PRIV_EVAL_0callUnevalEnd_K_HOOK ~, op
+#define ML99_PRIV_EVAL_FUEL_KIND_ML99_PRIV_EVAL_0v_K_HOOK             ~, v
+#define ML99_PRIV_EVAL_FUEL_KIND_ML99_PRIV_EVAL_0vEnd_K_HOOK          ~, cx
+#define ML99_PRIV_EVAL_FUEL_KIND_ML99_PRIV_EVAL_0op_K_HOOK            ~, cx
+// } (Fuel)
+
+// Resumption {
+
+#define ML99_PRIV_EVAL_RESUME(state) ML99_PRIV_EVAL_RESUME_AUX state
+#define ML99_PRIV_EVAL_RESUME_AUX(_tag, seq, k_hook, args)                                         \
+    ML99_PRIV_EVAL_OUTPUT(seq ML99_PRIV_REC_RESUME(k_hook, args))
+// } (Resumption)
+
 // Continuations {
 
 #define ML99_PRIV_EVAL_0v_K(k, k_cx, folder, acc, tail, ...)                                       \
-    ML99_PRIV_MACHINE_REDUCE(                                                                      \
+    ML99_PRIV_EVAL_0v_BATCH(                                                                       \
         k,                                                                                         \
         k_cx,                                                                                      \
         folder,                                                                                    \
-        ML99_PRIV_EVAL_##folder(acc, __VA_ARGS__),                                                 \
+        ML99_PRIV_EVAL_##folder(ML99_PRIV_EVAL_TICK acc, __VA_ARGS__),                             \
         ML99_PRIV_EXPAND tail)
 
+/* Up to 7 more `v(...)` terms following the first one are folded into the accumulator within the
+ * same reduction step, so that long sequences of values do not consume the recursion engine. */
+#define ML99_PRIV_EVAL_0v_BATCH(...) ML99_PRIV_EVAL_0v_BATCH_1(__VA_ARGS__)
+
+#define ML99_PRIV_EVAL_0v_BATCH_1(k, k_cx, folder, acc, head, ...)                                 \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_EVAL_IS_V(head),                                                                 \
+        ML99_PRIV_EVAL_0v_BATCH_1_FOLD,                                                            \
+        ML99_PRIV_MACHINE_REDUCE)                                                                  \
+    (k, k_cx, folder, acc, head, __VA_ARGS__)
+#define ML99_PRIV_EVAL_0v_BATCH_1_FOLD(k, k_cx, folder, acc, head, ...)                            \
+    ML99_PRIV_EVAL_0v_BATCH_2(                                                                     \
+        k,                                                                                         \
+        k_cx,                                                                                      \
+        folder,                                                                                    \
+        ML99_PRIV_EVAL_##folder(acc, ML99_PRIV_EVAL_TERM_DATA head),                               \
+        __VA_ARGS__)
+
+#define ML99_PRIV_EVAL_0v_BATCH_2(k, k_cx, folder, acc, head, ...)                                 \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_EVAL_IS_V(head),                                                                 \
+        ML99_PRIV_EVAL_0v_BATCH_2_FOLD,                                                            \
+        ML99_PRIV_MACHINE_REDUCE)                                                                  \
+    (k, k_cx, folder, acc, head, __VA_ARGS__)
+#define ML99_PRIV_EVAL_0v_BATCH_2_FOLD(k, k_cx, folder, acc, head, ...)                            \
+    ML99_PRIV_EVAL_0v_BATCH_3(                                                                     \
+        k,                                                                                         \
+        k_cx,                                                                                      \
+        folder,                                                                                    \
+        ML99_PRIV_EVAL_##folder(acc, ML99_PRIV_EVAL_TERM_DATA head),                               \
+        __VA_ARGS__)
+
+#define ML99_PRIV_EVAL_0v_BATCH_3(k, k_cx, folder, acc, head, ...)                                 \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_EVAL_IS_V(head),                                                                 \
+        ML99_PRIV_EVAL_0v_BATCH_3_FOLD,                                                            \
+        ML99_PRIV_MACHINE_REDUCE)                                                                  \
+    (k, k_cx, folder, acc, head, __VA_ARGS__)
+#define ML99_PRIV_EVAL_0v_BATCH_3_FOLD(k, k_cx, folder, acc, head, ...)                            \
+    ML99_PRIV_EVAL_0v_BATCH_4(                                                                     \
+        k,                                                                                         \
+        k_cx,                                                                                      \
+        folder,                                                                                    \
+        ML99_PRIV_EVAL_##folder(acc, ML99_PRIV_EVAL_TERM_DATA head),                               \
+        __VA_ARGS__)
+
+#define ML99_PRIV_EVAL_0v_BATCH_4(k, k_cx, folder, acc, head, ...)                                 \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_EVAL_IS_V(head),                                                                 \
+        ML99_PRIV_EVAL_0v_BATCH_4_FOLD,                                                            \
+        ML99_PRIV_MACHINE_REDUCE)                                                                  \
+    (k, k_cx, folder, acc, head, __VA_ARGS__)
+#define ML99_PRIV_EVAL_0v_BATCH_4_FOLD(k, k_cx, folder, acc, head, ...)                            \
+    ML99_PRIV_EVAL_0v_BATCH_5(                                                                     \
+        k,                                                                                         \
+        k_cx,                                                                                      \
+        folder,                                                                                    \
+        ML99_PRIV_EVAL_##folder(acc, ML99_PRIV_EVAL_TERM_DATA head),                               \
+        __VA_ARGS__)
+
+#define ML99_PRIV_EVAL_0v_BATCH_5(k, k_cx, folder, acc, head, ...)                                 \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_EVAL_IS_V(head),                                                                 \
+        ML99_PRIV_EVAL_0v_BATCH_5_FOLD,                                                            \
+        ML99_PRIV_MACHINE_REDUCE)                                                                  \
+    (k, k_cx, folder, acc, head, __VA_ARGS__)
+#define ML99_PRIV_EVAL_0v_BATCH_5_FOLD(k, k_cx, folder, acc, head, ...)                            \
+    ML99_PRIV_EVAL_0v_BATCH_6(                                                                     \
+        k,                                                                                         \
+        k_cx,                                                                                      \
+        folder,                                                                                    \
+        ML99_PRIV_EVAL_##folder(acc, ML99_PRIV_EVAL_TERM_DATA head),                               \
+        __VA_ARGS__)
+
+#define ML99_PRIV_EVAL_0v_BATCH_6(k, k_cx, folder, acc, head, ...)                                 \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_EVAL_IS_V(head),                                                                 \
+        ML99_PRIV_EVAL_0v_BATCH_6_FOLD,                                                            \
+        ML99_PRIV_MACHINE_REDUCE)                                                                  \
+    (k, k_cx, folder, acc, head, __VA_ARGS__)
+#define ML99_PRIV_EVAL_0v_BATCH_6_FOLD(k, k_cx, folder, acc, head, ...)                            \
+    ML99_PRIV_EVAL_0v_BATCH_7(                                                                     \
+        k,                                                                                         \
+        k_cx,                                                                                      \
+        folder,                                                                                    \
+        ML99_PRIV_EVAL_##folder(acc, ML99_PRIV_EVAL_TERM_DATA head),                               \
+        __VA_ARGS__)
+
+#define ML99_PRIV_EVAL_0v_BATCH_7(k, k_cx, folder, acc, head, ...)                                 \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_EVAL_IS_V(head),                                                                 \
+        ML99_PRIV_EVAL_0v_BATCH_7_FOLD,                                                            \
+        ML99_PRIV_MACHINE_REDUCE)                                                                  \
+    (k, k_cx, folder, acc, head, __VA_ARGS__)
+#define ML99_PRIV_EVAL_0v_BATCH_7_FOLD(k, k_cx, folder, acc, head, ...)                            \
+    ML99_PRIV_MACHINE_REDUCE(                                                                      \
+        k,                                                                                         \
+        k_cx,                                                                                      \
+        folder,                                                                                    \
+        ML99_PRIV_EVAL_##folder(acc, ML99_PRIV_EVAL_TERM_DATA head),                               \
+        __VA_ARGS__)
+
+/* If all the arguments are values, as in `ML99_call(F, v(1), v(2))`, we call `op` directly instead
+ * of evaluating the arguments in a nested machine, so that such a call is as cheap as
+ * `ML99_callUneval(F, 1, 2)`. This is checked for at most 8 arguments; otherwise, the values
+ * gathered so far are passed to the nested machine as a single `v(...)`. */
 #define ML99_PRIV_EVAL_0args_K(k, k_cx, folder, acc, tail, op, ...)                                \
+    ML99_PRIV_EVAL_0args_K_FAST_1(k, k_cx, folder, acc, tail, op, (), __VA_ARGS__, (0end, ~), ~)
+
+#define ML99_PRIV_EVAL_0args_K_FAST_1(k, k_cx, folder, acc, tail, op, data, head, ...)             \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_EVAL_IS_V(head),                                                                 \
+        ML99_PRIV_EVAL_0args_K_FAST_1_FOLD,                                                        \
+        ML99_PRIV_EVAL_0args_K_FAST_EXIT_1)                                                        \
+    (k, k_cx, folder, acc, tail, op, data, head, __VA_ARGS__)
+#define ML99_PRIV_EVAL_0args_K_FAST_1_FOLD(k, k_cx, folder, acc, tail, op, data, head, ...)        \
+    ML99_PRIV_EVAL_0args_K_FAST_2(                                                                 \
+        k,                                                                                         \
+        k_cx,                                                                                      \
+        folder,                                                                                    \
+        acc,                                                                                       \
+        tail,                                                                                      \
+        op,                                                                                        \
+        ML99_PRIV_EVAL_0fcomma(data, ML99_PRIV_EVAL_TERM_DATA head),                               \
+        __VA_ARGS__)
+
+#define ML99_PRIV_EVAL_0args_K_FAST_2(k, k_cx, folder, acc, tail, op, data, head, ...)             \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_EVAL_IS_V(head),                                                                 \
+        ML99_PRIV_EVAL_0args_K_FAST_2_FOLD,                                                        \
+        ML99_PRIV_EVAL_0args_K_FAST_EXIT)                                                          \
+    (k, k_cx, folder, acc, tail, op, data, head, __VA_ARGS__)
+#define ML99_PRIV_EVAL_0args_K_FAST_2_FOLD(k, k_cx, folder, acc, tail, op, data, head, ...)        \
+    ML99_PRIV_EVAL_0args_K_FAST_3(                                                                 \
+        k,                                                                                         \
+        k_cx,                                                                                      \
+        folder,                                                                                    \
+        acc,                                                                                       \
+        tail,                                                                                      \
+        op,                                                                                        \
+        ML99_PRIV_EVAL_0fcomma(data, ML99_PRIV_EVAL_TERM_DATA head),                               \
+        __VA_ARGS__)
+
+#define ML99_PRIV_EVAL_0args_K_FAST_3(k, k_cx, folder, acc, tail, op, data, head, ...)             \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_EVAL_IS_V(head),                                                                 \
+        ML99_PRIV_EVAL_0args_K_FAST_3_FOLD,                                                        \
+        ML99_PRIV_EVAL_0args_K_FAST_EXIT)                                                          \
+    (k, k_cx, folder, acc, tail, op, data, head, __VA_ARGS__)
+#define ML99_PRIV_EVAL_0args_K_FAST_3_FOLD(k, k_cx, folder, acc, tail, op, data, head, ...)        \
+    ML99_PRIV_EVAL_0args_K_FAST_4(                                                                 \
+        k,                                                                                         \
+        k_cx,                                                                                      \
+        folder,                                                                                    \
+        acc,                                                                                       \
+        tail,                                                                                      \
+        op,                                                                                        \
+        ML99_PRIV_EVAL_0fcomma(data, ML99_PRIV_EVAL_TERM_DATA head),                               \
+        __VA_ARGS__)
+
+#define ML99_PRIV_EVAL_0args_K_FAST_4(k, k_cx, folder, acc, tail, op, data, head, ...)             \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_EVAL_IS_V(head),                                                                 \
+        ML99_PRIV_EVAL_0args_K_FAST_4_FOLD,                                                        \
+        ML99_PRIV_EVAL_0args_K_FAST_EXIT)                                                          \
+    (k, k_cx, folder, acc, tail, op, data, head, __VA_ARGS__)
+#define ML99_PRIV_EVAL_0args_K_FAST_4_FOLD(k, k_cx, folder, acc, tail, op, data, head, ...)        \
+    ML99_PRIV_EVAL_0args_K_FAST_5(                                                                 \
+        k,                                                                                         \
+        k_cx,                                                                                      \
+        folder,                                                                                    \
+        acc,                                                                                       \
+        tail,                                                                                      \
+        op,                                                                                        \
+        ML99_PRIV_EVAL_0fcomma(data, ML99_PRIV_EVAL_TERM_DATA head),                               \
+        __VA_ARGS__)
+
+#define ML99_PRIV_EVAL_0args_K_FAST_5(k, k_cx, folder, acc, tail, op, data, head, ...)             \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_EVAL_IS_V(head),                                                                 \
+        ML99_PRIV_EVAL_0args_K_FAST_5_FOLD,                                                        \
+        ML99_PRIV_EVAL_0args_K_FAST_EXIT)                                                          \
+    (k, k_cx, folder, acc, tail, op, data, head, __VA_ARGS__)
+#define ML99_PRIV_EVAL_0args_K_FAST_5_FOLD(k, k_cx, folder, acc, tail, op, data, head, ...)        \
+    ML99_PRIV_EVAL_0args_K_FAST_6(                                                                 \
+        k,                                                                                         \
+        k_cx,                                                                                      \
+        folder,                                                                                    \
+        acc,                                                                                       \
+        tail,                                                                                      \
+        op,                                                                                        \
+        ML99_PRIV_EVAL_0fcomma(data, ML99_PRIV_EVAL_TERM_DATA head),                               \
+        __VA_ARGS__)
+
+#define ML99_PRIV_EVAL_0args_K_FAST_6(k, k_cx, folder, acc, tail, op, data, head, ...)             \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_EVAL_IS_V(head),                                                                 \
+        ML99_PRIV_EVAL_0args_K_FAST_6_FOLD,                                                        \
+        ML99_PRIV_EVAL_0args_K_FAST_EXIT)                                                          \
+    (k, k_cx, folder, acc, tail, op, data, head, __VA_ARGS__)
+#define ML99_PRIV_EVAL_0args_K_FAST_6_FOLD(k, k_cx, folder, acc, tail, op, data, head, ...)        \
+    ML99_PRIV_EVAL_0args_K_FAST_7(                                                                 \
+        k,                                                                                         \
+        k_cx,                                                                                      \
+        folder,                                                                                    \
+        acc,                                                                                       \
+        tail,                                                                                      \
+        op,                                                                                        \
+        ML99_PRIV_EVAL_0fcomma(data, ML99_PRIV_EVAL_TERM_DATA head),                               \
+        __VA_ARGS__)
+
+#define ML99_PRIV_EVAL_0args_K_FAST_7(k, k_cx, folder, acc, tail, op, data, head, ...)             \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_EVAL_IS_V(head),                                                                 \
+        ML99_PRIV_EVAL_0args_K_FAST_7_FOLD,                                                        \
+        ML99_PRIV_EVAL_0args_K_FAST_EXIT)                                                          \
+    (k, k_cx, folder, acc, tail, op, data, head, __VA_ARGS__)
+#define ML99_PRIV_EVAL_0args_K_FAST_7_FOLD(k, k_cx, folder, acc, tail, op, data, head, ...)        \
+    ML99_PRIV_EVAL_0args_K_FAST_8(                                                                 \
+        k,                                                                                         \
+        k_cx,                                                                                      \
+        folder,                                                                                    \
+        acc,                                                                                       \
+        tail,                                                                                      \
+        op,                                                                                        \
+        ML99_PRIV_EVAL_0fcomma(data, ML99_PRIV_EVAL_TERM_DATA head),                               \
+        __VA_ARGS__)
+
+#define ML99_PRIV_EVAL_0args_K_FAST_8(k, k_cx, folder, acc, tail, op, data, head, ...)             \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_EVAL_IS_V(head),                                                                 \
+        ML99_PRIV_EVAL_0args_K_REGULAR,                                                            \
+        ML99_PRIV_EVAL_0args_K_FAST_EXIT)                                                          \
+    (k, k_cx, folder, acc, tail, op, data, head, __VA_ARGS__)
+
+#define ML99_PRIV_EVAL_0args_K_FAST_EXIT_1(k, k_cx, folder, acc, tail, op, _data, head, ...)       \
     ML99_PRIV_MACHINE_REDUCE(                                                                      \
-        ML99_PRIV_EVAL_0callUneval_K,                                                              \
-        (k, k_cx, folder, acc, tail, op),                                                          \
+        ML99_PRIV_EVAL_CALL_FRAME(k, k_cx, folder, acc, tail, op),                                 \
         0fcomma,                                                                                   \
-        ML99_PRIV_EVAL_ACC_COMMA_SEP,                                                              \
-        __VA_ARGS__,                                                                               \
-        (0end, ~),                                                                                 \
-        ~)
+        ML99_PRIV_EVAL_FORK_COMMA_SEP acc,                                                         \
+        head,                                                                                      \
+        __VA_ARGS__)
+#define ML99_PRIV_EVAL_0args_K_FAST_EXIT(k, k_cx, folder, acc, tail, op, data, head, ...)          \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_EVAL_IS_END_KIND(head),                                                          \
+        ML99_PRIV_EVAL_0args_K_FAST_DONE,                                                          \
+        ML99_PRIV_EVAL_0args_K_REGULAR)                                                            \
+    (k, k_cx, folder, acc, tail, op, data, head, __VA_ARGS__)
+#define ML99_PRIV_EVAL_0args_K_FAST_DONE(k, k_cx, folder, acc, tail, op, data, ...)                \
+    ML99_PRIV_EVAL_0callUneval_K(k, k_cx, folder, acc, tail, op, ML99_PRIV_EVAL_ACC_UNWRAP data)
+
+#define ML99_PRIV_EVAL_0args_K_REGULAR(k, k_cx, folder, acc, tail, op, data, ...)                  \
+    ML99_PRIV_MACHINE_REDUCE(                                                                      \
+        ML99_PRIV_EVAL_CALL_FRAME(k, k_cx, folder, acc, tail, op),                                 \
+        0fcomma,                                                                                   \
+        ML99_PRIV_EVAL_FORK_COMMA_SEP acc,                                                         \
+        (0v, ML99_PRIV_EVAL_ACC_UNWRAP data),                                                      \
+        __VA_ARGS__)
 
 #define ML99_PRIV_EVAL_0op_K(k, k_cx, folder, acc, tail, op, ...)                                  \
     ML99_PRIV_MACHINE_REDUCE(                                                                      \
-        ML99_PRIV_EVAL_0callUneval_K,                                                              \
-        (k, k_cx, folder, acc, tail),                                                              \
+        ML99_PRIV_EVAL_OP_FRAME(k, k_cx, folder, acc, tail),                                       \
         0fcomma,                                                                                   \
-        ML99_PRIV_EVAL_ACC_COMMA_SEP,                                                              \
+        ML99_PRIV_EVAL_FORK_COMMA_SEP acc,                                                         \
         op,                                                                                        \
         __VA_ARGS__,                                                                               \
         (0end, ~),                                                                                 \
         ~)
 
 #define ML99_PRIV_EVAL_0callUneval_K(k, k_cx, folder, acc, tail, evaluated_op, ...)                \
-    /* If the metafunction `evaluated_op` expands to many terms, we first evaluate these terms and \
+    ML99_PRIV_EVAL_0callUneval_K_AUX(                                                              \
+        k,                                                                                         \
+        k_cx,                                                                                      \
+        folder,                                                                                    \
+        ML99_PRIV_EVAL_RECORD(evaluated_op, acc),                                                  \
+        tail,                                                                                      \
+        evaluated_op##_IMPL(__VA_ARGS__))
+
+// The body is expanded only once, as an argument of this macro, and then dispatched on `folder`.
+#define ML99_PRIV_EVAL_0callUneval_K_AUX(k, k_cx, folder, acc, tail, ...)                          \
+    ML99_PRIV_EVAL_0callUneval_K_##folder(k, k_cx, folder, acc, tail, __VA_ARGS__)
+
+/* If the results are appended to each other, the terms the body expands to are just pasted before
+ * the rest of the tail, so that such a call does not start a nested machine. Otherwise, they must
+ * not be interspersed with a comma, so we first evaluate them in a nested machine. */
+#define ML99_PRIV_EVAL_0callUneval_K_0fspace(k, k_cx, folder, acc, tail, ...)                     \
+    ML99_PRIV_MACHINE_REDUCE(                                                                      \
+        k,                                                                                         \
+        k_cx,                                                                                      \
+        folder,                                                                                    \
+        ML99_PRIV_EVAL_TICK acc,                                                                   \
+        __VA_ARGS__,                                                                               \
+        ML99_PRIV_EXPAND tail)
+#define ML99_PRIV_EVAL_0callUneval_K_0femit ML99_PRIV_EVAL_0callUneval_K_0fspace
+#define ML99_PRIV_EVAL_0callUneval_K_0fcomma(k, k_cx, folder, acc, tail, ...)                     \
+    /* If the metafunction's body expands to many terms, we first evaluate these terms and         \
      * accumulate them, otherwise, we just paste the single term with the rest of the tail. This   \
      * optimisation results in a huge performance improvement. */                                  \
     ML99_PRIV_IF(                                                                                  \
-        ML99_PRIV_CONTAINS_COMMA(evaluated_op##_IMPL(__VA_ARGS__)),                                \
+        ML99_PRIV_CONTAINS_COMMA(__VA_ARGS__),                                                     \
         ML99_PRIV_EVAL_0callUneval_K_REGULAR,                                                      \
         ML99_PRIV_EVAL_0callUneval_K_OPTIMIZED)                                                    \
-    (k, k_cx, folder, acc, tail, evaluated_op##_IMPL(__VA_ARGS__))
+    (k, k_cx, folder, acc, tail, __VA_ARGS__)
 
 #define ML99_PRIV_EVAL_0callUneval_K_OPTIMIZED(k, k_cx, folder, acc, tail, body)                   \
-    ML99_PRIV_MACHINE_REDUCE(k, k_cx, folder, acc, body, ML99_PRIV_EXPAND tail)
+    ML99_PRIV_MACHINE_REDUCE(                                                                      \
+        k,                                                                                         \
+        k_cx,                                                                                      \
+        folder,                                                                                    \
+        ML99_PRIV_EVAL_TICK acc,                                                                   \
+        body,                                                                                      \
+        ML99_PRIV_EXPAND tail)
 
 #define ML99_PRIV_EVAL_0callUneval_K_REGULAR(k, k_cx, folder, acc, tail, ...)                      \
     ML99_PRIV_MACHINE_REDUCE(                                                                      \
-        ML99_PRIV_EVAL_0v_K,                                                                       \
-        (k, k_cx, folder, acc, tail),                                                              \
+        ML99_PRIV_EVAL_BODY_FRAME(k, k_cx, folder, acc, tail),                                     \
         0fspace,                                                                                   \
-        ML99_PRIV_EVAL_ACC,                                                                        \
+        ML99_PRIV_EVAL_FORK acc,                                                                   \
         __VA_ARGS__,                                                                               \
         (0end, ~),                                                                                 \
         ~)
 
+/* The continuation and the context `k, k_cx` of a nested machine that evaluates the arguments of
+ * a call to `op` (`ML99_PRIV_EVAL_CALL_FRAME`) or an operator (`ML99_PRIV_EVAL_OP_FRAME`), so that
+ * the call is resumed by `ML99_PRIV_EVAL_0callUneval_K`. Most of the time, the call is the last
+ * term of its machine, as in the argument position of a right fold
+ * (`ML99_call(f, v(x), ML99_listFoldr_IMPL(...))`), and so `tail` is just `((0end, ~), ~)`. Since
+ * nested calls make the contexts of all the enclosing machines passed along every reduction step,
+ * such a `tail` is saved as `~` and restored by `ML99_PRIV_EVAL_0callUnevalEnd_K`; the layout of
+ * the context is kept for `ML99_PRIV_EVAL_JOIN` and the fuel. */
+#define ML99_PRIV_EVAL_CALL_FRAME(k, k_cx, folder, acc, tail, op)                                  \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_EVAL_IS_END_KIND(ML99_PRIV_HEAD tail),                                           \
+        ML99_PRIV_EVAL_CALL_FRAME_END,                                                             \
+        ML99_PRIV_EVAL_CALL_FRAME_REGULAR)                                                         \
+    (k, k_cx, folder, acc, tail, op)
+#define ML99_PRIV_EVAL_CALL_FRAME_REGULAR(k, k_cx, folder, acc, tail, op)                          \
+    ML99_PRIV_EVAL_0callUneval_K, (k, k_cx, folder, acc, tail, op)
+#define ML99_PRIV_EVAL_CALL_FRAME_END(k, k_cx, folder, acc, _tail, op)                             \
+    ML99_PRIV_EVAL_0callUnevalEnd_K, (k, k_cx, folder, acc, ~, op)
+
+#define ML99_PRIV_EVAL_OP_FRAME(k, k_cx, folder, acc, tail)                                        \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_EVAL_IS_END_KIND(ML99_PRIV_HEAD tail),                                           \
+        ML99_PRIV_EVAL_OP_FRAME_END,                                                               \
+        ML99_PRIV_EVAL_OP_FRAME_REGULAR)                                                           \
+    (k, k_cx, folder, acc, tail)
+#define ML99_PRIV_EVAL_OP_FRAME_REGULAR(k, k_cx, folder, acc, tail)                                \
+    ML99_PRIV_EVAL_0callUneval_K, (k, k_cx, folder, acc, tail)
+#define ML99_PRIV_EVAL_OP_FRAME_END(k, k_cx, folder, acc, _tail)                                   \
+    ML99_PRIV_EVAL_0callUnevalEnd_K, (k, k_cx, folder, acc, ~)
+
+#define ML99_PRIV_EVAL_0callUnevalEnd_K(k, k_cx, folder, acc, _tail, ...)                          \
+    ML99_PRIV_EVAL_0callUneval_K(k, k_cx, folder, acc, ((0end, ~), ~), __VA_ARGS__)
+
+// The same for a nested machine that evaluates the terms of a body, resumed by
+// `ML99_PRIV_EVAL_0v_K`.
+#define ML99_PRIV_EVAL_BODY_FRAME(k, k_cx, folder, acc, tail)                                      \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_EVAL_IS_END_KIND(ML99_PRIV_HEAD tail),                                           \
+        ML99_PRIV_EVAL_BODY_FRAME_END,                                                             \
+        ML99_PRIV_EVAL_BODY_FRAME_REGULAR)                                                         \
+    (k, k_cx, folder, acc, tail)
+#define ML99_PRIV_EVAL_BODY_FRAME_REGULAR(k, k_cx, folder, acc, tail)                              \
+    ML99_PRIV_EVAL_0v_K, (k, k_cx, folder, acc, tail)
+#define ML99_PRIV_EVAL_BODY_FRAME_END(k, k_cx, folder, acc, _tail)                                 \
+    ML99_PRIV_EVAL_0vEnd_K, (k, k_cx, folder, acc, ~)
+
+#define ML99_PRIV_EVAL_0vEnd_K(k, k_cx, folder, acc, _tail, ...)                                   \
+    ML99_PRIV_EVAL_0v_K(k, k_cx, folder, acc, ((0end, ~), ~), __VA_ARGS__)
+
 #define ML99_PRIV_MACHINE_REDUCE(...) ML99_PRIV_EVAL_MATCH(__VA_ARGS__)
+
+// ML99_PRIV_EVAL_IS_V {
+
+#ifdef ML99_NO_SYNTAX_CHECK
+#define ML99_PRIV_EVAL_IS_V(term) ML99_PRIV_EVAL_IS_V_KIND(term)
+#else
+/* `(0v, x) (0v, y)` must reach the syntax checker rather than be folded as `x (0v, y)`. */
+#define ML99_PRIV_EVAL_IS_V(term)                                                                  \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_EVAL_IS_V_KIND(term),                                                            \
+        ML99_PRIV_EVAL_IS_V_SINGLE,                                                                \
+        ML99_PRIV_EVAL_IS_V_NEVER)                                                                 \
+    (term)
+#endif
+
+#define ML99_PRIV_EVAL_IS_V_KIND(term)                                                             \
+    ML99_PRIV_SND(ML99_PRIV_CAT(ML99_PRIV_EVAL_IS_V_, ML99_PRIV_EVAL_TERM_KIND term), 0)
+#define ML99_PRIV_EVAL_IS_V_SINGLE(term) ML99_PRIV_NOT(ML99_PRIV_IS_DOUBLE_TUPLE_BEGINNING(term))
+#define ML99_PRIV_EVAL_IS_V_NEVER(_term) 0
+#define ML99_PRIV_EVAL_IS_V_0v           ~, 1,
+
+#define ML99_PRIV_EVAL_IS_END_KIND(term)                                                           \
+    ML99_PRIV_SND(ML99_PRIV_CAT(ML99_PRIV_EVAL_IS_END_, ML99_PRIV_EVAL_TERM_KIND term), 0)
+#define ML99_PRIV_EVAL_IS_END_0end ~, 1,
+// } (ML99_PRIV_EVAL_IS_V)
 // } (Continuations)
 
 #endif // ML99_EVAL_EVAL_H
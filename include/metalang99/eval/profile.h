@@ -0,0 +1,127 @@
+/*
+ * The profiling mode of the interpreter, enabled by defining `ML99_PROFILE` before including
+ * Metalang99.
+ *
+ * In this mode, the machine counts the reduction steps it performs. A counter `(lo, hi)` is stored
+ * in the emptiness slot of an accumulator (see `eval/acc.h`), so that no additional parameters are
+ * passed between continuations:
+ *
+ *  - Each continuation increments the counter of the current accumulator (`ML99_PRIV_EVAL_TICK`).
+ *
+ *  - A nested machine inherits the counter of its parent (`ML99_PRIV_EVAL_FORK`,
+ * `ML99_PRIV_EVAL_FORK_COMMA_SEP`).
+ *
+ *  - When a nested machine finishes, its counter is written back into the accumulator of the
+ * parent continuation saved in `k_cx` (`ML99_PRIV_EVAL_JOIN`).
+ *
+ * Thus, the counter flows linearly through the whole evaluation, and each increment corresponds to
+ * a single level of the recursion engine in `eval/rec.h`.
+ *
+ * If `ML99_TRACE` is defined as well (it implies `ML99_PROFILE`), the counter also carries a trace:
+ * a sequence `(op1)(op2)...` of all metafunctions called so far, appended to by
+ * `ML99_PRIV_EVAL_RECORD` in `ML99_PRIV_EVAL_0callUneval_K`. Without `ML99_TRACE`, the trace is
+ * always empty, so that step counting alone does not pay for it.
+ *
+ * If `ML99_PROFILE` is not defined, all these hooks do not count anything and cost (almost)
+ * nothing.
+ */
+
+#ifndef ML99_EVAL_PROFILE_H
+#define ML99_EVAL_PROFILE_H
+
+#include <metalang99/priv/util.h>
+
+#if defined(ML99_TRACE) && !defined(ML99_PROFILE)
+#define ML99_PROFILE
+#endif
+
+#ifdef ML99_PROFILE
+
+#include <metalang99/nat/eq.h>
+#include <metalang99/nat/inc.h>
+
+#define ML99_PRIV_EVAL_ACC           ((0, 0, ), )
+#define ML99_PRIV_EVAL_ACC_COMMA_SEP ((0, 0, ))
+
+#define ML99_PRIV_EVAL_TOP_K    ML99_PRIV_EVAL_PROFILE_STOP
+#define ML99_PRIV_EVAL_TOP_K_CX (~, ~, ~, ML99_PRIV_EVAL_ACC_COMMA_SEP, ~)
+
+#define ML99_PRIV_EVAL_TICK            ML99_PRIV_EVAL_PROFILE_TICK
+#define ML99_PRIV_EVAL_FORK            ML99_PRIV_EVAL_PROFILE_FORK
+#define ML99_PRIV_EVAL_FORK_COMMA_SEP  ML99_PRIV_EVAL_PROFILE_FORK_COMMA_SEP
+#define ML99_PRIV_EVAL_JOIN(acc, k_cx) ML99_PRIV_EVAL_PROFILE_JOIN_AUX(acc, ML99_PRIV_EXPAND k_cx)
+
+#ifdef ML99_TRACE
+#define ML99_PRIV_EVAL_RECORD(op, acc)                                                             \
+    ML99_PRIV_EVAL_PROFILE_SET(                                                                    \
+        ML99_PRIV_EVAL_PROFILE_PUSH(op, ML99_PRIV_EVAL_PROFILE_COUNTER(acc)),                      \
+        ML99_PRIV_EXPAND acc)
+#else
+#define ML99_PRIV_EVAL_RECORD(_op, acc) acc
+#endif
+
+// Top-level continuations {
+
+#define ML99_PRIV_EVAL_PROFILE_STOP(_k, _k_cx, _folder, _acc, _tail, ...) 0stop, (__VA_ARGS__)
+#define ML99_PRIV_EVAL_PROFILE_STEPS(_k, _k_cx, _folder, acc, _tail, ...)                          \
+    0stop, (ML99_PRIV_EVAL_PROFILE_STEPS_AUX(ML99_PRIV_EVAL_PROFILE_COUNTER(acc)))
+#define ML99_PRIV_EVAL_PROFILE_STEPS_AUX(counter)  ML99_PRIV_EVAL_PROFILE_NUM counter
+#define ML99_PRIV_EVAL_PROFILE_NUM(lo, hi, _trace) (hi * (ML99_PRIV_NAT_MAX + 1) + lo)
+
+#define ML99_PRIV_EVAL_PROFILE_TRACE(_k, _k_cx, _folder, acc, _tail, ...)                          \
+    0stop, (ML99_PRIV_EVAL_PROFILE_TRACE_AUX(ML99_PRIV_EVAL_PROFILE_COUNTER(acc)))
+#define ML99_PRIV_EVAL_PROFILE_TRACE_AUX(counter)        ML99_PRIV_EVAL_PROFILE_TRACE_OF counter
+#define ML99_PRIV_EVAL_PROFILE_TRACE_OF(_lo, _hi, trace) trace
+
+#define ML99_PRIV_EVAL_PROFILE_STOP_HOOK()  ML99_PRIV_EVAL_PROFILE_STOP
+#define ML99_PRIV_EVAL_PROFILE_STEPS_HOOK() ML99_PRIV_EVAL_PROFILE_STEPS
+#define ML99_PRIV_EVAL_PROFILE_TRACE_HOOK() ML99_PRIV_EVAL_PROFILE_TRACE
+// } (Top-level continuations)
+
+#define ML99_PRIV_EVAL_PROFILE_TICK(...) (ML99_PRIV_EVAL_PROFILE_INC __VA_ARGS__)
+#define ML99_PRIV_EVAL_PROFILE_FORK(...)                                                           \
+    (ML99_PRIV_EVAL_PROFILE_INC_AUX(ML99_PRIV_HEAD(__VA_ARGS__)), )
+#define ML99_PRIV_EVAL_PROFILE_FORK_COMMA_SEP(...)                                                 \
+    (ML99_PRIV_EVAL_PROFILE_INC_AUX(ML99_PRIV_HEAD(__VA_ARGS__)))
+
+#define ML99_PRIV_EVAL_PROFILE_JOIN_AUX(...) ML99_PRIV_EVAL_PROFILE_JOIN(__VA_ARGS__)
+#define ML99_PRIV_EVAL_PROFILE_JOIN(acc, k, k_cx, folder, parent_acc, ...)                         \
+    k, k_cx, folder,                                                                               \
+        ML99_PRIV_EVAL_PROFILE_SET(                                                                \
+            ML99_PRIV_EVAL_PROFILE_COUNTER(acc),                                                   \
+            ML99_PRIV_EXPAND parent_acc),                                                          \
+        __VA_ARGS__
+#define ML99_PRIV_EVAL_PROFILE_SET(counter, ...) (counter ML99_PRIV_EVAL_PROFILE_DROP __VA_ARGS__)
+#define ML99_PRIV_EVAL_PROFILE_DROP(...)
+
+#define ML99_PRIV_EVAL_PROFILE_COUNTER(acc) ML99_PRIV_HEAD(ML99_PRIV_EXPAND acc)
+
+#define ML99_PRIV_EVAL_PROFILE_INC_AUX(counter) ML99_PRIV_EVAL_PROFILE_INC counter
+#define ML99_PRIV_EVAL_PROFILE_INC(lo, hi, trace)                                                  \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_NAT_EQ(lo, ML99_PRIV_NAT_MAX),                                                   \
+        (0, ML99_PRIV_INC(hi), trace),                                                             \
+        (ML99_PRIV_INC(lo), hi, trace))
+
+#define ML99_PRIV_EVAL_PROFILE_PUSH(op, counter)                                                   \
+    ML99_PRIV_EVAL_PROFILE_PUSH_AUX(op, ML99_PRIV_EXPAND counter)
+#define ML99_PRIV_EVAL_PROFILE_PUSH_AUX(...) ML99_PRIV_EVAL_PROFILE_PUSH_AUX_2(__VA_ARGS__)
+#define ML99_PRIV_EVAL_PROFILE_PUSH_AUX_2(op, lo, hi, trace) (lo, hi, trace(op))
+
+#else
+
+#define ML99_PRIV_EVAL_ACC           (, )
+#define ML99_PRIV_EVAL_ACC_COMMA_SEP ()
+
+#define ML99_PRIV_EVAL_TOP_K    ML99_PRIV_EVAL_STOP
+#define ML99_PRIV_EVAL_TOP_K_CX (~)
+
+#define ML99_PRIV_EVAL_TICK
+#define ML99_PRIV_EVAL_FORK            ML99_PRIV_EVAL_ACC ML99_PRIV_EMPTY
+#define ML99_PRIV_EVAL_FORK_COMMA_SEP  ML99_PRIV_EVAL_ACC_COMMA_SEP ML99_PRIV_EMPTY
+#define ML99_PRIV_EVAL_JOIN(_acc, k_cx) ML99_PRIV_EXPAND k_cx
+#define ML99_PRIV_EVAL_RECORD(_op, acc) acc
+
+#endif // ML99_PROFILE
+
+#endif // ML99_EVAL_PROFILE_H
@@ -6,12 +6,18 @@
 
 #include <metalang99/eval/rec.h>
 
+// If `ML99_NO_SYNTAX_CHECK` is defined, terms are matched without checking; a malformed term then
+// results in an obscure compile-time error instead of a syntax error.
+#ifdef ML99_NO_SYNTAX_CHECK
+#define ML99_PRIV_CHECK_TERM(_term, default) default
+#else
 #define ML99_PRIV_CHECK_TERM(term, default)                                                        \
     ML99_PRIV_IF(ML99_PRIV_IS_UNTUPLE(term), ML99_PRIV_SYNTAX_CHECKER_EMIT_ERROR, default)
+#endif
 
 // clang-format off
 #define ML99_PRIV_SYNTAX_CHECKER_EMIT_ERROR(term, ...) \
-    ML99_PRIV_REC_CONTINUE(ML99_PRIV_REC_STOP)((~), ML99_PRIV_SYNTAX_ERROR(term)) \
+    ML99_PRIV_REC_CONTINUE(ML99_PRIV_REC_STOP)((~), , (ML99_PRIV_SYNTAX_ERROR(term))) \
     /* Consume arguments passed to ML99_PRIV_TERM_MATCH, see eval.h. */ \
     ML99_PRIV_EMPTY
 // clang-format on
@@ -35,8 +35,10 @@
 #ifndef ML99_GEN_H
 #define ML99_GEN_H
 
+#include <metalang99/nat/digits.h>
+#include <metalang99/nat/div.h>
+
 #include <metalang99/choice.h>
-#include <metalang99/control.h>
 #include <metalang99/lang.h>
 #include <metalang99/list.h>
 #include <metalang99/nat.h>
@@ -335,6 +337,130 @@
  */
 #define ML99_indexedArgs(n) ML99_call(ML99_indexedArgs, n)
 
+/**
+ * The same as #ML99_indexedParams but takes the types as variadic arguments instead of a list.
+ *
+ * Eight types are indexed per reduction step, and up to eight types take a single step.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/gen.h>
+ *
+ * // (int _0, long long _1, const char * _2)
+ * ML99_indexedParamsVariadics(v(int, long long, const char *))
+ * @endcode
+ *
+ * @note At least one type must be specified.
+ */
+#define ML99_indexedParamsVariadics(...) ML99_call(ML99_indexedParamsVariadics, __VA_ARGS__)
+
+/**
+ * The same as #ML99_indexedFields but takes the types as variadic arguments instead of a list.
+ *
+ * Eight types are indexed per reduction step, and up to eight types take a single step.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/gen.h>
+ *
+ * // int _0; long long _1; const char * _2;
+ * ML99_indexedFieldsVariadics(v(int, long long, const char *))
+ * @endcode
+ *
+ * @note At least one type must be specified.
+ */
+#define ML99_indexedFieldsVariadics(...) ML99_call(ML99_indexedFieldsVariadics, __VA_ARGS__)
+
+/**
+ * Generates \f$f(0), ..., f(n - 1)\f$.
+ *
+ * @p f is the name of an ordinary macro, not a metafunction: its invocations are pasted into the
+ * result as they are, so this macro takes a constant number of reduction steps regardless of @p n.
+ *
+ * If @p n is 0, this macro results in emptiness.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/gen.h>
+ *
+ * #define SQUARE(i) ((i) * (i))
+ *
+ * // { ((0) * (0)), ((1) * (1)), ((2) * (2)) }
+ * static const int squares[] = ML99_EVAL(ML99_braced(ML99_genArray(v(3), v(SQUARE))));
+ * @endcode
+ */
+#define ML99_genArray(n, f) ML99_call(ML99_genArray, n, f)
+
+/**
+ * Generates \f$f(0, 0), ..., f(0, cols - 1), ..., f(rows - 1, 0), ..., f(rows - 1, cols - 1)\f$.
+ *
+ * @p f is an ordinary macro as in #ML99_genArray, and this macro takes a constant number of
+ * reduction steps as well, so that thousands of initializers are generated without growing the
+ * evaluator's state one element or one row at a time.
+ *
+ * If @p rows or @p cols is 0, this macro results in emptiness.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/gen.h>
+ *
+ * #define CELL(i, j) ((i) * 128 + (j))
+ *
+ * // The values from 0 to 4095.
+ * static const int table[] = ML99_EVAL(ML99_braced(ML99_genTable(v(32), v(128), v(CELL))));
+ * @endcode
+ */
+#define ML99_genTable(rows, cols, f) ML99_call(ML99_genTable, rows, cols, f)
+
+/**
+ * Generates the @p i-th of @p shards contiguous slices of #ML99_genArray with @p n and @p f.
+ *
+ * The slices differ in length by at most one, and @p f receives the same indices as from
+ * #ML99_genArray, so a large generated set of symbols can be split between @p shards translation
+ * units, the @p i-th of them invoking this macro with its own @p i, and compiled in parallel.
+ *
+ * If the slice is empty (when @p n is lesser than @p shards), this macro results in emptiness.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/gen.h>
+ * #include <metalang99/util.h>
+ *
+ * #define HANDLER(i) v(int handler_##i(void) { return i; })
+ *
+ * // The definitions of handler_3, handler_4, handler_5 out of handler_0, ..., handler_7.
+ * ML99_EVAL(ML99_uncomma(ML99_genArrayShard(v(1), v(3), v(8), v(HANDLER))))
+ * @endcode
+ *
+ * @note @p i must be lesser than @p shards.
+ */
+#define ML99_genArrayShard(i, shards, n, f) ML99_call(ML99_genArrayShard, i, shards, n, f)
+
+/**
+ * The same as #ML99_genArrayShard but slices #ML99_genTable by rows.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/gen.h>
+ *
+ * #define CELL(i, j) ((i) * 128 + (j))
+ *
+ * // The values from 1024 to 2047, the second quarter of those of the #ML99_genTable example.
+ * static const int table[] =
+ *     ML99_EVAL(ML99_braced(ML99_genTableShard(v(1), v(4), v(32), v(128), v(CELL))));
+ * @endcode
+ *
+ * @note @p i must be lesser than @p shards.
+ */
+#define ML99_genTableShard(i, shards, rows, cols, f)                                               \
+    ML99_call(ML99_genTableShard, i, shards, rows, cols, f)
+
 /**
  * A statement chaining macro which introduces several variable definitions to a statement right
  * after its invocation.
@@ -473,16 +599,19 @@
 // ML99_indexedParams_IMPL {
 
 #define ML99_indexedParams_IMPL(type_list)                                                         \
-    ML99_tuple(ML99_PRIV_IF(                                                                       \
+    ML99_PRIV_IF(                                                                                  \
         ML99_IS_NIL(type_list),                                                                    \
-        v(void),                                                                                   \
-        ML99_variadicsTail(ML99_PRIV_indexedParamsAux_IMPL(type_list, 0))))
+        v((void)),                                                                                 \
+        ML99_call(ML99_PRIV_indexedParamsTuple, ML99_PRIV_indexedParamsAux_IMPL(type_list, 0)))
 
 #define ML99_PRIV_indexedParamsAux_IMPL(type_list, i)                                              \
     ML99_matchWithArgs_IMPL(type_list, ML99_PRIV_indexedParams_, i)
 #define ML99_PRIV_indexedParams_nil_IMPL(...) v(ML99_EMPTY())
 #define ML99_PRIV_indexedParams_cons_IMPL(x, xs, i)                                                \
     ML99_TERMS(v(, x _##i), ML99_PRIV_indexedParamsAux_IMPL(xs, ML99_INC(i)))
+
+// Drops the comma preceding the first parameter.
+#define ML99_PRIV_indexedParamsTuple_IMPL(_comma, ...) v((__VA_ARGS__))
 // } (ML99_indexedParams_IMPL)
 
 // ML99_indexedFields_IMPL {
@@ -496,16 +625,253 @@
     ML99_TERMS(v(x _##i;), ML99_PRIV_indexedFieldsAux_IMPL(xs, ML99_INC(i)))
 // } (ML99_indexedFields_IMPL)
 
-#define ML99_indexedInitializerList_IMPL(n) ML99_braced(ML99_PRIV_INDEXED_ITEMS(n, v(0)))
-#define ML99_indexedArgs_IMPL(n)            ML99_PRIV_INDEXED_ITEMS(n, v(ML99_EMPTY()))
+// ML99_indexed(Params, Fields)Variadics_IMPL {
+
+/* Both macros index eight types per reduction step while more than eight of them are left, and then
+ * the rest in a single step, so up to eight types take a single step altogether. */
 
-#define ML99_PRIV_INDEXED_ITEMS(n, empty_case)                                                     \
+#define ML99_indexedParamsVariadics_IMPL(...)                                                      \
     ML99_PRIV_IF(                                                                                  \
-        ML99_NAT_EQ(n, 0),                                                                         \
-        empty_case,                                                                                \
-        ML99_variadicsTail(ML99_repeat_IMPL(n, ML99_PRIV_indexedItem)))
+        ML99_PRIV_VARIADICS_MORE_THAN_8(__VA_ARGS__),                                              \
+        ML99_PRIV_indexedParamsVariadicsMany,                                                      \
+        ML99_PRIV_indexedParamsVariadicsFew)                                                       \
+    (__VA_ARGS__)
 
-#define ML99_PRIV_indexedItem_IMPL(i) v(, _##i)
+#define ML99_PRIV_indexedParamsVariadicsMany(...)                                                  \
+    ML99_tuple(ML99_callUneval(                                                                    \
+        ML99_PRIV_indexedVariadics,                                                                \
+        ML99_PRIV_INDEXED_PARAM,                                                                   \
+        ML99_PRIV_COMMA_SEP,                                                                       \
+        0,                                                                                         \
+        __VA_ARGS__))
+
+#define ML99_PRIV_indexedParamsVariadicsFew(...)                                                   \
+    v((ML99_PRIV_INDEXED_FEW(ML99_PRIV_INDEXED_PARAM, ML99_PRIV_COMMA_SEP, 0, __VA_ARGS__)))
+
+#define ML99_indexedFieldsVariadics_IMPL(...)                                                      \
+    ML99_PRIV_indexedVariadics_IMPL(ML99_PRIV_INDEXED_FIELD, ML99_PRIV_EMPTY, 0, __VA_ARGS__)
+
+/* `f(x, i)` yields the code of the type `x` at the index `i`, and `s()` yields the separator. A
+ * chunk of eight types is followed by a separator, since more types are always left after it. */
+
+#define ML99_PRIV_indexedVariadics_IMPL(f, s, i, ...)                                              \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_VARIADICS_MORE_THAN_8(__VA_ARGS__),                                              \
+        ML99_PRIV_indexedVariadicsChunk,                                                           \
+        ML99_PRIV_indexedVariadicsDone)                                                            \
+    (f, s, i, __VA_ARGS__)
+
+#define ML99_PRIV_indexedVariadicsDone(f, s, i, ...) v(ML99_PRIV_INDEXED_FEW(f, s, i, __VA_ARGS__))
+#define ML99_PRIV_indexedVariadicsChunk(f, s, i, _1, _2, _3, _4, _5, _6, _7, _8, ...)              \
+    ML99_TERMS(                                                                                    \
+        v(ML99_PRIV_INDEXED_FEW_8(f, s, i, _1, _2, _3, _4, _5, _6, _7, _8) s()),                   \
+        ML99_callUneval(                                                                           \
+            ML99_PRIV_indexedVariadics,                                                            \
+            f,                                                                                     \
+            s,                                                                                     \
+            ML99_PRIV_VARIADICS_ADD_8(i),                                                          \
+            __VA_ARGS__))
+
+#define ML99_PRIV_INDEXED_FEW(f, s, i, ...)                                                        \
+    ML99_PRIV_CAT(ML99_PRIV_INDEXED_FEW_, ML99_VARIADICS_COUNT(__VA_ARGS__))(f, s, i, __VA_ARGS__)
+
+#define ML99_PRIV_INDEXED_FEW_1(f, s, i, x) f(x, i)
+#define ML99_PRIV_INDEXED_FEW_2(f, s, i, x, ...)                                                   \
+    f(x, i) s() ML99_PRIV_INDEXED_FEW_1(f, s, ML99_PRIV_INC(i), __VA_ARGS__)
+#define ML99_PRIV_INDEXED_FEW_3(f, s, i, x, ...)                                                   \
+    f(x, i) s() ML99_PRIV_INDEXED_FEW_2(f, s, ML99_PRIV_INC(i), __VA_ARGS__)
+#define ML99_PRIV_INDEXED_FEW_4(f, s, i, x, ...)                                                   \
+    f(x, i) s() ML99_PRIV_INDEXED_FEW_3(f, s, ML99_PRIV_INC(i), __VA_ARGS__)
+#define ML99_PRIV_INDEXED_FEW_5(f, s, i, x, ...)                                                   \
+    f(x, i) s() ML99_PRIV_INDEXED_FEW_4(f, s, ML99_PRIV_INC(i), __VA_ARGS__)
+#define ML99_PRIV_INDEXED_FEW_6(f, s, i, x, ...)                                                   \
+    f(x, i) s() ML99_PRIV_INDEXED_FEW_5(f, s, ML99_PRIV_INC(i), __VA_ARGS__)
+#define ML99_PRIV_INDEXED_FEW_7(f, s, i, x, ...)                                                   \
+    f(x, i) s() ML99_PRIV_INDEXED_FEW_6(f, s, ML99_PRIV_INC(i), __VA_ARGS__)
+#define ML99_PRIV_INDEXED_FEW_8(f, s, i, x, ...)                                                   \
+    f(x, i) s() ML99_PRIV_INDEXED_FEW_7(f, s, ML99_PRIV_INC(i), __VA_ARGS__)
+
+#define ML99_PRIV_INDEXED_PARAM(x, i) x ML99_PRIV_CAT(_, i)
+#define ML99_PRIV_INDEXED_FIELD(x, i) x ML99_PRIV_CAT(_, i);
+#define ML99_PRIV_COMMA_SEP()         ,
+// } (ML99_indexed(Params, Fields)Variadics_IMPL)
+
+// ML99_indexed(InitializerList, Args)_IMPL {
+
+#define ML99_indexedInitializerList_IMPL(n)                                                        \
+    v({ML99_PRIV_IF(ML99_NAT_EQ(n, 0), ML99_PRIV_INDEXED_ZERO, ML99_PRIV_INDEXED_ARGS)(n)})
+#define ML99_indexedArgs_IMPL(n) v(ML99_PRIV_INDEXED_ARGS(n))
+
+#define ML99_PRIV_INDEXED_ARGS(n)  ML99_PRIV_GEN_ARRAY(n, ML99_PRIV_INDEXED_ARG, )
+#define ML99_PRIV_INDEXED_ARG(i)   _##i
+#define ML99_PRIV_INDEXED_ZERO(_n) 0
+// } (ML99_indexed(InitializerList, Args)_IMPL)
+
+// ML99_gen(Array, Table)_IMPL {
+
+#define ML99_genArray_IMPL(n, f) v(ML99_PRIV_GEN_ARRAY(n, f, ))
+
+#define ML99_genTable_IMPL(rows, cols, f)                                                          \
+    v(ML99_PRIV_IF(ML99_NAT_EQ(cols, 0), ML99_PRIV_EMPTY, ML99_PRIV_GEN_TABLE)(rows, cols, f))
+
+#define ML99_PRIV_GEN_TABLE(rows, cols, f) ML99_PRIV_GEN_TABLE_SHARD_AUX(f, cols, 0, rows)
+
+#define ML99_genArrayShard_IMPL(i, shards, n, f)                                                   \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_NAT_LESSER(i, shards),                                                           \
+        ML99_PRIV_genArrayShard,                                                                   \
+        ML99_PRIV_genShardError)(genArrayShard, i, shards, n, f)
+
+#define ML99_genTableShard_IMPL(i, shards, rows, cols, f)                                          \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_NAT_LESSER(i, shards),                                                           \
+        ML99_PRIV_genTableShard,                                                                   \
+        ML99_PRIV_genShardError)(genTableShard, i, shards, rows, cols, f)
+
+#define ML99_PRIV_genShardError(f, ...) ML99_fatal(ML99_##f, shard i is out of range)
+
+#define ML99_PRIV_genArrayShard(_f, i, shards, n, f)                                               \
+    v(ML99_PRIV_GEN_ARRAY_SHARD(f, ML99_PRIV_GEN_SHARD_RANGE(i, shards, n)))
+
+#define ML99_PRIV_genTableShard(_f, i, shards, rows, cols, f)                                      \
+    v(ML99_PRIV_IF(ML99_NAT_EQ(cols, 0), ML99_PRIV_EMPTY, ML99_PRIV_GEN_TABLE_SHARD)(             \
+        f,                                                                                         \
+        cols,                                                                                      \
+        ML99_PRIV_GEN_SHARD_RANGE(i, shards, rows)))
+
+/* The i-th slice starts at `i * q + min(i, r)` and has `q + (i < r)` items, where `q, r` are the
+ * quotient and the remainder of `n / shards`; neither of them exceeds `n`. */
+#define ML99_PRIV_GEN_SHARD_RANGE(i, shards, n)                                                    \
+    ML99_PRIV_GEN_SHARD_RANGE_AUX(i, ML99_PRIV_DIV_MOD(n, shards))
+#define ML99_PRIV_GEN_SHARD_RANGE_AUX(...) ML99_PRIV_GEN_SHARD_RANGE_QR(__VA_ARGS__)
+#define ML99_PRIV_GEN_SHARD_RANGE_QR(i, q, r)                                                      \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_NAT_LESSER(i, r),                                                                \
+        ML99_PRIV_GEN_SHARD_LONG,                                                                  \
+        ML99_PRIV_GEN_SHARD_SHORT)(i, q, r)
+#define ML99_PRIV_GEN_SHARD_LONG(i, q, _r)                                                         \
+    ML99_PRIV_NAT_ADD(ML99_PRIV_NAT_MUL(i, q), i), ML99_PRIV_INC(q)
+#define ML99_PRIV_GEN_SHARD_SHORT(i, q, r) ML99_PRIV_NAT_ADD(ML99_PRIV_NAT_MUL(i, q), r), q
+
+#define ML99_PRIV_GEN_ARRAY_SHARD(f, ...) ML99_PRIV_GEN_ARRAY_SHARD_AUX(f, __VA_ARGS__)
+#define ML99_PRIV_GEN_ARRAY_SHARD_AUX(f, lo, count)                                                \
+    ML99_PRIV_GEN_ARRAY(count, ML99_PRIV_GEN_SHARD_ITEM, f, lo, )
+#define ML99_PRIV_GEN_SHARD_ITEM(f, lo, k) ML99_PRIV_GEN_SHARD_CALL(f, ML99_PRIV_NAT_ADD(lo, k))
+#define ML99_PRIV_GEN_SHARD_CALL(f, i)     f(i)
+
+/* A row cannot invoke ML99_PRIV_GEN_ARRAY while the rows themselves are being generated by it, so
+ * each row is deferred and expanded afterwards by ML99_PRIV_GEN_SHARD_EXPAND. */
+#define ML99_PRIV_GEN_TABLE_SHARD(f, cols, ...) ML99_PRIV_GEN_TABLE_SHARD_AUX(f, cols, __VA_ARGS__)
+#define ML99_PRIV_GEN_TABLE_SHARD_AUX(f, cols, lo, count)                                          \
+    ML99_PRIV_GEN_SHARD_EXPAND(ML99_PRIV_GEN_ARRAY(count, ML99_PRIV_GEN_SHARD_ROW, f, cols, lo, ))
+#define ML99_PRIV_GEN_SHARD_ROW(f, cols, lo, k)                                                    \
+    ML99_PRIV_GEN_SHARD_ROW_AUX ML99_PRIV_EMPTY()(f, cols, ML99_PRIV_NAT_ADD(lo, k))
+#define ML99_PRIV_GEN_SHARD_ROW_AUX(f, cols, row) ML99_PRIV_GEN_ARRAY(cols, f, row, )
+#define ML99_PRIV_GEN_SHARD_EXPAND(...)           __VA_ARGS__
+
+/* `f(__VA_ARGS__ 0), ..., f(__VA_ARGS__ n - 1)`, built from the decimal digits of `n` so that no
+ * table of ML99_NAT_MAX entries is needed. */
+#define ML99_PRIV_GEN_ARRAY(n, f, ...)                                                             \
+    ML99_PRIV_GEN_ARRAY_AUX(ML99_PRIV_NAT_TO_DIGITS(n), f, __VA_ARGS__)
+#define ML99_PRIV_GEN_ARRAY_AUX(...) ML99_PRIV_GEN_ARRAY_DIGITS(__VA_ARGS__)
+#define ML99_PRIV_GEN_ARRAY_DIGITS(h, t, o, f, ...)                                                \
+    ML99_PRIV_GEN_ARRAY_PARTS(                                                                     \
+        h,                                                                                         \
+        t,                                                                                         \
+        o,                                                                                         \
+        ML99_PRIV_GEN_HP_##h,                                                                      \
+        ML99_PRIV_GEN_ZERO_##h,                                                                    \
+        ML99_PRIV_GEN_PREFIX(h, t),                                                                \
+        f,                                                                                         \
+        __VA_ARGS__)
+#define ML99_PRIV_GEN_ARRAY_PARTS(h, t, o, hp, z, p, f, ...)                                       \
+    ML99_PRIV_GEN_HUNDREDS_##h(f, __VA_ARGS__)                                                     \
+    ML99_PRIV_GEN_SEP(ML99_PRIV_GEN_NZ_##h, ML99_PRIV_GEN_NZ_##t)                                  \
+    ML99_PRIV_GEN_TENS_##t(f, hp, z, __VA_ARGS__)                                                  \
+    ML99_PRIV_GEN_SEP(                                                                             \
+        ML99_PRIV_OR(ML99_PRIV_GEN_NZ_##h, ML99_PRIV_GEN_NZ_##t),                                  \
+        ML99_PRIV_GEN_NZ_##o)                                                                      \
+    ML99_PRIV_GEN_ONES_##o(f, p, __VA_ARGS__)
+
+/* The separators are produced in place rather than by filtering the items afterwards, which would
+ * rescan the deferred rows of ML99_PRIV_GEN_TABLE_SHARD too early. */
+#define ML99_PRIV_GEN_SEP(x, y)                                                                    \
+    ML99_PRIV_IF(ML99_PRIV_AND(x, y), ML99_PRIV_GEN_COMMA, ML99_PRIV_EMPTY)()
+#define ML99_PRIV_GEN_COMMA() ,
+
+// The prefix of the units within `h * 100 + t * 10`.
+#define ML99_PRIV_GEN_PREFIX(h, t)                                                                 \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_GEN_NZ_##t,                                                                      \
+        ML99_PRIV_CAT(ML99_PRIV_GEN_HP_##h, t),                                                    \
+        ML99_PRIV_GEN_ZERO_##h)
+
+#define ML99_PRIV_GEN_HUNDREDS_0(f, ...)
+#define ML99_PRIV_GEN_HUNDREDS_1(f, ...) ML99_PRIV_GEN_TENS_10(f, , , __VA_ARGS__)
+#define ML99_PRIV_GEN_HUNDREDS_2(f, ...)                                                           \
+    ML99_PRIV_GEN_HUNDREDS_1(f, __VA_ARGS__), ML99_PRIV_GEN_TENS_10(f, 1, 10, __VA_ARGS__)
+
+#define ML99_PRIV_GEN_TENS_0(f, hp, z, ...)
+#define ML99_PRIV_GEN_TENS_1(f, hp, z, ...) ML99_PRIV_GEN_ONES_10(f, z, __VA_ARGS__)
+#define ML99_PRIV_GEN_TENS_2(f, hp, z, ...)                                                        \
+    ML99_PRIV_GEN_TENS_1(f, hp, z, __VA_ARGS__), ML99_PRIV_GEN_ONES_10(f, hp##1, __VA_ARGS__)
+#define ML99_PRIV_GEN_TENS_3(f, hp, z, ...)                                                        \
+    ML99_PRIV_GEN_TENS_2(f, hp, z, __VA_ARGS__), ML99_PRIV_GEN_ONES_10(f, hp##2, __VA_ARGS__)
+#define ML99_PRIV_GEN_TENS_4(f, hp, z, ...)                                                        \
+    ML99_PRIV_GEN_TENS_3(f, hp, z, __VA_ARGS__), ML99_PRIV_GEN_ONES_10(f, hp##3, __VA_ARGS__)
+#define ML99_PRIV_GEN_TENS_5(f, hp, z, ...)                                                        \
+    ML99_PRIV_GEN_TENS_4(f, hp, z, __VA_ARGS__), ML99_PRIV_GEN_ONES_10(f, hp##4, __VA_ARGS__)
+#define ML99_PRIV_GEN_TENS_6(f, hp, z, ...)                                                        \
+    ML99_PRIV_GEN_TENS_5(f, hp, z, __VA_ARGS__), ML99_PRIV_GEN_ONES_10(f, hp##5, __VA_ARGS__)
+#define ML99_PRIV_GEN_TENS_7(f, hp, z, ...)                                                        \
+    ML99_PRIV_GEN_TENS_6(f, hp, z, __VA_ARGS__), ML99_PRIV_GEN_ONES_10(f, hp##6, __VA_ARGS__)
+#define ML99_PRIV_GEN_TENS_8(f, hp, z, ...)                                                        \
+    ML99_PRIV_GEN_TENS_7(f, hp, z, __VA_ARGS__), ML99_PRIV_GEN_ONES_10(f, hp##7, __VA_ARGS__)
+#define ML99_PRIV_GEN_TENS_9(f, hp, z, ...)                                                        \
+    ML99_PRIV_GEN_TENS_8(f, hp, z, __VA_ARGS__), ML99_PRIV_GEN_ONES_10(f, hp##8, __VA_ARGS__)
+#define ML99_PRIV_GEN_TENS_10(f, hp, z, ...)                                                       \
+    ML99_PRIV_GEN_TENS_9(f, hp, z, __VA_ARGS__), ML99_PRIV_GEN_ONES_10(f, hp##9, __VA_ARGS__)
+
+#define ML99_PRIV_GEN_ONES_0(f, p, ...)
+#define ML99_PRIV_GEN_ONES_1(f, p, ...) f(__VA_ARGS__ p##0)
+#define ML99_PRIV_GEN_ONES_2(f, p, ...)                                                            \
+    ML99_PRIV_GEN_ONES_1(f, p, __VA_ARGS__), f(__VA_ARGS__ p##1)
+#define ML99_PRIV_GEN_ONES_3(f, p, ...)                                                            \
+    ML99_PRIV_GEN_ONES_2(f, p, __VA_ARGS__), f(__VA_ARGS__ p##2)
+#define ML99_PRIV_GEN_ONES_4(f, p, ...)                                                            \
+    ML99_PRIV_GEN_ONES_3(f, p, __VA_ARGS__), f(__VA_ARGS__ p##3)
+#define ML99_PRIV_GEN_ONES_5(f, p, ...)                                                            \
+    ML99_PRIV_GEN_ONES_4(f, p, __VA_ARGS__), f(__VA_ARGS__ p##4)
+#define ML99_PRIV_GEN_ONES_6(f, p, ...)                                                            \
+    ML99_PRIV_GEN_ONES_5(f, p, __VA_ARGS__), f(__VA_ARGS__ p##5)
+#define ML99_PRIV_GEN_ONES_7(f, p, ...)                                                            \
+    ML99_PRIV_GEN_ONES_6(f, p, __VA_ARGS__), f(__VA_ARGS__ p##6)
+#define ML99_PRIV_GEN_ONES_8(f, p, ...)                                                            \
+    ML99_PRIV_GEN_ONES_7(f, p, __VA_ARGS__), f(__VA_ARGS__ p##7)
+#define ML99_PRIV_GEN_ONES_9(f, p, ...)                                                            \
+    ML99_PRIV_GEN_ONES_8(f, p, __VA_ARGS__), f(__VA_ARGS__ p##8)
+#define ML99_PRIV_GEN_ONES_10(f, p, ...)                                                           \
+    ML99_PRIV_GEN_ONES_9(f, p, __VA_ARGS__), f(__VA_ARGS__ p##9)
+
+#define ML99_PRIV_GEN_NZ_0 0
+#define ML99_PRIV_GEN_NZ_1 1
+#define ML99_PRIV_GEN_NZ_2 1
+#define ML99_PRIV_GEN_NZ_3 1
+#define ML99_PRIV_GEN_NZ_4 1
+#define ML99_PRIV_GEN_NZ_5 1
+#define ML99_PRIV_GEN_NZ_6 1
+#define ML99_PRIV_GEN_NZ_7 1
+#define ML99_PRIV_GEN_NZ_8 1
+#define ML99_PRIV_GEN_NZ_9 1
+
+#define ML99_PRIV_GEN_HP_0
+#define ML99_PRIV_GEN_HP_1 1
+#define ML99_PRIV_GEN_HP_2 2
+
+#define ML99_PRIV_GEN_ZERO_0
+#define ML99_PRIV_GEN_ZERO_1 10
+#define ML99_PRIV_GEN_ZERO_2 20
+// } (ML99_gen(Array, Table)_IMPL)
 
 // Arity specifiers {
 
@@ -529,8 +895,15 @@
 #define ML99_indexedFields_ARITY             1
 #define ML99_indexedInitializerList_ARITY    1
 #define ML99_indexedArgs_ARITY               1
-
-#define ML99_PRIV_indexedItem_ARITY 1
+#define ML99_indexedParamsVariadics_ARITY    1
+#define ML99_indexedFieldsVariadics_ARITY    1
+#define ML99_genArray_ARITY                  2
+#define ML99_genTable_ARITY                  3
+#define ML99_genArrayShard_ARITY             4
+#define ML99_genTableShard_ARITY             5
+
+#define ML99_PRIV_indexedParamsTuple_ARITY 1
+#define ML99_PRIV_indexedVariadics_ARITY   4
 // } (Arity specifiers)
 
 #endif // DOXYGEN_IGNORE
@@ -136,13 +136,76 @@
  */
 #define ML99_isChar(x) ML99_call(ML99_isChar, x)
 
+/**
+ * Classifies the identifier @p x as a character.
+ *
+ * The result is a choice instance whose tag is `lower`, `upper`, `digit`, or `underscore` if @p x
+ * is a lowercase letter, an uppercase letter, a digit, or `_`, respectively, and `other` if @p x
+ * is not a character. In all cases, the choice data is @p x itself.
+ *
+ * Unlike a chain of #ML99_isLowercase, #ML99_isUppercase, and so on, this function looks @p x up
+ * in a single table, so #ML99_match can dispatch on its result straight away.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/choice.h>
+ * #include <metalang99/ident.h>
+ *
+ * #define TOKEN_lower_IMPL(x)      v(ident)
+ * #define TOKEN_upper_IMPL(x)      v(ident)
+ * #define TOKEN_digit_IMPL(x)      v(number)
+ * #define TOKEN_underscore_IMPL(x) v(ident)
+ * #define TOKEN_other_IMPL(x)      v(unknown)
+ *
+ * // number
+ * ML99_match(ML99_charClass(v(7)), v(TOKEN_))
+ *
+ * // unknown
+ * ML99_match(ML99_charClass(v(abc)), v(TOKEN_))
+ * @endcode
+ */
+#define ML99_charClass(x) ML99_call(ML99_charClass, x)
+
+/**
+ * Classifies the identifier @p x by a set of identifiers defined by @p prefix.
+ *
+ * If `ML99_cat(prefix, x)` exists, it must be an object-like macro which expands to `(tag)`, as the
+ * detectors of #ML99_detectIdent expand to `()`. If so, the result is a choice instance with the
+ * tag `tag`, otherwise with the tag `other`. In both cases, the choice data is @p x itself.
+ *
+ * This function takes a single lookup regardless of the number of classes in the set.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/choice.h>
+ * #include <metalang99/ident.h>
+ *
+ * #define KIND_int    (type)
+ * #define KIND_double (type)
+ * #define KIND_if     (statement)
+ * #define KIND_while  (statement)
+ *
+ * // (type, int)
+ * ML99_identClassify(v(KIND_), v(int))
+ *
+ * // statement
+ * ML99_choiceTag(ML99_identClassify(v(KIND_), v(while)))
+ *
+ * // (other, foo)
+ * ML99_identClassify(v(KIND_), v(foo))
+ * @endcode
+ */
+#define ML99_identClassify(prefix, x) ML99_call(ML99_identClassify, prefix, x)
+
 /**
  * Converts the Metalang99 character @p x to a C character literal.
  *
  * # Examples
  *
  * @code
- * #include <metalang/ident.h>
+ * #include <metalang99/ident.h>
  *
  * // 't'
  * ML99_charLit(v(t))
@@ -204,13 +267,11 @@
 #define ML99_IS_LOWERCASE(x) ML99_IDENT_EQ(ML99_LOWERCASE_DETECTOR, x, x)
 #define ML99_IS_UPPERCASE(x) ML99_IDENT_EQ(ML99_UPPERCASE_DETECTOR, x, x)
 #define ML99_IS_DIGIT(x)     ML99_IDENT_EQ(ML99_DIGIT_DETECTOR, x, x)
-#define ML99_IS_CHAR(x)                                                                            \
-    ML99_OR(                                                                                       \
-        ML99_IS_LOWERCASE(x),                                                                      \
-        ML99_OR(                                                                                   \
-            ML99_IS_UPPERCASE(x),                                                                  \
-            ML99_OR(ML99_IS_DIGIT(x), ML99_DETECT_IDENT(ML99_UNDERSCORE_DETECTOR, x))))
-#define ML99_CHAR_LIT(x) ML99_PRIV_CAT(ML99_PRIV_CHAR_LIT_, x)
+#define ML99_IS_CHAR(x)      ML99_DETECT_IDENT(ML99_PRIV_CHAR_CLASS_, x)
+#define ML99_CHAR_LIT(x)     ML99_PRIV_CAT(ML99_PRIV_CHAR_LIT_, x)
+
+#define ML99_CHAR_CLASS(x)             ML99_IDENT_CLASSIFY(ML99_PRIV_CHAR_CLASS_, x)
+#define ML99_IDENT_CLASSIFY(prefix, x) ML99_PRIV_IDENT_CLASSIFY(ML99_PRIV_CAT(prefix, x), x)
 
 #ifndef DOXYGEN_IGNORE
 
@@ -222,6 +283,11 @@
 #define ML99_isDigit_IMPL(x)                 v(ML99_IS_DIGIT(x))
 #define ML99_isChar_IMPL(x)                  v(ML99_IS_CHAR(x))
 #define ML99_charLit_IMPL(x)                 v(ML99_CHAR_LIT(x))
+#define ML99_charClass_IMPL(x)               v(ML99_CHAR_CLASS(x))
+#define ML99_identClassify_IMPL(prefix, x)   v(ML99_IDENT_CLASSIFY(prefix, x))
+
+#define ML99_PRIV_IDENT_CLASSIFY(entry, x)                                                         \
+    (ML99_PRIV_IF(ML99_PRIV_IS_TUPLE_FAST(entry), ML99_PRIV_EXPAND entry, other), x)
 
 #define ML99_UNDERSCORE_DETECTOR ML99_PRIV_UNDERSCORE_DETECTOR_
 #define ML99_C_KEYWORD_DETECTOR  ML99_PRIV_C_KEYWORD_DETECTOR_
@@ -229,6 +295,7 @@
 #define ML99_UPPERCASE_DETECTOR  ML99_PRIV_UPPER_DETECTOR_
 #define ML99_DIGIT_DETECTOR      ML99_PRIV_DIGIT_DETECTOR_
 
+// Generated by scripts/gen-tables.py.
 #define ML99_PRIV_C_KEYWORD_DETECTOR_auto_auto                     ()
 #define ML99_PRIV_C_KEYWORD_DETECTOR_break_break                   ()
 #define ML99_PRIV_C_KEYWORD_DETECTOR_case_case                     ()
@@ -408,16 +475,85 @@
 
 #define ML99_PRIV_CHAR_LIT__ '_'
 
+#define ML99_PRIV_CHAR_CLASS_a (lower)
+#define ML99_PRIV_CHAR_CLASS_b (lower)
+#define ML99_PRIV_CHAR_CLASS_c (lower)
+#define ML99_PRIV_CHAR_CLASS_d (lower)
+#define ML99_PRIV_CHAR_CLASS_e (lower)
+#define ML99_PRIV_CHAR_CLASS_f (lower)
+#define ML99_PRIV_CHAR_CLASS_g (lower)
+#define ML99_PRIV_CHAR_CLASS_h (lower)
+#define ML99_PRIV_CHAR_CLASS_i (lower)
+#define ML99_PRIV_CHAR_CLASS_j (lower)
+#define ML99_PRIV_CHAR_CLASS_k (lower)
+#define ML99_PRIV_CHAR_CLASS_l (lower)
+#define ML99_PRIV_CHAR_CLASS_m (lower)
+#define ML99_PRIV_CHAR_CLASS_n (lower)
+#define ML99_PRIV_CHAR_CLASS_o (lower)
+#define ML99_PRIV_CHAR_CLASS_p (lower)
+#define ML99_PRIV_CHAR_CLASS_q (lower)
+#define ML99_PRIV_CHAR_CLASS_r (lower)
+#define ML99_PRIV_CHAR_CLASS_s (lower)
+#define ML99_PRIV_CHAR_CLASS_t (lower)
+#define ML99_PRIV_CHAR_CLASS_u (lower)
+#define ML99_PRIV_CHAR_CLASS_v (lower)
+#define ML99_PRIV_CHAR_CLASS_w (lower)
+#define ML99_PRIV_CHAR_CLASS_x (lower)
+#define ML99_PRIV_CHAR_CLASS_y (lower)
+#define ML99_PRIV_CHAR_CLASS_z (lower)
+
+#define ML99_PRIV_CHAR_CLASS_A (upper)
+#define ML99_PRIV_CHAR_CLASS_B (upper)
+#define ML99_PRIV_CHAR_CLASS_C (upper)
+#define ML99_PRIV_CHAR_CLASS_D (upper)
+#define ML99_PRIV_CHAR_CLASS_E (upper)
+#define ML99_PRIV_CHAR_CLASS_F (upper)
+#define ML99_PRIV_CHAR_CLASS_G (upper)
+#define ML99_PRIV_CHAR_CLASS_H (upper)
+#define ML99_PRIV_CHAR_CLASS_I (upper)
+#define ML99_PRIV_CHAR_CLASS_J (upper)
+#define ML99_PRIV_CHAR_CLASS_K (upper)
+#define ML99_PRIV_CHAR_CLASS_L (upper)
+#define ML99_PRIV_CHAR_CLASS_M (upper)
+#define ML99_PRIV_CHAR_CLASS_N (upper)
+#define ML99_PRIV_CHAR_CLASS_O (upper)
+#define ML99_PRIV_CHAR_CLASS_P (upper)
+#define ML99_PRIV_CHAR_CLASS_Q (upper)
+#define ML99_PRIV_CHAR_CLASS_R (upper)
+#define ML99_PRIV_CHAR_CLASS_S (upper)
+#define ML99_PRIV_CHAR_CLASS_T (upper)
+#define ML99_PRIV_CHAR_CLASS_U (upper)
+#define ML99_PRIV_CHAR_CLASS_V (upper)
+#define ML99_PRIV_CHAR_CLASS_W (upper)
+#define ML99_PRIV_CHAR_CLASS_X (upper)
+#define ML99_PRIV_CHAR_CLASS_Y (upper)
+#define ML99_PRIV_CHAR_CLASS_Z (upper)
+
+#define ML99_PRIV_CHAR_CLASS_0 (digit)
+#define ML99_PRIV_CHAR_CLASS_1 (digit)
+#define ML99_PRIV_CHAR_CLASS_2 (digit)
+#define ML99_PRIV_CHAR_CLASS_3 (digit)
+#define ML99_PRIV_CHAR_CLASS_4 (digit)
+#define ML99_PRIV_CHAR_CLASS_5 (digit)
+#define ML99_PRIV_CHAR_CLASS_6 (digit)
+#define ML99_PRIV_CHAR_CLASS_7 (digit)
+#define ML99_PRIV_CHAR_CLASS_8 (digit)
+#define ML99_PRIV_CHAR_CLASS_9 (digit)
+
+#define ML99_PRIV_CHAR_CLASS__ (underscore)
+
 // Arity specifiers {
 
-#define ML99_detectIdent_ARITY 2
-#define ML99_identEq_ARITY     3
-#define ML99_charEq_ARITY      2
-#define ML99_isLowercase_ARITY 1
-#define ML99_isUppercase_ARITY 1
-#define ML99_isDigit_ARITY     1
-#define ML99_isChar_ARITY      1
-#define ML99_charLit_ARITY     1
+#define ML99_detectIdent_ARITY   2
+#define ML99_identEq_ARITY       3
+#define ML99_charEq_ARITY        2
+#define ML99_isLowercase_ARITY   1
+#define ML99_isUppercase_ARITY   1
+#define ML99_isDigit_ARITY       1
+#define ML99_isChar_ARITY        1
+#define ML99_charLit_ARITY       1
+#define ML99_charClass_ARITY     1
+#define ML99_identClassify_ARITY 2
 // } (Arity specifiers)
 
 #endif // DOXYGEN_IGNORE
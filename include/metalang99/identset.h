@@ -0,0 +1,249 @@
+/**
+ * @file
+ * Sets of identifiers.
+ *
+ * It is separate from `ident.h` because it needs the tables of `nat.h` and `variadics.h`, which
+ * most metaprograms that compare identifiers do not; for the same reason, `metalang99.h` does not
+ * include it.
+ */
+
+#ifndef ML99_IDENTSET_H
+#define ML99_IDENTSET_H
+
+#include <metalang99/nat/dec.h>
+#include <metalang99/nat/eq.h>
+#include <metalang99/nat/inc.h>
+#include <metalang99/variadics/slice.h>
+
+#include <metalang99/priv/util.h>
+
+#include <metalang99/ident.h>
+#include <metalang99/lang.h>
+
+/**
+ * The empty set of identifiers that are compared by @p prefix.
+ *
+ * The identifiers of a set are compared by `ML99_IDENT_EQ(prefix, x, y)`, so that
+ * `prefix##x##_##y` must be defined as `()` if and only if `x` and `y` are equal, as for
+ * #ML99_identEq. #ML99_identSetInsert, #ML99_identSetRemove, and #ML99_identSetContains compare
+ * eight identifiers per reduction step, so that they take a constant number of reduction steps on
+ * a set of at most eight identifiers. A set holds at most #ML99_NAT_MAX identifiers.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/identset.h>
+ *
+ * #define FOO_x_x ()
+ * #define FOO_y_y ()
+ *
+ * // x, y
+ * ML99_identSetItems(ML99_identSetInsert(
+ *     v(x), ML99_identSetInsert(v(y), ML99_identSetInsert(v(x), ML99_identSet(v(FOO_))))))
+ *
+ * // 1
+ * ML99_identSetContains(
+ *     v(while), ML99_identSetInsert(v(while), ML99_identSet(v(ML99_C_KEYWORD_DETECTOR))))
+ * @endcode
+ */
+#define ML99_identSet(prefix) ML99_call(ML99_identSet, prefix)
+
+/**
+ * Adds the identifier @p x to @p set, if it is not there.
+ */
+#define ML99_identSetInsert(x, set) ML99_call(ML99_identSetInsert, x, set)
+
+/**
+ * Removes the identifier @p x from @p set, if it is there.
+ */
+#define ML99_identSetRemove(x, set) ML99_call(ML99_identSetRemove, x, set)
+
+/**
+ * Checks whether @p set contains the identifier @p x.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/identset.h>
+ *
+ * #define FOO_x_x ()
+ * #define FOO_y_y ()
+ *
+ * // 1
+ * ML99_identSetContains(v(x), ML99_identSetInsert(v(x), ML99_identSet(v(FOO_))))
+ *
+ * // 0
+ * ML99_identSetContains(v(y), ML99_identSetInsert(v(x), ML99_identSet(v(FOO_))))
+ * @endcode
+ */
+#define ML99_identSetContains(x, set) ML99_call(ML99_identSetContains, x, set)
+
+/**
+ * The number of identifiers in @p set.
+ */
+#define ML99_identSetLen(set) ML99_call(ML99_identSetLen, set)
+
+/**
+ * The comma-separated identifiers of @p set, in the order of their insertion.
+ */
+#define ML99_identSetItems(set) ML99_call(ML99_identSetItems, set)
+
+#ifndef DOXYGEN_IGNORE
+
+/* A set of identifiers is `(prefix, n, (x1, ..., xn, ()))`. */
+
+#define ML99_identSet_IMPL(prefix) v((prefix, 0, (())))
+#define ML99_identSetInsert_IMPL(x, set)                                                           \
+    ML99_PRIV_identSetFind(ML99_PRIV_identSetInsertAt, x, ML99_PRIV_EXPAND set)
+#define ML99_identSetRemove_IMPL(x, set)                                                           \
+    ML99_PRIV_identSetFind(ML99_PRIV_identSetRemoveAt, x, ML99_PRIV_EXPAND set)
+#define ML99_identSetContains_IMPL(x, set)                                                         \
+    ML99_PRIV_identSetFind(ML99_PRIV_identSetContainsAt, x, ML99_PRIV_EXPAND set)
+#define ML99_identSetLen_IMPL(set)   v(ML99_PRIV_identSetLen set)
+#define ML99_identSetItems_IMPL(set) v(ML99_PRIV_identSetItems set)
+
+#define ML99_PRIV_identSetFind(...) ML99_PRIV_identSetFindAux(__VA_ARGS__)
+#define ML99_PRIV_identSetFindAux(k, x, prefix, n, items)                                          \
+    ML99_PRIV_identFind_IMPL(k, (x, prefix, n, items), prefix, x, 0, ML99_PRIV_EXPAND items, ~)
+
+#define ML99_PRIV_identSetInsertAt(found, _i, x, prefix, n, items)                                 \
+    ML99_PRIV_IF(                                                                                  \
+        found,                                                                                     \
+        ML99_PRIV_identSetSame,                                                                    \
+        ML99_PRIV_IF(                                                                              \
+            ML99_PRIV_NAT_EQ(n, ML99_PRIV_NAT_MAX),                                                \
+            ML99_PRIV_identSetFull,                                                                \
+            ML99_PRIV_identSetAdd))                                                                \
+    (x, prefix, n, items)
+#define ML99_PRIV_identSetSame(_x, prefix, n, items) v((prefix, n, items))
+#define ML99_PRIV_identSetAdd(x, prefix, n, items)                                                 \
+    v(ML99_PRIV_identSetAppend(x, prefix, n, items))
+#define ML99_PRIV_identSetFull(...)                                                                \
+    ML99_fatal(ML99_identSetInsert, the set already holds ML99_NAT_MAX identifiers)
+
+#define ML99_PRIV_identSetRemoveAt(found, i, _x, prefix, n, items)                                 \
+    ML99_PRIV_IF(found, ML99_PRIV_identSetDelete, ML99_PRIV_identSetSame)(i, prefix, n, items)
+#define ML99_PRIV_identSetDelete(i, prefix, n, items)                                              \
+    v((prefix,                                                                                     \
+       ML99_PRIV_DEC(n),                                                                           \
+       (ML99_PRIV_identSetPrefix(i, ML99_PRIV_EXPAND items)                                        \
+            ML99_PRIV_VARIADICS_DROP(ML99_PRIV_INC(i), ML99_PRIV_EXPAND items))))
+
+#define ML99_PRIV_identSetContainsAt(found, ...) v(found)
+
+#define ML99_PRIV_identSetLen(_prefix, n, _items) n
+
+/* `ML99_PRIV_identSetAppend(x, prefix, n, items)` is the set `(prefix, n, items)`, which does not
+ * contain `x` and holds less than `ML99_NAT_MAX` identifiers, with `x` added. */
+#define ML99_PRIV_identSetAppend(x, prefix, n, items)                                              \
+    (prefix, ML99_PRIV_INC(n), (ML99_PRIV_identSetPrefix(n, ML99_PRIV_EXPAND items) x, ()))
+#define ML99_PRIV_identSetItems(_prefix, n, items)                                                 \
+    ML99_PRIV_IF(ML99_PRIV_NAT_EQ(n, 0), ML99_PRIV_EMPTY, ML99_PRIV_VARIADICS_TAKE)                \
+    (n, ML99_PRIV_EXPAND items)
+
+#define ML99_PRIV_identSetPrefix(i, ...)                                                           \
+    ML99_PRIV_IF(ML99_PRIV_NAT_EQ(i, 0), ML99_PRIV_EMPTY, ML99_PRIV_identSetTake)(i, __VA_ARGS__)
+#define ML99_PRIV_identSetTake(i, ...) ML99_PRIV_VARIADICS_TAKE(i, __VA_ARGS__),
+
+/* `ML99_PRIV_identFind1(k, kargs, prefix, key, i, ki, ..., (), ~)` searches for `key` among the
+ * identifiers `ki, ...`, the first of which has the index `i`, and calls the plain macro
+ * `k(found, j, kargs...)`, where `j` is the index of `key` if `found` is 1. Eight identifiers are
+ * compared per reduction step. */
+
+#define ML99_PRIV_identFind_IMPL(...) ML99_PRIV_identFind1(__VA_ARGS__)
+
+#define ML99_PRIV_identFind1(k, kargs, prefix, key, i, x, ...)                                     \
+    ML99_PRIV_IF(ML99_PRIV_IS_TUPLE_FAST(x), ML99_PRIV_identMissing, ML99_PRIV_identFindCmp1)      \
+    (k, kargs, prefix, key, i, x, __VA_ARGS__)
+#define ML99_PRIV_identFindCmp1(k, kargs, prefix, key, i, x, ...)                                  \
+    ML99_PRIV_IF(ML99_IDENT_EQ(prefix, x, key), ML99_PRIV_identFound, ML99_PRIV_identFindSkip1)    \
+    (k, kargs, prefix, key, i, __VA_ARGS__)
+#define ML99_PRIV_identFindSkip1(k, kargs, prefix, key, i, ...)                                    \
+    ML99_PRIV_identFind2(k, kargs, prefix, key, ML99_PRIV_INC(i), __VA_ARGS__)
+
+#define ML99_PRIV_identFind2(k, kargs, prefix, key, i, x, ...)                                     \
+    ML99_PRIV_IF(ML99_PRIV_IS_TUPLE_FAST(x), ML99_PRIV_identMissing, ML99_PRIV_identFindCmp2)      \
+    (k, kargs, prefix, key, i, x, __VA_ARGS__)
+#define ML99_PRIV_identFindCmp2(k, kargs, prefix, key, i, x, ...)                                  \
+    ML99_PRIV_IF(ML99_IDENT_EQ(prefix, x, key), ML99_PRIV_identFound, ML99_PRIV_identFindSkip2)    \
+    (k, kargs, prefix, key, i, __VA_ARGS__)
+#define ML99_PRIV_identFindSkip2(k, kargs, prefix, key, i, ...)                                    \
+    ML99_PRIV_identFind3(k, kargs, prefix, key, ML99_PRIV_INC(i), __VA_ARGS__)
+
+#define ML99_PRIV_identFind3(k, kargs, prefix, key, i, x, ...)                                     \
+    ML99_PRIV_IF(ML99_PRIV_IS_TUPLE_FAST(x), ML99_PRIV_identMissing, ML99_PRIV_identFindCmp3)      \
+    (k, kargs, prefix, key, i, x, __VA_ARGS__)
+#define ML99_PRIV_identFindCmp3(k, kargs, prefix, key, i, x, ...)                                  \
+    ML99_PRIV_IF(ML99_IDENT_EQ(prefix, x, key), ML99_PRIV_identFound, ML99_PRIV_identFindSkip3)    \
+    (k, kargs, prefix, key, i, __VA_ARGS__)
+#define ML99_PRIV_identFindSkip3(k, kargs, prefix, key, i, ...)                                    \
+    ML99_PRIV_identFind4(k, kargs, prefix, key, ML99_PRIV_INC(i), __VA_ARGS__)
+
+#define ML99_PRIV_identFind4(k, kargs, prefix, key, i, x, ...)                                     \
+    ML99_PRIV_IF(ML99_PRIV_IS_TUPLE_FAST(x), ML99_PRIV_identMissing, ML99_PRIV_identFindCmp4)      \
+    (k, kargs, prefix, key, i, x, __VA_ARGS__)
+#define ML99_PRIV_identFindCmp4(k, kargs, prefix, key, i, x, ...)                                  \
+    ML99_PRIV_IF(ML99_IDENT_EQ(prefix, x, key), ML99_PRIV_identFound, ML99_PRIV_identFindSkip4)    \
+    (k, kargs, prefix, key, i, __VA_ARGS__)
+#define ML99_PRIV_identFindSkip4(k, kargs, prefix, key, i, ...)                                    \
+    ML99_PRIV_identFind5(k, kargs, prefix, key, ML99_PRIV_INC(i), __VA_ARGS__)
+
+#define ML99_PRIV_identFind5(k, kargs, prefix, key, i, x, ...)                                     \
+    ML99_PRIV_IF(ML99_PRIV_IS_TUPLE_FAST(x), ML99_PRIV_identMissing, ML99_PRIV_identFindCmp5)      \
+    (k, kargs, prefix, key, i, x, __VA_ARGS__)
+#define ML99_PRIV_identFindCmp5(k, kargs, prefix, key, i, x, ...)                                  \
+    ML99_PRIV_IF(ML99_IDENT_EQ(prefix, x, key), ML99_PRIV_identFound, ML99_PRIV_identFindSkip5)    \
+    (k, kargs, prefix, key, i, __VA_ARGS__)
+#define ML99_PRIV_identFindSkip5(k, kargs, prefix, key, i, ...)                                    \
+    ML99_PRIV_identFind6(k, kargs, prefix, key, ML99_PRIV_INC(i), __VA_ARGS__)
+
+#define ML99_PRIV_identFind6(k, kargs, prefix, key, i, x, ...)                                     \
+    ML99_PRIV_IF(ML99_PRIV_IS_TUPLE_FAST(x), ML99_PRIV_identMissing, ML99_PRIV_identFindCmp6)      \
+    (k, kargs, prefix, key, i, x, __VA_ARGS__)
+#define ML99_PRIV_identFindCmp6(k, kargs, prefix, key, i, x, ...)                                  \
+    ML99_PRIV_IF(ML99_IDENT_EQ(prefix, x, key), ML99_PRIV_identFound, ML99_PRIV_identFindSkip6)    \
+    (k, kargs, prefix, key, i, __VA_ARGS__)
+#define ML99_PRIV_identFindSkip6(k, kargs, prefix, key, i, ...)                                    \
+    ML99_PRIV_identFind7(k, kargs, prefix, key, ML99_PRIV_INC(i), __VA_ARGS__)
+
+#define ML99_PRIV_identFind7(k, kargs, prefix, key, i, x, ...)                                     \
+    ML99_PRIV_IF(ML99_PRIV_IS_TUPLE_FAST(x), ML99_PRIV_identMissing, ML99_PRIV_identFindCmp7)      \
+    (k, kargs, prefix, key, i, x, __VA_ARGS__)
+#define ML99_PRIV_identFindCmp7(k, kargs, prefix, key, i, x, ...)                                  \
+    ML99_PRIV_IF(ML99_IDENT_EQ(prefix, x, key), ML99_PRIV_identFound, ML99_PRIV_identFindSkip7)    \
+    (k, kargs, prefix, key, i, __VA_ARGS__)
+#define ML99_PRIV_identFindSkip7(k, kargs, prefix, key, i, ...)                                    \
+    ML99_PRIV_identFind8(k, kargs, prefix, key, ML99_PRIV_INC(i), __VA_ARGS__)
+
+#define ML99_PRIV_identFind8(k, kargs, prefix, key, i, x, ...)                                     \
+    ML99_PRIV_IF(ML99_PRIV_IS_TUPLE_FAST(x), ML99_PRIV_identMissing, ML99_PRIV_identFindCmp8)      \
+    (k, kargs, prefix, key, i, x, __VA_ARGS__)
+#define ML99_PRIV_identFindCmp8(k, kargs, prefix, key, i, x, ...)                                  \
+    ML99_PRIV_IF(ML99_IDENT_EQ(prefix, x, key), ML99_PRIV_identFound, ML99_PRIV_identFindSkip8)    \
+    (k, kargs, prefix, key, i, __VA_ARGS__)
+#define ML99_PRIV_identFindSkip8(k, kargs, prefix, key, i, ...)                                    \
+    ML99_PRIV_identFindNext(k, kargs, prefix, key, ML99_PRIV_INC(i), __VA_ARGS__)
+
+#define ML99_PRIV_identFindNext(k, kargs, prefix, key, i, ...)                                     \
+    ML99_callUneval(ML99_PRIV_identFind, k, kargs, prefix, key, i, __VA_ARGS__)
+#define ML99_PRIV_identFound(k, kargs, _prefix, _key, i, ...)                                      \
+    ML99_PRIV_identCont(k, 1, i, kargs)
+#define ML99_PRIV_identMissing(k, kargs, _prefix, _key, i, ...)                                    \
+    ML99_PRIV_identCont(k, 0, i, kargs)
+#define ML99_PRIV_identCont(k, found, i, kargs)                                                    \
+    ML99_PRIV_identContAux(k, found, i, ML99_PRIV_EXPAND kargs)
+#define ML99_PRIV_identContAux(k, ...) k(__VA_ARGS__)
+
+// Arity specifiers {
+
+#define ML99_identSet_ARITY         1
+#define ML99_identSetInsert_ARITY   2
+#define ML99_identSetRemove_ARITY   2
+#define ML99_identSetContains_ARITY 2
+#define ML99_identSetLen_ARITY      1
+#define ML99_identSetItems_ARITY    1
+// } (Arity specifiers)
+
+#endif // DOXYGEN_IGNORE
+
+#endif // ML99_IDENTSET_H
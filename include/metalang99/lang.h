@@ -23,9 +23,225 @@
  *
  * ML99_EVAL(v(abc ~ 123), ML99_call(F, v(1, 2)))
  * @endcode
+ *
+ * @note A metaprogram can perform approximately `ML99_REC_DEPTH * 1024` reduction steps. You can
+ * define `ML99_REC_DEPTH` before including Metalang99 as 1 (small), 16 (default), 64 (large), or
+ * 256 (huge). A larger depth makes every evaluation slower, so raise it only if your metaprograms
+ * really need it.
  */
 #define ML99_EVAL(...) ML99_PRIV_EVAL(__VA_ARGS__)
 
+/**
+ * Evaluates a sequence of independent metaprograms, each consisting of a single term, and yields
+ * their results one after another.
+ *
+ * It is the same as `ML99_EVAL(t1) ML99_EVAL(t2) ... ML99_EVAL(tN)`. Since a term does not carry
+ * the rest of the sequence, #ML99_EVAL_STREAM is faster than #ML99_EVAL for long sequences of
+ * top-level terms, e.g., one generator call per type.
+ *
+ * At most 63 terms are acceptable.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/lang.h>
+ *
+ * #define F_IMPL(x) v(typedef int x;)
+ *
+ * // typedef int A; typedef int B; typedef int C;
+ * ML99_EVAL_STREAM(ML99_call(F, v(A)), ML99_call(F, v(B)), ML99_call(F, v(C)))
+ * @endcode
+ *
+ * @note Unlike #ML99_EVAL, #ML99_abort aborts the evaluation of the term it occurs in only; the
+ * results of the other terms are kept.
+ */
+#define ML99_EVAL_STREAM(...) ML99_PRIV_EVAL_STREAM(__VA_ARGS__)
+
+/**
+ * Evaluates a sequence of independent metaprograms and yields their results as a sequence
+ * `(r1)(r2)...(rN)`.
+ *
+ * Each metaprogram is a parenthesised sequence of terms, as accepted by #ML99_EVAL. It is the same
+ * as `(ML99_EVAL p1) (ML99_EVAL p2) ... (ML99_EVAL pN)`, but expands in a single macro call, like
+ * #ML99_EVAL_STREAM, and keeps the results of different metaprograms apart.
+ *
+ * At most 63 metaprograms are acceptable.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/lang.h>
+ * #include <metalang99/nat.h>
+ *
+ * // (6) (1)
+ * ML99_EVAL_MANY((ML99_add(v(1), v(5))), (ML99_natEq(v(3), v(3))))
+ * @endcode
+ *
+ * @note #ML99_abort aborts the evaluation of the metaprogram it occurs in only.
+ */
+#define ML99_EVAL_MANY(...) ML99_PRIV_EVAL_MANY(__VA_ARGS__)
+
+/**
+ * Continues a metaprogram that has run out of reduction steps.
+ *
+ * If a metaprogram does not fit into the `ML99_REC_DEPTH * 1024` reduction steps of #ML99_EVAL,
+ * the evaluation is suspended: instead of its result, #ML99_EVAL yields a state, which can be
+ * passed to #ML99_EVAL_RESUME. It performs yet another `ML99_REC_DEPTH * 1024` reduction steps
+ * and yields either the result of the metaprogram, or the next state if it has still not been
+ * completed.
+ *
+ * # Examples
+ *
+ * @code
+ * #define ML99_REC_DEPTH 1
+ * #include <metalang99/lang.h>
+ * #include <metalang99/nat.h>
+ *
+ * #define COUNTDOWN_IMPL(i)                                                                      \
+ *     ML99_PRIV_IF(ML99_PRIV_NAT_EQ(i, 0), v(done), ML99_call(COUNTDOWN, ML99_dec(v(i))))
+ * #define COUNTDOWN_ARITY 1
+ *
+ * #define PROGRAM ML99_call(COUNTDOWN, v(255)), ML99_call(COUNTDOWN, v(255))
+ *
+ * // A state.
+ * ML99_EVAL(PROGRAM)
+ *
+ * // done done
+ * ML99_EVAL_RESUME(ML99_EVAL(PROGRAM))
+ * @endcode
+ *
+ * @note The state is an opaque tuple; the only valid operation on it is #ML99_EVAL_RESUME. Passing
+ * anything else, e.g., the result of a completed metaprogram, results in undefined behaviour.
+ * @note Resuming a metaprogram keeps its results produced so far, so there is no need to evaluate
+ * it from the beginning with a larger `ML99_REC_DEPTH`.
+ */
+#define ML99_EVAL_RESUME(state) ML99_PRIV_EVAL_RESUME(state)
+
+/**
+ * Evaluates a metaprogram, like #ML99_EVAL, but results in a fatal error if it takes more than `n`
+ * reduction steps.
+ *
+ * The error names the metafunction being evaluated at the moment the fuel has run out. This makes
+ * a runaway metaprogram fail quickly and cheaply instead of exhausting the whole recursion engine.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/lang.h>
+ *
+ * #define LOOP_IMPL(x) ML99_call(LOOP, v(x))
+ *
+ * // !"Metalang99 error" (LOOP): "ran out of fuel"
+ * ML99_EVAL_WITH_FUEL(100, ML99_call(LOOP, v(~)))
+ * @endcode
+ *
+ * @note `n` must be a literal within [1; 1023]; otherwise, this macro results in a fatal error.
+ */
+#define ML99_EVAL_WITH_FUEL(n, ...) ML99_PRIV_EVAL_WITH_FUEL(n, __VA_ARGS__)
+
+/**
+ * Evaluates a metaprogram, like #ML99_EVAL, unless its result has been cached ahead of time under
+ * @p key.
+ *
+ * `scripts/eval-cache.py` preprocesses the given source files, collects the results of all their
+ * `ML99_EVAL_CACHED` sites, and writes them to a header. If `ML99_EVAL_CACHE_HEADER` names that
+ * header when Metalang99 is included (e.g., `-DML99_EVAL_CACHE_HEADER='"ml99_cache.h"'`),
+ * `ML99_EVAL_CACHED` expands to the cached result of @p key without performing any reduction step.
+ * If there is no cache header or it has no entry for @p key, the metaprogram is evaluated as usual.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/lang.h>
+ * #include <metalang99/list.h>
+ *
+ * // 1, 2, 3
+ * ML99_EVAL_CACHED(numbers, ML99_listUnwrapCommaSep(ML99_list(v(1, 2, 3))))
+ * @endcode
+ *
+ * @note @p key must be an identifier that is not a macro and is unique among the files of a cache.
+ * The result of the metaprogram must have balanced parentheses.
+ * @note The preprocessor cannot tell whether a cached result is stale: the cache header must be
+ * regenerated whenever the cached metaprograms, the macros they call, or Metalang99 change, e.g.,
+ * by a build rule that depends on them. `scripts/eval-cache.py --check` fails if it is out of date.
+ */
+#define ML99_EVAL_CACHED(key, ...) ML99_PRIV_EVAL_CACHED(key, __VA_ARGS__)
+
+/**
+ * 1 if `ML99_EVAL_CACHED(key, ...)` takes its result from the cache header, 0 otherwise.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/lang.h>
+ *
+ * // 0
+ * ML99_EVAL_IS_CACHED(numbers)
+ * @endcode
+ */
+#define ML99_EVAL_IS_CACHED(key) ML99_PRIV_EVAL_IS_CACHED(key)
+
+#ifdef ML99_PROFILE
+
+/**
+ * Evaluates a metaprogram and yields the number of reduction steps it has taken instead of its
+ * result.
+ *
+ * The result is an integral constant expression, so it can be checked by `ML99_ASSERT_UNEVAL` or
+ * printed at run-time.
+ *
+ * # Examples
+ *
+ * @code
+ * #define ML99_PROFILE
+ * #include <metalang99/lang.h>
+ *
+ * #define F_IMPL(x, y) v(x + y)
+ *
+ * // 5
+ * ML99_EVAL_STEPS(v(abc ~ 123), ML99_call(F, v(1, 2)))
+ * @endcode
+ *
+ * @note #ML99_EVAL_STEPS is defined only if `ML99_PROFILE` is defined before including
+ * Metalang99. Each reduction step corresponds to a single level of the recursion engine.
+ * @note If a metaprogram calls #ML99_abort, #ML99_EVAL_STEPS yields the result of the aborted
+ * evaluation, just as #ML99_EVAL does.
+ */
+#define ML99_EVAL_STEPS(...) ML99_PRIV_EVAL_STEPS(__VA_ARGS__)
+
+#endif // ML99_PROFILE
+
+#ifdef ML99_TRACE
+
+/**
+ * Evaluates a metaprogram and yields the sequence `(op1)(op2)...` of all the metafunctions it has
+ * called, in the order of their calls, instead of its result.
+ *
+ * To see which metafunctions take most of the time, put #ML99_EVAL_TRACE on a separate line,
+ * preprocess the file, and pass the output to `scripts/trace-histogram.py`, which prints the
+ * `name:count` table sorted by the number of calls.
+ *
+ * # Examples
+ *
+ * @code
+ * #define ML99_TRACE
+ * #include <metalang99/lang.h>
+ *
+ * #define F_IMPL(x) ML99_call(G, v(x))
+ * #define G_IMPL(x) v(x)
+ *
+ * // (F)(G)
+ * ML99_EVAL_TRACE(ML99_call(F, v(1)))
+ * @endcode
+ *
+ * @note #ML99_EVAL_TRACE is defined only if `ML99_TRACE` is defined before including Metalang99.
+ * `ML99_TRACE` implies `ML99_PROFILE`. Recording the trace slows down evaluation considerably, so
+ * use it only for diagnostics.
+ */
+#define ML99_EVAL_TRACE(...) ML99_PRIV_EVAL_TRACE(__VA_ARGS__)
+
+#endif // ML99_TRACE
+
 /**
  * Invokes a metafunction with arguments.
  */
@@ -93,6 +309,9 @@
 /**
  * Applies @p a and @p b to @p f.
  *
+ * The same as `ML99_appl(ML99_appl(f, a), b)`, but if @p f accepts at least two applications, both
+ * arguments are applied at once.
+ *
  * # Examples
  *
  * @code
@@ -137,6 +356,32 @@
  */
 #define ML99_compose(f, g) ML99_call(ML99_compose, f, g)
 
+/**
+ * Evaluates @p x once and applies @p f to the result.
+ *
+ * This is how a metaprogram binds the value of a term to a name: @p f is a metafunction (or a
+ * closure obtained from #ML99_appl) whose parameter is the name, and its body may use the value
+ * any number of times without evaluating @p x again.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/div.h>
+ * #include <metalang99/lang.h>
+ * #include <metalang99/list.h>
+ * #include <metalang99/nat.h>
+ *
+ * #define MEAN_IMPL(xs, n) ML99_div(ML99_listFoldl(v(ML99_add), v(0), v(xs)), v(n))
+ * #define MEAN_ARITY       2
+ *
+ * #define XS ML99_list(v(1, 2, 3, 10))
+ *
+ * // 4
+ * ML99_let(ML99_listLen(XS), ML99_appl(v(MEAN), XS))
+ * @endcode
+ */
+#define ML99_let(x, f) ML99_call(ML99_let, x, f)
+
 /**
  * A value that is pasted as-is; no evaluation occurs on provided arguments.
  */
@@ -227,6 +472,40 @@
 
 #define ML99_compose_IMPL(f, g)         ML99_appl2_IMPL(ML99_PRIV_compose, f, g)
 #define ML99_PRIV_compose_IMPL(f, g, x) ML99_appl(v(f), ML99_appl_IMPL(g, x))
+#define ML99_let_IMPL(x, f)             ML99_appl_IMPL(f, x)
+
+// ML99_EVAL_CACHED {
+
+#ifdef ML99_EVAL_CACHE_DUMP
+
+/* `scripts/eval-cache.py` defines `ML99_EVAL_CACHE_DUMP` and collects the results between these
+ * markers. */
+#define ML99_PRIV_EVAL_CACHED(key, ...)                                                            \
+    ML99_PRIV_EVAL_CACHE_BEGIN key ML99_PRIV_EVAL_CACHE_SEP ML99_EVAL(__VA_ARGS__)                 \
+        ML99_PRIV_EVAL_CACHE_END
+#define ML99_PRIV_EVAL_IS_CACHED(_key) 0
+
+#else
+
+/* A cache header defines `ML99_EVAL_CACHE_<key>` as the parenthesised result. The branches are
+ * selected by name, so a cache hit does not evaluate the metaprogram. */
+#define ML99_PRIV_EVAL_CACHED(key, ...)                                                            \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_EVAL_IS_CACHED(key),                                                             \
+        ML99_PRIV_EVAL_CACHE_HIT,                                                                  \
+        ML99_PRIV_EVAL_CACHE_MISS)                                                                 \
+    (key, __VA_ARGS__)
+#define ML99_PRIV_EVAL_IS_CACHED(key) ML99_PRIV_IS_TUPLE_FAST(ML99_PRIV_CAT(ML99_EVAL_CACHE_, key))
+
+#define ML99_PRIV_EVAL_CACHE_HIT(key, ...)   ML99_PRIV_UNTUPLE(ML99_PRIV_CAT(ML99_EVAL_CACHE_, key))
+#define ML99_PRIV_EVAL_CACHE_MISS(_key, ...) ML99_EVAL(__VA_ARGS__)
+
+#ifdef ML99_EVAL_CACHE_HEADER
+#include ML99_EVAL_CACHE_HEADER
+#endif
+
+#endif // ML99_EVAL_CACHE_DUMP
+// } (ML99_EVAL_CACHED)
 
 // Arity specifiers {
 
@@ -235,6 +514,7 @@
 #define ML99_appl3_ARITY   4
 #define ML99_appl4_ARITY   5
 #define ML99_compose_ARITY 2
+#define ML99_let_ARITY     2
 
 #define ML99_PRIV_compose_ARITY 3
 // } (Arity specifiers)
@@ -1,6 +1,7 @@
 #ifndef ML99_LANG_CLOSURE_H
 #define ML99_LANG_CLOSURE_H
 
+#include <metalang99/priv/logical.h>
 #include <metalang99/priv/util.h>
 
 #include <metalang99/nat/dec.h>
@@ -43,8 +44,60 @@
         ML99_callUneval(f, __VA_ARGS__),                                                           \
         v((ML99_PRIV_DEC(arity), f, __VA_ARGS__)))
 
-#define ML99_appl2_IMPL(f, a, b)       ML99_appl(ML99_appl_IMPL(f, a), v(b))
-#define ML99_appl3_IMPL(f, a, b, c)    ML99_appl(ML99_appl2_IMPL(f, a, b), v(c))
-#define ML99_appl4_IMPL(f, a, b, c, d) ML99_appl(ML99_appl3_IMPL(f, a, b, c), v(d))
+/*
+ * `ML99_applN(f, x1, ..., xN)` applies `f` to all the `N` arguments at once if `f` accepts at
+ * least `N` applications, where `k` is `f##_ARITY` or the arity of the closure `f`:
+ *  - If `k` is `N`, then just call `f` with its environment and `x1, ..., xN`.
+ *  - If `k` is greater than `N`, then return `(k - N, f, env..., x1, ..., xN)`.
+ *  - Otherwise, `f` evaluates to a new function after `k` applications, so apply `x1` first and
+ *    the rest of the arguments to the result.
+ */
+
+#define ML99_appl2_IMPL(f, a, b)       ML99_PRIV_APPL_N(2, f, a, b)
+#define ML99_appl3_IMPL(f, a, b, c)    ML99_PRIV_APPL_N(3, f, a, b, c)
+#define ML99_appl4_IMPL(f, a, b, c, d) ML99_PRIV_APPL_N(4, f, a, b, c, d)
+
+#define ML99_PRIV_APPL_N(n, f, ...)                                                                \
+    ML99_PRIV_IF(ML99_PRIV_IS_UNTUPLE_FAST(f), ML99_PRIV_APPL_N_F, ML99_PRIV_APPL_N_CLOSURE)       \
+    (n, f, __VA_ARGS__)
+
+#define ML99_PRIV_APPL_N_F(n, f, ...)                                                              \
+    ML99_PRIV_APPL_N_AUX(n, f##_ARITY, f, (__VA_ARGS__), (f, __VA_ARGS__))
+#define ML99_PRIV_APPL_N_CLOSURE(n, closure, ...)                                                  \
+    ML99_PRIV_APPL_N_CLOSURE_AUX(n, closure, (__VA_ARGS__), ML99_PRIV_EXPAND closure, __VA_ARGS__)
+#define ML99_PRIV_APPL_N_CLOSURE_AUX(...) ML99_PRIV_APPL_N_CLOSURE_AUX_AUX(__VA_ARGS__)
+#define ML99_PRIV_APPL_N_CLOSURE_AUX_AUX(n, closure, args, arity, f, ...)                          \
+    ML99_PRIV_APPL_N_AUX(n, arity, closure, args, (f, __VA_ARGS__))
+
+#define ML99_PRIV_APPL_N_AUX(n, arity, f, args, call)                                              \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_NAT_EQ(arity, n),                                                                \
+        ML99_PRIV_APPL_N_CALL,                                                                     \
+        ML99_PRIV_IF(                                                                              \
+            ML99_PRIV_CAT(ML99_PRIV_APPL_LESSER_THAN_, n)(arity),                                  \
+            ML99_PRIV_APPL_N_CHAIN,                                                                \
+            ML99_PRIV_APPL_N_PARTIAL))                                                             \
+    (n, arity, f, args, call)
+
+#define ML99_PRIV_APPL_N_CALL(_n, _arity, _f, _args, call) ML99_callUneval call
+#define ML99_PRIV_APPL_N_PARTIAL(n, arity, _f, _args, call)                                        \
+    v((ML99_PRIV_CAT(ML99_PRIV_APPL_SUB_, n)(arity), ML99_PRIV_EXPAND call))
+#define ML99_PRIV_APPL_N_CHAIN(n, _arity, f, args, _call)                                          \
+    ML99_PRIV_APPL_N_CHAIN_AUX(ML99_PRIV_CAT(ML99_PRIV_APPL_CHAIN_, n), f, ML99_PRIV_EXPAND args)
+#define ML99_PRIV_APPL_N_CHAIN_AUX(chain, ...) chain(__VA_ARGS__)
+
+#define ML99_PRIV_APPL_CHAIN_2(f, a, b)       ML99_appl(ML99_appl_IMPL(f, a), v(b))
+#define ML99_PRIV_APPL_CHAIN_3(f, a, b, c)    ML99_appl2(ML99_appl_IMPL(f, a), v(b), v(c))
+#define ML99_PRIV_APPL_CHAIN_4(f, a, b, c, d) ML99_appl3(ML99_appl_IMPL(f, a), v(b), v(c), v(d))
+
+#define ML99_PRIV_APPL_LESSER_THAN_2(arity) ML99_PRIV_NAT_EQ(arity, 1)
+#define ML99_PRIV_APPL_LESSER_THAN_3(arity)                                                        \
+    ML99_PRIV_OR(ML99_PRIV_APPL_LESSER_THAN_2(arity), ML99_PRIV_NAT_EQ(arity, 2))
+#define ML99_PRIV_APPL_LESSER_THAN_4(arity)                                                        \
+    ML99_PRIV_OR(ML99_PRIV_APPL_LESSER_THAN_3(arity), ML99_PRIV_NAT_EQ(arity, 3))
+
+#define ML99_PRIV_APPL_SUB_2(arity) ML99_PRIV_DEC(ML99_PRIV_DEC(arity))
+#define ML99_PRIV_APPL_SUB_3(arity) ML99_PRIV_DEC(ML99_PRIV_APPL_SUB_2(arity))
+#define ML99_PRIV_APPL_SUB_4(arity) ML99_PRIV_DEC(ML99_PRIV_APPL_SUB_3(arity))
 
 #endif // ML99_LANG_CLOSURE_H
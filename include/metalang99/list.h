@@ -6,10 +6,14 @@
 #ifndef ML99_LIST_H
 #define ML99_LIST_H
 
+#include <metalang99/variadics/slice.h>
+
 #include <metalang99/priv/util.h>
 
 #include <metalang99/choice.h>
 #include <metalang99/control.h>
+#include <metalang99/ident.h>
+#include <metalang99/identset.h>
 #include <metalang99/logical.h>
 #include <metalang99/nat.h>
 #include <metalang99/util.h>
@@ -98,8 +102,6 @@
 /**
  * Constructs a list from its arguments.
  *
- * At most 63 arguments are acceptable.
- *
  * # Examples
  *
  * @code
@@ -136,6 +138,147 @@
  */
 #define ML99_listFromTuples(f, ...) ML99_call(ML99_listFromTuples, f, __VA_ARGS__)
 
+/**
+ * Constructs a sized list from its arguments.
+ *
+ * A sized list keeps its length and stores its items in a single tuple, so that #ML99_listLen,
+ * #ML99_listGet, #ML99_listTake, and #ML99_listDrop take a constant number of reduction steps on
+ * it; #ML99_listTake and #ML99_listDrop then result in sized lists as well. The other list
+ * functions accept a sized list too, converting it by #ML99_listUnsized to a list constructed by
+ * `ML99_cons` and `ML99_nil` first. The empty sized list is `ML99_nil()`.
+ *
+ * At most #ML99_NAT_MAX arguments are acceptable.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/list.h>
+ *
+ * // 3
+ * ML99_listGet(v(2), ML99_sizedList(v(1, 2, 3)))
+ *
+ * // 2, 3
+ * ML99_listDrop(v(1), ML99_sizedList(v(1, 2, 3)))
+ * @endcode
+ */
+#define ML99_sizedList(...) ML99_call(ML99_sizedList, __VA_ARGS__)
+
+/**
+ * Converts @p list to a sized list.
+ *
+ * A sized @p list is returned as-is.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/list.h>
+ *
+ * // ML99_sizedList(v(1, 2, 3))
+ * ML99_listSized(ML99_list(v(1, 2, 3)))
+ * @endcode
+ */
+#define ML99_listSized(list) ML99_call(ML99_listSized, list)
+
+/**
+ * Converts the sized or lazy list @p list to a list constructed by `ML99_cons` and `ML99_nil`.
+ *
+ * Any other @p list is returned as-is.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/list.h>
+ *
+ * // ML99_list(v(1, 2, 3))
+ * ML99_listUnsized(ML99_sizedList(v(1, 2, 3)))
+ * @endcode
+ */
+#define ML99_listUnsized(list) ML99_call(ML99_listUnsized, list)
+
+/**
+ * Checks whether @p list is a sized list.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/list.h>
+ *
+ * // 1
+ * ML99_isSizedList(ML99_sizedList(v(1, 2, 3)))
+ *
+ * // 0
+ * ML99_isSizedList(ML99_list(v(1, 2, 3)))
+ * @endcode
+ */
+#define ML99_isSizedList(list) ML99_call(ML99_isSizedList, list)
+
+/**
+ * A lazy list of the natural numbers from @p from up to, but not including, @p to.
+ *
+ * Every list function accepts a lazy list, whose items are computed only when the function reaches
+ * them: #ML99_listHead, #ML99_listContains, #ML99_listTake, and #ML99_listTakeWhile, for instance,
+ * stop at the first item they do not need to go past, while a function that walks through the
+ * whole list, such as #ML99_listLen, does not terminate on an infinite one. #ML99_listUnsized
+ * converts a finite lazy list to one constructed by `ML99_cons` and `ML99_nil`.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/list.h>
+ * #include <metalang99/nat.h>
+ *
+ * // 0 + 1 + 2 + 3 + 4 = 10
+ * ML99_listFoldl(v(ML99_add), v(0), ML99_range(v(0), v(5)))
+ *
+ * // ML99_list(v(3, 4, 5))
+ * ML99_listUnsized(ML99_range(v(3), v(6)))
+ * @endcode
+ */
+#define ML99_range(from, to) ML99_call(ML99_range, from, to)
+
+/**
+ * An infinite lazy list of @p x, `f(x)`, `f(f(x))`, and so on.
+ *
+ * See #ML99_range for how the list functions treat lazy lists.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/list.h>
+ * #include <metalang99/nat.h>
+ *
+ * // ML99_list(v(1, 2, 4, 8))
+ * ML99_listTake(v(4), ML99_iterate(ML99_appl(v(ML99_mul), v(2)), v(1)))
+ *
+ * // ML99_list(v(1, 2, 4, 8))
+ * ML99_listTakeWhile(
+ *     ML99_appl(v(ML99_greater), v(10)),
+ *     ML99_iterate(ML99_appl(v(ML99_mul), v(2)), v(1)))
+ * @endcode
+ */
+#define ML99_iterate(f, x) ML99_call(ML99_iterate, f, x)
+
+/**
+ * A lazy list of @p x, `next(x)`, `next(next(x))`, and so on, up to, but not including, the first
+ * item `y` for which `done(y)` is true.
+ *
+ * See #ML99_range for how the list functions treat lazy lists.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/list.h>
+ * #include <metalang99/nat.h>
+ *
+ * // ML99_list(v(20, 15, 10, 5))
+ * ML99_listUnsized(ML99_generator(
+ *     v(20),
+ *     ML99_appl(ML99_flip(v(ML99_sub)), v(5)),
+ *     ML99_appl(v(ML99_natEq), v(0))))
+ * @endcode
+ */
+#define ML99_generator(x, next, done) ML99_call(ML99_generator, x, next, done)
+
 /**
  * Computes the length of @p list.
  *
@@ -179,7 +322,7 @@
  * # Examples
  *
  * @code
- * #include <metalang99/util.h>
+ * #include <metalang99/list.h>
  *
  * // Literally 1, 2, 3
  * ML99_LIST_EVAL_COMMA_SEP(ML99_list(v(1, 2, 3)))
@@ -503,6 +646,41 @@
  */
 #define ML99_listFilter(f, list) ML99_call(ML99_listFilter, f, list)
 
+/**
+ * A more efficient version of `ML99_listUnwrap(ML99_listFilter(f, list))`.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/list.h>
+ * #include <metalang99/nat.h>
+ *
+ * // 9 11 6
+ * ML99_listFilterInPlace(ML99_appl(v(ML99_lesser), v(5)), ML99_list(v(9, 1, 11, 6, 0, 4)))
+ * @endcode
+ */
+#define ML99_listFilterInPlace(f, list) ML99_call(ML99_listFilterInPlace, f, list)
+
+/**
+ * Maps @p list with @p f, which evaluates to either `ML99_just(y)` or `ML99_nothing()`, keeping
+ * only the `y` values.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/list.h>
+ * #include <metalang99/maybe.h>
+ * #include <metalang99/nat.h>
+ *
+ * #define F_IMPL(x) ML99_if(ML99_natEq(v(x), v(0)), ML99_nothing(), ML99_just(ML99_dec(v(x))))
+ * #define F_ARITY   1
+ *
+ * // 0, 2
+ * ML99_listFilterMap(v(F), ML99_list(v(1, 0, 3, 0)))
+ * @endcode
+ */
+#define ML99_listFilterMap(f, list) ML99_call(ML99_listFilterMap, f, list)
+
 /**
  * Tests @p list and @p other for equality.
  *
@@ -521,6 +699,47 @@
  */
 #define ML99_listEq(cmp, list, other) ML99_call(ML99_listEq, cmp, list, other)
 
+/**
+ * A more efficient version of `ML99_listEq(v(ML99_natEq), list, other)`.
+ *
+ * Several items are compared per reduction step, and the comparison stops at the first mismatch.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/list.h>
+ *
+ * // 0
+ * ML99_listEqNat(ML99_list(v(1, 2, 3)), ML99_list(v(1, 2, 4)))
+ *
+ * // 1
+ * ML99_listEqNat(ML99_list(v(1, 2, 3)), ML99_list(v(1, 2, 3)))
+ * @endcode
+ */
+#define ML99_listEqNat(list, other) ML99_call(ML99_listEqNat, list, other)
+
+/**
+ * A more efficient version of `ML99_listEq(ML99_appl(v(ML99_identEq), v(prefix)), list, other)`.
+ *
+ * Several items are compared per reduction step, and the comparison stops at the first mismatch.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/list.h>
+ *
+ * #define FOO_x_x ()
+ * #define FOO_y_y ()
+ *
+ * // 1
+ * ML99_listEqIdent(v(FOO_), ML99_list(v(x, y)), ML99_list(v(x, y)))
+ *
+ * // 0
+ * ML99_listEqIdent(v(FOO_), ML99_list(v(x, y)), ML99_list(v(x)))
+ * @endcode
+ */
+#define ML99_listEqIdent(prefix, list, other) ML99_call(ML99_listEqIdent, prefix, list, other)
+
 /**
  * Checks whether @p item resides in @p list.
  *
@@ -539,6 +758,74 @@
  */
 #define ML99_listContains(cmp, item, list) ML99_call(ML99_listContains, cmp, item, list)
 
+/**
+ * A more efficient version of `ML99_listContains(v(ML99_natEq), item, list)`.
+ *
+ * Several items are compared per reduction step, and the search stops at the first match.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/list.h>
+ *
+ * // 1
+ * ML99_listContainsNat(v(3), ML99_list(v(1, 2, 3)))
+ *
+ * // 0
+ * ML99_listContainsNat(v(4), ML99_list(v(1, 2, 3)))
+ * @endcode
+ */
+#define ML99_listContainsNat(item, list) ML99_call(ML99_listContainsNat, item, list)
+
+/**
+ * A more efficient version of `ML99_listContains(ML99_appl(v(ML99_identEq), v(prefix)), item,
+ * list)`.
+ *
+ * Several items are compared per reduction step, and the search stops at the first match.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/list.h>
+ *
+ * #define FOO_x_x ()
+ * #define FOO_y_y ()
+ * #define FOO_z_z ()
+ *
+ * // 1
+ * ML99_listContainsIdent(v(FOO_), v(y), ML99_list(v(x, y, z)))
+ *
+ * // 0
+ * ML99_listContainsIdent(v(FOO_), v(w), ML99_list(v(x, y, z)))
+ * @endcode
+ */
+#define ML99_listContainsIdent(prefix, item, list)                                                 \
+    ML99_call(ML99_listContainsIdent, prefix, item, list)
+
+/**
+ * Removes the duplicates of the identifiers of @p list, keeping the first occurrence of each of
+ * them.
+ *
+ * The identifiers are compared by `ML99_IDENT_EQ(prefix, x, y)` and accumulated into an
+ * #ML99_identSet, so that an item takes a single reduction step while fewer than eight distinct
+ * identifiers precede it, and one more step per eight of them otherwise. @p list must hold at most
+ * #ML99_NAT_MAX distinct identifiers.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/list.h>
+ *
+ * #define FOO_x_x ()
+ * #define FOO_y_y ()
+ * #define FOO_z_z ()
+ *
+ * // ML99_list(v(x, y, z))
+ * ML99_listDedup(v(FOO_), ML99_list(v(x, y, x, z, y, x)))
+ * @endcode
+ */
+#define ML99_listDedup(prefix, list) ML99_call(ML99_listDedup, prefix, list)
+
 /**
  * Extracts the prefix of @p list of the length @p n. If @p n is greater than the length of @p list,
  * the whole @p list is returned.
@@ -662,6 +949,27 @@
  */
 #define ML99_listPartition(f, list) ML99_call(ML99_listPartition, f, list)
 
+/**
+ * Returns an @p n -place tuple of lists: each item `x` of @p list goes to the list at the index
+ * `f(x)`, and the order of the items is preserved within each list.
+ *
+ * @p n must be positive, and `f(x)` must be lesser than @p n.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/div.h>
+ * #include <metalang99/list.h>
+ * #include <metalang99/util.h>
+ *
+ * #define F ML99_appl(ML99_flip(v(ML99_mod)), v(3))
+ *
+ * // ML99_tuple(ML99_list(v(3, 6)), ML99_list(v(1, 4, 7)), ML99_list(v(2, 5)))
+ * ML99_listPartitionBy(v(3), F, ML99_list(v(1, 2, 3, 4, 5, 6, 7)))
+ * @endcode
+ */
+#define ML99_listPartitionBy(n, f, list) ML99_call(ML99_listPartitionBy, n, f, list)
+
 /**
  * Applies all the items in @p list to @p f.
  *
@@ -685,10 +993,110 @@
  */
 #define ML99_listAppl(f, list) ML99_call(ML99_listAppl, f, list)
 
-#define ML99_CONS(x, xs)   ML99_CHOICE(cons, x, xs)
-#define ML99_NIL(...)      ML99_CHOICE(nil, ~)
+/**
+ * Sorts @p list by the predicate @p f, keeping equal items in their original order.
+ *
+ * `f(x, y)` must tell whether `x` goes strictly before `y`, as #ML99_lesser does for an ascending
+ * order. Sorting takes O(n log n) reduction steps and applications of @p f.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/list.h>
+ * #include <metalang99/nat.h>
+ *
+ * // ML99_list(v(1, 2, 3, 5, 8))
+ * ML99_listSort(v(ML99_lesser), ML99_list(v(5, 1, 8, 3, 2)))
+ *
+ * // ML99_list(v(8, 5, 3, 2, 1))
+ * ML99_listSort(v(ML99_greater), ML99_list(v(5, 1, 8, 3, 2)))
+ * @endcode
+ */
+#define ML99_listSort(f, list) ML99_call(ML99_listSort, f, list)
+
+/**
+ * Sorts the natural numbers in @p list in ascending order.
+ *
+ * The same as `ML99_listSort(v(ML99_lesser), list)`, except that the comparisons take no
+ * reduction steps of their own, so that every merged item takes a single step.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/list.h>
+ *
+ * // ML99_list(v(1, 2, 3, 5, 8))
+ * ML99_listSortNat(ML99_list(v(5, 1, 8, 3, 2)))
+ * @endcode
+ */
+#define ML99_listSortNat(list) ML99_call(ML99_listSortNat, list)
+
+/**
+ * Passes each item of @p list through a sequence of stages, in a single traversal.
+ *
+ * A stage is #ML99_mapStage, #ML99_filterStage, or #ML99_foldStage, which may only be the last
+ * one. Unlike a chain of #ML99_listMap, #ML99_listFilter, and #ML99_listFoldl, no intermediate
+ * list is built and matched again: the result is the fold accumulator if the last stage is
+ * #ML99_foldStage, or the list of the items that went through all the stages otherwise.
+ *
+ * At least one stage must be given.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/list.h>
+ * #include <metalang99/nat.h>
+ *
+ * // ML99_list(v(10, 12, 14))
+ * ML99_listPipe(
+ *     ML99_list(v(1, 5, 2, 6, 7)),
+ *     ML99_filterStage(ML99_appl(v(ML99_lesser), v(4))),
+ *     ML99_mapStage(ML99_appl(v(ML99_mul), v(2))))
+ *
+ * // 5 + 6 + 7 + 3 = 21
+ * ML99_listPipe(
+ *     ML99_list(v(1, 5, 2, 6, 7)),
+ *     ML99_filterStage(ML99_appl(v(ML99_lesser), v(4))),
+ *     ML99_foldStage(v(ML99_add), v(3)))
+ * @endcode
+ */
+#define ML99_listPipe(list, ...) ML99_call(ML99_listPipe, list, __VA_ARGS__)
+
+/**
+ * A stage of #ML99_listPipe that maps an item `x` to `f(x)`.
+ */
+#define ML99_mapStage(f) ML99_call(ML99_mapStage, f)
+
+/**
+ * A stage of #ML99_listPipe that keeps only the items `x` for which `f(x)` is true.
+ */
+#define ML99_filterStage(f) ML99_call(ML99_filterStage, f)
+
+/**
+ * The last stage of #ML99_listPipe, which folds the items into `f(... f(f(init, x1), x2) ...)`.
+ */
+#define ML99_foldStage(f, init) ML99_call(ML99_foldStage, f, init)
+
+#define ML99_CONS(x, xs) ML99_CHOICE(cons, x, xs)
+#define ML99_NIL(...)    ML99_CHOICE(nil, ~)
+
+/**
+ * The plain version of #ML99_isCons.
+ *
+ * @p list must not be a lazy list: whether it is empty is known only once its first item is
+ * computed, which #ML99_isCons does.
+ */
 #define ML99_IS_CONS(list) ML99_NOT(ML99_IS_NIL(list))
-#define ML99_IS_NIL(list)  ML99_PRIV_IS_NIL(list)
+
+/**
+ * The plain version of #ML99_isNil.
+ *
+ * @p list must not be a lazy list: whether it is empty is known only once its first item is
+ * computed, which #ML99_isNil does.
+ */
+#define ML99_IS_NIL(list) ML99_PRIV_IS_NIL(list)
+
+#define ML99_IS_SIZED_LIST(list) ML99_PRIV_IS_SIZED_LIST(list)
 
 #ifndef DOXYGEN_IGNORE
 
@@ -698,56 +1106,120 @@
 #define ML99_listHead_IMPL(list)             ML99_match_IMPL(list, ML99_PRIV_listHead_)
 #define ML99_PRIV_listHead_nil_IMPL(_)       ML99_PRIV_EMPTY_LIST_ERROR(listHead)
 #define ML99_PRIV_listHead_cons_IMPL(x, _xs) v(x)
+#define ML99_PRIV_listHead_sized_IMPL(n, items)                                                    \
+    ML99_PRIV_listSizedMatch_IMPL(ML99_PRIV_listHead_, n, items)
+#define ML99_PRIV_listHead_gen_IMPL(x, next, done)                                                 \
+    ML99_PRIV_listGenMatch_IMPL(ML99_PRIV_listHead_, x, next, done)
 
 #define ML99_listTail_IMPL(list)             ML99_match_IMPL(list, ML99_PRIV_listTail_)
 #define ML99_PRIV_listTail_nil_IMPL(_)       ML99_PRIV_EMPTY_LIST_ERROR(listTail)
 #define ML99_PRIV_listTail_cons_IMPL(_x, xs) v(xs)
-
-#define ML99_listLast_IMPL(list)       ML99_match_IMPL(list, ML99_PRIV_listLast_)
-#define ML99_PRIV_listLast_nil_IMPL(_) ML99_PRIV_EMPTY_LIST_ERROR(listLast)
-#define ML99_PRIV_listLast_cons_IMPL(x, xs)                                                        \
-    ML99_PRIV_IF(ML99_IS_NIL(xs), v(x), ML99_listLast_IMPL(xs))
-
-#define ML99_listInit_IMPL(list)       ML99_match_IMPL(list, ML99_PRIV_listInit_)
-#define ML99_PRIV_listInit_nil_IMPL(_) ML99_PRIV_EMPTY_LIST_ERROR(listInit)
-#define ML99_PRIV_listInit_cons_IMPL(x, xs)                                                        \
-    ML99_PRIV_IF(ML99_IS_NIL(xs), v(ML99_NIL()), ML99_cons(v(x), ML99_listInit_IMPL(xs)))
+#define ML99_PRIV_listTail_sized_IMPL(n, items)                                                    \
+    ML99_PRIV_listSizedMatch_IMPL(ML99_PRIV_listTail_, n, items)
+#define ML99_PRIV_listTail_gen_IMPL(x, next, done)                                                 \
+    ML99_PRIV_listGenMatch_IMPL(ML99_PRIV_listTail_, x, next, done)
+
+/* `ML99_listLast` and `ML99_listInit` match the rest `xs` of each cell by
+ * `ML99_PRIV_list(Last, Init)After_` with its item `x` passed along, so that the cell following `x`
+ * is peeled only once even if `xs` is a lazy list. */
+
+#define ML99_listLast_IMPL(list)            ML99_match_IMPL(list, ML99_PRIV_listLast_)
+#define ML99_PRIV_listLast_nil_IMPL(_)      ML99_PRIV_EMPTY_LIST_ERROR(listLast)
+#define ML99_PRIV_listLast_cons_IMPL(x, xs) ML99_PRIV_listLastAfter_IMPL(x, xs)
+#define ML99_PRIV_listLast_sized_IMPL(n, items)                                                    \
+    ML99_PRIV_listSizedMatch_IMPL(ML99_PRIV_listLast_, n, items)
+#define ML99_PRIV_listLast_gen_IMPL(x, next, done)                                                 \
+    ML99_PRIV_listGenMatch_IMPL(ML99_PRIV_listLast_, x, next, done)
+
+#define ML99_PRIV_listLastAfter_IMPL(x, list)                                                      \
+    ML99_matchWithArgs_IMPL(list, ML99_PRIV_listLastAfter_, x)
+#define ML99_PRIV_listLastAfter_nil_IMPL(_, x)       v(x)
+#define ML99_PRIV_listLastAfter_cons_IMPL(y, ys, _x) ML99_PRIV_listLastAfter_IMPL(y, ys)
+#define ML99_PRIV_listLastAfter_sized_IMPL(n, items, _x)                                           \
+    ML99_PRIV_listSizedMatch_IMPL(ML99_PRIV_listLast_, n, items)
+#define ML99_PRIV_listLastAfter_gen_IMPL(y, next, done, x)                                         \
+    ML99_PRIV_listGenUncons_IMPL(ML99_PRIV_listLastAfter_, y, next, done, x)
+
+#define ML99_listInit_IMPL(list)            ML99_match_IMPL(list, ML99_PRIV_listInit_)
+#define ML99_PRIV_listInit_nil_IMPL(_)      ML99_PRIV_EMPTY_LIST_ERROR(listInit)
+#define ML99_PRIV_listInit_cons_IMPL(x, xs) ML99_PRIV_listInitAfter_IMPL(x, xs)
+#define ML99_PRIV_listInit_sized_IMPL(n, items)                                                    \
+    ML99_PRIV_listSizedMatch_IMPL(ML99_PRIV_listInit_, n, items)
+#define ML99_PRIV_listInit_gen_IMPL(x, next, done)                                                 \
+    ML99_PRIV_listGenMatch_IMPL(ML99_PRIV_listInit_, x, next, done)
+
+#define ML99_PRIV_listInitAfter_IMPL(x, list)                                                      \
+    ML99_matchWithArgs_IMPL(list, ML99_PRIV_listInitAfter_, x)
+#define ML99_PRIV_listInitAfter_nil_IMPL(_, _x) v(ML99_NIL())
+#define ML99_PRIV_listInitAfter_cons_IMPL(y, ys, x)                                                \
+    ML99_cons(v(x), ML99_PRIV_listInitAfter_IMPL(y, ys))
+#define ML99_PRIV_listInitAfter_sized_IMPL(n, items, x)                                            \
+    ML99_cons(v(x), ML99_PRIV_listSizedMatch_IMPL(ML99_PRIV_listInit_, n, items))
+#define ML99_PRIV_listInitAfter_gen_IMPL(y, next, done, x)                                         \
+    ML99_PRIV_listGenUncons_IMPL(ML99_PRIV_listInitAfter_, y, next, done, x)
 
 // ML99_list_IMPL {
 
-#define ML99_list_IMPL(...)                                                                        \
-    ML99_PRIV_listProgress_IMPL(ML99_VARIADICS_COUNT(__VA_ARGS__), __VA_ARGS__, ~)
+// The items are followed by a sentinel and consumed 32 at a time, so that any number of them is
+// acceptable; the last chunk, of at most 32 items, is prepended to `ML99_NIL()` at once.
+#define ML99_list_IMPL(...) ML99_PRIV_listProgress_IMPL(__VA_ARGS__, ~)
 
-// Last 4 recursion steps unrolled.
-#define ML99_PRIV_listProgress_IMPL(count, ...)                                                    \
+#define ML99_PRIV_listProgress_IMPL(...)                                                           \
     ML99_PRIV_IF(                                                                                  \
-        ML99_NAT_EQ(count, 4),                                                                     \
-        ML99_PRIV_listDone_4,                                                                      \
-        ML99_PRIV_IF(                                                                              \
-            ML99_NAT_EQ(count, 3),                                                                 \
-            ML99_PRIV_listDone_3,                                                                  \
-            ML99_PRIV_IF(                                                                          \
-                ML99_NAT_EQ(count, 2),                                                             \
-                ML99_PRIV_listDone_2,                                                              \
-                ML99_PRIV_IF(                                                                      \
-                    ML99_NAT_EQ(count, 1),                                                         \
-                    ML99_PRIV_listDone_1,                                                          \
-                    ML99_PRIV_IF(                                                                  \
-                        ML99_NAT_EQ(count, 0),                                                     \
-                        ML99_PRIV_listDone_0,                                                      \
-                        ML99_PRIV_listProgressAux)))))                                             \
-    (count, __VA_ARGS__)
-
-#define ML99_PRIV_listProgressAux(count, x, ...)                                                   \
-    ML99_cons(v(x), ML99_callUneval(ML99_PRIV_listProgress, ML99_DEC(count), __VA_ARGS__))
-
-#define ML99_PRIV_listDone_0(_count, _)       v(ML99_NIL())
-#define ML99_PRIV_listDone_1(_count, a, _)    v(ML99_CONS(a, ML99_NIL()))
-#define ML99_PRIV_listDone_2(_count, a, b, _) v(ML99_CONS(a, ML99_CONS(b, ML99_NIL())))
-#define ML99_PRIV_listDone_3(_count, a, b, c, _)                                                   \
-    v(ML99_CONS(a, ML99_CONS(b, ML99_CONS(c, ML99_NIL()))))
-#define ML99_PRIV_listDone_4(_count, a, b, c, d, _)                                                \
-    v(ML99_CONS(a, ML99_CONS(b, ML99_CONS(c, ML99_CONS(d, ML99_NIL())))))
+        ML99_PRIV_VARIADICS_MORE_THAN_32(__VA_ARGS__),                                             \
+        ML99_PRIV_listChunk,                                                                       \
+        ML99_PRIV_listLastChunk)                                                                   \
+    (__VA_ARGS__)
+
+#define ML99_PRIV_listChunk(                                                                       \
+    _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20,     \
+    _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, ...)                               \
+    ML99_call(                                                                                     \
+        ML99_PRIV_listPrependChunk,                                                                \
+        ML99_callUneval(ML99_PRIV_listProgress, __VA_ARGS__),                                      \
+        v(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19,    \
+          _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32))
+#define ML99_PRIV_listLastChunk(...)                                                               \
+    v(ML99_PRIV_LIST_CONS_N(ML99_DEC(ML99_VARIADICS_COUNT(__VA_ARGS__)), ML99_NIL(), __VA_ARGS__))
+
+#define ML99_PRIV_listPrependChunk_IMPL(xs, ...) v(ML99_PRIV_LIST_CONS_32(xs, __VA_ARGS__, ~))
+
+// `ML99_PRIV_LIST_CONS_n(xs, x1, ..., xn, ...)` is `ML99_CONS(x1, ..., ML99_CONS(xn, xs))`.
+#define ML99_PRIV_LIST_CONS_N(n, xs, ...) ML99_PRIV_CAT(ML99_PRIV_LIST_CONS_, n)(xs, __VA_ARGS__)
+
+#define ML99_PRIV_LIST_CONS_0(xs, ...)     xs
+#define ML99_PRIV_LIST_CONS_1(xs, x, ...)  ML99_CONS(x, ML99_PRIV_LIST_CONS_0(xs, __VA_ARGS__))
+#define ML99_PRIV_LIST_CONS_2(xs, x, ...)  ML99_CONS(x, ML99_PRIV_LIST_CONS_1(xs, __VA_ARGS__))
+#define ML99_PRIV_LIST_CONS_3(xs, x, ...)  ML99_CONS(x, ML99_PRIV_LIST_CONS_2(xs, __VA_ARGS__))
+#define ML99_PRIV_LIST_CONS_4(xs, x, ...)  ML99_CONS(x, ML99_PRIV_LIST_CONS_3(xs, __VA_ARGS__))
+#define ML99_PRIV_LIST_CONS_5(xs, x, ...)  ML99_CONS(x, ML99_PRIV_LIST_CONS_4(xs, __VA_ARGS__))
+#define ML99_PRIV_LIST_CONS_6(xs, x, ...)  ML99_CONS(x, ML99_PRIV_LIST_CONS_5(xs, __VA_ARGS__))
+#define ML99_PRIV_LIST_CONS_7(xs, x, ...)  ML99_CONS(x, ML99_PRIV_LIST_CONS_6(xs, __VA_ARGS__))
+#define ML99_PRIV_LIST_CONS_8(xs, x, ...)  ML99_CONS(x, ML99_PRIV_LIST_CONS_7(xs, __VA_ARGS__))
+#define ML99_PRIV_LIST_CONS_9(xs, x, ...)  ML99_CONS(x, ML99_PRIV_LIST_CONS_8(xs, __VA_ARGS__))
+#define ML99_PRIV_LIST_CONS_10(xs, x, ...) ML99_CONS(x, ML99_PRIV_LIST_CONS_9(xs, __VA_ARGS__))
+#define ML99_PRIV_LIST_CONS_11(xs, x, ...) ML99_CONS(x, ML99_PRIV_LIST_CONS_10(xs, __VA_ARGS__))
+#define ML99_PRIV_LIST_CONS_12(xs, x, ...) ML99_CONS(x, ML99_PRIV_LIST_CONS_11(xs, __VA_ARGS__))
+#define ML99_PRIV_LIST_CONS_13(xs, x, ...) ML99_CONS(x, ML99_PRIV_LIST_CONS_12(xs, __VA_ARGS__))
+#define ML99_PRIV_LIST_CONS_14(xs, x, ...) ML99_CONS(x, ML99_PRIV_LIST_CONS_13(xs, __VA_ARGS__))
+#define ML99_PRIV_LIST_CONS_15(xs, x, ...) ML99_CONS(x, ML99_PRIV_LIST_CONS_14(xs, __VA_ARGS__))
+#define ML99_PRIV_LIST_CONS_16(xs, x, ...) ML99_CONS(x, ML99_PRIV_LIST_CONS_15(xs, __VA_ARGS__))
+#define ML99_PRIV_LIST_CONS_17(xs, x, ...) ML99_CONS(x, ML99_PRIV_LIST_CONS_16(xs, __VA_ARGS__))
+#define ML99_PRIV_LIST_CONS_18(xs, x, ...) ML99_CONS(x, ML99_PRIV_LIST_CONS_17(xs, __VA_ARGS__))
+#define ML99_PRIV_LIST_CONS_19(xs, x, ...) ML99_CONS(x, ML99_PRIV_LIST_CONS_18(xs, __VA_ARGS__))
+#define ML99_PRIV_LIST_CONS_20(xs, x, ...) ML99_CONS(x, ML99_PRIV_LIST_CONS_19(xs, __VA_ARGS__))
+#define ML99_PRIV_LIST_CONS_21(xs, x, ...) ML99_CONS(x, ML99_PRIV_LIST_CONS_20(xs, __VA_ARGS__))
+#define ML99_PRIV_LIST_CONS_22(xs, x, ...) ML99_CONS(x, ML99_PRIV_LIST_CONS_21(xs, __VA_ARGS__))
+#define ML99_PRIV_LIST_CONS_23(xs, x, ...) ML99_CONS(x, ML99_PRIV_LIST_CONS_22(xs, __VA_ARGS__))
+#define ML99_PRIV_LIST_CONS_24(xs, x, ...) ML99_CONS(x, ML99_PRIV_LIST_CONS_23(xs, __VA_ARGS__))
+#define ML99_PRIV_LIST_CONS_25(xs, x, ...) ML99_CONS(x, ML99_PRIV_LIST_CONS_24(xs, __VA_ARGS__))
+#define ML99_PRIV_LIST_CONS_26(xs, x, ...) ML99_CONS(x, ML99_PRIV_LIST_CONS_25(xs, __VA_ARGS__))
+#define ML99_PRIV_LIST_CONS_27(xs, x, ...) ML99_CONS(x, ML99_PRIV_LIST_CONS_26(xs, __VA_ARGS__))
+#define ML99_PRIV_LIST_CONS_28(xs, x, ...) ML99_CONS(x, ML99_PRIV_LIST_CONS_27(xs, __VA_ARGS__))
+#define ML99_PRIV_LIST_CONS_29(xs, x, ...) ML99_CONS(x, ML99_PRIV_LIST_CONS_28(xs, __VA_ARGS__))
+#define ML99_PRIV_LIST_CONS_30(xs, x, ...) ML99_CONS(x, ML99_PRIV_LIST_CONS_29(xs, __VA_ARGS__))
+#define ML99_PRIV_LIST_CONS_31(xs, x, ...) ML99_CONS(x, ML99_PRIV_LIST_CONS_30(xs, __VA_ARGS__))
+#define ML99_PRIV_LIST_CONS_32(xs, x, ...) ML99_CONS(x, ML99_PRIV_LIST_CONS_31(xs, __VA_ARGS__))
 // } (ML99_list_IMPL)
 
 // ML99_listFromTuples_IMPL {
@@ -757,15 +1229,21 @@
 
 #define ML99_PRIV_listFromTuplesProgress_IMPL(f, count, x, ...)                                    \
     ML99_PRIV_IF(                                                                                  \
-        ML99_IS_UNTUPLE(x),                                                                        \
+        ML99_PRIV_IS_UNTUPLE(x),                                                                   \
         ML99_PRIV_listFromTuplesError,                                                             \
         ML99_PRIV_listFromTuplesProgressAux)                                                       \
     (f, count, x, __VA_ARGS__)
 
-#define ML99_PRIV_listFromTuplesError(_f, _count, x, ...) ML99_PRIV_NOT_TUPLE_ERROR(x)
+// clang-format off
+#define ML99_PRIV_listFromTuplesError(_f, _count, x, ...) \
+    ML99_PRIV_IF( \
+        ML99_PRIV_IS_DOUBLE_TUPLE_BEGINNING(x), \
+        ML99_fatal(ML99_listFromTuples, x must be (x1, ..., xN), did you miss a comma?), \
+        ML99_fatal(ML99_listFromTuples, x must be (x1, ..., xN)))
+// clang-format on
 #define ML99_PRIV_listFromTuplesProgressAux(f, count, x, ...)                                      \
     ML99_cons(                                                                                     \
-        ML99_appl_IMPL(f, ML99_UNTUPLE(x)),                                                        \
+        ML99_appl_IMPL(f, ML99_PRIV_EXPAND x),                                                     \
         ML99_PRIV_IF(                                                                              \
             ML99_NAT_EQ(count, 1),                                                                 \
             v(ML99_NIL()),                                                                         \
@@ -775,63 +1253,522 @@
 #define ML99_listLen_IMPL(list)             ML99_match_IMPL(list, ML99_PRIV_listLen_)
 #define ML99_PRIV_listLen_nil_IMPL(_)       v(0)
 #define ML99_PRIV_listLen_cons_IMPL(_x, xs) ML99_inc(ML99_listLen_IMPL(xs))
+#define ML99_PRIV_listLen_sized_IMPL(n, _)  v(n)
+#define ML99_PRIV_listLen_gen_IMPL(x, next, done)                                                  \
+    ML99_PRIV_listGenMatch_IMPL(ML99_PRIV_listLen_, x, next, done)
+
+// Sized lists {
+
+// The items are counted 32 at a time, in the same way as `ML99_list` consumes them.
+#define ML99_sizedList_IMPL(...) ML99_PRIV_sizedListCount_IMPL((__VA_ARGS__), 0, __VA_ARGS__, ~)
+
+#define ML99_PRIV_sizedListCount_IMPL(items, n, ...)                                               \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_VARIADICS_MORE_THAN_32(__VA_ARGS__),                                             \
+        ML99_PRIV_sizedListCountChunk,                                                             \
+        ML99_PRIV_sizedListCountDone)                                                              \
+    (items, n, __VA_ARGS__)
+
+#define ML99_PRIV_sizedListCountChunk(items, n, ...)                                               \
+    ML99_callUneval(                                                                               \
+        ML99_PRIV_sizedListCount,                                                                  \
+        items,                                                                                     \
+        ML99_PRIV_NAT_ADD(n, 32),                                                                  \
+        ML99_PRIV_DROP_32(__VA_ARGS__))
+#define ML99_PRIV_sizedListCountDone(items, n, ...)                                                \
+    v(ML99_PRIV_SIZED_LIST(                                                                        \
+        ML99_PRIV_NAT_ADD(n, ML99_DEC(ML99_VARIADICS_COUNT(__VA_ARGS__))),                         \
+        items))
+
+#define ML99_listSized_IMPL(list)                ML99_match_IMPL(list, ML99_PRIV_listSized_)
+#define ML99_PRIV_listSized_nil_IMPL(_)          v(ML99_NIL())
+#define ML99_PRIV_listSized_sized_IMPL(n, items) v(ML99_PRIV_SIZED_LIST(n, items))
+#define ML99_PRIV_listSized_cons_IMPL(x, xs)                                                       \
+    ML99_call(                                                                                     \
+        ML99_PRIV_listSizedAux,                                                                    \
+        ML99_listLen_IMPL(ML99_CONS(x, xs)),                                                       \
+        ML99_listUnwrapCommaSep_IMPL(ML99_CONS(x, xs)))
+
+#define ML99_PRIV_listSized_gen_IMPL(x, next, done)                                                \
+    ML99_call(ML99_listSized, ML99_PRIV_listUnsized_gen_IMPL(x, next, done))
+
+#define ML99_PRIV_listSizedAux_IMPL(n, ...) v(ML99_PRIV_SIZED_LIST(n, (__VA_ARGS__)))
+
+#define ML99_listUnsized_IMPL(list)                 ML99_match_IMPL(list, ML99_PRIV_listUnsized_)
+#define ML99_PRIV_listUnsized_nil_IMPL(_)           v(ML99_NIL())
+#define ML99_PRIV_listUnsized_cons_IMPL(x, xs)      v(ML99_CONS(x, xs))
+#define ML99_PRIV_listUnsized_sized_IMPL(_n, items) ML99_list_IMPL(ML99_PRIV_EXPAND items)
+#define ML99_PRIV_listUnsized_gen_IMPL(x, next, done)                                              \
+    ML99_PRIV_listGenUncons_IMPL(ML99_PRIV_listUnsizedGen_, x, next, done, ~)
+#define ML99_PRIV_listUnsizedGen_nil_IMPL(_, _tilde) v(ML99_NIL())
+#define ML99_PRIV_listUnsizedGen_cons_IMPL(x, xs, _tilde)                                          \
+    ML99_cons(v(x), ML99_listUnsized_IMPL(xs))
+
+#define ML99_isSizedList_IMPL(list) v(ML99_IS_SIZED_LIST(list))
+
+#define ML99_PRIV_SIZED_LIST(n, items) ML99_CHOICE(sized, n, items)
+
+#define ML99_PRIV_IS_SIZED_LIST(list)                                                              \
+    ML99_DETECT_IDENT(ML99_PRIV_IS_SIZED_LIST_, ML99_CHOICE_TAG(list))
+#define ML99_PRIV_IS_SIZED_LIST_sized ()
+
+/* A list function that matches its list by `ML99_match(WithArgs)` accepts a sized list by
+ * forwarding `op##sized_IMPL(n, items, args...)` to `ML99_PRIV_listSizedMatch(WithArgs)_IMPL(op, n,
+ * items, args...)`, which matches the list of `items` constructed by `ML99_cons` and `ML99_nil`
+ * instead. */
+
+#define ML99_PRIV_listSizedMatch_IMPL(op, n, items)                                                \
+    ML99_call(ML99_match, ML99_PRIV_listUnsized_sized_IMPL(n, items), v(op))
+#define ML99_PRIV_listSizedMatchWithArgs_IMPL(op, n, items, ...)                                   \
+    ML99_call(ML99_matchWithArgs, ML99_PRIV_listUnsized_sized_IMPL(n, items), v(op, __VA_ARGS__))
+// } (Sized lists)
+
+// Lazy lists {
+
+/* A lazy list is `(gen, x, next, done)`: its first item is `x` unless `done(x)` is true, and the
+ * rest of it is `(gen, next(x), next, done)`. A list function `op` accepts it by forwarding
+ * `op##gen_IMPL(x, next, done, args...)` to `ML99_PRIV_listGenUncons_IMPL(op##_, x, next, done,
+ * args...)`, which invokes the `op##nil_IMPL` or `op##cons_IMPL` handler as if the list were
+ * constructed by `ML99_cons` and `ML99_nil`. */
+
+#define ML99_range_IMPL(from, to) v(ML99_PRIV_LIST_GEN(from, ML99_inc, (1, ML99_natEq, to)))
+#define ML99_iterate_IMPL(f, x)   v(ML99_PRIV_LIST_GEN(x, f, (1, ML99_const, 0)))
+
+#define ML99_generator_IMPL(x, next, done) v(ML99_PRIV_LIST_GEN(x, next, done))
+
+#define ML99_PRIV_listGenUncons_IMPL(op, x, next, done, ...)                                       \
+    ML99_call(                                                                                     \
+        ML99_PRIV_listGenUnconsAux,                                                                \
+        ML99_appl_IMPL(done, x),                                                                   \
+        v(op, x, next, done, __VA_ARGS__))
+#define ML99_PRIV_listGenUnconsAux_IMPL(is_done, op, x, next, done, ...)                           \
+    ML99_PRIV_IF(is_done, ML99_PRIV_listGenNil, ML99_PRIV_listGenCons)                             \
+    (op, x, next, done, __VA_ARGS__)
+#define ML99_PRIV_listGenNil(op, _x, _next, _done, ...)                                            \
+    ML99_PRIV_CAT(op, nil_IMPL)(~, __VA_ARGS__)
+#define ML99_PRIV_listGenCons(op, x, next, done, ...)                                              \
+    ML99_call(                                                                                     \
+        ML99_PRIV_listGenConsAux,                                                                  \
+        v(op, x),                                                                                  \
+        ML99_appl_IMPL(next, x),                                                                   \
+        v(next, done, __VA_ARGS__))
+#define ML99_PRIV_listGenConsAux_IMPL(op, x, y, next, done, ...)                                   \
+    ML99_PRIV_CAT(op, cons_IMPL)(x, ML99_PRIV_LIST_GEN(y, next, done), __VA_ARGS__)
+
+// The same as `ML99_PRIV_listGenUncons_IMPL` for a list function `op` that takes only the list.
+#define ML99_PRIV_listGenMatch_IMPL(op, x, next, done)                                             \
+    ML99_PRIV_listGenUncons_IMPL(ML99_PRIV_listGenMatch_, x, next, done, op)
+#define ML99_PRIV_listGenMatch_nil_IMPL(_, op)      op##nil_IMPL(~)
+#define ML99_PRIV_listGenMatch_cons_IMPL(x, xs, op) op##cons_IMPL(x, xs)
+
+/* `ML99_PRIV_listCell_IMPL(list)` results in `ML99_nil()` or a cons cell whatever kind of list
+ * `list` is, peeling only the first item of a lazy list. A function that dispatches on the tags of
+ * several lists at once matches their cells instead of sized or lazy lists. */
+#define ML99_PRIV_listCell_IMPL(list)           ML99_match_IMPL(list, ML99_PRIV_listCell_)
+#define ML99_PRIV_listCell_nil_IMPL(_)          v(ML99_NIL())
+#define ML99_PRIV_listCell_cons_IMPL(x, xs)     v(ML99_CONS(x, xs))
+#define ML99_PRIV_listCell_sized_IMPL(n, items) ML99_PRIV_listUnsized_sized_IMPL(n, items)
+#define ML99_PRIV_listCell_gen_IMPL(x, next, done)                                                 \
+    ML99_PRIV_listGenMatch_IMPL(ML99_PRIV_listCell_, x, next, done)
+
+#define ML99_PRIV_LIST_GEN(x, next, done) ML99_CHOICE(gen, x, next, done)
+// } (Lazy lists)
 
 #define ML99_listAppend_IMPL(list, other)                                                          \
     ML99_matchWithArgs_IMPL(list, ML99_PRIV_listAppend_, other)
 #define ML99_PRIV_listAppend_nil_IMPL(_, other) v(other)
 #define ML99_PRIV_listAppend_cons_IMPL(x, xs, other)                                               \
     ML99_cons(v(x), ML99_listAppend_IMPL(xs, other))
+#define ML99_PRIV_listAppend_sized_IMPL(n, items, other)                                           \
+    ML99_PRIV_listSizedMatchWithArgs_IMPL(ML99_PRIV_listAppend_, n, items, other)
+#define ML99_PRIV_listAppend_gen_IMPL(x, next, done, other)                                        \
+    ML99_PRIV_listGenUncons_IMPL(ML99_PRIV_listAppend_, x, next, done, other)
 
 #define ML99_listAppendItem_IMPL(item, list) ML99_listAppend_IMPL(list, ML99_CONS(item, ML99_NIL()))
 
-#define ML99_isCons_IMPL(list) v(ML99_IS_CONS(list))
-#define ML99_isNil_IMPL(list)  v(ML99_IS_NIL(list))
-
-#define ML99_listUnwrap_IMPL(list)            ML99_match_IMPL(list, ML99_PRIV_listUnwrap_)
-#define ML99_PRIV_listUnwrap_nil_IMPL(_)      v(ML99_EMPTY())
-#define ML99_PRIV_listUnwrap_cons_IMPL(x, xs) ML99_TERMS(v(x), ML99_listUnwrap_IMPL(xs))
-
-#define ML99_listReverse_IMPL(list)            ML99_match_IMPL(list, ML99_PRIV_listReverse_)
-#define ML99_PRIV_listReverse_nil_IMPL(_)      v(ML99_NIL())
-#define ML99_PRIV_listReverse_cons_IMPL(x, xs) ML99_listAppendItem(v(x), ML99_listReverse_IMPL(xs))
+// Whether a lazy list is empty is known only once `done` is applied to its first item.
+#define ML99_isCons_IMPL(list) ML99_PRIV_CAT(ML99_PRIV_isCons_, ML99_CHOICE_TAG(list))(list)
+#define ML99_PRIV_isCons_nil(_list)   v(ML99_FALSE())
+#define ML99_PRIV_isCons_cons(_list)  v(ML99_TRUE())
+#define ML99_PRIV_isCons_sized(_list) v(ML99_TRUE())
+#define ML99_PRIV_isCons_gen(list)    ML99_call(ML99_not, ML99_PRIV_isNil_gen(list))
+
+#define ML99_isNil_IMPL(list) ML99_PRIV_CAT(ML99_PRIV_isNil_, ML99_CHOICE_TAG(list))(list)
+#define ML99_PRIV_isNil_nil(_list)   v(ML99_TRUE())
+#define ML99_PRIV_isNil_cons(_list)  v(ML99_FALSE())
+#define ML99_PRIV_isNil_sized(_list) v(ML99_FALSE())
+#define ML99_PRIV_isNil_gen(list)    ML99_PRIV_isNilGen(ML99_PRIV_TAIL list)
+
+#define ML99_PRIV_isNilGen(...)               ML99_PRIV_isNilGenAux(__VA_ARGS__)
+#define ML99_PRIV_isNilGenAux(x, _next, done) ML99_appl_IMPL(done, x)
+
+// ML99_listUnwrap_IMPL {
+
+/* `ML99_listUnwrap` and `ML99_listUnwrapCommaSep` peel up to eight cells per reduction step:
+ * `ML99_PRIV_LIST_UNWRAP_k(op, acc, list)` appends the item of a cons cell to the tuple `acc`, after
+ * a leading empty item, and peels the next cell by `ML99_PRIV_LIST_UNWRAP_{k-1}`. On `ML99_nil()`,
+ * `op##Done(acc)` results in the items; after eight cells, `op##Chunk(acc, xs)` results in them
+ * followed by a call that unwraps the rest of the list. */
+
+#define ML99_listUnwrap_IMPL(list) ML99_PRIV_LIST_UNWRAP_8(ML99_PRIV_listUnwrap, (), list)
+
+#define ML99_PRIV_listUnwrapDone(acc)                                                              \
+    v(ML99_PRIV_LIST_JOIN(ML99_PRIV_EXPAND acc, , , , , , , , , ~))
+#define ML99_PRIV_listUnwrapChunk(acc, list)                                                       \
+    ML99_TERMS(                                                                                    \
+        ML99_PRIV_listUnwrapDone(acc),                                                             \
+        ML99_callUneval(ML99_listUnwrap, list))
+
+// `ML99_PRIV_LIST_JOIN(, x1, ..., xk, ...)` is `x1 ... xk`, where the items are padded by empty
+// ones up to eight.
+#define ML99_PRIV_LIST_JOIN(...) ML99_PRIV_LIST_JOIN_AUX(__VA_ARGS__)
+#define ML99_PRIV_LIST_JOIN_AUX(_, _1, _2, _3, _4, _5, _6, _7, _8, ...) _1 _2 _3 _4 _5 _6 _7 _8
+
+#define ML99_PRIV_LIST_UNWRAP_8(op, acc, list)                                                     \
+    ML99_PRIV_LIST_UNWRAP_8_FWD(op, acc, ML99_PRIV_EXPAND list)
+#define ML99_PRIV_LIST_UNWRAP_8_FWD(...) ML99_PRIV_LIST_UNWRAP_8_AUX(__VA_ARGS__)
+#define ML99_PRIV_LIST_UNWRAP_8_AUX(op, acc, tag, ...)                                             \
+    ML99_PRIV_LIST_UNWRAP_8_##tag(op, acc, __VA_ARGS__)
+#define ML99_PRIV_LIST_UNWRAP_8_nil(op, acc, _) ML99_PRIV_CAT(op, Done)(acc)
+#define ML99_PRIV_LIST_UNWRAP_8_cons(op, acc, x, xs)                                               \
+    ML99_PRIV_LIST_UNWRAP_7(op, (ML99_PRIV_EXPAND acc, x), xs)
+#define ML99_PRIV_LIST_UNWRAP_8_sized(op, acc, ...)                                                \
+    ML99_PRIV_LIST_UNWRAP_CELL(8, op, acc, ML99_CHOICE(sized, __VA_ARGS__))
+#define ML99_PRIV_LIST_UNWRAP_8_gen(op, acc, ...)                                                  \
+    ML99_PRIV_LIST_UNWRAP_CELL(8, op, acc, ML99_CHOICE(gen, __VA_ARGS__))
+
+#define ML99_PRIV_LIST_UNWRAP_7(op, acc, list)                                                     \
+    ML99_PRIV_LIST_UNWRAP_7_FWD(op, acc, ML99_PRIV_EXPAND list)
+#define ML99_PRIV_LIST_UNWRAP_7_FWD(...) ML99_PRIV_LIST_UNWRAP_7_AUX(__VA_ARGS__)
+#define ML99_PRIV_LIST_UNWRAP_7_AUX(op, acc, tag, ...)                                             \
+    ML99_PRIV_LIST_UNWRAP_7_##tag(op, acc, __VA_ARGS__)
+#define ML99_PRIV_LIST_UNWRAP_7_nil(op, acc, _) ML99_PRIV_CAT(op, Done)(acc)
+#define ML99_PRIV_LIST_UNWRAP_7_cons(op, acc, x, xs)                                               \
+    ML99_PRIV_LIST_UNWRAP_6(op, (ML99_PRIV_EXPAND acc, x), xs)
+#define ML99_PRIV_LIST_UNWRAP_7_sized(op, acc, ...)                                                \
+    ML99_PRIV_LIST_UNWRAP_CELL(7, op, acc, ML99_CHOICE(sized, __VA_ARGS__))
+#define ML99_PRIV_LIST_UNWRAP_7_gen(op, acc, ...)                                                  \
+    ML99_PRIV_LIST_UNWRAP_CELL(7, op, acc, ML99_CHOICE(gen, __VA_ARGS__))
+
+#define ML99_PRIV_LIST_UNWRAP_6(op, acc, list)                                                     \
+    ML99_PRIV_LIST_UNWRAP_6_FWD(op, acc, ML99_PRIV_EXPAND list)
+#define ML99_PRIV_LIST_UNWRAP_6_FWD(...) ML99_PRIV_LIST_UNWRAP_6_AUX(__VA_ARGS__)
+#define ML99_PRIV_LIST_UNWRAP_6_AUX(op, acc, tag, ...)                                             \
+    ML99_PRIV_LIST_UNWRAP_6_##tag(op, acc, __VA_ARGS__)
+#define ML99_PRIV_LIST_UNWRAP_6_nil(op, acc, _) ML99_PRIV_CAT(op, Done)(acc)
+#define ML99_PRIV_LIST_UNWRAP_6_cons(op, acc, x, xs)                                               \
+    ML99_PRIV_LIST_UNWRAP_5(op, (ML99_PRIV_EXPAND acc, x), xs)
+#define ML99_PRIV_LIST_UNWRAP_6_sized(op, acc, ...)                                                \
+    ML99_PRIV_LIST_UNWRAP_CELL(6, op, acc, ML99_CHOICE(sized, __VA_ARGS__))
+#define ML99_PRIV_LIST_UNWRAP_6_gen(op, acc, ...)                                                  \
+    ML99_PRIV_LIST_UNWRAP_CELL(6, op, acc, ML99_CHOICE(gen, __VA_ARGS__))
+
+#define ML99_PRIV_LIST_UNWRAP_5(op, acc, list)                                                     \
+    ML99_PRIV_LIST_UNWRAP_5_FWD(op, acc, ML99_PRIV_EXPAND list)
+#define ML99_PRIV_LIST_UNWRAP_5_FWD(...) ML99_PRIV_LIST_UNWRAP_5_AUX(__VA_ARGS__)
+#define ML99_PRIV_LIST_UNWRAP_5_AUX(op, acc, tag, ...)                                             \
+    ML99_PRIV_LIST_UNWRAP_5_##tag(op, acc, __VA_ARGS__)
+#define ML99_PRIV_LIST_UNWRAP_5_nil(op, acc, _) ML99_PRIV_CAT(op, Done)(acc)
+#define ML99_PRIV_LIST_UNWRAP_5_cons(op, acc, x, xs)                                               \
+    ML99_PRIV_LIST_UNWRAP_4(op, (ML99_PRIV_EXPAND acc, x), xs)
+#define ML99_PRIV_LIST_UNWRAP_5_sized(op, acc, ...)                                                \
+    ML99_PRIV_LIST_UNWRAP_CELL(5, op, acc, ML99_CHOICE(sized, __VA_ARGS__))
+#define ML99_PRIV_LIST_UNWRAP_5_gen(op, acc, ...)                                                  \
+    ML99_PRIV_LIST_UNWRAP_CELL(5, op, acc, ML99_CHOICE(gen, __VA_ARGS__))
+
+#define ML99_PRIV_LIST_UNWRAP_4(op, acc, list)                                                     \
+    ML99_PRIV_LIST_UNWRAP_4_FWD(op, acc, ML99_PRIV_EXPAND list)
+#define ML99_PRIV_LIST_UNWRAP_4_FWD(...) ML99_PRIV_LIST_UNWRAP_4_AUX(__VA_ARGS__)
+#define ML99_PRIV_LIST_UNWRAP_4_AUX(op, acc, tag, ...)                                             \
+    ML99_PRIV_LIST_UNWRAP_4_##tag(op, acc, __VA_ARGS__)
+#define ML99_PRIV_LIST_UNWRAP_4_nil(op, acc, _) ML99_PRIV_CAT(op, Done)(acc)
+#define ML99_PRIV_LIST_UNWRAP_4_cons(op, acc, x, xs)                                               \
+    ML99_PRIV_LIST_UNWRAP_3(op, (ML99_PRIV_EXPAND acc, x), xs)
+#define ML99_PRIV_LIST_UNWRAP_4_sized(op, acc, ...)                                                \
+    ML99_PRIV_LIST_UNWRAP_CELL(4, op, acc, ML99_CHOICE(sized, __VA_ARGS__))
+#define ML99_PRIV_LIST_UNWRAP_4_gen(op, acc, ...)                                                  \
+    ML99_PRIV_LIST_UNWRAP_CELL(4, op, acc, ML99_CHOICE(gen, __VA_ARGS__))
+
+#define ML99_PRIV_LIST_UNWRAP_3(op, acc, list)                                                     \
+    ML99_PRIV_LIST_UNWRAP_3_FWD(op, acc, ML99_PRIV_EXPAND list)
+#define ML99_PRIV_LIST_UNWRAP_3_FWD(...) ML99_PRIV_LIST_UNWRAP_3_AUX(__VA_ARGS__)
+#define ML99_PRIV_LIST_UNWRAP_3_AUX(op, acc, tag, ...)                                             \
+    ML99_PRIV_LIST_UNWRAP_3_##tag(op, acc, __VA_ARGS__)
+#define ML99_PRIV_LIST_UNWRAP_3_nil(op, acc, _) ML99_PRIV_CAT(op, Done)(acc)
+#define ML99_PRIV_LIST_UNWRAP_3_cons(op, acc, x, xs)                                               \
+    ML99_PRIV_LIST_UNWRAP_2(op, (ML99_PRIV_EXPAND acc, x), xs)
+#define ML99_PRIV_LIST_UNWRAP_3_sized(op, acc, ...)                                                \
+    ML99_PRIV_LIST_UNWRAP_CELL(3, op, acc, ML99_CHOICE(sized, __VA_ARGS__))
+#define ML99_PRIV_LIST_UNWRAP_3_gen(op, acc, ...)                                                  \
+    ML99_PRIV_LIST_UNWRAP_CELL(3, op, acc, ML99_CHOICE(gen, __VA_ARGS__))
+
+#define ML99_PRIV_LIST_UNWRAP_2(op, acc, list)                                                     \
+    ML99_PRIV_LIST_UNWRAP_2_FWD(op, acc, ML99_PRIV_EXPAND list)
+#define ML99_PRIV_LIST_UNWRAP_2_FWD(...) ML99_PRIV_LIST_UNWRAP_2_AUX(__VA_ARGS__)
+#define ML99_PRIV_LIST_UNWRAP_2_AUX(op, acc, tag, ...)                                             \
+    ML99_PRIV_LIST_UNWRAP_2_##tag(op, acc, __VA_ARGS__)
+#define ML99_PRIV_LIST_UNWRAP_2_nil(op, acc, _) ML99_PRIV_CAT(op, Done)(acc)
+#define ML99_PRIV_LIST_UNWRAP_2_cons(op, acc, x, xs)                                               \
+    ML99_PRIV_LIST_UNWRAP_1(op, (ML99_PRIV_EXPAND acc, x), xs)
+#define ML99_PRIV_LIST_UNWRAP_2_sized(op, acc, ...)                                                \
+    ML99_PRIV_LIST_UNWRAP_CELL(2, op, acc, ML99_CHOICE(sized, __VA_ARGS__))
+#define ML99_PRIV_LIST_UNWRAP_2_gen(op, acc, ...)                                                  \
+    ML99_PRIV_LIST_UNWRAP_CELL(2, op, acc, ML99_CHOICE(gen, __VA_ARGS__))
+
+#define ML99_PRIV_LIST_UNWRAP_1(op, acc, list)                                                     \
+    ML99_PRIV_LIST_UNWRAP_1_FWD(op, acc, ML99_PRIV_EXPAND list)
+#define ML99_PRIV_LIST_UNWRAP_1_FWD(...) ML99_PRIV_LIST_UNWRAP_1_AUX(__VA_ARGS__)
+#define ML99_PRIV_LIST_UNWRAP_1_AUX(op, acc, tag, ...)                                             \
+    ML99_PRIV_LIST_UNWRAP_1_##tag(op, acc, __VA_ARGS__)
+#define ML99_PRIV_LIST_UNWRAP_1_nil(op, acc, _) ML99_PRIV_CAT(op, Done)(acc)
+#define ML99_PRIV_LIST_UNWRAP_1_cons(op, acc, x, xs)                                               \
+    ML99_PRIV_LIST_UNWRAP_0(op, (ML99_PRIV_EXPAND acc, x), xs)
+#define ML99_PRIV_LIST_UNWRAP_1_sized(op, acc, ...)                                                \
+    ML99_PRIV_LIST_UNWRAP_CELL(1, op, acc, ML99_CHOICE(sized, __VA_ARGS__))
+#define ML99_PRIV_LIST_UNWRAP_1_gen(op, acc, ...)                                                  \
+    ML99_PRIV_LIST_UNWRAP_CELL(1, op, acc, ML99_CHOICE(gen, __VA_ARGS__))
+
+#define ML99_PRIV_LIST_UNWRAP_0(op, acc, list) ML99_PRIV_CAT(op, Chunk)(acc, list)
+
+// A sized or lazy list is converted to its first cell, which is then peeled by the same level.
+#define ML99_PRIV_LIST_UNWRAP_CELL(k, op, acc, list)                                               \
+    ML99_call(ML99_PRIV_listUnwrapCell, v(k, op, acc), ML99_PRIV_listCell_IMPL(list))
+#define ML99_PRIV_listUnwrapCell_IMPL(k, op, acc, list) ML99_PRIV_LIST_UNWRAP_##k(op, acc, list)
+// } (ML99_listUnwrap_IMPL)
+
+// The reversed prefix is accumulated in `acc`, so that each element takes a single step.
+#define ML99_listReverse_IMPL(list) ML99_PRIV_listReverseAux_IMPL(list, ML99_NIL())
+#define ML99_PRIV_listReverseAux_IMPL(list, acc)                                                   \
+    ML99_matchWithArgs_IMPL(list, ML99_PRIV_listReverse_, acc)
+#define ML99_PRIV_listReverse_nil_IMPL(_, acc) v(acc)
+#define ML99_PRIV_listReverse_cons_IMPL(x, xs, acc)                                                \
+    ML99_PRIV_listReverseAux_IMPL(xs, ML99_CONS(x, acc))
+#define ML99_PRIV_listReverse_sized_IMPL(n, items, acc)                                            \
+    ML99_PRIV_listSizedMatchWithArgs_IMPL(ML99_PRIV_listReverse_, n, items, acc)
+#define ML99_PRIV_listReverse_gen_IMPL(x, next, done, acc)                                         \
+    ML99_PRIV_listGenUncons_IMPL(ML99_PRIV_listReverse_, x, next, done, acc)
 
 #define ML99_listGet_IMPL(i, list)       ML99_matchWithArgs_IMPL(list, ML99_PRIV_listGet_, i)
-#define ML99_PRIV_listGet_nil_IMPL(_, i) ML99_PRIV_EMPTY_LIST_ERROR(ML99_listGet)
+#define ML99_PRIV_listGet_nil_IMPL(_, i) ML99_PRIV_EMPTY_LIST_ERROR(listGet)
 #define ML99_PRIV_listGet_cons_IMPL(x, xs, i)                                                      \
     ML99_PRIV_IF(ML99_NAT_EQ(i, 0), v(x), ML99_listGet_IMPL(ML99_DEC(i), xs))
+#define ML99_PRIV_listGet_gen_IMPL(x, next, done, i)                                               \
+    ML99_PRIV_listGenUncons_IMPL(ML99_PRIV_listGet_, x, next, done, i)
+#define ML99_PRIV_listGet_sized_IMPL(n, items, i)                                                  \
+    ML99_PRIV_IF(ML99_NAT_LESSER(i, n), ML99_PRIV_listGetSized, ML99_PRIV_listGet_nil_IMPL)        \
+    (items, i)
+#define ML99_PRIV_listGetSized(items, i)                                                           \
+    v(ML99_PRIV_HEAD(ML99_PRIV_VARIADICS_DROP(i, ML99_PRIV_EXPAND items, ~)))
 
 #define ML99_listFoldr_IMPL(f, init, list)                                                         \
     ML99_matchWithArgs_IMPL(list, ML99_PRIV_listFoldr_, f, init)
 #define ML99_PRIV_listFoldr_nil_IMPL(_, _f, acc) v(acc)
 #define ML99_PRIV_listFoldr_cons_IMPL(x, xs, f, acc)                                               \
     ML99_call(ML99_appl2, v(f, x), ML99_listFoldr_IMPL(f, acc, xs))
+#define ML99_PRIV_listFoldr_sized_IMPL(n, items, f, acc)                                           \
+    ML99_PRIV_listSizedMatchWithArgs_IMPL(ML99_PRIV_listFoldr_, n, items, f, acc)
+#define ML99_PRIV_listFoldr_gen_IMPL(x, next, done, f, acc)                                        \
+    ML99_PRIV_listGenUncons_IMPL(ML99_PRIV_listFoldr_, x, next, done, f, acc)
+
+// ML99_listFoldl_IMPL {
+
+/* The left fold takes up to four items per reduction step: `f` is applied to them by nested calls,
+ * which are evaluated at once as the accumulator of the next step. `op` is how `f` is called, so
+ * that a metafunction or a closure of arity 2 costs a single reduction step per item: `(f)` for
+ * the former, `(g, v(env...))` for a closure `(2, g, env...)`, and `(ML99_appl2, v(f))` for
+ * anything else. */
 
 #define ML99_listFoldl_IMPL(f, init, list)                                                         \
-    ML99_matchWithArgs_IMPL(list, ML99_PRIV_listFoldl_, f, init)
-#define ML99_PRIV_listFoldl_nil_IMPL(_, _f, acc) v(acc)
-#define ML99_PRIV_listFoldl_cons_IMPL(x, xs, f, acc)                                               \
-    ML99_listFoldl(v(f), ML99_appl2_IMPL(f, acc, x), v(xs))
+    ML99_PRIV_listFoldlLoop_IMPL(ML99_PRIV_listFoldlOp(f), list, init)
+#define ML99_PRIV_listFoldlLoop_IMPL(op, list, acc)                                                \
+    ML99_PRIV_CAT(ML99_PRIV_listFoldlLoop_, ML99_CHOICE_TAG(list))(op, acc, list)
+
+#define ML99_PRIV_listFoldlLoop_nil(_op, acc, _list) v(acc)
+#define ML99_PRIV_listFoldlLoop_cons(op, acc, list)                                                \
+    ML99_PRIV_listFoldlLoop1(op, acc, ML99_PRIV_TAIL list)
+#define ML99_PRIV_listFoldlLoop_sized(op, acc, list)                                               \
+    ML99_call(ML99_PRIV_listFoldlLoop, v(op), ML99_listUnsized_IMPL(list), v(acc))
+#define ML99_PRIV_listFoldlLoop_gen(op, acc, list)                                                 \
+    ML99_matchWithArgs_IMPL(list, ML99_PRIV_listFoldl_, op, acc)
+
+#define ML99_PRIV_listFoldlLoop1(...) ML99_PRIV_listFoldlLoop1Aux(__VA_ARGS__)
+#define ML99_PRIV_listFoldlLoop1Aux(op, acc, x1, xs)                                               \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_LIST_IS_CONS(xs),                                                                \
+        ML99_PRIV_listFoldlNext1,                                                                  \
+        ML99_PRIV_listFoldlStep1)                                                                  \
+    (op, acc, x1, xs)
+#define ML99_PRIV_listFoldlNext1(op, acc, x1, xs)                                                  \
+    ML99_PRIV_listFoldlLoop2(op, acc, x1, ML99_PRIV_TAIL xs)
+#define ML99_PRIV_listFoldlStep1(op, acc, x1, xs)                                                  \
+    ML99_call(ML99_PRIV_listFoldlLoop, v(op, xs), ML99_PRIV_listFoldlAppl(op, v(acc), x1))
+
+#define ML99_PRIV_listFoldlLoop2(...) ML99_PRIV_listFoldlLoop2Aux(__VA_ARGS__)
+#define ML99_PRIV_listFoldlLoop2Aux(op, acc, x1, x2, xs)                                           \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_LIST_IS_CONS(xs),                                                                \
+        ML99_PRIV_listFoldlNext2,                                                                  \
+        ML99_PRIV_listFoldlStep2)                                                                  \
+    (op, acc, x1, x2, xs)
+#define ML99_PRIV_listFoldlNext2(op, acc, x1, x2, xs)                                              \
+    ML99_PRIV_listFoldlLoop3(op, acc, x1, x2, ML99_PRIV_TAIL xs)
+#define ML99_PRIV_listFoldlStep2(op, acc, x1, x2, xs)                                              \
+    ML99_call(ML99_PRIV_listFoldlLoop, v(op, xs), ML99_PRIV_listFoldlAppl2(op, acc, x1, x2))
+
+#define ML99_PRIV_listFoldlLoop3(...) ML99_PRIV_listFoldlLoop3Aux(__VA_ARGS__)
+#define ML99_PRIV_listFoldlLoop3Aux(op, acc, x1, x2, x3, xs)                                       \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_LIST_IS_CONS(xs),                                                                \
+        ML99_PRIV_listFoldlNext3,                                                                  \
+        ML99_PRIV_listFoldlStep3)                                                                  \
+    (op, acc, x1, x2, x3, xs)
+#define ML99_PRIV_listFoldlNext3(op, acc, x1, x2, x3, xs)                                          \
+    ML99_PRIV_listFoldlLoop4(op, acc, x1, x2, x3, ML99_PRIV_TAIL xs)
+#define ML99_PRIV_listFoldlStep3(op, acc, x1, x2, x3, xs)                                          \
+    ML99_call(                                                                                     \
+        ML99_PRIV_listFoldlLoop,                                                                   \
+        v(op, xs),                                                                                 \
+        ML99_PRIV_listFoldlAppl3(op, acc, x1, x2, x3))
+
+#define ML99_PRIV_listFoldlLoop4(...) ML99_PRIV_listFoldlLoop4Aux(__VA_ARGS__)
+#define ML99_PRIV_listFoldlLoop4Aux(op, acc, x1, x2, x3, x4, xs)                                   \
+    ML99_call(                                                                                     \
+        ML99_PRIV_listFoldlLoop,                                                                   \
+        v(op, xs),                                                                                 \
+        ML99_PRIV_listFoldlAppl4(op, acc, x1, x2, x3, x4))
+
+#define ML99_PRIV_listFoldl_gen_IMPL(x, next, done, op, acc)                                       \
+    ML99_PRIV_listGenUncons_IMPL(ML99_PRIV_listFoldl_, x, next, done, op, acc)
+#define ML99_PRIV_listFoldl_nil_IMPL(_, _op, acc) v(acc)
+#define ML99_PRIV_listFoldl_cons_IMPL(x, xs, op, acc)                                              \
+    ML99_call(ML99_PRIV_listFoldlLoop, v(op, xs), ML99_PRIV_listFoldlAppl(op, v(acc), x))
+
+#define ML99_PRIV_listFoldlAppl(op, acc, x)                                                        \
+    ML99_PRIV_listFoldlApplAux(ML99_PRIV_EXPAND op, acc, v(x))
+#define ML99_PRIV_listFoldlApplAux(...) ML99_call(__VA_ARGS__)
+#define ML99_PRIV_listFoldlAppl2(op, acc, x1, x2)                                                  \
+    ML99_PRIV_listFoldlAppl(op, ML99_PRIV_listFoldlAppl(op, v(acc), x1), x2)
+#define ML99_PRIV_listFoldlAppl3(op, acc, x1, x2, x3)                                              \
+    ML99_PRIV_listFoldlAppl(op, ML99_PRIV_listFoldlAppl2(op, acc, x1, x2), x3)
+#define ML99_PRIV_listFoldlAppl4(op, acc, x1, x2, x3, x4)                                          \
+    ML99_PRIV_listFoldlAppl(op, ML99_PRIV_listFoldlAppl3(op, acc, x1, x2, x3), x4)
+
+#define ML99_PRIV_listFoldlOp(f)                                                                   \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_IS_UNTUPLE_FAST(f),                                                              \
+        ML99_PRIV_listFoldlOpF,                                                                    \
+        ML99_PRIV_listFoldlOpClosure)                                                              \
+    (f)
+#define ML99_PRIV_listFoldlOpF(f)                                                                  \
+    ML99_PRIV_IF(ML99_PRIV_NAT_EQ(f##_ARITY, 2), (f), (ML99_appl2, v(f)))
+#define ML99_PRIV_listFoldlOpClosure(f)                                                            \
+    ML99_PRIV_listFoldlOpClosureAux(f, ML99_PRIV_EXPAND f)
+#define ML99_PRIV_listFoldlOpClosureAux(...)                                                       \
+    ML99_PRIV_listFoldlOpClosureAuxAux(__VA_ARGS__)
+#define ML99_PRIV_listFoldlOpClosureAuxAux(f, arity, g, ...)                                       \
+    ML99_PRIV_IF(ML99_PRIV_NAT_EQ(arity, 2), (g, v(__VA_ARGS__)), (ML99_appl2, v(f)))
+// } (ML99_listFoldl_IMPL)
 
 #define ML99_listFoldl1_IMPL(f, list)            ML99_matchWithArgs_IMPL(list, ML99_PRIV_listFoldl1_, f)
-#define ML99_PRIV_listFoldl1_nil_IMPL(_, _f)     ML99_PRIV_EMPTY_LIST_ERROR(ML99_listFoldl1)
+#define ML99_PRIV_listFoldl1_nil_IMPL(_, _f)     ML99_PRIV_EMPTY_LIST_ERROR(listFoldl1)
 #define ML99_PRIV_listFoldl1_cons_IMPL(x, xs, f) ML99_listFoldl_IMPL(f, x, xs)
+#define ML99_PRIV_listFoldl1_sized_IMPL(n, items, f)                                               \
+    ML99_PRIV_listSizedMatchWithArgs_IMPL(ML99_PRIV_listFoldl1_, n, items, f)
+#define ML99_PRIV_listFoldl1_gen_IMPL(x, next, done, f)                                            \
+    ML99_PRIV_listGenUncons_IMPL(ML99_PRIV_listFoldl1_, x, next, done, f)
 
 #define ML99_listIntersperse_IMPL(item, list)                                                      \
     ML99_matchWithArgs_IMPL(list, ML99_PRIV_listIntersperse_, item)
 #define ML99_PRIV_listIntersperse_nil_IMPL(...) v(ML99_NIL())
 #define ML99_PRIV_listIntersperse_cons_IMPL(x, xs, item)                                           \
     ML99_cons(v(x), ML99_listPrependToAll_IMPL(item, xs))
+#define ML99_PRIV_listIntersperse_sized_IMPL(n, items, item)                                       \
+    ML99_PRIV_listSizedMatchWithArgs_IMPL(ML99_PRIV_listIntersperse_, n, items, item)
+#define ML99_PRIV_listIntersperse_gen_IMPL(x, next, done, item)                                    \
+    ML99_PRIV_listGenUncons_IMPL(ML99_PRIV_listIntersperse_, x, next, done, item)
 
 #define ML99_listPrependToAll_IMPL(item, list)                                                     \
     ML99_matchWithArgs_IMPL(list, ML99_PRIV_listPrependToAll_, item)
 #define ML99_PRIV_listPrependToAll_nil_IMPL(...) v(ML99_NIL())
 #define ML99_PRIV_listPrependToAll_cons_IMPL(x, xs, item)                                          \
     ML99_cons(v(item), ML99_cons(v(x), ML99_listPrependToAll_IMPL(item, xs)))
-
-#define ML99_listMap_IMPL(f, list)      ML99_matchWithArgs_IMPL(list, ML99_PRIV_listMap_, f)
-#define ML99_PRIV_listMap_nil_IMPL(...) v(ML99_NIL())
-#define ML99_PRIV_listMap_cons_IMPL(x, xs, f)                                                      \
-    ML99_cons(ML99_appl_IMPL(f, x), ML99_listMap_IMPL(f, xs))
+#define ML99_PRIV_listPrependToAll_sized_IMPL(n, items, item)                                      \
+    ML99_PRIV_listSizedMatchWithArgs_IMPL(ML99_PRIV_listPrependToAll_, n, items, item)
+#define ML99_PRIV_listPrependToAll_gen_IMPL(x, next, done, item)                                   \
+    ML99_PRIV_listGenUncons_IMPL(ML99_PRIV_listPrependToAll_, x, next, done, item)
+
+// ML99_listMap_IMPL {
+
+/* Like `ML99_listFoldl`, the map takes up to four items per reduction step; their images are
+ * consed at once onto the map of the rest of the list. */
+
+#define ML99_listMap_IMPL(f, list)                                                                 \
+    ML99_PRIV_CAT(ML99_PRIV_listMap_, ML99_CHOICE_TAG(list))(f, list)
+
+#define ML99_PRIV_listMap_nil(_f, _list) v(ML99_NIL())
+#define ML99_PRIV_listMap_cons(f, list)  ML99_PRIV_listMap1(f, ML99_PRIV_TAIL list)
+#define ML99_PRIV_listMap_sized          ML99_PRIV_listMapOther
+#define ML99_PRIV_listMap_gen            ML99_PRIV_listMapOther
+#define ML99_PRIV_listMapOther(f, list)                                                            \
+    ML99_call(ML99_listMap, v(f), ML99_PRIV_listCell_IMPL(list))
+
+#define ML99_PRIV_listMap1(...) ML99_PRIV_listMap1Aux(__VA_ARGS__)
+#define ML99_PRIV_listMap1Aux(f, x1, xs)                                                           \
+    ML99_PRIV_IF(ML99_PRIV_LIST_IS_CONS(xs), ML99_PRIV_listMapNext1, ML99_PRIV_listMapLast1)       \
+    (f, x1, xs)
+#define ML99_PRIV_listMapNext1(f, x1, xs)                                                          \
+    ML99_PRIV_listMap2(f, x1, ML99_PRIV_TAIL xs)
+#define ML99_PRIV_listMapLast1(f, x1, xs)                                                          \
+    ML99_call(ML99_PRIV_listMapCons1, ML99_appl_IMPL(f, x1), ML99_PRIV_listMapRest(f, xs))
+
+#define ML99_PRIV_listMap2(...) ML99_PRIV_listMap2Aux(__VA_ARGS__)
+#define ML99_PRIV_listMap2Aux(f, x1, x2, xs)                                                       \
+    ML99_PRIV_IF(ML99_PRIV_LIST_IS_CONS(xs), ML99_PRIV_listMapNext2, ML99_PRIV_listMapLast2)       \
+    (f, x1, x2, xs)
+#define ML99_PRIV_listMapNext2(f, x1, x2, xs)                                                      \
+    ML99_PRIV_listMap3(f, x1, x2, ML99_PRIV_TAIL xs)
+#define ML99_PRIV_listMapLast2(f, x1, x2, xs)                                                      \
+    ML99_call(                                                                                     \
+        ML99_PRIV_listMapCons2,                                                                    \
+        ML99_appl_IMPL(f, x1),                                                                     \
+        ML99_appl_IMPL(f, x2),                                                                     \
+        ML99_PRIV_listMapRest(f, xs))
+
+#define ML99_PRIV_listMap3(...) ML99_PRIV_listMap3Aux(__VA_ARGS__)
+#define ML99_PRIV_listMap3Aux(f, x1, x2, x3, xs)                                                   \
+    ML99_PRIV_IF(ML99_PRIV_LIST_IS_CONS(xs), ML99_PRIV_listMapNext3, ML99_PRIV_listMapLast3)       \
+    (f, x1, x2, x3, xs)
+#define ML99_PRIV_listMapNext3(f, x1, x2, x3, xs)                                                  \
+    ML99_PRIV_listMap4(f, x1, x2, x3, ML99_PRIV_TAIL xs)
+#define ML99_PRIV_listMapLast3(f, x1, x2, x3, xs)                                                  \
+    ML99_call(                                                                                     \
+        ML99_PRIV_listMapCons3,                                                                    \
+        ML99_appl_IMPL(f, x1),                                                                     \
+        ML99_appl_IMPL(f, x2),                                                                     \
+        ML99_appl_IMPL(f, x3),                                                                     \
+        ML99_PRIV_listMapRest(f, xs))
+
+#define ML99_PRIV_listMap4(...) ML99_PRIV_listMap4Aux(__VA_ARGS__)
+#define ML99_PRIV_listMap4Aux(f, x1, x2, x3, x4, xs)                                               \
+    ML99_call(                                                                                     \
+        ML99_PRIV_listMapCons4,                                                                    \
+        ML99_appl_IMPL(f, x1),                                                                     \
+        ML99_appl_IMPL(f, x2),                                                                     \
+        ML99_appl_IMPL(f, x3),                                                                     \
+        ML99_appl_IMPL(f, x4),                                                                     \
+        ML99_callUneval(ML99_listMap, f, xs))
+
+// The rest of the list is `ML99_nil()` unless it is a sized or lazy list, which is mapped anew.
+#define ML99_PRIV_listMapRest(f, xs)                                                               \
+    ML99_PRIV_CAT(ML99_PRIV_listMap_, ML99_CHOICE_TAG(xs))(f, xs)
+
+#define ML99_PRIV_listMapCons1_IMPL(y1, xs)     v(ML99_CONS(y1, xs))
+#define ML99_PRIV_listMapCons2_IMPL(y1, y2, xs) v(ML99_CONS(y1, ML99_CONS(y2, xs)))
+#define ML99_PRIV_listMapCons3_IMPL(y1, y2, y3, xs)                                                \
+    v(ML99_CONS(y1, ML99_CONS(y2, ML99_CONS(y3, xs))))
+#define ML99_PRIV_listMapCons4_IMPL(y1, y2, y3, y4, xs)                                            \
+    v(ML99_CONS(y1, ML99_CONS(y2, ML99_CONS(y3, ML99_CONS(y4, xs)))))
+// } (ML99_listMap_IMPL)
 
 #define ML99_listMapI_IMPL(f, list) ML99_PRIV_listMapIAux_IMPL(f, list, 0)
 #define ML99_PRIV_listMapIAux_IMPL(f, list, i)                                                     \
@@ -839,12 +1776,20 @@
 #define ML99_PRIV_listMapI_nil_IMPL(...) v(ML99_NIL())
 #define ML99_PRIV_listMapI_cons_IMPL(x, xs, f, i)                                                  \
     ML99_cons(ML99_appl2_IMPL(f, x, i), ML99_PRIV_listMapIAux_IMPL(f, xs, ML99_INC(i)))
+#define ML99_PRIV_listMapI_sized_IMPL(n, items, f, i)                                              \
+    ML99_PRIV_listSizedMatchWithArgs_IMPL(ML99_PRIV_listMapI_, n, items, f, i)
+#define ML99_PRIV_listMapI_gen_IMPL(x, next, done, f, i)                                           \
+    ML99_PRIV_listGenUncons_IMPL(ML99_PRIV_listMapI_, x, next, done, f, i)
 
 #define ML99_listMapInPlace_IMPL(f, list)                                                          \
     ML99_matchWithArgs_IMPL(list, ML99_PRIV_listMapInPlace_, f)
 #define ML99_PRIV_listMapInPlace_nil_IMPL(...) v(ML99_EMPTY())
 #define ML99_PRIV_listMapInPlace_cons_IMPL(x, xs, f)                                               \
     ML99_TERMS(ML99_appl_IMPL(f, x), ML99_listMapInPlace_IMPL(f, xs))
+#define ML99_PRIV_listMapInPlace_sized_IMPL(n, items, f)                                           \
+    ML99_PRIV_listSizedMatchWithArgs_IMPL(ML99_PRIV_listMapInPlace_, n, items, f)
+#define ML99_PRIV_listMapInPlace_gen_IMPL(x, next, done, f)                                        \
+    ML99_PRIV_listGenUncons_IMPL(ML99_PRIV_listMapInPlace_, x, next, done, f)
 
 #define ML99_listMapInPlaceI_IMPL(f, list) ML99_PRIV_listMapInPlaceIAux_IMPL(f, list, 0)
 #define ML99_PRIV_listMapInPlaceIAux_IMPL(f, list, i)                                              \
@@ -852,42 +1797,289 @@
 #define ML99_PRIV_listMapInPlaceI_nil_IMPL(...) v(ML99_EMPTY())
 #define ML99_PRIV_listMapInPlaceI_cons_IMPL(x, xs, f, i)                                           \
     ML99_TERMS(ML99_appl2_IMPL(f, x, i), ML99_PRIV_listMapInPlaceIAux_IMPL(f, xs, ML99_INC(i)))
+#define ML99_PRIV_listMapInPlaceI_sized_IMPL(n, items, f, i)                                       \
+    ML99_PRIV_listSizedMatchWithArgs_IMPL(ML99_PRIV_listMapInPlaceI_, n, items, f, i)
+#define ML99_PRIV_listMapInPlaceI_gen_IMPL(x, next, done, f, i)                                    \
+    ML99_PRIV_listGenUncons_IMPL(ML99_PRIV_listMapInPlaceI_, x, next, done, f, i)
 
 #define ML99_listFor_IMPL(list, f) ML99_listMap_IMPL(f, list)
 
+/* A single pass: the last element is the one followed by `ML99_nil()`, which is told by matching
+ * the rest `xs` of each cell with its item `x` passed along, in the same way as `ML99_listLast`. */
 #define ML99_listMapInitLast_IMPL(f_init, f_last, list)                                            \
-    ML99_listAppendItem(                                                                           \
-        ML99_appl(v(f_last), ML99_listLast_IMPL(list)),                                            \
-        ML99_listMap(v(f_init), ML99_listInit_IMPL(list)))
+    ML99_matchWithArgs_IMPL(list, ML99_PRIV_listMapInitLast_, f_init, f_last)
+#define ML99_PRIV_listMapInitLast_nil_IMPL(...) ML99_PRIV_EMPTY_LIST_ERROR(listMapInitLast)
+#define ML99_PRIV_listMapInitLast_cons_IMPL(x, xs, f_init, f_last)                                 \
+    ML99_PRIV_listMapInitLastAfter_IMPL(x, xs, f_init, f_last)
+#define ML99_PRIV_listMapInitLast_sized_IMPL(n, items, f_init, f_last)                             \
+    ML99_PRIV_listSizedMatchWithArgs_IMPL(ML99_PRIV_listMapInitLast_, n, items, f_init, f_last)
+#define ML99_PRIV_listMapInitLast_gen_IMPL(x, next, done, f_init, f_last)                          \
+    ML99_PRIV_listGenUncons_IMPL(ML99_PRIV_listMapInitLast_, x, next, done, f_init, f_last)
+
+#define ML99_PRIV_listMapInitLastAfter_IMPL(x, list, f_init, f_last)                               \
+    ML99_matchWithArgs_IMPL(list, ML99_PRIV_listMapInitLastAfter_, x, f_init, f_last)
+#define ML99_PRIV_listMapInitLastAfter_nil_IMPL(_, x, _f_init, f_last)                             \
+    ML99_cons(ML99_appl_IMPL(f_last, x), v(ML99_NIL()))
+#define ML99_PRIV_listMapInitLastAfter_cons_IMPL(y, ys, x, f_init, f_last)                         \
+    ML99_cons(ML99_appl_IMPL(f_init, x), ML99_PRIV_listMapInitLastAfter_IMPL(y, ys, f_init, f_last))
+#define ML99_PRIV_listMapInitLastAfter_sized_IMPL(n, items, x, f_init, f_last)                     \
+    ML99_cons(                                                                                     \
+        ML99_appl_IMPL(f_init, x),                                                                 \
+        ML99_PRIV_listSizedMatchWithArgs_IMPL(ML99_PRIV_listMapInitLast_, n, items, f_init, f_last))
+#define ML99_PRIV_listMapInitLastAfter_gen_IMPL(y, next, done, x, f_init, f_last)                  \
+    ML99_PRIV_listGenUncons_IMPL(ML99_PRIV_listMapInitLastAfter_, y, next, done, x, f_init, f_last)
 
 #define ML99_listForInitLast_IMPL(list, f_init, f_last)                                            \
     ML99_listMapInitLast_IMPL(f_init, f_last, list)
 
-#define ML99_listFilter_IMPL(f, list)      ML99_matchWithArgs_IMPL(list, ML99_PRIV_listFilter_, f)
-#define ML99_PRIV_listFilter_nil_IMPL(...) v(ML99_NIL())
-#define ML99_PRIV_listFilter_cons_IMPL(x, xs, f)                                                   \
-    ML99_call(                                                                                     \
-        ML99_call(ML99_if, ML99_appl_IMPL(f, x), v(ML99_cons, ML99_PRIV_listFilterRest)),          \
-        v(x),                                                                                      \
-        ML99_listFilter_IMPL(f, xs))
-#define ML99_PRIV_listFilterRest_IMPL(_x, rest) v(rest)
+// ML99_listFilter_IMPL {
+
+/* The filters take a single reduction step per item besides `f`: the step receives the result of
+ * `f` on the item along with the rest of the list, pushes the item onto an accumulator if needed,
+ * and calls `f` on the next item. `out` is how an item is pushed and how the accumulator is turned
+ * into the result: `ML99_PRIV_listFilterList` accumulates `(~, ys...)`, `ML99_PRIV_listFilterTerms`
+ * accumulates `(ys)`, and `ML99_PRIV_listFilterMaybe` is the former with an optional item. */
+
+#define ML99_listFilter_IMPL(f, list)                                                              \
+    ML99_PRIV_listFilterGo(ML99_PRIV_listFilterList, f, list, (~))
+#define ML99_listFilterInPlace_IMPL(f, list)                                                       \
+    ML99_PRIV_listFilterGo(ML99_PRIV_listFilterTerms, f, list, ())
+#define ML99_listFilterMap_IMPL(f, list)                                                           \
+    ML99_PRIV_listFilterGo(ML99_PRIV_listFilterMaybe, f, list, (~))
+
+#define ML99_PRIV_listFilterGo(out, f, list, acc)                                                  \
+    ML99_PRIV_CAT(ML99_PRIV_listFilterGo_, ML99_CHOICE_TAG(list))(out, f, list, acc)
+
+#define ML99_PRIV_listFilterGo_nil(out, _f, _list, acc) ML99_PRIV_CAT(out, Done)(acc)
+#define ML99_PRIV_listFilterGo_cons(out, f, list, acc)                                             \
+    ML99_PRIV_listFilterGoCons(out, f, acc, ML99_PRIV_TAIL list)
+#define ML99_PRIV_listFilterGo_sized ML99_PRIV_listFilterGoOther
+#define ML99_PRIV_listFilterGo_gen   ML99_PRIV_listFilterGoOther
+#define ML99_PRIV_listFilterGoOther(out, f, list, acc)                                             \
+    ML99_call(ML99_PRIV_listFilterGoCell, v(out, f, acc), ML99_PRIV_listCell_IMPL(list))
+#define ML99_PRIV_listFilterGoCell_IMPL(out, f, acc, list) ML99_PRIV_listFilterGo(out, f, list, acc)
+#define ML99_PRIV_listFilterGoCons(...) ML99_PRIV_listFilterGoConsAux(__VA_ARGS__)
+#define ML99_PRIV_listFilterGoConsAux(out, f, acc, x, xs)                                          \
+    ML99_call(ML99_PRIV_listFilterNext, v(out, f, xs, acc, x), ML99_appl_IMPL(f, x))
+#define ML99_PRIV_listFilterNext_IMPL(out, f, xs, acc, x, y)                                       \
+    ML99_PRIV_listFilterGo(out, f, xs, ML99_PRIV_CAT(out, Push)(acc, x, y))
+
+#define ML99_PRIV_listFilterListPush(acc, x, b) ML99_PRIV_IF(b, (ML99_PRIV_EXPAND acc, x), acc)
+#define ML99_PRIV_listFilterListDone(acc)                                                          \
+    ML99_PRIV_listFilterListDoneAux(ML99_PRIV_EXPAND acc)
+#define ML99_PRIV_listFilterListDoneAux(...)                                                       \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_VARIADICS_MORE_THAN_1(__VA_ARGS__),                                              \
+        ML99_PRIV_listFilterListItems,                                                             \
+        ML99_PRIV_listFilterListNil)                                                               \
+    (__VA_ARGS__)
+#define ML99_PRIV_listFilterListItems(_, ...) ML99_list_IMPL(__VA_ARGS__)
+#define ML99_PRIV_listFilterListNil(_)        v(ML99_NIL())
+
+#define ML99_PRIV_listFilterTermsPush(acc, x, b) ML99_PRIV_IF(b, (ML99_PRIV_EXPAND acc x), acc)
+#define ML99_PRIV_listFilterTermsDone(acc)       v(ML99_PRIV_EXPAND acc)
+
+#define ML99_PRIV_listFilterMaybePush(acc, _x, maybe)                                              \
+    ML99_PRIV_CAT(ML99_PRIV_listFilterMaybePush_, ML99_CHOICE_TAG(maybe))(acc, maybe)
+#define ML99_PRIV_listFilterMaybePush_just(acc, maybe)                                             \
+    (ML99_PRIV_EXPAND acc, ML99_PRIV_CHOICE_DATA maybe)
+#define ML99_PRIV_listFilterMaybePush_nothing(acc, _maybe) acc
+#define ML99_PRIV_listFilterMaybeDone                      ML99_PRIV_listFilterListDone
+// } (ML99_listFilter_IMPL)
 
 // ML99_listEq_IMPL {
 
-#define ML99_listEq_IMPL(cmp, list, other)                                                         \
-    ML99_matchWithArgs_IMPL(list, ML99_PRIV_listEq_, other, cmp)
+/* Both lists are matched at once, and `ML99_PRIV_listEqNext` compares the rest of them if `cmp`
+ * holds for their heads. */
 
-#define ML99_PRIV_listEq_nil_IMPL(_, other, _cmp) v(ML99_IS_NIL(other))
-#define ML99_PRIV_listEq_cons_IMPL(x, xs, other, cmp)                                              \
-    ML99_matchWithArgs_IMPL(other, ML99_PRIV_listEq_cons_, x, xs, cmp)
+#define ML99_listEq_IMPL(cmp, list, other)                                                         \
+    ML99_match2WithArgs_IMPL(list, other, ML99_PRIV_listEq_, cmp)
 
+#define ML99_PRIV_listEq_nil_nil_IMPL(...)   v(ML99_TRUE())
+#define ML99_PRIV_listEq_nil_cons_IMPL(...)  v(ML99_FALSE())
+#define ML99_PRIV_listEq_nil_sized_IMPL(...) v(ML99_FALSE())
+#define ML99_PRIV_listEq_nil_gen_IMPL(_, other_x, other_next, other_done, cmp)                     \
+    ML99_PRIV_listEqCells(cmp, ML99_NIL(), ML99_PRIV_LIST_GEN(other_x, other_next, other_done))
 #define ML99_PRIV_listEq_cons_nil_IMPL(...) v(ML99_FALSE())
-#define ML99_PRIV_listEq_cons_cons_IMPL(other_x, other_xs, x, xs, cmp)                             \
-    ML99_call(                                                                                     \
-        ML99_call(ML99_if, ML99_appl2_IMPL(cmp, x, other_x), v(ML99_listEq, ML99_false)),          \
-        v(cmp, xs, other_xs))
+#define ML99_PRIV_listEq_cons_sized_IMPL(x, xs, other_n, other_items, cmp)                         \
+    ML99_PRIV_listEqCells(cmp, ML99_CONS(x, xs), ML99_PRIV_SIZED_LIST(other_n, other_items))
+#define ML99_PRIV_listEq_cons_gen_IMPL(x, xs, other_x, other_next, other_done, cmp)                \
+    ML99_PRIV_listEqCells(                                                                         \
+        cmp,                                                                                       \
+        ML99_CONS(x, xs),                                                                          \
+        ML99_PRIV_LIST_GEN(other_x, other_next, other_done))
+#define ML99_PRIV_listEq_sized_nil_IMPL(...) v(ML99_FALSE())
+#define ML99_PRIV_listEq_sized_cons_IMPL(n, items, other_x, other_xs, cmp)                         \
+    ML99_PRIV_listEqCells(cmp, ML99_PRIV_SIZED_LIST(n, items), ML99_CONS(other_x, other_xs))
+#define ML99_PRIV_listEq_sized_sized_IMPL(n, items, other_n, other_items, cmp)                     \
+    ML99_PRIV_listEqCells(                                                                         \
+        cmp,                                                                                       \
+        ML99_PRIV_SIZED_LIST(n, items),                                                            \
+        ML99_PRIV_SIZED_LIST(other_n, other_items))
+#define ML99_PRIV_listEq_sized_gen_IMPL(n, items, other_x, other_next, other_done, cmp)            \
+    ML99_PRIV_listEqCells(                                                                         \
+        cmp,                                                                                       \
+        ML99_PRIV_SIZED_LIST(n, items),                                                            \
+        ML99_PRIV_LIST_GEN(other_x, other_next, other_done))
+#define ML99_PRIV_listEq_gen_nil_IMPL(x, next, done, _, cmp)                                       \
+    ML99_PRIV_listEqCells(cmp, ML99_PRIV_LIST_GEN(x, next, done), ML99_NIL())
+#define ML99_PRIV_listEq_gen_cons_IMPL(x, next, done, other_x, other_xs, cmp)                      \
+    ML99_PRIV_listEqCells(cmp, ML99_PRIV_LIST_GEN(x, next, done), ML99_CONS(other_x, other_xs))
+#define ML99_PRIV_listEq_gen_sized_IMPL(x, next, done, other_n, other_items, cmp)                  \
+    ML99_PRIV_listEqCells(                                                                         \
+        cmp,                                                                                       \
+        ML99_PRIV_LIST_GEN(x, next, done),                                                         \
+        ML99_PRIV_SIZED_LIST(other_n, other_items))
+#define ML99_PRIV_listEq_gen_gen_IMPL(x, next, done, other_x, other_next, other_done, cmp)         \
+    ML99_PRIV_listEqCells(                                                                         \
+        cmp,                                                                                       \
+        ML99_PRIV_LIST_GEN(x, next, done),                                                         \
+        ML99_PRIV_LIST_GEN(other_x, other_next, other_done))
+#define ML99_PRIV_listEq_cons_cons_IMPL(x, xs, other_x, other_xs, cmp)                             \
+    ML99_call(ML99_PRIV_listEqNext, ML99_appl2_IMPL(cmp, x, other_x), v(cmp, xs, other_xs))
+#define ML99_PRIV_listEqNext_IMPL(b, cmp, xs, other_xs)                                            \
+    ML99_PRIV_IF(b, ML99_listEq_IMPL, ML99_PRIV_listEqFalse)(cmp, xs, other_xs)
+#define ML99_PRIV_listEqFalse(...) v(ML99_FALSE())
+
+#define ML99_PRIV_listEqCells(cmp, list, other)                                                    \
+    ML99_call(ML99_listEq, v(cmp), ML99_PRIV_listCell_IMPL(list), ML99_PRIV_listCell_IMPL(other))
 // } (ML99_listEq_IMPL)
 
+// ML99_listEqBy_IMPL {
+
+/* `ML99_listEqNat` and `ML99_listEqIdent` compare up to four pairs of items per reduction step by a
+ * plain macro `cmp(args..., x, y)`, which is given as `(cmp, args...)`. */
+
+#define ML99_listEqNat_IMPL(list, other)                                                           \
+    ML99_PRIV_listEqByStep_IMPL((ML99_PRIV_NAT_EQ), list, other)
+#define ML99_listEqIdent_IMPL(prefix, list, other)                                                 \
+    ML99_PRIV_listEqByStep_IMPL((ML99_IDENT_EQ, prefix), list, other)
+
+#define ML99_PRIV_listEqByStep_IMPL(cmp, list, other) ML99_PRIV_listEqBy1(cmp, list, other)
+
+#define ML99_PRIV_listEqBy1(cmp, list, other)                                                      \
+    ML99_PRIV_CAT3(ML99_PRIV_listEqBy1_, ML99_CHOICE_TAG(list), ML99_CHOICE_TAG(other))            \
+    (cmp, list, other)
+#define ML99_PRIV_listEqBy1_nilnil(...)  v(ML99_TRUE())
+#define ML99_PRIV_listEqBy1_nilcons(...) v(ML99_FALSE())
+#define ML99_PRIV_listEqBy1_consnil(...) v(ML99_FALSE())
+#define ML99_PRIV_listEqBy1_nilsized     ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy1_nilgen       ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy1_conssized    ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy1_consgen      ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy1_sizednil     ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy1_sizedcons    ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy1_sizedsized   ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy1_sizedgen     ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy1_gennil       ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy1_gencons      ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy1_gensized     ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy1_gengen       ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy1_conscons(cmp, list, other)                                             \
+    ML99_PRIV_listEqBy1Aux(cmp, ML99_PRIV_TAIL list, ML99_PRIV_TAIL other)
+#define ML99_PRIV_listEqBy1Aux(...) ML99_PRIV_listEqBy1AuxAux(__VA_ARGS__)
+#define ML99_PRIV_listEqBy1AuxAux(cmp, x, xs, y, ys)                                               \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_listCmp(cmp, x, y),                                                              \
+        ML99_PRIV_listEqBy2,                                                                       \
+        ML99_PRIV_listEqByFalse)                                                                   \
+    (cmp, xs, ys)
+
+#define ML99_PRIV_listEqBy2(cmp, list, other)                                                      \
+    ML99_PRIV_CAT3(ML99_PRIV_listEqBy2_, ML99_CHOICE_TAG(list), ML99_CHOICE_TAG(other))            \
+    (cmp, list, other)
+#define ML99_PRIV_listEqBy2_nilnil(...)  v(ML99_TRUE())
+#define ML99_PRIV_listEqBy2_nilcons(...) v(ML99_FALSE())
+#define ML99_PRIV_listEqBy2_consnil(...) v(ML99_FALSE())
+#define ML99_PRIV_listEqBy2_nilsized     ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy2_nilgen       ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy2_conssized    ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy2_consgen      ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy2_sizednil     ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy2_sizedcons    ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy2_sizedsized   ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy2_sizedgen     ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy2_gennil       ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy2_gencons      ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy2_gensized     ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy2_gengen       ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy2_conscons(cmp, list, other)                                             \
+    ML99_PRIV_listEqBy2Aux(cmp, ML99_PRIV_TAIL list, ML99_PRIV_TAIL other)
+#define ML99_PRIV_listEqBy2Aux(...) ML99_PRIV_listEqBy2AuxAux(__VA_ARGS__)
+#define ML99_PRIV_listEqBy2AuxAux(cmp, x, xs, y, ys)                                               \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_listCmp(cmp, x, y),                                                              \
+        ML99_PRIV_listEqBy3,                                                                       \
+        ML99_PRIV_listEqByFalse)                                                                   \
+    (cmp, xs, ys)
+
+#define ML99_PRIV_listEqBy3(cmp, list, other)                                                      \
+    ML99_PRIV_CAT3(ML99_PRIV_listEqBy3_, ML99_CHOICE_TAG(list), ML99_CHOICE_TAG(other))            \
+    (cmp, list, other)
+#define ML99_PRIV_listEqBy3_nilnil(...)  v(ML99_TRUE())
+#define ML99_PRIV_listEqBy3_nilcons(...) v(ML99_FALSE())
+#define ML99_PRIV_listEqBy3_consnil(...) v(ML99_FALSE())
+#define ML99_PRIV_listEqBy3_nilsized     ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy3_nilgen       ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy3_conssized    ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy3_consgen      ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy3_sizednil     ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy3_sizedcons    ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy3_sizedsized   ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy3_sizedgen     ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy3_gennil       ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy3_gencons      ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy3_gensized     ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy3_gengen       ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy3_conscons(cmp, list, other)                                             \
+    ML99_PRIV_listEqBy3Aux(cmp, ML99_PRIV_TAIL list, ML99_PRIV_TAIL other)
+#define ML99_PRIV_listEqBy3Aux(...) ML99_PRIV_listEqBy3AuxAux(__VA_ARGS__)
+#define ML99_PRIV_listEqBy3AuxAux(cmp, x, xs, y, ys)                                               \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_listCmp(cmp, x, y),                                                              \
+        ML99_PRIV_listEqBy4,                                                                       \
+        ML99_PRIV_listEqByFalse)                                                                   \
+    (cmp, xs, ys)
+
+#define ML99_PRIV_listEqBy4(cmp, list, other)                                                      \
+    ML99_PRIV_CAT3(ML99_PRIV_listEqBy4_, ML99_CHOICE_TAG(list), ML99_CHOICE_TAG(other))            \
+    (cmp, list, other)
+#define ML99_PRIV_listEqBy4_nilnil(...)  v(ML99_TRUE())
+#define ML99_PRIV_listEqBy4_nilcons(...) v(ML99_FALSE())
+#define ML99_PRIV_listEqBy4_consnil(...) v(ML99_FALSE())
+#define ML99_PRIV_listEqBy4_nilsized     ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy4_nilgen       ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy4_conssized    ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy4_consgen      ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy4_sizednil     ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy4_sizedcons    ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy4_sizedsized   ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy4_sizedgen     ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy4_gennil       ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy4_gencons      ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy4_gensized     ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy4_gengen       ML99_PRIV_listEqByCells
+#define ML99_PRIV_listEqBy4_conscons(cmp, list, other)                                             \
+    ML99_PRIV_listEqBy4Aux(cmp, ML99_PRIV_TAIL list, ML99_PRIV_TAIL other)
+#define ML99_PRIV_listEqBy4Aux(...) ML99_PRIV_listEqBy4AuxAux(__VA_ARGS__)
+#define ML99_PRIV_listEqBy4AuxAux(cmp, x, xs, y, ys)                                               \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_listCmp(cmp, x, y),                                                              \
+        ML99_PRIV_listEqByNext,                                                                    \
+        ML99_PRIV_listEqByFalse)                                                                   \
+    (cmp, xs, ys)
+
+#define ML99_PRIV_listEqByNext(cmp, list, other)                                                   \
+    ML99_callUneval(ML99_PRIV_listEqByStep, cmp, list, other)
+#define ML99_PRIV_listEqByFalse(...) v(ML99_FALSE())
+#define ML99_PRIV_listEqByCells(cmp, list, other)                                                  \
+    ML99_call(                                                                                     \
+        ML99_PRIV_listEqByStep,                                                                    \
+        v(cmp),                                                                                    \
+        ML99_PRIV_listCell_IMPL(list),                                                             \
+        ML99_PRIV_listCell_IMPL(other))
+// } (ML99_listEqBy_IMPL)
+
 #define ML99_listContains_IMPL(cmp, item, list)                                                    \
     ML99_matchWithArgs_IMPL(list, ML99_PRIV_listContains_, item, cmp)
 #define ML99_PRIV_listContains_nil_IMPL(...) v(ML99_FALSE())
@@ -895,6 +2087,155 @@
     ML99_call(                                                                                     \
         ML99_call(ML99_if, ML99_appl2_IMPL(cmp, x, item), v(ML99_true, ML99_listContains)),        \
         v(cmp, item, xs))
+#define ML99_PRIV_listContains_sized_IMPL(n, items, item, cmp)                                     \
+    ML99_PRIV_listSizedMatchWithArgs_IMPL(ML99_PRIV_listContains_, n, items, item, cmp)
+#define ML99_PRIV_listContains_gen_IMPL(x, next, done, item, cmp)                                  \
+    ML99_PRIV_listGenUncons_IMPL(ML99_PRIV_listContains_, x, next, done, item, cmp)
+
+// ML99_listContainsBy_IMPL {
+
+/* `ML99_listContainsNat` and `ML99_listContainsIdent` compare up to four items per reduction step,
+ * just like `ML99_listEqNat` and `ML99_listEqIdent`. A lazy list hands each of its items over to
+ * `ML99_PRIV_listContainsBy_cons_IMPL`. */
+
+#define ML99_listContainsNat_IMPL(item, list)                                                      \
+    ML99_PRIV_listContainsByStep_IMPL((ML99_PRIV_NAT_EQ), item, list)
+#define ML99_listContainsIdent_IMPL(prefix, item, list)                                            \
+    ML99_PRIV_listContainsByStep_IMPL((ML99_IDENT_EQ, prefix), item, list)
+
+#define ML99_PRIV_listContainsByStep_IMPL(cmp, item, list)                                         \
+    ML99_PRIV_listContainsBy1(cmp, item, list)
+
+#define ML99_PRIV_listContainsBy1(cmp, item, list)                                                 \
+    ML99_PRIV_CAT(ML99_PRIV_listContainsBy1_, ML99_CHOICE_TAG(list))(cmp, item, list)
+#define ML99_PRIV_listContainsBy1_nil(...) v(ML99_FALSE())
+#define ML99_PRIV_listContainsBy1_cons(cmp, item, list)                                            \
+    ML99_PRIV_listContainsBy1Aux(cmp, item, ML99_PRIV_TAIL list)
+#define ML99_PRIV_listContainsBy1_sized ML99_PRIV_listContainsBySized
+#define ML99_PRIV_listContainsBy1_gen   ML99_PRIV_listContainsByGen
+#define ML99_PRIV_listContainsBy1Aux(...) ML99_PRIV_listContainsBy1AuxAux(__VA_ARGS__)
+#define ML99_PRIV_listContainsBy1AuxAux(cmp, item, x, xs)                                          \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_listCmp(cmp, x, item),                                                           \
+        ML99_PRIV_listContainsByTrue,                                                              \
+        ML99_PRIV_listContainsBy2)                                                                 \
+    (cmp, item, xs)
+
+#define ML99_PRIV_listContainsBy2(cmp, item, list)                                                 \
+    ML99_PRIV_CAT(ML99_PRIV_listContainsBy2_, ML99_CHOICE_TAG(list))(cmp, item, list)
+#define ML99_PRIV_listContainsBy2_nil(...) v(ML99_FALSE())
+#define ML99_PRIV_listContainsBy2_cons(cmp, item, list)                                            \
+    ML99_PRIV_listContainsBy2Aux(cmp, item, ML99_PRIV_TAIL list)
+#define ML99_PRIV_listContainsBy2_sized ML99_PRIV_listContainsBySized
+#define ML99_PRIV_listContainsBy2_gen   ML99_PRIV_listContainsByGen
+#define ML99_PRIV_listContainsBy2Aux(...) ML99_PRIV_listContainsBy2AuxAux(__VA_ARGS__)
+#define ML99_PRIV_listContainsBy2AuxAux(cmp, item, x, xs)                                          \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_listCmp(cmp, x, item),                                                           \
+        ML99_PRIV_listContainsByTrue,                                                              \
+        ML99_PRIV_listContainsBy3)                                                                 \
+    (cmp, item, xs)
+
+#define ML99_PRIV_listContainsBy3(cmp, item, list)                                                 \
+    ML99_PRIV_CAT(ML99_PRIV_listContainsBy3_, ML99_CHOICE_TAG(list))(cmp, item, list)
+#define ML99_PRIV_listContainsBy3_nil(...) v(ML99_FALSE())
+#define ML99_PRIV_listContainsBy3_cons(cmp, item, list)                                            \
+    ML99_PRIV_listContainsBy3Aux(cmp, item, ML99_PRIV_TAIL list)
+#define ML99_PRIV_listContainsBy3_sized ML99_PRIV_listContainsBySized
+#define ML99_PRIV_listContainsBy3_gen   ML99_PRIV_listContainsByGen
+#define ML99_PRIV_listContainsBy3Aux(...) ML99_PRIV_listContainsBy3AuxAux(__VA_ARGS__)
+#define ML99_PRIV_listContainsBy3AuxAux(cmp, item, x, xs)                                          \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_listCmp(cmp, x, item),                                                           \
+        ML99_PRIV_listContainsByTrue,                                                              \
+        ML99_PRIV_listContainsBy4)                                                                 \
+    (cmp, item, xs)
+
+#define ML99_PRIV_listContainsBy4(cmp, item, list)                                                 \
+    ML99_PRIV_CAT(ML99_PRIV_listContainsBy4_, ML99_CHOICE_TAG(list))(cmp, item, list)
+#define ML99_PRIV_listContainsBy4_nil(...) v(ML99_FALSE())
+#define ML99_PRIV_listContainsBy4_cons(cmp, item, list)                                            \
+    ML99_PRIV_listContainsBy4Aux(cmp, item, ML99_PRIV_TAIL list)
+#define ML99_PRIV_listContainsBy4_sized ML99_PRIV_listContainsBySized
+#define ML99_PRIV_listContainsBy4_gen   ML99_PRIV_listContainsByGen
+#define ML99_PRIV_listContainsBy4Aux(...) ML99_PRIV_listContainsBy4AuxAux(__VA_ARGS__)
+#define ML99_PRIV_listContainsBy4AuxAux(cmp, item, x, xs)                                          \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_listCmp(cmp, x, item),                                                           \
+        ML99_PRIV_listContainsByTrue,                                                              \
+        ML99_PRIV_listContainsByNext)                                                              \
+    (cmp, item, xs)
+
+#define ML99_PRIV_listContainsByNext(cmp, item, list)                                              \
+    ML99_callUneval(ML99_PRIV_listContainsByStep, cmp, item, list)
+#define ML99_PRIV_listContainsByTrue(...) v(ML99_TRUE())
+#define ML99_PRIV_listContainsBySized(cmp, item, list)                                             \
+    ML99_call(ML99_PRIV_listContainsByStep, v(cmp, item), ML99_listUnsized_IMPL(list))
+#define ML99_PRIV_listContainsByGen(cmp, item, list)                                               \
+    ML99_matchWithArgs_IMPL(list, ML99_PRIV_listContainsBy_, cmp, item)
+
+#define ML99_PRIV_listContainsBy_gen_IMPL(x, next, done, cmp, item)                                \
+    ML99_PRIV_listGenUncons_IMPL(ML99_PRIV_listContainsBy_, x, next, done, cmp, item)
+#define ML99_PRIV_listContainsBy_nil_IMPL(...) v(ML99_FALSE())
+#define ML99_PRIV_listContainsBy_cons_IMPL(x, xs, cmp, item)                                       \
+    ML99_PRIV_listContainsBy1AuxAux(cmp, item, x, xs)
+
+// Compares `x` and `y` by `cmp`, given as `(cmp, args...)`.
+#define ML99_PRIV_listCmp(cmp, x, y)        ML99_PRIV_listCmpAux(ML99_PRIV_EXPAND cmp, x, y)
+#define ML99_PRIV_listCmpAux(...)           ML99_PRIV_listCmpAuxAux(__VA_ARGS__)
+#define ML99_PRIV_listCmpAuxAux(cmp, ...)   cmp(__VA_ARGS__)
+// } (ML99_listContainsBy_IMPL)
+
+// ML99_listDedup_IMPL {
+
+/* The identifiers seen so far make up an identifier set `(prefix, n, (x1, ..., xn, ()))`, which
+ * is the result once the list is over. */
+
+#define ML99_listDedup_IMPL(prefix, list)                                                          \
+    ML99_PRIV_listDedup_IMPL(list, (prefix, 0, (())))
+#define ML99_PRIV_listDedup_IMPL(list, set)                                                        \
+    ML99_PRIV_CAT(ML99_PRIV_listDedup_, ML99_CHOICE_TAG(list))(list, set)
+
+#define ML99_PRIV_listDedup_nil(_list, set) ML99_PRIV_listDedupDone set
+#define ML99_PRIV_listDedup_cons(list, set)                                                        \
+    ML99_PRIV_listDedupCons(ML99_PRIV_TAIL list, ML99_PRIV_EXPAND set)
+#define ML99_PRIV_listDedup_sized ML99_PRIV_listDedupOther
+#define ML99_PRIV_listDedup_gen   ML99_PRIV_listDedupOther
+#define ML99_PRIV_listDedupOther(list, set)                                                        \
+    ML99_call(ML99_PRIV_listDedup, ML99_PRIV_listCell_IMPL(list), v(set))
+#define ML99_PRIV_listDedupCons(...) ML99_PRIV_listDedupConsAux(__VA_ARGS__)
+#define ML99_PRIV_listDedupConsAux(x, xs, prefix, n, items)                                        \
+    ML99_PRIV_identFind_IMPL(                                                                      \
+        ML99_PRIV_listDedupNext,                                                                   \
+        (x, xs, prefix, n, items),                                                                 \
+        prefix,                                                                                    \
+        x,                                                                                         \
+        0,                                                                                         \
+        ML99_PRIV_EXPAND items,                                                                    \
+        ~)
+
+#define ML99_PRIV_listDedupNext(found, _i, x, xs, prefix, n, items)                                \
+    ML99_PRIV_IF(                                                                                  \
+        found,                                                                                     \
+        ML99_PRIV_listDedupSkip,                                                                   \
+        ML99_PRIV_IF(                                                                              \
+            ML99_NAT_EQ(n, ML99_NAT_MAX),                                                          \
+            ML99_PRIV_listDedupFull,                                                               \
+            ML99_PRIV_listDedupAdd))                                                               \
+    (x, xs, prefix, n, items)
+#define ML99_PRIV_listDedupSkip(_x, xs, prefix, n, items)                                          \
+    ML99_callUneval(ML99_PRIV_listDedup, xs, (prefix, n, items))
+#define ML99_PRIV_listDedupAdd(x, xs, prefix, n, items)                                            \
+    ML99_callUneval(ML99_PRIV_listDedup, xs, ML99_PRIV_identSetAppend(x, prefix, n, items))
+#define ML99_PRIV_listDedupFull(...)                                                               \
+    ML99_fatal(ML99_listDedup, the list holds more than ML99_NAT_MAX distinct identifiers)
+
+#define ML99_PRIV_listDedupDone(prefix, n, items)                                                  \
+    ML99_PRIV_IF(ML99_NAT_EQ(n, 0), ML99_PRIV_listDedupNil, ML99_PRIV_listDedupItems)              \
+    (prefix, n, items)
+#define ML99_PRIV_listDedupNil(...)   v(ML99_NIL())
+#define ML99_PRIV_listDedupItems(...) ML99_list_IMPL(ML99_PRIV_identSetItems(__VA_ARGS__))
+// } (ML99_listDedup_IMPL)
 
 #define ML99_listTake_IMPL(n, list)      ML99_matchWithArgs_IMPL(list, ML99_PRIV_listTake_, n)
 #define ML99_PRIV_listTake_nil_IMPL(...) v(ML99_NIL())
@@ -903,6 +2244,23 @@
         ML99_NAT_EQ(i, 0),                                                                         \
         v(ML99_NIL()),                                                                             \
         ML99_cons(v(x), ML99_listTake_IMPL(ML99_DEC(i), xs)))
+#define ML99_PRIV_listTake_sized_IMPL(n, items, i)                                                 \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_NAT_EQ(i, 0),                                                                         \
+        ML99_PRIV_listTakeNone,                                                                    \
+        ML99_PRIV_IF(ML99_NAT_LESSER(i, n), ML99_PRIV_listTakeSized, ML99_PRIV_listTakeAll))       \
+    (n, items, i)
+
+#define ML99_PRIV_listTake_gen_IMPL(x, next, done, i)                                              \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_NAT_EQ(i, 0),                                                                         \
+        v(ML99_NIL()),                                                                             \
+        ML99_PRIV_listGenUncons_IMPL(ML99_PRIV_listTake_, x, next, done, i))
+
+#define ML99_PRIV_listTakeNone(_n, _items, _i) v(ML99_NIL())
+#define ML99_PRIV_listTakeAll(n, items, _i)    v(ML99_PRIV_SIZED_LIST(n, items))
+#define ML99_PRIV_listTakeSized(_n, items, i)                                                      \
+    v(ML99_PRIV_SIZED_LIST(i, (ML99_PRIV_VARIADICS_TAKE(i, ML99_PRIV_EXPAND items, ~))))
 
 #define ML99_listTakeWhile_IMPL(f, list)      ML99_matchWithArgs_IMPL(list, ML99_PRIV_listTakeWhile_, f)
 #define ML99_PRIV_listTakeWhile_nil_IMPL(...) v(ML99_NIL())
@@ -910,6 +2268,10 @@
     ML99_call(                                                                                     \
         ML99_call(ML99_if, ML99_appl_IMPL(f, x), v(ML99_PRIV_listTakeWhileProgress, ML99_nil)),    \
         v(x, xs, f))
+#define ML99_PRIV_listTakeWhile_sized_IMPL(n, items, f)                                            \
+    ML99_PRIV_listSizedMatchWithArgs_IMPL(ML99_PRIV_listTakeWhile_, n, items, f)
+#define ML99_PRIV_listTakeWhile_gen_IMPL(x, next, done, f)                                         \
+    ML99_PRIV_listGenUncons_IMPL(ML99_PRIV_listTakeWhile_, x, next, done, f)
 #define ML99_PRIV_listTakeWhileProgress_IMPL(x, xs, f)                                             \
     ML99_cons(v(x), ML99_listTakeWhile_IMPL(f, xs))
 
@@ -917,6 +2279,23 @@
 #define ML99_PRIV_listDrop_nil_IMPL(...) v(ML99_NIL())
 #define ML99_PRIV_listDrop_cons_IMPL(x, xs, i)                                                     \
     ML99_PRIV_IF(ML99_NAT_EQ(i, 0), v(ML99_CONS(x, xs)), ML99_listDrop_IMPL(ML99_DEC(i), xs))
+#define ML99_PRIV_listDrop_gen_IMPL(x, next, done, i)                                              \
+    ML99_PRIV_listGenUncons_IMPL(ML99_PRIV_listDrop_, x, next, done, i)
+#define ML99_PRIV_listDrop_sized_IMPL(n, items, i)                                                 \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_NAT_EQ(i, 0),                                                                         \
+        ML99_PRIV_listTakeAll,                                                                     \
+        ML99_PRIV_IF(ML99_NAT_LESSER(i, n), ML99_PRIV_listDropSized, ML99_PRIV_listTakeNone))      \
+    (n, items, i)
+
+// The remaining items are followed by the sentinel of `ML99_PRIV_VARIADICS_DROP`, which is then
+// left out by taking exactly `n - i` of them.
+#define ML99_PRIV_listDropSized(n, items, i)                                                       \
+    ML99_PRIV_listDropSizedAux(ML99_PRIV_NAT_SUB(n, i), items, i)
+#define ML99_PRIV_listDropSizedAux(m, items, i)                                                    \
+    v(ML99_PRIV_SIZED_LIST(                                                                        \
+        m,                                                                                         \
+        (ML99_PRIV_VARIADICS_TAKE(m, ML99_PRIV_VARIADICS_DROP(i, ML99_PRIV_EXPAND items, ~)))))
 
 // ML99_listDropWhile_IMPL {
 
@@ -930,6 +2309,10 @@
             ML99_appl_IMPL(f, x),                                                                  \
             v(ML99_PRIV_listDropWhileProgress, ML99_PRIV_listDropWhileDone)),                      \
         v(x, xs, f))
+#define ML99_PRIV_listDropWhile_sized_IMPL(n, items, f)                                            \
+    ML99_PRIV_listSizedMatchWithArgs_IMPL(ML99_PRIV_listDropWhile_, n, items, f)
+#define ML99_PRIV_listDropWhile_gen_IMPL(x, next, done, f)                                         \
+    ML99_PRIV_listGenUncons_IMPL(ML99_PRIV_listDropWhile_, x, next, done, f)
 
 #define ML99_PRIV_listDropWhileDone_IMPL(x, xs, _f)     v(ML99_CONS(x, xs))
 #define ML99_PRIV_listDropWhileProgress_IMPL(_x, xs, f) ML99_listDropWhile_IMPL(f, xs)
@@ -937,30 +2320,85 @@
 
 // ML99_listZip_IMPL {
 
-#define ML99_listZip_IMPL(list, other) ML99_matchWithArgs_IMPL(list, ML99_PRIV_listZip_, other)
-
-#define ML99_PRIV_listZip_nil_IMPL(...) v(ML99_NIL())
-#define ML99_PRIV_listZip_cons_IMPL(x, xs, other)                                                  \
-    ML99_matchWithArgs_IMPL(other, ML99_PRIV_listZip_cons_, x, xs)
-
-#define ML99_PRIV_listZip_cons_nil_IMPL(...) v(ML99_NIL())
-#define ML99_PRIV_listZip_cons_cons_IMPL(other_x, other_xs, x, xs)                                 \
-    ML99_cons(v(ML99_TUPLE(x, other_x)), ML99_listZip_IMPL(xs, other_xs))
+#define ML99_listZip_IMPL(list, other) ML99_match2_IMPL(list, other, ML99_PRIV_listZip_)
+
+#define ML99_PRIV_listZip_nil_nil_IMPL(...)   v(ML99_NIL())
+#define ML99_PRIV_listZip_nil_cons_IMPL(...)  v(ML99_NIL())
+#define ML99_PRIV_listZip_nil_sized_IMPL(...) v(ML99_NIL())
+#define ML99_PRIV_listZip_nil_gen_IMPL(...)   v(ML99_NIL())
+#define ML99_PRIV_listZip_cons_nil_IMPL(...)  v(ML99_NIL())
+#define ML99_PRIV_listZip_cons_cons_IMPL(x, xs, other_x, other_xs)                                 \
+    ML99_cons(v((x, other_x)), ML99_listZip_IMPL(xs, other_xs))
+#define ML99_PRIV_listZip_cons_sized_IMPL(x, xs, other_n, other_items)                             \
+    ML99_PRIV_listZipCells(ML99_CONS(x, xs), ML99_PRIV_SIZED_LIST(other_n, other_items))
+#define ML99_PRIV_listZip_cons_gen_IMPL(x, xs, other_x, other_next, other_done)                    \
+    ML99_PRIV_listZipCells(ML99_CONS(x, xs), ML99_PRIV_LIST_GEN(other_x, other_next, other_done))
+#define ML99_PRIV_listZip_sized_nil_IMPL(...) v(ML99_NIL())
+#define ML99_PRIV_listZip_sized_cons_IMPL(n, items, other_x, other_xs)                             \
+    ML99_PRIV_listZipCells(ML99_PRIV_SIZED_LIST(n, items), ML99_CONS(other_x, other_xs))
+#define ML99_PRIV_listZip_sized_sized_IMPL(n, items, other_n, other_items)                         \
+    ML99_PRIV_listZipCells(                                                                        \
+        ML99_PRIV_SIZED_LIST(n, items),                                                            \
+        ML99_PRIV_SIZED_LIST(other_n, other_items))
+#define ML99_PRIV_listZip_sized_gen_IMPL(n, items, other_x, other_next, other_done)                \
+    ML99_PRIV_listZipCells(                                                                        \
+        ML99_PRIV_SIZED_LIST(n, items),                                                            \
+        ML99_PRIV_LIST_GEN(other_x, other_next, other_done))
+#define ML99_PRIV_listZip_gen_nil_IMPL(...) v(ML99_NIL())
+#define ML99_PRIV_listZip_gen_cons_IMPL(x, next, done, other_x, other_xs)                          \
+    ML99_PRIV_listZipCells(ML99_PRIV_LIST_GEN(x, next, done), ML99_CONS(other_x, other_xs))
+#define ML99_PRIV_listZip_gen_sized_IMPL(x, next, done, other_n, other_items)                      \
+    ML99_PRIV_listZipCells(                                                                        \
+        ML99_PRIV_LIST_GEN(x, next, done),                                                         \
+        ML99_PRIV_SIZED_LIST(other_n, other_items))
+#define ML99_PRIV_listZip_gen_gen_IMPL(x, next, done, other_x, other_next, other_done)             \
+    ML99_PRIV_listZipCells(                                                                        \
+        ML99_PRIV_LIST_GEN(x, next, done),                                                         \
+        ML99_PRIV_LIST_GEN(other_x, other_next, other_done))
+
+#define ML99_PRIV_listZipCells(list, other)                                                        \
+    ML99_call(ML99_listZip, ML99_PRIV_listCell_IMPL(list), ML99_PRIV_listCell_IMPL(other))
 // } (ML99_listZip_IMPL)
 
 // ML99_listUnzip_IMPL {
 
-#define ML99_listUnzip_IMPL(list) ML99_match_IMPL(list, ML99_PRIV_listUnzip_)
-
-#define ML99_PRIV_listUnzip_nil_IMPL(_) v(ML99_TUPLE(ML99_NIL(), ML99_NIL()))
-#define ML99_PRIV_listUnzip_cons_IMPL(x, xs)                                                       \
-    ML99_call(ML99_PRIV_listUnzipProgress, v(x), ML99_listUnzip_IMPL(xs))
+/* The cells are peeled eight at a time as in `ML99_listUnwrap`, after the accumulators `(~, xs...)`
+ * and `(~, ys...)` of the first and second components, and then the components of the peeled
+ * tuples are appended to them at once. `ML99_PRIV_LIST_UNZIP_PUSH` skips the empty items that pad
+ * the last chunk up to eight. */
 
-#define ML99_PRIV_listUnzipProgress_IMPL(x, rest)                                                  \
-    v(ML99_TUPLE(ML99_PRIV_LIST_UNZIP_EXTEND(x, rest, 0), ML99_PRIV_LIST_UNZIP_EXTEND(x, rest, 1)))
+#define ML99_listUnzip_IMPL(list) ML99_PRIV_listUnzipGo_IMPL(list, (~), (~))
+#define ML99_PRIV_listUnzipGo_IMPL(list, fst, snd)                                                 \
+    ML99_PRIV_LIST_UNWRAP_8(ML99_PRIV_listUnzip, (fst, snd), list)
 
-#define ML99_PRIV_LIST_UNZIP_EXTEND(x, rest, i)                                                    \
-    ML99_CONS(ML99_TUPLE_GET(i)(x), ML99_TUPLE_GET(i)(rest))
+#define ML99_PRIV_listUnzipDone(acc)                                                               \
+    ML99_PRIV_listUnzipDoneAux(ML99_PRIV_listUnzipPush(ML99_PRIV_EXPAND acc, , , , , , , , , ~))
+#define ML99_PRIV_listUnzipDoneAux(...) ML99_PRIV_listUnzipDoneLists(__VA_ARGS__)
+#define ML99_PRIV_listUnzipDoneLists(fst, snd)                                                     \
+    ML99_call(                                                                                     \
+        ML99_PRIV_listTupleOf,                                                                     \
+        ML99_PRIV_listFilterListDone(fst),                                                         \
+        ML99_PRIV_listFilterListDone(snd))
+#define ML99_PRIV_listUnzipChunk(acc, list)                                                        \
+    ML99_callUneval(ML99_PRIV_listUnzipGo, list, ML99_PRIV_listUnzipPush(ML99_PRIV_EXPAND acc, ~))
+
+#define ML99_PRIV_listUnzipPush(...) ML99_PRIV_listUnzipPushAux(__VA_ARGS__)
+#define ML99_PRIV_listUnzipPushAux(fst, snd, _1, _2, _3, _4, _5, _6, _7, _8, ...)                  \
+    (ML99_PRIV_EXPAND fst ML99_PRIV_LIST_UNZIP_PUSH(0, _1) ML99_PRIV_LIST_UNZIP_PUSH(0, _2)        \
+         ML99_PRIV_LIST_UNZIP_PUSH(0, _3) ML99_PRIV_LIST_UNZIP_PUSH(0, _4)                         \
+             ML99_PRIV_LIST_UNZIP_PUSH(0, _5) ML99_PRIV_LIST_UNZIP_PUSH(0, _6)                     \
+                 ML99_PRIV_LIST_UNZIP_PUSH(0, _7) ML99_PRIV_LIST_UNZIP_PUSH(0, _8)),               \
+        (ML99_PRIV_EXPAND snd ML99_PRIV_LIST_UNZIP_PUSH(1, _1) ML99_PRIV_LIST_UNZIP_PUSH(1, _2)    \
+             ML99_PRIV_LIST_UNZIP_PUSH(1, _3) ML99_PRIV_LIST_UNZIP_PUSH(1, _4)                     \
+                 ML99_PRIV_LIST_UNZIP_PUSH(1, _5) ML99_PRIV_LIST_UNZIP_PUSH(1, _6)                 \
+                     ML99_PRIV_LIST_UNZIP_PUSH(1, _7) ML99_PRIV_LIST_UNZIP_PUSH(1, _8))
+
+#define ML99_PRIV_LIST_UNZIP_PUSH(i, x)                                                            \
+    ML99_PRIV_IF(ML99_PRIV_IS_TUPLE_FAST(x), ML99_PRIV_LIST_UNZIP_PUSH_##i, ML99_PRIV_EMPTY)(x)
+#define ML99_PRIV_LIST_UNZIP_PUSH_0(x) , ML99_PRIV_LIST_UNZIP_FST x
+#define ML99_PRIV_LIST_UNZIP_PUSH_1(x) , ML99_PRIV_LIST_UNZIP_SND x
+#define ML99_PRIV_LIST_UNZIP_FST(x, _y) x
+#define ML99_PRIV_LIST_UNZIP_SND(_x, y) y
 // } (ML99_listUnzip_IMPL)
 
 #define ML99_listReplicate_IMPL(n, item)                                                           \
@@ -970,42 +2408,408 @@
 
 // ML99_listPartition_IMPL {
 
-#define ML99_listPartition_IMPL(f, list)                                                           \
-    ML99_listFoldr(                                                                                \
-        ML99_appl_IMPL(ML99_PRIV_listPartitionAux, f),                                             \
-        v(ML99_TUPLE(ML99_NIL(), ML99_NIL())),                                                     \
-        v(list))
+/* The cells are peeled eight at a time as in `ML99_listUnwrap`, after `f` and the accumulators
+ * `(~, ys...)` and `(~, zs...)` of the items that do and do not satisfy it. `f` is then applied to
+ * the peeled items at once, and each of them is appended to one of the accumulators according to
+ * its bit; the items of the last chunk are taken one at a time. */
 
-#define ML99_PRIV_listPartitionAux_IMPL(f, x, acc)                                                 \
-    ML99_call(                                                                                     \
-        ML99_call(                                                                                 \
-            ML99_if,                                                                               \
-            ML99_appl_IMPL(f, x),                                                                  \
-            v(ML99_PRIV_listPartitionExtendFst, ML99_PRIV_listPartitionExtendSnd)),                \
-        v(x, ML99_TUPLE_GET(0)(acc), ML99_TUPLE_GET(1)(acc)))
+#define ML99_listPartition_IMPL(f, list) ML99_PRIV_listPartitionGo_IMPL(f, list, (~), (~))
+#define ML99_PRIV_listPartitionGo_IMPL(f, list, yes, no)                                           \
+    ML99_PRIV_LIST_UNWRAP_8(ML99_PRIV_listPartition, (f, yes, no), list)
 
-#define ML99_PRIV_listPartitionExtendFst_IMPL(x, fst, snd) v(ML99_TUPLE(ML99_CONS(x, fst), snd))
-#define ML99_PRIV_listPartitionExtendSnd_IMPL(x, fst, snd) v(ML99_TUPLE(fst, ML99_CONS(x, snd)))
+#define ML99_PRIV_listPartitionChunk(acc, list)                                                    \
+    ML99_PRIV_listPartitionChunkAux(list, ML99_PRIV_EXPAND acc)
+#define ML99_PRIV_listPartitionChunkAux(...) ML99_PRIV_listPartitionChunkApply(__VA_ARGS__)
+#define ML99_PRIV_listPartitionChunkApply(list, f, yes, no, _1, _2, _3, _4, _5, _6, _7, _8)        \
+    ML99_call(                                                                                     \
+        ML99_PRIV_listPartitionKeepChunk,                                                          \
+        v(f, list, yes, no),                                                                       \
+        ML99_appl_IMPL(f, _1),                                                                     \
+        ML99_appl_IMPL(f, _2),                                                                     \
+        ML99_appl_IMPL(f, _3),                                                                     \
+        ML99_appl_IMPL(f, _4),                                                                     \
+        ML99_appl_IMPL(f, _5),                                                                     \
+        ML99_appl_IMPL(f, _6),                                                                     \
+        ML99_appl_IMPL(f, _7),                                                                     \
+        ML99_appl_IMPL(f, _8),                                                                     \
+        v(_1, _2, _3, _4, _5, _6, _7, _8))
+
+#define ML99_PRIV_listPartitionKeepChunk_IMPL(                                                     \
+    f, list, yes, no, b1, b2, b3, b4, b5, b6, b7, b8, _1, _2, _3, _4, _5, _6, _7, _8)              \
+    ML99_PRIV_listPartitionGo_IMPL(                                                                \
+        f,                                                                                         \
+        list,                                                                                      \
+        (ML99_PRIV_EXPAND yes ML99_PRIV_LIST_KEEP_##b1(_1) ML99_PRIV_LIST_KEEP_##b2(_2)            \
+             ML99_PRIV_LIST_KEEP_##b3(_3) ML99_PRIV_LIST_KEEP_##b4(_4)                             \
+                 ML99_PRIV_LIST_KEEP_##b5(_5) ML99_PRIV_LIST_KEEP_##b6(_6)                         \
+                     ML99_PRIV_LIST_KEEP_##b7(_7) ML99_PRIV_LIST_KEEP_##b8(_8)),                   \
+        (ML99_PRIV_EXPAND no ML99_PRIV_LIST_SKIP_##b1(_1) ML99_PRIV_LIST_SKIP_##b2(_2)             \
+             ML99_PRIV_LIST_SKIP_##b3(_3) ML99_PRIV_LIST_SKIP_##b4(_4)                             \
+                 ML99_PRIV_LIST_SKIP_##b5(_5) ML99_PRIV_LIST_SKIP_##b6(_6)                         \
+                     ML99_PRIV_LIST_SKIP_##b7(_7) ML99_PRIV_LIST_SKIP_##b8(_8)))
+
+#define ML99_PRIV_listPartitionDone(acc) ML99_PRIV_listPartitionDoneAux(ML99_PRIV_EXPAND acc, ~)
+#define ML99_PRIV_listPartitionDoneAux(...) ML99_PRIV_listPartitionRest_IMPL(__VA_ARGS__)
+#define ML99_PRIV_listPartitionRest_IMPL(f, yes, no, ...)                                          \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_VARIADICS_MORE_THAN_1(__VA_ARGS__),                                              \
+        ML99_PRIV_listPartitionOne,                                                                \
+        ML99_PRIV_listPartitionLists)                                                              \
+    (f, yes, no, __VA_ARGS__)
+#define ML99_PRIV_listPartitionOne(f, yes, no, x, ...)                                             \
+    ML99_call(                                                                                     \
+        ML99_PRIV_listPartitionKeepOne,                                                            \
+        v(f, yes, no, x),                                                                          \
+        ML99_appl_IMPL(f, x),                                                                      \
+        v(__VA_ARGS__))
+#define ML99_PRIV_listPartitionKeepOne_IMPL(f, yes, no, x, b, ...)                                 \
+    ML99_callUneval(                                                                               \
+        ML99_PRIV_listPartitionRest,                                                               \
+        f,                                                                                         \
+        (ML99_PRIV_EXPAND yes ML99_PRIV_LIST_KEEP_##b(x)),                                         \
+        (ML99_PRIV_EXPAND no ML99_PRIV_LIST_SKIP_##b(x)),                                          \
+        __VA_ARGS__)
+#define ML99_PRIV_listPartitionLists(_f, yes, no, ...)                                             \
+    ML99_call(                                                                                     \
+        ML99_PRIV_listTupleOf,                                                                     \
+        ML99_PRIV_listFilterListDone(yes),                                                         \
+        ML99_PRIV_listFilterListDone(no))
+
+#define ML99_PRIV_LIST_KEEP_0(x)
+#define ML99_PRIV_LIST_KEEP_1(x) , x
+#define ML99_PRIV_LIST_SKIP_0(x) , x
+#define ML99_PRIV_LIST_SKIP_1(x)
 // } (ML99_listPartition_IMPL)
 
+// ML99_listPartitionBy_IMPL {
+
+/* The lists are accumulated as `(~, ys...)`, all of them followed by the `~` sentinel, so that the
+ * item is appended to the list at the index `f(x)` by dropping and taking the lists before it in
+ * the same step. */
+
+#define ML99_listPartitionBy_IMPL(n, f, list)                                                      \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_NAT_EQ(n, 0),                                                                    \
+        ML99_PRIV_listPartitionByZeroError,                                                        \
+        ML99_PRIV_listPartitionByStart)                                                            \
+    (n, f, list)
+
+#define ML99_PRIV_listPartitionByStart(n, f, list)                                                 \
+    ML99_PRIV_listPartitionByGo(n, f, list, (ML99_PRIV_TIMES(ML99_PRIV_NAT_TO_BITS(n), (~), ) ~))
+#define ML99_PRIV_listPartitionByZeroError(_n, _f, _list)                                          \
+    ML99_fatal(ML99_listPartitionBy, n must be positive)
+
+#define ML99_PRIV_listPartitionByGo(n, f, list, lists)                                             \
+    ML99_PRIV_CAT(ML99_PRIV_listPartitionByGo_, ML99_CHOICE_TAG(list))(n, f, list, lists)
+
+#define ML99_PRIV_listPartitionByGo_nil(n, _f, _list, lists)                                       \
+    ML99_call(                                                                                     \
+        ML99_PRIV_listTupleOf,                                                                     \
+        ML99_callUneval(                                                                           \
+            ML99_PRIV_listPartitionByLists,                                                        \
+            ML99_PRIV_VARIADICS_TAKE(n, ML99_PRIV_EXPAND lists),                                   \
+            ~))
+#define ML99_PRIV_listPartitionByGo_cons(n, f, list, lists)                                        \
+    ML99_PRIV_listPartitionByGoCons(n, f, lists, ML99_PRIV_TAIL list)
+#define ML99_PRIV_listPartitionByGo_sized ML99_PRIV_listPartitionByGoOther
+#define ML99_PRIV_listPartitionByGo_gen   ML99_PRIV_listPartitionByGoOther
+#define ML99_PRIV_listPartitionByGoOther(n, f, list, lists)                                        \
+    ML99_call(ML99_PRIV_listPartitionByCell, v(n, f, lists), ML99_PRIV_listCell_IMPL(list))
+#define ML99_PRIV_listPartitionByCell_IMPL(n, f, lists, list)                                      \
+    ML99_PRIV_listPartitionByGo(n, f, list, lists)
+#define ML99_PRIV_listPartitionByGoCons(...) ML99_PRIV_listPartitionByGoConsAux(__VA_ARGS__)
+#define ML99_PRIV_listPartitionByGoConsAux(n, f, lists, x, xs)                                     \
+    ML99_call(ML99_PRIV_listPartitionByNext, v(n, f, xs, lists, x), ML99_appl_IMPL(f, x))
+
+#define ML99_PRIV_listPartitionByNext_IMPL(n, f, xs, lists, x, i)                                  \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_NAT_LESSER(i, n),                                                                \
+        ML99_PRIV_listPartitionByPush,                                                             \
+        ML99_PRIV_listPartitionByIndexError)                                                       \
+    (n, f, xs, lists, x, i)
+#define ML99_PRIV_listPartitionByPush(n, f, xs, lists, x, i)                                       \
+    ML99_PRIV_listPartitionByGo(n, f, xs, ML99_PRIV_LIST_PUSH(i, x, ML99_PRIV_EXPAND lists))
+#define ML99_PRIV_listPartitionByIndexError(_n, _f, _xs, _lists, _x, i)                            \
+    ML99_fatal(ML99_listPartitionBy, index i is out of range)
+
+#define ML99_PRIV_listPartitionByLists_IMPL(ys, ...)                                               \
+    ML99_PRIV_listFilterListDone(ys) ML99_PRIV_IF(                                                 \
+        ML99_PRIV_VARIADICS_MORE_THAN_1(__VA_ARGS__),                                              \
+        ML99_PRIV_listPartitionByNextList,                                                         \
+        ML99_PRIV_EMPTY)(__VA_ARGS__)
+#define ML99_PRIV_listPartitionByNextList(...)                                                     \
+    , v(,), ML99_callUneval(ML99_PRIV_listPartitionByLists, __VA_ARGS__)
+
+#define ML99_PRIV_LIST_PUSH(...) ML99_PRIV_LIST_PUSH_AUX(__VA_ARGS__)
+#define ML99_PRIV_LIST_PUSH_AUX(i, x, ...)                                                         \
+    ML99_PRIV_IF(ML99_PRIV_NAT_EQ(i, 0), ML99_PRIV_LIST_PUSH_FIRST, ML99_PRIV_LIST_PUSH_AT)        \
+    (i, x, __VA_ARGS__)
+#define ML99_PRIV_LIST_PUSH_FIRST(_i, x, ys, ...) ((ML99_PRIV_EXPAND ys, x), __VA_ARGS__)
+#define ML99_PRIV_LIST_PUSH_AT(i, x, ...)                                                          \
+    ML99_PRIV_LIST_PUSH_AT_AUX(                                                                    \
+        x,                                                                                         \
+        (ML99_PRIV_VARIADICS_TAKE(i, __VA_ARGS__)),                                                \
+        ML99_PRIV_VARIADICS_DROP(i, __VA_ARGS__))
+#define ML99_PRIV_LIST_PUSH_AT_AUX(...) ML99_PRIV_LIST_PUSH_AT_DONE(__VA_ARGS__)
+#define ML99_PRIV_LIST_PUSH_AT_DONE(x, before, ys, ...)                                            \
+    (ML99_PRIV_EXPAND before, (ML99_PRIV_EXPAND ys, x), __VA_ARGS__)
+// } (ML99_listPartitionBy_IMPL)
+
 #define ML99_listAppl_IMPL(f, list) ML99_listFoldl_IMPL(ML99_appl, f, list)
 
 // ML99_listUnwrapCommaSep_IMPL {
 
+/* The items are peeled as in `ML99_listUnwrap`, each of them preceded by a comma, except that the
+ * first chunk is accumulated after a dummy item `~` instead of an empty one and is emitted without
+ * it. */
+
 #define ML99_listUnwrapCommaSep_IMPL(list)                                                         \
     ML99_PRIV_IF(                                                                                  \
         ML99_IS_NIL(list),                                                                         \
-        v(ML99_EMPTY()),                                                                           \
-        ML99_variadicsTail(ML99_PRIV_listUnwrapCommaSepAux_IMPL(list)))
+        ML99_PRIV_listUnwrapCommaSepNil,                                                           \
+        ML99_PRIV_listUnwrapCommaSepCons)                                                          \
+    (list)
+
+#define ML99_PRIV_listUnwrapCommaSepNil(_list) v(ML99_EMPTY())
+#define ML99_PRIV_listUnwrapCommaSepCons(list)                                                     \
+    ML99_PRIV_LIST_UNWRAP_8(ML99_PRIV_listUnwrapCommaSepFirst, (~), list)
+
+#define ML99_PRIV_listUnwrapCommaSepFirstDone(acc) v(ML99_PRIV_TAIL acc)
+#define ML99_PRIV_listUnwrapCommaSepFirstChunk(acc, list)                                          \
+    ML99_TERMS(v(ML99_PRIV_TAIL acc), ML99_callUneval(ML99_PRIV_listUnwrapCommaSepRest, list))
 
-#define ML99_PRIV_listUnwrapCommaSepAux_IMPL(xs)                                                   \
-    ML99_match_IMPL(xs, ML99_PRIV_listUnwrapCommaSepAux_)
+#define ML99_PRIV_listUnwrapCommaSepRest_IMPL(list)                                                \
+    ML99_PRIV_LIST_UNWRAP_8(ML99_PRIV_listUnwrapCommaSepRest, (), list)
 
-#define ML99_PRIV_listUnwrapCommaSepAux_nil_IMPL(_) v(ML99_EMPTY())
-#define ML99_PRIV_listUnwrapCommaSepAux_cons_IMPL(x, xs)                                           \
-    ML99_TERMS(v(, x), ML99_PRIV_listUnwrapCommaSepAux_IMPL(xs))
+#define ML99_PRIV_listUnwrapCommaSepRestDone(acc) v(ML99_PRIV_EXPAND acc)
+#define ML99_PRIV_listUnwrapCommaSepRestChunk(acc, list)                                           \
+    ML99_TERMS(v(ML99_PRIV_EXPAND acc), ML99_callUneval(ML99_PRIV_listUnwrapCommaSepRest, list))
 // } (ML99_listUnwrapCommaSep_IMPL)
 
+// ML99_listSort_IMPL {
+
+/* A bottom-up merge sort: the items are first turned into single-item runs `(x)`, and each pass
+ * then merges the runs pairwise, left to right, until one run is left. A run being merged is
+ * followed by the runs `done` in this pass as `(~, (r1), ..., (rN))` and the runs left, so that a
+ * merge takes one item per reduction step and the pass continues where it stopped. The runs are
+ * merged by `merge`, which is `ML99_PRIV_listSortMergeBy` to compare the heads by `f` or
+ * `ML99_PRIV_listSortMergeNat` to compare them as natural numbers. On a tie, the item of the left
+ * run is taken first, which keeps the sort stable. */
+
+#define ML99_listSort_IMPL(f, list)                                                                \
+    ML99_PRIV_listSortRuns_IMPL(ML99_PRIV_listSortMergeBy, f, (~), list)
+#define ML99_listSortNat_IMPL(list)                                                                \
+    ML99_PRIV_listSortRuns_IMPL(ML99_PRIV_listSortMergeNat, ~, (~), list)
+
+#define ML99_PRIV_listSortRuns_IMPL(merge, f, runs, list)                                          \
+    ML99_matchWithArgs_IMPL(list, ML99_PRIV_listSortRuns_, merge, f, runs)
+#define ML99_PRIV_listSortRuns_nil_IMPL(_, merge, f, runs)                                         \
+    ML99_PRIV_listSortNextPass(merge, f, ML99_PRIV_EXPAND runs)
+#define ML99_PRIV_listSortRuns_cons_IMPL(x, xs, merge, f, runs)                                    \
+    ML99_PRIV_listSortRuns_IMPL(merge, f, (ML99_PRIV_EXPAND runs, (x)), xs)
+#define ML99_PRIV_listSortRuns_sized_IMPL(n, items, merge, f, runs)                                \
+    ML99_PRIV_listSizedMatchWithArgs_IMPL(ML99_PRIV_listSortRuns_, n, items, merge, f, runs)
+#define ML99_PRIV_listSortRuns_gen_IMPL(x, next, done, merge, f, runs)                             \
+    ML99_PRIV_listGenUncons_IMPL(ML99_PRIV_listSortRuns_, x, next, done, merge, f, runs)
+
+#define ML99_PRIV_listSortPass_IMPL(merge, f, done, ...)                                           \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_VARIADICS_MORE_THAN_2(__VA_ARGS__),                                              \
+        ML99_PRIV_listSortPassMerge,                                                               \
+        ML99_PRIV_listSortPassEnd)                                                                 \
+    (merge, f, done, __VA_ARGS__)
+#define ML99_PRIV_listSortPassMerge(merge, f, done, xs, ys, ...)                                   \
+    ML99_PRIV_CAT(merge, _IMPL)(merge, f, (~), xs, ys, done, __VA_ARGS__)
+#define ML99_PRIV_listSortPassEnd(merge, f, done, ...)                                             \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_VARIADICS_MORE_THAN_1(__VA_ARGS__),                                              \
+        ML99_PRIV_listSortPassEndOdd,                                                              \
+        ML99_PRIV_listSortPassEndEven)                                                             \
+    (merge, f, done, __VA_ARGS__)
+#define ML99_PRIV_listSortPassEndOdd(merge, f, done, xs, _)                                        \
+    ML99_PRIV_listSortNextPass(merge, f, ML99_PRIV_EXPAND done, xs)
+#define ML99_PRIV_listSortPassEndEven(merge, f, done, _)                                           \
+    ML99_PRIV_listSortNextPass(merge, f, ML99_PRIV_EXPAND done)
+
+#define ML99_PRIV_listSortNextPass(merge, f, ...)                                                  \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_VARIADICS_MORE_THAN_2(__VA_ARGS__),                                              \
+        ML99_PRIV_listSortNextPassAux,                                                             \
+        ML99_PRIV_IF(                                                                              \
+            ML99_PRIV_VARIADICS_MORE_THAN_1(__VA_ARGS__),                                          \
+            ML99_PRIV_listSortDone,                                                                \
+            ML99_PRIV_listSortDoneNil))                                                            \
+    (merge, f, __VA_ARGS__)
+#define ML99_PRIV_listSortNextPassAux(merge, f, _, ...)                                            \
+    ML99_callUneval(ML99_PRIV_listSortPass, merge, f, (~), __VA_ARGS__, ~)
+#define ML99_PRIV_listSortDone(_merge, _f, _, xs) ML99_list_IMPL(ML99_PRIV_EXPAND xs)
+#define ML99_PRIV_listSortDoneNil(_merge, _f, _)  v(ML99_NIL())
+
+#define ML99_PRIV_listSortMergeBy_IMPL(merge, f, acc, xs, ys, ...)                                 \
+    ML99_call(                                                                                     \
+        ML99_PRIV_listSortMergeByAux,                                                              \
+        ML99_appl2_IMPL(f, ML99_PRIV_HEAD ys, ML99_PRIV_HEAD xs),                                  \
+        v(merge, f, acc, xs, ys, __VA_ARGS__))
+#define ML99_PRIV_listSortMergeByAux_IMPL(ys_first, ...)                                           \
+    ML99_PRIV_listSortTake(ys_first, __VA_ARGS__)
+#define ML99_PRIV_listSortMergeNat_IMPL(merge, f, acc, xs, ys, ...)                                \
+    ML99_PRIV_listSortTake(                                                                        \
+        ML99_NAT_LESSER(ML99_PRIV_HEAD ys, ML99_PRIV_HEAD xs),                                     \
+        merge,                                                                                     \
+        f,                                                                                         \
+        acc,                                                                                       \
+        xs,                                                                                        \
+        ys,                                                                                        \
+        __VA_ARGS__)
+
+/* `ML99_PRIV_listSortTake` moves the head of `ys` if `ys_first` is 1, or the head of `xs`
+ * otherwise, to `acc`; if that run runs out, the merged run is `acc` followed by the other run. */
+
+#define ML99_PRIV_listSortTake(ys_first, merge, f, acc, xs, ys, ...)                               \
+    ML99_PRIV_IF(                                                                                  \
+        ys_first,                                                                                  \
+        ML99_PRIV_IF(                                                                              \
+            ML99_VARIADICS_IS_SINGLE(ML99_PRIV_EXPAND ys),                                         \
+            ML99_PRIV_listSortTakeLast,                                                            \
+            ML99_PRIV_listSortTakeSnd),                                                            \
+        ML99_PRIV_IF(                                                                              \
+            ML99_VARIADICS_IS_SINGLE(ML99_PRIV_EXPAND xs),                                         \
+            ML99_PRIV_listSortTakeLast,                                                            \
+            ML99_PRIV_listSortTakeFst))                                                            \
+    (merge, f, acc, ML99_PRIV_IF(ys_first, ys, xs), ML99_PRIV_IF(ys_first, xs, ys), __VA_ARGS__)
+
+/* The run that the head is taken from is `xs` below, and the other one is `ys`. */
+
+#define ML99_PRIV_listSortTakeFst(merge, f, acc, xs, ys, ...)                                      \
+    ML99_callUneval(                                                                               \
+        merge,                                                                                     \
+        merge,                                                                                     \
+        f,                                                                                         \
+        (ML99_PRIV_EXPAND acc, ML99_PRIV_HEAD xs),                                                 \
+        (ML99_PRIV_TAIL xs),                                                                       \
+        ys,                                                                                        \
+        __VA_ARGS__)
+#define ML99_PRIV_listSortTakeSnd(merge, f, acc, ys, xs, ...)                                      \
+    ML99_callUneval(                                                                               \
+        merge,                                                                                     \
+        merge,                                                                                     \
+        f,                                                                                         \
+        (ML99_PRIV_EXPAND acc, ML99_PRIV_HEAD ys),                                                 \
+        xs,                                                                                        \
+        (ML99_PRIV_TAIL ys),                                                                       \
+        __VA_ARGS__)
+#define ML99_PRIV_listSortTakeLast(merge, f, acc, xs, ys, done, ...)                               \
+    ML99_callUneval(                                                                               \
+        ML99_PRIV_listSortPass,                                                                    \
+        merge,                                                                                     \
+        f,                                                                                         \
+        (ML99_PRIV_EXPAND done,                                                                    \
+         (ML99_PRIV_TAIL(ML99_PRIV_EXPAND acc, ML99_PRIV_EXPAND xs, ML99_PRIV_EXPAND ys))),        \
+        __VA_ARGS__)
+// } (ML99_listSort_IMPL)
+
+// ML99_listPipe_IMPL {
+
+/* The stages of a pipeline are `(tag, arg)` tuples, kept in `stages` as `(s1, ..., sN, end, ~)`
+ * with `end` being `(ML99_PRIV_listPipeEnd, ~)`. An item `x` goes through them by
+ * `ML99_PRIV_listPipeStep`, which invokes `tag_IMPL(arg, x, xs, stages, sink, rest)` for the first
+ * stage of the `rest` tuple of stages left. The end stage hands the item to `sink`:
+ * `(ML99_PRIV_listPipeCollect, ~, ys...)` accumulates the resulting items, which become a list
+ * once `xs` is exhausted, and `(ML99_PRIV_listPipeFold, f, acc)` folds them. */
+
+#define ML99_listPipe_IMPL(list, ...)                                                              \
+    ML99_PRIV_listPipeCompile_IMPL(list, (~), __VA_ARGS__, ~)
+
+#define ML99_mapStage_IMPL(f)         v((ML99_PRIV_listPipeMap, f))
+#define ML99_filterStage_IMPL(f)      v((ML99_PRIV_listPipeFilter, f))
+#define ML99_foldStage_IMPL(f, init)  v((ML99_PRIV_listPipeFold, f, init))
+#define ML99_PRIV_listPipeMap_FOLD    0
+#define ML99_PRIV_listPipeFilter_FOLD 0
+#define ML99_PRIV_listPipeFold_FOLD   1
+
+#define ML99_PRIV_listPipeIsFold(stage) ML99_PRIV_CAT(ML99_PRIV_HEAD stage, _FOLD)
+
+#define ML99_PRIV_listPipeCompile_IMPL(list, stages, stage, ...)                                   \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_VARIADICS_IS_SINGLE(__VA_ARGS__),                                                     \
+        ML99_PRIV_IF(                                                                              \
+            ML99_PRIV_listPipeIsFold(stage),                                                       \
+            ML99_PRIV_listPipeCompileFold,                                                         \
+            ML99_PRIV_listPipeCompileCollect),                                                     \
+        ML99_PRIV_IF(                                                                              \
+            ML99_PRIV_listPipeIsFold(stage),                                                       \
+            ML99_PRIV_listPipeMisplacedFold,                                                       \
+            ML99_PRIV_listPipeCompileProgress))                                                    \
+    (list, stages, stage, __VA_ARGS__)
+#define ML99_PRIV_listPipeCompileProgress(list, stages, stage, ...)                                \
+    ML99_callUneval(ML99_PRIV_listPipeCompile, list, (ML99_PRIV_EXPAND stages, stage), __VA_ARGS__)
+#define ML99_PRIV_listPipeCompileFold(list, stages, stage, _)                                      \
+    ML99_PRIV_listPipeGo_IMPL(                                                                     \
+        list,                                                                                      \
+        (ML99_PRIV_TAIL(ML99_PRIV_EXPAND stages, (ML99_PRIV_listPipeEnd, ~), ~)),                  \
+        stage)
+#define ML99_PRIV_listPipeCompileCollect(list, stages, stage, _)                                   \
+    ML99_PRIV_listPipeGo_IMPL(                                                                     \
+        list,                                                                                      \
+        (ML99_PRIV_TAIL(ML99_PRIV_EXPAND stages, stage, (ML99_PRIV_listPipeEnd, ~), ~)),           \
+        (ML99_PRIV_listPipeCollect, ~))
+#define ML99_PRIV_listPipeMisplacedFold(...)                                                       \
+    ML99_fatal(ML99_listPipe, ML99_foldStage must be the last stage)
+
+#define ML99_PRIV_listPipeGo_IMPL(list, stages, sink)                                              \
+    ML99_matchWithArgs_IMPL(list, ML99_PRIV_listPipeGo_, stages, sink)
+#define ML99_PRIV_listPipeGo_nil_IMPL(_, _stages, sink)                                            \
+    ML99_PRIV_CAT(ML99_PRIV_HEAD sink, Done) sink
+#define ML99_PRIV_listPipeGo_cons_IMPL(x, xs, stages, sink)                                        \
+    ML99_PRIV_listPipeStep(x, xs, stages, sink, stages)
+#define ML99_PRIV_listPipeGo_sized_IMPL(n, items, stages, sink)                                    \
+    ML99_PRIV_listSizedMatchWithArgs_IMPL(ML99_PRIV_listPipeGo_, n, items, stages, sink)
+#define ML99_PRIV_listPipeGo_gen_IMPL(x, next, done, stages, sink)                                 \
+    ML99_PRIV_listGenUncons_IMPL(ML99_PRIV_listPipeGo_, x, next, done, stages, sink)
+
+#define ML99_PRIV_listPipeStep(x, xs, stages, sink, rest)                                          \
+    ML99_PRIV_listPipeStepAux(x, xs, stages, sink, ML99_PRIV_HEAD rest, (ML99_PRIV_TAIL rest))
+#define ML99_PRIV_listPipeStepAux(x, xs, stages, sink, stage, rest)                                \
+    ML99_PRIV_CAT(ML99_PRIV_HEAD stage, _IMPL)(ML99_PRIV_TAIL stage, x, xs, stages, sink, rest)
+
+#define ML99_PRIV_listPipeMap_IMPL(f, x, xs, stages, sink, rest)                                   \
+    ML99_call(ML99_PRIV_listPipeMapped, ML99_appl_IMPL(f, x), v(xs, stages, sink, rest))
+#define ML99_PRIV_listPipeMapped_IMPL(y, xs, stages, sink, rest)                                   \
+    ML99_PRIV_listPipeStep(y, xs, stages, sink, rest)
+
+#define ML99_PRIV_listPipeFilter_IMPL(f, x, xs, stages, sink, rest)                                \
+    ML99_call(ML99_PRIV_listPipeFiltered, ML99_appl_IMPL(f, x), v(x, xs, stages, sink, rest))
+#define ML99_PRIV_listPipeFiltered_IMPL(keep, x, xs, stages, sink, rest)                           \
+    ML99_PRIV_IF(keep, ML99_PRIV_listPipeStep, ML99_PRIV_listPipeSkip)(x, xs, stages, sink, rest)
+#define ML99_PRIV_listPipeSkip(_x, xs, stages, sink, _rest)                                        \
+    ML99_PRIV_listPipeGo_IMPL(xs, stages, sink)
+
+#define ML99_PRIV_listPipeEnd_IMPL(_, x, xs, stages, sink, _rest)                                  \
+    ML99_PRIV_CAT(ML99_PRIV_HEAD sink, _IMPL)(x, xs, stages, sink)
+
+#define ML99_PRIV_listPipeCollect_IMPL(x, xs, stages, sink)                                        \
+    ML99_callUneval(ML99_PRIV_listPipeGo, xs, stages, (ML99_PRIV_EXPAND sink, x))
+#define ML99_PRIV_listPipeCollectDone(_tag, ...)                                                   \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_VARIADICS_MORE_THAN_1(__VA_ARGS__),                                              \
+        ML99_PRIV_listPipeCollectList,                                                             \
+        ML99_PRIV_listPipeCollectNil)                                                              \
+    (__VA_ARGS__)
+#define ML99_PRIV_listPipeCollectList(_, ...) ML99_list_IMPL(__VA_ARGS__)
+#define ML99_PRIV_listPipeCollectNil(_)       v(ML99_NIL())
+
+#define ML99_PRIV_listPipeFold_IMPL(x, xs, stages, sink)                                           \
+    ML99_call(                                                                                     \
+        ML99_PRIV_listPipeFolded,                                                                  \
+        v(xs, stages, ML99_PRIV_listPipeFoldFn sink),                                              \
+        ML99_appl2_IMPL(ML99_PRIV_listPipeFoldFn sink, ML99_PRIV_listPipeFoldAcc sink, x))
+#define ML99_PRIV_listPipeFolded_IMPL(xs, stages, f, acc)                                          \
+    ML99_PRIV_listPipeGo_IMPL(xs, stages, (ML99_PRIV_listPipeFold, f, acc))
+#define ML99_PRIV_listPipeFoldDone(_tag, _f, acc) v(acc)
+#define ML99_PRIV_listPipeFoldFn(_tag, f, _acc)   f
+#define ML99_PRIV_listPipeFoldAcc(_tag, _f, acc)  acc
+// } (ML99_listPipe_IMPL)
+
 // clang-format off
 #define ML99_PRIV_EMPTY_LIST_ERROR(f) ML99_fatal(ML99_##f, expected a non-empty list)
 // clang-format on
@@ -1013,6 +2817,13 @@
 #define ML99_PRIV_IS_NIL(list) ML99_DETECT_IDENT(ML99_PRIV_IS_NIL_, ML99_CHOICE_TAG(list))
 #define ML99_PRIV_IS_NIL_nil   ()
 
+#define ML99_PRIV_LIST_IS_CONS(list)                                                               \
+    ML99_DETECT_IDENT(ML99_PRIV_LIST_IS_CONS_, ML99_CHOICE_TAG(list))
+#define ML99_PRIV_LIST_IS_CONS_cons ()
+
+// The results of `ML99_listUnzip`, `ML99_listPartition`, and `ML99_listPartitionBy`.
+#define ML99_PRIV_listTupleOf_IMPL(...) v((__VA_ARGS__))
+
 // Arity specifiers {
 
 #define ML99_cons_ARITY               2
@@ -1023,6 +2834,13 @@
 #define ML99_listInit_ARITY           1
 #define ML99_list_ARITY               1
 #define ML99_listFromTuples_ARITY     2
+#define ML99_sizedList_ARITY          1
+#define ML99_listSized_ARITY          1
+#define ML99_listUnsized_ARITY        1
+#define ML99_isSizedList_ARITY        1
+#define ML99_range_ARITY              2
+#define ML99_iterate_ARITY            2
+#define ML99_generator_ARITY          3
 #define ML99_listLen_ARITY            1
 #define ML99_listAppend_ARITY         2
 #define ML99_listAppendItem_ARITY     2
@@ -1045,8 +2863,15 @@
 #define ML99_listMapInitLast_ARITY    3
 #define ML99_listForInitLast_ARITY    3
 #define ML99_listFilter_ARITY         2
+#define ML99_listFilterInPlace_ARITY  2
+#define ML99_listFilterMap_ARITY      2
 #define ML99_listEq_ARITY             3
+#define ML99_listEqNat_ARITY          2
+#define ML99_listEqIdent_ARITY        3
 #define ML99_listContains_ARITY       3
+#define ML99_listContainsNat_ARITY    2
+#define ML99_listContainsIdent_ARITY  3
+#define ML99_listDedup_ARITY          2
 #define ML99_listTake_ARITY           2
 #define ML99_listTakeWhile_ARITY      2
 #define ML99_listDrop_ARITY           2
@@ -1055,9 +2880,15 @@
 #define ML99_listUnzip_ARITY          1
 #define ML99_listReplicate_ARITY      2
 #define ML99_listPartition_ARITY      2
+#define ML99_listPartitionBy_ARITY    3
 #define ML99_listAppl_ARITY           2
+#define ML99_listSort_ARITY           2
+#define ML99_listSortNat_ARITY        1
+#define ML99_listPipe_ARITY           2
+#define ML99_mapStage_ARITY           1
+#define ML99_filterStage_ARITY        1
+#define ML99_foldStage_ARITY          2
 
-#define ML99_PRIV_listPartitionAux_ARITY 3
 // } (Arity specifiers)
 
 #endif // DOXYGEN_IGNORE
@@ -118,6 +118,57 @@
  */
 #define ML99_boolEq(x, y) ML99_call(ML99_boolEq, x, y)
 
+/**
+ * Short-circuit logical conjunction: evaluates to `ML99_appl(f, ...)` if @p x is true, and to 0
+ * otherwise.
+ *
+ * Unlike #ML99_and, the second operand is not computed unless @p x is true, so it can rely on what
+ * @p x has checked.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/list.h>
+ * #include <metalang99/logical.h>
+ * #include <metalang99/nat.h>
+ *
+ * #define HEAD_IS_ZERO_IMPL(list) ML99_natEq(ML99_listHead(v(list)), v(0))
+ * #define HEAD_IS_ZERO_ARITY      1
+ *
+ * // 0, without failing on the empty list
+ * ML99_andThen(ML99_isCons(ML99_nil()), v(HEAD_IS_ZERO), ML99_nil())
+ *
+ * // 1
+ * ML99_andThen(ML99_isCons(ML99_list(v(0, 1))), v(HEAD_IS_ZERO), ML99_list(v(0, 1)))
+ * @endcode
+ */
+#define ML99_andThen(x, f, ...) ML99_call(ML99_andThen, x, f, __VA_ARGS__)
+
+/**
+ * Short-circuit logical inclusive OR: evaluates to 1 if @p x is true, and to `ML99_appl(f, ...)`
+ * otherwise.
+ *
+ * Unlike #ML99_or, the second operand is not computed if @p x is true.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/list.h>
+ * #include <metalang99/logical.h>
+ * #include <metalang99/nat.h>
+ *
+ * #define HEAD_IS_ZERO_IMPL(list) ML99_natEq(ML99_listHead(v(list)), v(0))
+ * #define HEAD_IS_ZERO_ARITY      1
+ *
+ * // 1, without failing on the empty list
+ * ML99_orElse(ML99_isNil(ML99_nil()), v(HEAD_IS_ZERO), ML99_nil())
+ *
+ * // 0
+ * ML99_orElse(ML99_isNil(ML99_list(v(1))), v(HEAD_IS_ZERO), ML99_list(v(1)))
+ * @endcode
+ */
+#define ML99_orElse(x, f, ...) ML99_call(ML99_orElse, x, f, __VA_ARGS__)
+
 #define ML99_TRUE(...)  1
 #define ML99_FALSE(...) 0
 
@@ -138,15 +189,22 @@
 #define ML99_xor_IMPL(x, y)    v(ML99_XOR(x, y))
 #define ML99_boolEq_IMPL(x, y) v(ML99_BOOL_EQ(x, y))
 
+#define ML99_andThen_IMPL(x, f, ...)                                                               \
+    ML99_PRIV_IF(x, ML99_appl_IMPL, ML99_false_IMPL)(f, __VA_ARGS__)
+#define ML99_orElse_IMPL(x, f, ...)                                                                \
+    ML99_PRIV_IF(x, ML99_true_IMPL, ML99_appl_IMPL)(f, __VA_ARGS__)
+
 // Arity specifiers {
 
-#define ML99_true_ARITY   1
-#define ML99_false_ARITY  1
-#define ML99_not_ARITY    1
-#define ML99_and_ARITY    2
-#define ML99_or_ARITY     2
-#define ML99_xor_ARITY    2
-#define ML99_boolEq_ARITY 2
+#define ML99_true_ARITY    1
+#define ML99_false_ARITY   1
+#define ML99_not_ARITY     1
+#define ML99_and_ARITY     2
+#define ML99_or_ARITY      2
+#define ML99_xor_ARITY     2
+#define ML99_boolEq_ARITY  2
+#define ML99_andThen_ARITY 3
+#define ML99_orElse_ARITY  3
 // } (Arity specifiers)
 
 #endif // DOXYGEN_IGNORE
@@ -0,0 +1,416 @@
+/**
+ * @file
+ * Associative maps keyed by natural numbers or identifiers.
+ *
+ * A map associates each of its keys with a single value, and #ML99_mapGet looks up a key without
+ * walking through the whole map wherever the kind of keys allows it:
+ *
+ *  - A map constructed by #ML99_natMap keeps a slot for every natural number up to its greatest
+ *    key, so that #ML99_mapGet, #ML99_mapInsert, and #ML99_mapRemove take a constant number of
+ *    reduction steps. A key must be lesser than #ML99_NAT_MAX.
+ *  - A map constructed by #ML99_identMap compares identifiers by `ML99_IDENT_EQ(prefix, x, y)`, so
+ *    that `prefix##x##_##y` must be defined as `()` if and only if `x` and `y` are equal (see
+ *    #ML99_identEq). The keys are compared eight per reduction step, so that a lookup in a map of
+ *    at most eight entries takes a constant number of steps. A map holds at most #ML99_NAT_MAX
+ *    entries.
+ *
+ * Since the values are arguments of macros, a value that contains a comma must be parenthesised.
+ *
+ * `metalang99.h` does not include this header.
+ */
+
+#ifndef ML99_MAP_H
+#define ML99_MAP_H
+
+#include <metalang99/variadics/slice.h>
+
+#include <metalang99/priv/util.h>
+
+#include <metalang99/ident.h>
+#include <metalang99/identset.h>
+#include <metalang99/lang.h>
+#include <metalang99/list.h>
+#include <metalang99/maybe.h>
+#include <metalang99/nat.h>
+
+/**
+ * The empty map keyed by natural numbers.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/map.h>
+ *
+ * // ML99_nothing()
+ * ML99_mapGet(v(5), ML99_natMap())
+ * @endcode
+ */
+#define ML99_natMap(...) ML99_callUneval(ML99_natMap, )
+
+/**
+ * The empty map keyed by identifiers that are compared by @p prefix.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/map.h>
+ *
+ * #define FOO_x_x ()
+ *
+ * // ML99_nothing()
+ * ML99_mapGet(v(x), ML99_identMap(v(FOO_)))
+ * @endcode
+ */
+#define ML99_identMap(prefix) ML99_call(ML99_identMap, prefix)
+
+/**
+ * Associates @p key with @p val in @p map, replacing the value that @p key had.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/map.h>
+ *
+ * // ML99_just(7)
+ * ML99_mapGet(v(3), ML99_mapInsert(v(3), v(7), ML99_mapInsert(v(3), v(5), ML99_natMap())))
+ * @endcode
+ */
+#define ML99_mapInsert(key, val, map) ML99_call(ML99_mapInsert, key, val, map)
+
+/**
+ * Looks up @p key in @p map: evaluates to `ML99_just(val)` if @p key is associated with `val`,
+ * otherwise `ML99_nothing()`.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/map.h>
+ *
+ * #define FOO_x_x ()
+ * #define FOO_y_y ()
+ *
+ * #define MAP ML99_mapInsert(v(y), v(2), ML99_mapInsert(v(x), v(1), ML99_identMap(v(FOO_))))
+ *
+ * // ML99_just(2)
+ * ML99_mapGet(v(y), MAP)
+ *
+ * // ML99_nothing()
+ * ML99_mapGet(v(z), MAP)
+ * @endcode
+ */
+#define ML99_mapGet(key, map) ML99_call(ML99_mapGet, key, map)
+
+/**
+ * Checks whether @p key is associated with a value in @p map.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/map.h>
+ *
+ * // 1
+ * ML99_mapContains(v(3), ML99_mapInsert(v(3), v(~), ML99_natMap()))
+ *
+ * // 0
+ * ML99_mapContains(v(4), ML99_mapInsert(v(3), v(~), ML99_natMap()))
+ * @endcode
+ */
+#define ML99_mapContains(key, map) ML99_call(ML99_mapContains, key, map)
+
+/**
+ * Removes @p key from @p map, if it is there.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/map.h>
+ *
+ * // ML99_nothing()
+ * ML99_mapGet(v(3), ML99_mapRemove(v(3), ML99_mapInsert(v(3), v(7), ML99_natMap())))
+ * @endcode
+ */
+#define ML99_mapRemove(key, map) ML99_call(ML99_mapRemove, key, map)
+
+/**
+ * The list of the keys of @p map.
+ *
+ * The keys of a map keyed by natural numbers are in ascending order, and the keys of a map keyed
+ * by identifiers are in the order of their insertion.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/map.h>
+ *
+ * // ML99_list(v(1, 5))
+ * ML99_mapKeys(ML99_mapInsert(v(5), v(b), ML99_mapInsert(v(1), v(a), ML99_natMap())))
+ * @endcode
+ */
+#define ML99_mapKeys(map) ML99_call(ML99_mapKeys, map)
+
+/**
+ * The list of the values of @p map, in the order of #ML99_mapKeys.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/map.h>
+ *
+ * // ML99_list(v(a, b))
+ * ML99_mapValues(ML99_mapInsert(v(5), v(b), ML99_mapInsert(v(1), v(a), ML99_natMap())))
+ * @endcode
+ */
+#define ML99_mapValues(map) ML99_call(ML99_mapValues, map)
+
+#ifndef DOXYGEN_IGNORE
+
+/* A map is `(kind, data...)`, and a function dispatches on `kind`. */
+
+#define ML99_mapInsert_IMPL(key, val, map)                                                         \
+    ML99_PRIV_CAT(ML99_PRIV_mapInsert_, ML99_PRIV_HEAD map)(key, val, ML99_PRIV_TAIL map)
+#define ML99_mapGet_IMPL(key, map)                                                                 \
+    ML99_PRIV_CAT(ML99_PRIV_mapGet_, ML99_PRIV_HEAD map)(key, ML99_PRIV_TAIL map)
+#define ML99_mapContains_IMPL(key, map) ML99_call(ML99_isJust, ML99_mapGet_IMPL(key, map))
+#define ML99_mapRemove_IMPL(key, map)                                                              \
+    ML99_PRIV_CAT(ML99_PRIV_mapRemove_, ML99_PRIV_HEAD map)(key, ML99_PRIV_TAIL map)
+#define ML99_mapKeys_IMPL(map)                                                                     \
+    ML99_PRIV_CAT(ML99_PRIV_mapKeys_, ML99_PRIV_HEAD map)(ML99_PRIV_TAIL map)
+#define ML99_mapValues_IMPL(map)                                                                   \
+    ML99_PRIV_CAT(ML99_PRIV_mapValues_, ML99_PRIV_HEAD map)(ML99_PRIV_TAIL map)
+
+// `s0, ..., s(n - 1),` if `n` is not 0, for the arguments `s0, ...` followed by a sentinel.
+#define ML99_PRIV_mapPrefix(n, ...)                                                                \
+    ML99_PRIV_IF(ML99_NAT_EQ(n, 0), ML99_PRIV_EMPTY, ML99_PRIV_mapPrefixTake)(n, __VA_ARGS__)
+#define ML99_PRIV_mapPrefixTake(n, ...) ML99_PRIV_VARIADICS_TAKE(n, __VA_ARGS__),
+
+// Natural keys {
+
+/* A map keyed by natural numbers is `(nat, n, (s0, ..., s(n - 1), ~))`, where the slot `si` is
+ * `(1, val)` if `i` is associated with `val`, otherwise `(0, ~)`. */
+
+#define ML99_natMap_IMPL(...) v((nat, 0, (~)))
+
+#define ML99_PRIV_mapGet_nat(key, ...) ML99_PRIV_mapNatGet(key, __VA_ARGS__)
+#define ML99_PRIV_mapNatGet(key, n, slots)                                                         \
+    ML99_PRIV_IF(ML99_NAT_LESSER(key, n), ML99_PRIV_mapNatGetSlot, ML99_PRIV_mapNothing)(key, slots)
+#define ML99_PRIV_mapNatGetSlot(key, slots)                                                        \
+    ML99_PRIV_mapNatSlot(ML99_PRIV_HEAD(ML99_PRIV_VARIADICS_DROP(key, ML99_PRIV_EXPAND slots)))
+#define ML99_PRIV_mapNatSlot(slot)                                                                 \
+    ML99_PRIV_IF(ML99_PRIV_HEAD slot, ML99_PRIV_mapJust, ML99_PRIV_mapNothing)(ML99_PRIV_TAIL slot)
+
+#define ML99_PRIV_mapInsert_nat(key, val, ...)                                                     \
+    ML99_PRIV_mapNatInsert(key, val, __VA_ARGS__)
+#define ML99_PRIV_mapNatInsert(key, val, n, slots)                                                 \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_NAT_LESSER(key, n),                                                                   \
+        ML99_PRIV_mapNatSet,                                                                       \
+        ML99_PRIV_IF(                                                                              \
+            ML99_NAT_EQ(key, ML99_NAT_MAX),                                                        \
+            ML99_PRIV_mapNatKeyError,                                                              \
+            ML99_PRIV_mapNatExtend))                                                               \
+    (key, (1, val), n, slots)
+
+
+#define ML99_PRIV_mapRemove_nat(key, ...) ML99_PRIV_mapNatRemove(key, __VA_ARGS__)
+#define ML99_PRIV_mapNatRemove(key, n, slots)                                                      \
+    ML99_PRIV_IF(ML99_NAT_LESSER(key, n), ML99_PRIV_mapNatSet, ML99_PRIV_mapNatSame)               \
+    (key, (0, ~), n, slots)
+
+#define ML99_PRIV_mapNatSet(key, slot, n, slots)                                                   \
+    v((nat,                                                                                        \
+       n,                                                                                          \
+       (ML99_PRIV_mapPrefix(key, ML99_PRIV_EXPAND slots) slot,                                     \
+        ML99_PRIV_VARIADICS_DROP(ML99_PRIV_INC(key), ML99_PRIV_EXPAND slots))))
+#define ML99_PRIV_mapNatExtend(key, slot, n, slots)                                                \
+    v((nat,                                                                                        \
+       ML99_PRIV_INC(key),                                                                         \
+       (ML99_PRIV_mapPrefix(n, ML99_PRIV_EXPAND slots)                                             \
+            ML99_PRIV_mapPrefix(ML99_PRIV_NAT_SUB(key, n), ML99_PRIV_MAP_ABSENT_256, ~) slot,      \
+        ~)))
+#define ML99_PRIV_mapNatSame(_key, _slot, n, slots) v((nat, n, slots))
+#define ML99_PRIV_mapNatKeyError(k, ...)                                                           \
+    ML99_fatal(ML99_mapInsert, key k is not lesser than ML99_NAT_MAX)
+
+/* The keys and the values are walked through four slots per reduction step. `sel(i, si)` is
+ * `(1, x)` if the item `x` is produced for the slot `si` of the key `i`, otherwise `(0, ~)`. */
+
+#define ML99_PRIV_mapKeys_nat(...)   ML99_PRIV_mapNatItems(ML99_PRIV_mapNatKey, __VA_ARGS__)
+#define ML99_PRIV_mapValues_nat(...) ML99_PRIV_mapNatItems(ML99_PRIV_mapNatValue, __VA_ARGS__)
+#define ML99_PRIV_mapNatKey(i, slot)       (ML99_PRIV_HEAD slot, i)
+#define ML99_PRIV_mapNatValue(_i, slot)    slot
+
+#define ML99_PRIV_mapNatItems(sel, _n, slots)                                                      \
+    ML99_PRIV_mapNatItems_IMPL(sel, 0, (~), ML99_PRIV_EXPAND slots, ~)
+#define ML99_PRIV_mapNatItems_IMPL(...) ML99_PRIV_mapNatItems1(__VA_ARGS__)
+
+#define ML99_PRIV_mapNatItems1(sel, i, acc, slot, ...)                                             \
+    ML99_PRIV_IF(ML99_PRIV_IS_TUPLE_FAST(slot), ML99_PRIV_mapNatItemsSlot1, ML99_PRIV_mapItemsDone)\
+    (sel, i, acc, slot, __VA_ARGS__)
+#define ML99_PRIV_mapNatItemsSlot1(sel, i, acc, slot, ...)                                         \
+    ML99_PRIV_mapNatItems2(sel, ML99_PRIV_INC(i), ML99_PRIV_mapKeep(acc, sel(i, slot)), __VA_ARGS__)
+
+#define ML99_PRIV_mapNatItems2(sel, i, acc, slot, ...)                                             \
+    ML99_PRIV_IF(ML99_PRIV_IS_TUPLE_FAST(slot), ML99_PRIV_mapNatItemsSlot2, ML99_PRIV_mapItemsDone)\
+    (sel, i, acc, slot, __VA_ARGS__)
+#define ML99_PRIV_mapNatItemsSlot2(sel, i, acc, slot, ...)                                         \
+    ML99_PRIV_mapNatItems3(sel, ML99_PRIV_INC(i), ML99_PRIV_mapKeep(acc, sel(i, slot)), __VA_ARGS__)
+
+#define ML99_PRIV_mapNatItems3(sel, i, acc, slot, ...)                                             \
+    ML99_PRIV_IF(ML99_PRIV_IS_TUPLE_FAST(slot), ML99_PRIV_mapNatItemsSlot3, ML99_PRIV_mapItemsDone)\
+    (sel, i, acc, slot, __VA_ARGS__)
+#define ML99_PRIV_mapNatItemsSlot3(sel, i, acc, slot, ...)                                         \
+    ML99_PRIV_mapNatItems4(sel, ML99_PRIV_INC(i), ML99_PRIV_mapKeep(acc, sel(i, slot)), __VA_ARGS__)
+
+#define ML99_PRIV_mapNatItems4(sel, i, acc, slot, ...)                                             \
+    ML99_PRIV_IF(ML99_PRIV_IS_TUPLE_FAST(slot), ML99_PRIV_mapNatItemsSlot4, ML99_PRIV_mapItemsDone)\
+    (sel, i, acc, slot, __VA_ARGS__)
+#define ML99_PRIV_mapNatItemsSlot4(sel, i, acc, slot, ...)                                         \
+    ML99_PRIV_mapNatItemsNext(                                                                     \
+        sel,                                                                                       \
+        ML99_PRIV_INC(i),                                                                          \
+        ML99_PRIV_mapKeep(acc, sel(i, slot)),                                                      \
+        __VA_ARGS__)
+
+#define ML99_PRIV_mapNatItemsNext(sel, i, acc, ...)                                                \
+    ML99_callUneval(ML99_PRIV_mapNatItems, sel, i, acc, __VA_ARGS__)
+
+// Appends `x` to the accumulator `(~, xs...)` if `item` is `(1, x)`.
+#define ML99_PRIV_mapKeep(acc, item)    ML99_PRIV_mapKeepAux(acc, ML99_PRIV_EXPAND item)
+#define ML99_PRIV_mapKeepAux(...)       ML99_PRIV_mapKeepAuxAux(__VA_ARGS__)
+#define ML99_PRIV_mapKeepAuxAux(acc, b, x) (ML99_PRIV_EXPAND acc ML99_PRIV_mapKeep##b(x))
+#define ML99_PRIV_mapKeep0(_x)
+#define ML99_PRIV_mapKeep1(x) , x
+
+#define ML99_PRIV_mapItemsDone(_sel, _i, acc, ...)                                                 \
+    ML99_PRIV_mapItemsDoneAux(ML99_PRIV_EXPAND acc)
+#define ML99_PRIV_mapItemsDoneAux(...)                                                             \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_VARIADICS_MORE_THAN_1(__VA_ARGS__),                                              \
+        ML99_PRIV_mapItemsList,                                                                    \
+        ML99_PRIV_mapItemsNil)                                                                     \
+    (__VA_ARGS__)
+#define ML99_PRIV_mapItemsList(_, ...) ML99_list_IMPL(__VA_ARGS__)
+#define ML99_PRIV_mapItemsNil(_)       v(ML99_NIL())
+
+#define ML99_PRIV_MAP_ABSENT_1   (0, ~)
+#define ML99_PRIV_MAP_ABSENT_2   ML99_PRIV_MAP_ABSENT_1, ML99_PRIV_MAP_ABSENT_1
+#define ML99_PRIV_MAP_ABSENT_4   ML99_PRIV_MAP_ABSENT_2, ML99_PRIV_MAP_ABSENT_2
+#define ML99_PRIV_MAP_ABSENT_8   ML99_PRIV_MAP_ABSENT_4, ML99_PRIV_MAP_ABSENT_4
+#define ML99_PRIV_MAP_ABSENT_16  ML99_PRIV_MAP_ABSENT_8, ML99_PRIV_MAP_ABSENT_8
+#define ML99_PRIV_MAP_ABSENT_32  ML99_PRIV_MAP_ABSENT_16, ML99_PRIV_MAP_ABSENT_16
+#define ML99_PRIV_MAP_ABSENT_64  ML99_PRIV_MAP_ABSENT_32, ML99_PRIV_MAP_ABSENT_32
+#define ML99_PRIV_MAP_ABSENT_128 ML99_PRIV_MAP_ABSENT_64, ML99_PRIV_MAP_ABSENT_64
+#define ML99_PRIV_MAP_ABSENT_256 ML99_PRIV_MAP_ABSENT_128, ML99_PRIV_MAP_ABSENT_128
+// } (Natural keys)
+
+// Identifier keys {
+
+/* A map keyed by identifiers is `(ident, prefix, n, (k1, ..., kn, ()), (v1, ..., vn, ~))`. */
+
+#define ML99_identMap_IMPL(prefix) v((ident, prefix, 0, (()), (~)))
+
+#define ML99_PRIV_mapGet_ident(key, ...) ML99_PRIV_mapIdentGet(key, __VA_ARGS__)
+#define ML99_PRIV_mapIdentGet(key, prefix, _n, keys, values)                                       \
+    ML99_PRIV_identFind_IMPL(                                                                        \
+        ML99_PRIV_mapIdentGetAt,                                                                   \
+        (values),                                                                                  \
+        prefix,                                                                                    \
+        key,                                                                                       \
+        0,                                                                                         \
+        ML99_PRIV_EXPAND keys,                                                                     \
+        ~)
+#define ML99_PRIV_mapIdentGetAt(found, i, values)                                                  \
+    ML99_PRIV_IF(found, ML99_PRIV_mapIdentGetValue, ML99_PRIV_mapNothingAt)(i, values)
+#define ML99_PRIV_mapIdentGetValue(i, values)                                                      \
+    ML99_PRIV_mapJust(ML99_PRIV_HEAD(ML99_PRIV_VARIADICS_DROP(i, ML99_PRIV_EXPAND values)))
+
+#define ML99_PRIV_mapInsert_ident(key, val, ...)                                                   \
+    ML99_PRIV_mapIdentInsert(key, val, __VA_ARGS__)
+#define ML99_PRIV_mapIdentInsert(key, val, prefix, n, keys, values)                                \
+    ML99_PRIV_identFind_IMPL(                                                                        \
+        ML99_PRIV_mapIdentInsertAt,                                                                \
+        (key, val, prefix, n, keys, values),                                                       \
+        prefix,                                                                                    \
+        key,                                                                                       \
+        0,                                                                                         \
+        ML99_PRIV_EXPAND keys,                                                                     \
+        ~)
+#define ML99_PRIV_mapIdentInsertAt(found, i, key, val, prefix, n, keys, values)                    \
+    ML99_PRIV_IF(                                                                                  \
+        found,                                                                                     \
+        ML99_PRIV_mapIdentReplace,                                                                 \
+        ML99_PRIV_IF(                                                                              \
+            ML99_NAT_EQ(n, ML99_NAT_MAX),                                                          \
+            ML99_PRIV_mapIdentSizeError,                                                           \
+            ML99_PRIV_mapIdentAppend))                                                             \
+    (i, key, val, prefix, n, keys, values)
+#define ML99_PRIV_mapIdentReplace(i, _key, val, prefix, n, keys, values)                           \
+    v((ident,                                                                                      \
+       prefix,                                                                                     \
+       n,                                                                                          \
+       keys,                                                                                       \
+       (ML99_PRIV_mapPrefix(i, ML99_PRIV_EXPAND values) val,                                       \
+        ML99_PRIV_VARIADICS_DROP(ML99_PRIV_INC(i), ML99_PRIV_EXPAND values))))
+#define ML99_PRIV_mapIdentAppend(_i, key, val, prefix, n, keys, values)                            \
+    v((ident,                                                                                      \
+       prefix,                                                                                     \
+       ML99_PRIV_INC(n),                                                                           \
+       (ML99_PRIV_mapPrefix(n, ML99_PRIV_EXPAND keys) key, ()),                                    \
+       (ML99_PRIV_mapPrefix(n, ML99_PRIV_EXPAND values) val, ~)))
+#define ML99_PRIV_mapIdentSizeError(...)                                                           \
+    ML99_fatal(ML99_mapInsert, the map already holds ML99_NAT_MAX entries)
+
+
+#define ML99_PRIV_mapRemove_ident(key, ...) ML99_PRIV_mapIdentRemove(key, __VA_ARGS__)
+#define ML99_PRIV_mapIdentRemove(key, prefix, n, keys, values)                                     \
+    ML99_PRIV_identFind_IMPL(                                                                        \
+        ML99_PRIV_mapIdentRemoveAt,                                                                \
+        (prefix, n, keys, values),                                                                 \
+        prefix,                                                                                    \
+        key,                                                                                       \
+        0,                                                                                         \
+        ML99_PRIV_EXPAND keys,                                                                     \
+        ~)
+#define ML99_PRIV_mapIdentRemoveAt(found, i, prefix, n, keys, values)                              \
+    ML99_PRIV_IF(found, ML99_PRIV_mapIdentDelete, ML99_PRIV_mapIdentSame)                          \
+    (i, prefix, n, keys, values)
+#define ML99_PRIV_mapIdentDelete(i, prefix, n, keys, values)                                       \
+    v((ident,                                                                                      \
+       prefix,                                                                                     \
+       ML99_PRIV_DEC(n),                                                                           \
+       (ML99_PRIV_mapPrefix(i, ML99_PRIV_EXPAND keys)                                              \
+            ML99_PRIV_VARIADICS_DROP(ML99_PRIV_INC(i), ML99_PRIV_EXPAND keys)),                    \
+       (ML99_PRIV_mapPrefix(i, ML99_PRIV_EXPAND values)                                            \
+            ML99_PRIV_VARIADICS_DROP(ML99_PRIV_INC(i), ML99_PRIV_EXPAND values))))
+#define ML99_PRIV_mapIdentSame(_i, prefix, n, keys, values)                                        \
+    v((ident, prefix, n, keys, values))
+
+#define ML99_PRIV_mapKeys_ident(...)   ML99_PRIV_mapIdentKeys(__VA_ARGS__)
+#define ML99_PRIV_mapValues_ident(...) ML99_PRIV_mapIdentValues(__VA_ARGS__)
+#define ML99_PRIV_mapIdentKeys(_prefix, n, keys, _values)   ML99_PRIV_mapIdentItems(n, keys)
+#define ML99_PRIV_mapIdentValues(_prefix, n, _keys, values) ML99_PRIV_mapIdentItems(n, values)
+#define ML99_PRIV_mapIdentItems(n, items)                                                          \
+    ML99_PRIV_IF(ML99_NAT_EQ(n, 0), ML99_PRIV_mapIdentItemsNil, ML99_PRIV_mapIdentItemsList)       \
+    (n, items)
+#define ML99_PRIV_mapIdentItemsNil(_n, _items) v(ML99_NIL())
+#define ML99_PRIV_mapIdentItemsList(n, items)                                                      \
+    ML99_list_IMPL(ML99_PRIV_VARIADICS_TAKE(n, ML99_PRIV_EXPAND items))
+
+// } (Identifier keys)
+
+#define ML99_PRIV_mapJust(x)        v(ML99_JUST(x))
+#define ML99_PRIV_mapNothing(...)   v(ML99_NOTHING())
+#define ML99_PRIV_mapNothingAt(...) v(ML99_NOTHING())
+
+#define ML99_natMap_ARITY       1
+#define ML99_identMap_ARITY     1
+#define ML99_mapInsert_ARITY    3
+#define ML99_mapGet_ARITY       2
+#define ML99_mapContains_ARITY  2
+#define ML99_mapRemove_ARITY    2
+#define ML99_mapKeys_ARITY      1
+#define ML99_mapValues_ARITY    1
+
+#endif // DOXYGEN_IGNORE
+
+#endif // ML99_MAP_H
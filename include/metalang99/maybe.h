@@ -94,6 +94,76 @@
  */
 #define ML99_maybeUnwrap(maybe) ML99_call(ML99_maybeUnwrap, maybe)
 
+/**
+ * Applies @p f to the contained value on `ML99_just(x)`, yielding the maybe that @p f returns, or
+ * returns `ML99_nothing()` without applying @p f on `ML99_nothing()`.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/control.h>
+ * #include <metalang99/maybe.h>
+ * #include <metalang99/nat.h>
+ *
+ * #define CHECKED_DEC_IMPL(x) ML99_IF(ML99_NAT_EQ(x, 0), ML99_nothing(), ML99_just(ML99_dec(v(x))))
+ * #define CHECKED_DEC_ARITY   1
+ *
+ * // ML99_just(v(4))
+ * ML99_maybeBind(ML99_just(v(5)), v(CHECKED_DEC))
+ *
+ * // ML99_nothing()
+ * ML99_maybeBind(ML99_just(v(0)), v(CHECKED_DEC))
+ *
+ * // ML99_nothing()
+ * ML99_maybeBind(ML99_nothing(), v(CHECKED_DEC))
+ * @endcode
+ */
+#define ML99_maybeBind(maybe, f) ML99_call(ML99_maybeBind, maybe, f)
+
+/**
+ * Applies @p f to the contained value on `ML99_just(x)`, yielding `ML99_just(f(x))`, or returns
+ * `ML99_nothing()` without applying @p f on `ML99_nothing()`.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/maybe.h>
+ * #include <metalang99/nat.h>
+ *
+ * // ML99_just(v(6))
+ * ML99_maybeMap(ML99_just(v(5)), v(ML99_inc))
+ *
+ * // ML99_nothing()
+ * ML99_maybeMap(ML99_nothing(), v(ML99_inc))
+ * @endcode
+ */
+#define ML99_maybeMap(maybe, f) ML99_call(ML99_maybeMap, maybe, f)
+
+/**
+ * Binds @p maybe to the functions `f1, ..., fn` in turn, as #ML99_maybeBind does.
+ *
+ * The chain stops at the first `ML99_nothing()`: the remaining functions are neither applied nor
+ * even dispatched on. Each stage takes a single match besides the application of its function.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/control.h>
+ * #include <metalang99/maybe.h>
+ * #include <metalang99/nat.h>
+ *
+ * #define CHECKED_DEC_IMPL(x) ML99_IF(ML99_NAT_EQ(x, 0), ML99_nothing(), ML99_just(ML99_dec(v(x))))
+ * #define CHECKED_DEC_ARITY   1
+ *
+ * // ML99_just(v(2))
+ * ML99_maybeChain(ML99_just(v(5)), v(CHECKED_DEC), v(CHECKED_DEC), v(CHECKED_DEC))
+ *
+ * // ML99_nothing(), after two stages
+ * ML99_maybeChain(ML99_just(v(1)), v(CHECKED_DEC), v(CHECKED_DEC), v(CHECKED_DEC))
+ * @endcode
+ */
+#define ML99_maybeChain(maybe, ...) ML99_call(ML99_maybeChain, maybe, __VA_ARGS__)
+
 #define ML99_JUST(x)           ML99_CHOICE(just, x)
 #define ML99_NOTHING(...)      ML99_CHOICE(nothing, ~)
 #define ML99_IS_JUST(maybe)    ML99_PRIV_IS_JUST(maybe)
@@ -124,6 +194,33 @@
     ML99_fatal(ML99_maybeUnwrap, expected ML99_just but found ML99_nothing)
 #define ML99_PRIV_maybeUnwrap_just_IMPL(x) v(x)
 
+#define ML99_maybeBind_IMPL(maybe, f)                                                              \
+    ML99_matchWithArgs_IMPL(maybe, ML99_PRIV_maybeBind_, f)
+#define ML99_PRIV_maybeBind_nothing_IMPL(...) v(ML99_NOTHING())
+#define ML99_PRIV_maybeBind_just_IMPL(x, f)   ML99_appl_IMPL(f, x)
+
+#define ML99_maybeMap_IMPL(maybe, f)                                                               \
+    ML99_matchWithArgs_IMPL(maybe, ML99_PRIV_maybeMap_, f)
+#define ML99_PRIV_maybeMap_nothing_IMPL(...) v(ML99_NOTHING())
+#define ML99_PRIV_maybeMap_just_IMPL(x, f)   ML99_call(ML99_just, ML99_appl_IMPL(f, x))
+
+// ML99_maybeChain_IMPL {
+
+#define ML99_maybeChain_IMPL(maybe, ...)                                                           \
+    ML99_matchWithArgs_IMPL(maybe, ML99_PRIV_maybeChain_, __VA_ARGS__)
+#define ML99_PRIV_maybeChain_nothing_IMPL(...) v(ML99_NOTHING())
+#define ML99_PRIV_maybeChain_just_IMPL(x, ...)                                                     \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_CONTAINS_COMMA(__VA_ARGS__),                                                     \
+        ML99_PRIV_maybeChainProgress,                                                              \
+        ML99_PRIV_maybeChainDone)                                                                  \
+    (x, __VA_ARGS__)
+
+#define ML99_PRIV_maybeChainDone(x, f) ML99_appl_IMPL(f, x)
+#define ML99_PRIV_maybeChainProgress(x, f, ...)                                                    \
+    ML99_call(ML99_maybeChain, ML99_appl_IMPL(f, x), v(__VA_ARGS__))
+// } (ML99_maybeChain_IMPL)
+
 // Arity specifiers {
 
 #define ML99_just_ARITY        1
@@ -132,6 +229,9 @@
 #define ML99_isNothing_ARITY   1
 #define ML99_maybeEq_ARITY     3
 #define ML99_maybeUnwrap_ARITY 1
+#define ML99_maybeBind_ARITY   2
+#define ML99_maybeMap_ARITY    2
+#define ML99_maybeChain_ARITY  2
 // } (Arity specifiers)
 
 #endif // DOXYGEN_IGNORE
@@ -1,6 +1,6 @@
 /**
  * @file
- * Natural numbers ([0; 255]).
+ * Natural numbers ([0; #ML99_NAT_MAX]).
  *
  * Most of the time, natural numbers are used for iteration; they are not meant for CPU-bound tasks
  * such as Fibonacci numbers or factorials.
@@ -9,12 +9,13 @@
 #ifndef ML99_NAT_H
 #define ML99_NAT_H
 
+#include <metalang99/nat/add.h>
 #include <metalang99/nat/dec.h>
-#include <metalang99/nat/div.h>
 #include <metalang99/nat/eq.h>
 #include <metalang99/nat/inc.h>
+#include <metalang99/nat/mul.h>
+#include <metalang99/nat/sub.h>
 
-#include <metalang99/control.h>
 #include <metalang99/lang.h>
 #include <metalang99/logical.h>
 
@@ -210,6 +211,8 @@
  * // 11
  * ML99_add(v(5), v(6))
  * @endcode
+ *
+ * @note If \f$x + y\f$ exceeds #ML99_NAT_MAX, the result wraps around, as with #ML99_inc.
  */
 #define ML99_add(x, y) ML99_call(ML99_add, x, y)
 
@@ -224,6 +227,8 @@
  * // 6
  * ML99_sub(v(11), v(5))
  * @endcode
+ *
+ * @note If \f$x - y\f$ is negative, the result wraps around, as with #ML99_dec.
  */
 #define ML99_sub(x, y) ML99_call(ML99_sub, x, y)
 
@@ -238,61 +243,10 @@
  * // 12
  * ML99_mul(v(3), v(4))
  * @endcode
- */
-#define ML99_mul(x, y) ML99_call(ML99_mul, x, y)
-
-/**
- * \f$\frac{x}{y}\f$
- *
- * # Examples
- *
- * @code
- * #include <metalang99/nat.h>
- *
- * // 3
- * ML99_div(v(12), v(4))
- * @endcode
- *
- * @note A compile-time error if \f$\frac{x}{y}\f$ is not a natural number.
- */
-#define ML99_div(x, y) ML99_call(ML99_div, x, y)
-
-/**
- * Like #ML99_div but returns `ML99_nothing()` is @p x is not divisible by @p y,
- * otherwise `ML99_just(result)`.
- *
- * # Examples
- *
- * @code
- * #include <metalang99/nat.h>
- *
- * // ML99_just(3)
- * ML99_divChecked(v(12), v(4))
- *
- * // ML99_nothing()
- * ML99_divChecked(v(14), v(5))
- *
- * // ML99_nothing()
- * ML99_divChecked(v(1), v(0))
- * @endcode
- */
-#define ML99_divChecked(x, y) ML99_call(ML99_divChecked, x, y)
-
-/**
- * Computes the remainder of division.
- *
- * # Examples
- *
- * @code
- * #include <metalang99/nat.h>
- *
- * // 2
- * ML99_mod(v(8), v(3))
- * @endcode
  *
- * @note A compile-time error if @p y is 0.
+ * @note If \f$x * y\f$ exceeds #ML99_NAT_MAX, the result wraps around, as with #ML99_add.
  */
-#define ML99_mod(x, y) ML99_call(ML99_mod, x, y)
+#define ML99_mul(x, y) ML99_call(ML99_mul, x, y)
 
 /**
  * \f$x + y + z\f$
@@ -336,22 +290,6 @@
  */
 #define ML99_mul3(x, y, z) ML99_call(ML99_mul3, x, y, z)
 
-/**
- * \f$\frac{(\frac{x}{y})}{z}\f$
- *
- * # Examples
- *
- * @code
- * #include <metalang99/nat.h>
- *
- * // 5
- * ML99_div(v(30), v(3), v(2))
- * @endcode
- *
- * @note A compile-time error if \f$\frac{(\frac{x}{y})}{z}\f$ is not a natural number.
- */
-#define ML99_div3(x, y, z) ML99_call(ML99_div3, x, y, z)
-
 /**
  * \f$min(x, y)\f$
  *
@@ -399,16 +337,26 @@
  */
 #define ML99_assertIsNat(x) ML99_call(ML99_assertIsNat, x)
 
-#define ML99_INC(x)            ML99_PRIV_INC(x)
-#define ML99_DEC(x)            ML99_PRIV_DEC(x)
-#define ML99_NAT_EQ(x, y)      ML99_PRIV_NAT_EQ(x, y)
-#define ML99_NAT_NEQ(x, y)     ML99_NOT(ML99_NAT_EQ(x, y))
-#define ML99_DIV_CHECKED(x, y) ML99_PRIV_DIV_CHECKED(x, y)
+#define ML99_INC(x)               ML99_PRIV_INC(x)
+#define ML99_DEC(x)               ML99_PRIV_DEC(x)
+#define ML99_NAT_EQ(x, y)         ML99_PRIV_NAT_EQ(x, y)
+#define ML99_NAT_NEQ(x, y)        ML99_NOT(ML99_NAT_EQ(x, y))
+#define ML99_NAT_LESSER(x, y)     ML99_PRIV_NAT_LESSER(x, y)
+#define ML99_NAT_LESSER_EQ(x, y)  ML99_NOT(ML99_PRIV_NAT_LESSER(y, x))
+#define ML99_NAT_GREATER(x, y)    ML99_PRIV_NAT_LESSER(y, x)
+#define ML99_NAT_GREATER_EQ(x, y) ML99_NOT(ML99_PRIV_NAT_LESSER(x, y))
 
 /**
- * The maximum value of a natural number, currently 255.
+ * The maximum value of a natural number, 255 by default.
+ *
+ * You can define `ML99_NAT_MAX` before including Metalang99 as 63, 127, or 255. The tables of
+ * natural numbers only cover [0; ML99_NAT_MAX], so a smaller maximum makes every translation unit
+ * that includes Metalang99 parse fewer macros. Arithmetic wraps around `ML99_NAT_MAX + 1`, and
+ * `ML99_REC_DEPTH` must not exceed `ML99_NAT_MAX + 1`.
  */
-#define ML99_NAT_MAX 255
+#ifndef ML99_NAT_MAX
+#define ML99_NAT_MAX ML99_PRIV_NAT_MAX
+#endif
 
 #ifndef DOXYGEN_IGNORE
 
@@ -430,52 +378,21 @@
 #define ML99_natEq_IMPL(x, y)  v(ML99_NAT_EQ(x, y))
 #define ML99_natNeq_IMPL(x, y) v(ML99_NAT_NEQ(x, y))
 
-#define ML99_greater_IMPL(x, y) ML99_lesser_IMPL(y, x)
-#define ML99_greaterEq_IMPL(x, y)                                                                  \
-    ML99_PRIV_IF(ML99_NAT_EQ(x, y), v(ML99_TRUE()), ML99_greater_IMPL(x, y))
-
-#define ML99_lesser_IMPL(x, y)                                                                     \
-    ML99_PRIV_IF(                                                                                  \
-        ML99_NAT_EQ(y, 0),                                                                         \
-        v(ML99_FALSE()),                                                                           \
-        ML99_PRIV_IF(                                                                              \
-            ML99_NAT_EQ(x, ML99_DEC(y)),                                                           \
-            v(ML99_TRUE()),                                                                        \
-            ML99_callUneval(ML99_lesser, x, ML99_DEC(y))))
-
-#define ML99_lesserEq_IMPL(x, y) ML99_greaterEq_IMPL(y, x)
-
-#define ML99_add_IMPL(x, y)                                                                        \
-    ML99_PRIV_IF(ML99_NAT_EQ(y, 0), v(x), ML99_callUneval(ML99_add, ML99_INC(x), ML99_DEC(y)))
-#define ML99_sub_IMPL(x, y)                                                                        \
-    ML99_PRIV_IF(ML99_NAT_EQ(y, 0), v(x), ML99_callUneval(ML99_sub, ML99_DEC(x), ML99_DEC(y)))
-#define ML99_mul_IMPL(x, y)                                                                        \
-    ML99_PRIV_IF(ML99_NAT_EQ(y, 0), v(0), ML99_add(v(x), ML99_callUneval(ML99_mul, x, ML99_DEC(y))))
-
-// ML99_mod_IMPL {
-
-#define ML99_mod_IMPL(x, y)                                                                        \
-    ML99_PRIV_IF(                                                                                  \
-        ML99_NAT_EQ(y, 0),                                                                         \
-        ML99_fatal(ML99_mod, modulo by 0),                                                         \
-        ML99_PRIV_modAux_IMPL(x, y, 0))
-
-#define ML99_PRIV_modAux_IMPL(x, y, acc)                                                           \
-    ML99_PRIV_IF(                                                                                  \
-        ML99_OR(ML99_NAT_EQ(x, 0), ML99_IS_JUST(ML99_DIV_CHECKED(x, y))),                          \
-        v(acc),                                                                                    \
-        ML99_callUneval(ML99_PRIV_modAux, ML99_DEC(x), y, ML99_INC(acc)))
-// } (ML99_mod_IMPL)
+#define ML99_greater_IMPL(x, y)   v(ML99_NAT_GREATER(x, y))
+#define ML99_greaterEq_IMPL(x, y) v(ML99_NAT_GREATER_EQ(x, y))
+#define ML99_lesser_IMPL(x, y)    v(ML99_NAT_LESSER(x, y))
+#define ML99_lesserEq_IMPL(x, y)  v(ML99_NAT_LESSER_EQ(x, y))
 
-#define ML99_divChecked_IMPL(x, y) v(ML99_DIV_CHECKED(x, y))
+#define ML99_add_IMPL(x, y) v(ML99_PRIV_NAT_ADD(x, y))
+#define ML99_sub_IMPL(x, y) v(ML99_PRIV_NAT_SUB(x, y))
+#define ML99_mul_IMPL(x, y) v(ML99_PRIV_NAT_MUL(x, y))
 
 #define ML99_add3_IMPL(x, y, z) ML99_add(ML99_add_IMPL(x, y), v(z))
 #define ML99_sub3_IMPL(x, y, z) ML99_sub(ML99_sub_IMPL(x, y), v(z))
 #define ML99_mul3_IMPL(x, y, z) ML99_mul(ML99_mul_IMPL(x, y), v(z))
-#define ML99_div3_IMPL(x, y, z) ML99_div(ML99_div_IMPL(x, y), v(z))
 
-#define ML99_min_IMPL(x, y) ML99_call(ML99_if, ML99_lesser_IMPL(x, y), v(x, y))
-#define ML99_max_IMPL(x, y) ML99_call(ML99_if, ML99_lesser_IMPL(x, y), v(y, x))
+#define ML99_min_IMPL(x, y) v(ML99_PRIV_IF(ML99_NAT_LESSER(x, y), x, y))
+#define ML99_max_IMPL(x, y) v(ML99_PRIV_IF(ML99_NAT_LESSER(x, y), y, x))
 
 #define ML99_assertIsNat_IMPL(x)                                                                   \
     ML99_PRIV_IF(                                                                                  \
@@ -502,13 +419,9 @@
 #define ML99_add_ARITY              2
 #define ML99_sub_ARITY              2
 #define ML99_mul_ARITY              2
-#define ML99_div_ARITY              2
-#define ML99_divChecked_ARITY       2
-#define ML99_mod_ARITY              2
 #define ML99_add3_ARITY             3
 #define ML99_sub3_ARITY             3
 #define ML99_mul3_ARITY             3
-#define ML99_div3_ARITY             3
 #define ML99_min_ARITY              2
 #define ML99_max_ARITY              2
 #define ML99_assertIsNat_ARITY      1
@@ -0,0 +1,68 @@
+#ifndef ML99_NAT_ADD_H
+#define ML99_NAT_ADD_H
+
+#include <metalang99/nat/bits.h>
+#include <metalang99/nat/from_bits.h>
+
+/* The numbers are added two binary digits at a time, from the least significant ones, each time
+ * propagating a carry: `ML99_PRIV_NAT_ADD_PAIR_c_a_b` is the carry and the two digits of
+ * `c + a + b`. The pairs of digits are pasted together upfront, e.g., `01_11`, and the carry out
+ * of the most significant pair is dropped, so that the sum wraps around like `ML99_PRIV_INC`. */
+
+#define ML99_PRIV_NAT_ADD(x, y)                                                                    \
+    ML99_PRIV_NAT_ADD_AUX(ML99_PRIV_NAT_TO_BITS(x), ML99_PRIV_NAT_TO_BITS(y))
+#define ML99_PRIV_NAT_ADD_AUX(...) ML99_PRIV_NAT_ADD_BITS(__VA_ARGS__)
+
+#define ML99_PRIV_NAT_ADD_BITS(x7, x6, x5, x4, x3, x2, x1, x0, y7, y6, y5, y4, y3, y2, y1, y0)     \
+    ML99_PRIV_NAT_ADD_2(                                                                           \
+        ML99_PRIV_NAT_ADD_PAIR_0_##x1##x0##_##y1##y0,                                              \
+        x3##x2##_##y3##y2,                                                                         \
+        x5##x4##_##y5##y4,                                                                         \
+        x7##x6##_##y7##y6)
+
+#define ML99_PRIV_NAT_ADD_2(...) ML99_PRIV_NAT_ADD_2_AUX(__VA_ARGS__)
+#define ML99_PRIV_NAT_ADD_2_AUX(c, s1, s0, p2, p4, p6)                                             \
+    ML99_PRIV_NAT_ADD_4(ML99_PRIV_NAT_ADD_PAIR_##c##_##p2, p4, p6, s1, s0)
+#define ML99_PRIV_NAT_ADD_4(...) ML99_PRIV_NAT_ADD_4_AUX(__VA_ARGS__)
+#define ML99_PRIV_NAT_ADD_4_AUX(c, s3, s2, p4, p6, ...)                                            \
+    ML99_PRIV_NAT_ADD_6(ML99_PRIV_NAT_ADD_PAIR_##c##_##p4, p6, s3, s2, __VA_ARGS__)
+#define ML99_PRIV_NAT_ADD_6(...) ML99_PRIV_NAT_ADD_6_AUX(__VA_ARGS__)
+#define ML99_PRIV_NAT_ADD_6_AUX(c, s5, s4, p6, ...)                                                \
+    ML99_PRIV_NAT_ADD_END(ML99_PRIV_NAT_ADD_PAIR_##c##_##p6, s5, s4, __VA_ARGS__)
+#define ML99_PRIV_NAT_ADD_END(...)         ML99_PRIV_NAT_ADD_END_AUX(__VA_ARGS__)
+#define ML99_PRIV_NAT_ADD_END_AUX(_c, ...) ML99_PRIV_NAT_FROM_BITS(__VA_ARGS__)
+
+// Generated by scripts/gen-tables.py.
+#define ML99_PRIV_NAT_ADD_PAIR_0_00_00 0, 0, 0
+#define ML99_PRIV_NAT_ADD_PAIR_0_00_01 0, 0, 1
+#define ML99_PRIV_NAT_ADD_PAIR_0_00_10 0, 1, 0
+#define ML99_PRIV_NAT_ADD_PAIR_0_00_11 0, 1, 1
+#define ML99_PRIV_NAT_ADD_PAIR_0_01_00 0, 0, 1
+#define ML99_PRIV_NAT_ADD_PAIR_0_01_01 0, 1, 0
+#define ML99_PRIV_NAT_ADD_PAIR_0_01_10 0, 1, 1
+#define ML99_PRIV_NAT_ADD_PAIR_0_01_11 1, 0, 0
+#define ML99_PRIV_NAT_ADD_PAIR_0_10_00 0, 1, 0
+#define ML99_PRIV_NAT_ADD_PAIR_0_10_01 0, 1, 1
+#define ML99_PRIV_NAT_ADD_PAIR_0_10_10 1, 0, 0
+#define ML99_PRIV_NAT_ADD_PAIR_0_10_11 1, 0, 1
+#define ML99_PRIV_NAT_ADD_PAIR_0_11_00 0, 1, 1
+#define ML99_PRIV_NAT_ADD_PAIR_0_11_01 1, 0, 0
+#define ML99_PRIV_NAT_ADD_PAIR_0_11_10 1, 0, 1
+#define ML99_PRIV_NAT_ADD_PAIR_0_11_11 1, 1, 0
+#define ML99_PRIV_NAT_ADD_PAIR_1_00_00 0, 0, 1
+#define ML99_PRIV_NAT_ADD_PAIR_1_00_01 0, 1, 0
+#define ML99_PRIV_NAT_ADD_PAIR_1_00_10 0, 1, 1
+#define ML99_PRIV_NAT_ADD_PAIR_1_00_11 1, 0, 0
+#define ML99_PRIV_NAT_ADD_PAIR_1_01_00 0, 1, 0
+#define ML99_PRIV_NAT_ADD_PAIR_1_01_01 0, 1, 1
+#define ML99_PRIV_NAT_ADD_PAIR_1_01_10 1, 0, 0
+#define ML99_PRIV_NAT_ADD_PAIR_1_01_11 1, 0, 1
+#define ML99_PRIV_NAT_ADD_PAIR_1_10_00 0, 1, 1
+#define ML99_PRIV_NAT_ADD_PAIR_1_10_01 1, 0, 0
+#define ML99_PRIV_NAT_ADD_PAIR_1_10_10 1, 0, 1
+#define ML99_PRIV_NAT_ADD_PAIR_1_10_11 1, 1, 0
+#define ML99_PRIV_NAT_ADD_PAIR_1_11_00 1, 0, 0
+#define ML99_PRIV_NAT_ADD_PAIR_1_11_01 1, 0, 1
+#define ML99_PRIV_NAT_ADD_PAIR_1_11_10 1, 1, 0
+#define ML99_PRIV_NAT_ADD_PAIR_1_11_11 1, 1, 1
+#endif // ML99_NAT_ADD_H
@@ -0,0 +1,295 @@
+#ifndef ML99_NAT_BITS_H
+#define ML99_NAT_BITS_H
+
+#include <metalang99/nat/max.h>
+
+/* `ML99_PRIV_NAT_TO_BITS_x` is the binary digits of `x`, from the most significant one. They are
+ * turned back into a natural number by `nat/from_bits.h`, which only the arithmetic needs. */
+
+#define ML99_PRIV_NAT_TO_BITS(x)     ML99_PRIV_NAT_TO_BITS_AUX(x)
+#define ML99_PRIV_NAT_TO_BITS_AUX(x) ML99_PRIV_NAT_TO_BITS_##x
+
+/* `ML99_PRIV_NAT_LESSER(x, y)` is whether `x < y`, decided by the most significant pair of binary
+ * digits that differ: `ML99_PRIV_NAT_BITS_LT_ab(rest)` is `rest` when `a` and `b` are equal, and
+ * the answer otherwise. */
+
+#define ML99_PRIV_NAT_LESSER(x, y)                                                                 \
+    ML99_PRIV_NAT_LESSER_AUX(ML99_PRIV_NAT_TO_BITS(x), ML99_PRIV_NAT_TO_BITS(y))
+#define ML99_PRIV_NAT_LESSER_AUX(...) ML99_PRIV_NAT_BITS_LT(__VA_ARGS__)
+
+#define ML99_PRIV_NAT_BITS_LT(x7, x6, x5, x4, x3, x2, x1, x0, y7, y6, y5, y4, y3, y2, y1, y0)      \
+    ML99_PRIV_NAT_BITS_LT_##x7##y7(ML99_PRIV_NAT_BITS_LT_##x6##y6(ML99_PRIV_NAT_BITS_LT_##x5##y5(  \
+        ML99_PRIV_NAT_BITS_LT_##x4##y4(ML99_PRIV_NAT_BITS_LT_##x3##y3(                             \
+            ML99_PRIV_NAT_BITS_LT_##x2##y2(ML99_PRIV_NAT_BITS_LT_##x1##y1(                         \
+                ML99_PRIV_NAT_BITS_LT_##x0##y0(0))))))))
+
+#define ML99_PRIV_NAT_BITS_LT_00(rest) rest
+#define ML99_PRIV_NAT_BITS_LT_01(_)    1
+#define ML99_PRIV_NAT_BITS_LT_10(_)    0
+#define ML99_PRIV_NAT_BITS_LT_11(rest) rest
+
+// Generated by scripts/gen-tables.py.
+#define ML99_PRIV_NAT_TO_BITS_0  0, 0, 0, 0, 0, 0, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_1  0, 0, 0, 0, 0, 0, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_2  0, 0, 0, 0, 0, 0, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_3  0, 0, 0, 0, 0, 0, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_4  0, 0, 0, 0, 0, 1, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_5  0, 0, 0, 0, 0, 1, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_6  0, 0, 0, 0, 0, 1, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_7  0, 0, 0, 0, 0, 1, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_8  0, 0, 0, 0, 1, 0, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_9  0, 0, 0, 0, 1, 0, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_10 0, 0, 0, 0, 1, 0, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_11 0, 0, 0, 0, 1, 0, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_12 0, 0, 0, 0, 1, 1, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_13 0, 0, 0, 0, 1, 1, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_14 0, 0, 0, 0, 1, 1, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_15 0, 0, 0, 0, 1, 1, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_16 0, 0, 0, 1, 0, 0, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_17 0, 0, 0, 1, 0, 0, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_18 0, 0, 0, 1, 0, 0, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_19 0, 0, 0, 1, 0, 0, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_20 0, 0, 0, 1, 0, 1, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_21 0, 0, 0, 1, 0, 1, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_22 0, 0, 0, 1, 0, 1, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_23 0, 0, 0, 1, 0, 1, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_24 0, 0, 0, 1, 1, 0, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_25 0, 0, 0, 1, 1, 0, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_26 0, 0, 0, 1, 1, 0, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_27 0, 0, 0, 1, 1, 0, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_28 0, 0, 0, 1, 1, 1, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_29 0, 0, 0, 1, 1, 1, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_30 0, 0, 0, 1, 1, 1, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_31 0, 0, 0, 1, 1, 1, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_32 0, 0, 1, 0, 0, 0, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_33 0, 0, 1, 0, 0, 0, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_34 0, 0, 1, 0, 0, 0, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_35 0, 0, 1, 0, 0, 0, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_36 0, 0, 1, 0, 0, 1, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_37 0, 0, 1, 0, 0, 1, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_38 0, 0, 1, 0, 0, 1, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_39 0, 0, 1, 0, 0, 1, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_40 0, 0, 1, 0, 1, 0, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_41 0, 0, 1, 0, 1, 0, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_42 0, 0, 1, 0, 1, 0, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_43 0, 0, 1, 0, 1, 0, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_44 0, 0, 1, 0, 1, 1, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_45 0, 0, 1, 0, 1, 1, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_46 0, 0, 1, 0, 1, 1, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_47 0, 0, 1, 0, 1, 1, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_48 0, 0, 1, 1, 0, 0, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_49 0, 0, 1, 1, 0, 0, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_50 0, 0, 1, 1, 0, 0, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_51 0, 0, 1, 1, 0, 0, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_52 0, 0, 1, 1, 0, 1, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_53 0, 0, 1, 1, 0, 1, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_54 0, 0, 1, 1, 0, 1, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_55 0, 0, 1, 1, 0, 1, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_56 0, 0, 1, 1, 1, 0, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_57 0, 0, 1, 1, 1, 0, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_58 0, 0, 1, 1, 1, 0, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_59 0, 0, 1, 1, 1, 0, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_60 0, 0, 1, 1, 1, 1, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_61 0, 0, 1, 1, 1, 1, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_62 0, 0, 1, 1, 1, 1, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_63 0, 0, 1, 1, 1, 1, 1, 1
+
+#if ML99_PRIV_NAT_MAX > 63
+#define ML99_PRIV_NAT_TO_BITS_64  0, 1, 0, 0, 0, 0, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_65  0, 1, 0, 0, 0, 0, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_66  0, 1, 0, 0, 0, 0, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_67  0, 1, 0, 0, 0, 0, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_68  0, 1, 0, 0, 0, 1, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_69  0, 1, 0, 0, 0, 1, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_70  0, 1, 0, 0, 0, 1, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_71  0, 1, 0, 0, 0, 1, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_72  0, 1, 0, 0, 1, 0, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_73  0, 1, 0, 0, 1, 0, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_74  0, 1, 0, 0, 1, 0, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_75  0, 1, 0, 0, 1, 0, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_76  0, 1, 0, 0, 1, 1, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_77  0, 1, 0, 0, 1, 1, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_78  0, 1, 0, 0, 1, 1, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_79  0, 1, 0, 0, 1, 1, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_80  0, 1, 0, 1, 0, 0, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_81  0, 1, 0, 1, 0, 0, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_82  0, 1, 0, 1, 0, 0, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_83  0, 1, 0, 1, 0, 0, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_84  0, 1, 0, 1, 0, 1, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_85  0, 1, 0, 1, 0, 1, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_86  0, 1, 0, 1, 0, 1, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_87  0, 1, 0, 1, 0, 1, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_88  0, 1, 0, 1, 1, 0, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_89  0, 1, 0, 1, 1, 0, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_90  0, 1, 0, 1, 1, 0, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_91  0, 1, 0, 1, 1, 0, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_92  0, 1, 0, 1, 1, 1, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_93  0, 1, 0, 1, 1, 1, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_94  0, 1, 0, 1, 1, 1, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_95  0, 1, 0, 1, 1, 1, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_96  0, 1, 1, 0, 0, 0, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_97  0, 1, 1, 0, 0, 0, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_98  0, 1, 1, 0, 0, 0, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_99  0, 1, 1, 0, 0, 0, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_100 0, 1, 1, 0, 0, 1, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_101 0, 1, 1, 0, 0, 1, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_102 0, 1, 1, 0, 0, 1, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_103 0, 1, 1, 0, 0, 1, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_104 0, 1, 1, 0, 1, 0, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_105 0, 1, 1, 0, 1, 0, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_106 0, 1, 1, 0, 1, 0, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_107 0, 1, 1, 0, 1, 0, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_108 0, 1, 1, 0, 1, 1, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_109 0, 1, 1, 0, 1, 1, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_110 0, 1, 1, 0, 1, 1, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_111 0, 1, 1, 0, 1, 1, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_112 0, 1, 1, 1, 0, 0, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_113 0, 1, 1, 1, 0, 0, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_114 0, 1, 1, 1, 0, 0, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_115 0, 1, 1, 1, 0, 0, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_116 0, 1, 1, 1, 0, 1, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_117 0, 1, 1, 1, 0, 1, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_118 0, 1, 1, 1, 0, 1, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_119 0, 1, 1, 1, 0, 1, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_120 0, 1, 1, 1, 1, 0, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_121 0, 1, 1, 1, 1, 0, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_122 0, 1, 1, 1, 1, 0, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_123 0, 1, 1, 1, 1, 0, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_124 0, 1, 1, 1, 1, 1, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_125 0, 1, 1, 1, 1, 1, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_126 0, 1, 1, 1, 1, 1, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_127 0, 1, 1, 1, 1, 1, 1, 1
+
+#if ML99_PRIV_NAT_MAX > 127
+#define ML99_PRIV_NAT_TO_BITS_128 1, 0, 0, 0, 0, 0, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_129 1, 0, 0, 0, 0, 0, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_130 1, 0, 0, 0, 0, 0, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_131 1, 0, 0, 0, 0, 0, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_132 1, 0, 0, 0, 0, 1, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_133 1, 0, 0, 0, 0, 1, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_134 1, 0, 0, 0, 0, 1, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_135 1, 0, 0, 0, 0, 1, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_136 1, 0, 0, 0, 1, 0, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_137 1, 0, 0, 0, 1, 0, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_138 1, 0, 0, 0, 1, 0, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_139 1, 0, 0, 0, 1, 0, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_140 1, 0, 0, 0, 1, 1, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_141 1, 0, 0, 0, 1, 1, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_142 1, 0, 0, 0, 1, 1, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_143 1, 0, 0, 0, 1, 1, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_144 1, 0, 0, 1, 0, 0, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_145 1, 0, 0, 1, 0, 0, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_146 1, 0, 0, 1, 0, 0, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_147 1, 0, 0, 1, 0, 0, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_148 1, 0, 0, 1, 0, 1, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_149 1, 0, 0, 1, 0, 1, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_150 1, 0, 0, 1, 0, 1, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_151 1, 0, 0, 1, 0, 1, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_152 1, 0, 0, 1, 1, 0, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_153 1, 0, 0, 1, 1, 0, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_154 1, 0, 0, 1, 1, 0, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_155 1, 0, 0, 1, 1, 0, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_156 1, 0, 0, 1, 1, 1, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_157 1, 0, 0, 1, 1, 1, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_158 1, 0, 0, 1, 1, 1, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_159 1, 0, 0, 1, 1, 1, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_160 1, 0, 1, 0, 0, 0, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_161 1, 0, 1, 0, 0, 0, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_162 1, 0, 1, 0, 0, 0, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_163 1, 0, 1, 0, 0, 0, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_164 1, 0, 1, 0, 0, 1, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_165 1, 0, 1, 0, 0, 1, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_166 1, 0, 1, 0, 0, 1, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_167 1, 0, 1, 0, 0, 1, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_168 1, 0, 1, 0, 1, 0, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_169 1, 0, 1, 0, 1, 0, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_170 1, 0, 1, 0, 1, 0, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_171 1, 0, 1, 0, 1, 0, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_172 1, 0, 1, 0, 1, 1, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_173 1, 0, 1, 0, 1, 1, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_174 1, 0, 1, 0, 1, 1, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_175 1, 0, 1, 0, 1, 1, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_176 1, 0, 1, 1, 0, 0, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_177 1, 0, 1, 1, 0, 0, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_178 1, 0, 1, 1, 0, 0, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_179 1, 0, 1, 1, 0, 0, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_180 1, 0, 1, 1, 0, 1, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_181 1, 0, 1, 1, 0, 1, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_182 1, 0, 1, 1, 0, 1, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_183 1, 0, 1, 1, 0, 1, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_184 1, 0, 1, 1, 1, 0, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_185 1, 0, 1, 1, 1, 0, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_186 1, 0, 1, 1, 1, 0, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_187 1, 0, 1, 1, 1, 0, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_188 1, 0, 1, 1, 1, 1, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_189 1, 0, 1, 1, 1, 1, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_190 1, 0, 1, 1, 1, 1, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_191 1, 0, 1, 1, 1, 1, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_192 1, 1, 0, 0, 0, 0, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_193 1, 1, 0, 0, 0, 0, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_194 1, 1, 0, 0, 0, 0, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_195 1, 1, 0, 0, 0, 0, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_196 1, 1, 0, 0, 0, 1, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_197 1, 1, 0, 0, 0, 1, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_198 1, 1, 0, 0, 0, 1, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_199 1, 1, 0, 0, 0, 1, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_200 1, 1, 0, 0, 1, 0, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_201 1, 1, 0, 0, 1, 0, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_202 1, 1, 0, 0, 1, 0, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_203 1, 1, 0, 0, 1, 0, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_204 1, 1, 0, 0, 1, 1, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_205 1, 1, 0, 0, 1, 1, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_206 1, 1, 0, 0, 1, 1, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_207 1, 1, 0, 0, 1, 1, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_208 1, 1, 0, 1, 0, 0, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_209 1, 1, 0, 1, 0, 0, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_210 1, 1, 0, 1, 0, 0, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_211 1, 1, 0, 1, 0, 0, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_212 1, 1, 0, 1, 0, 1, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_213 1, 1, 0, 1, 0, 1, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_214 1, 1, 0, 1, 0, 1, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_215 1, 1, 0, 1, 0, 1, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_216 1, 1, 0, 1, 1, 0, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_217 1, 1, 0, 1, 1, 0, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_218 1, 1, 0, 1, 1, 0, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_219 1, 1, 0, 1, 1, 0, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_220 1, 1, 0, 1, 1, 1, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_221 1, 1, 0, 1, 1, 1, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_222 1, 1, 0, 1, 1, 1, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_223 1, 1, 0, 1, 1, 1, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_224 1, 1, 1, 0, 0, 0, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_225 1, 1, 1, 0, 0, 0, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_226 1, 1, 1, 0, 0, 0, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_227 1, 1, 1, 0, 0, 0, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_228 1, 1, 1, 0, 0, 1, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_229 1, 1, 1, 0, 0, 1, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_230 1, 1, 1, 0, 0, 1, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_231 1, 1, 1, 0, 0, 1, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_232 1, 1, 1, 0, 1, 0, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_233 1, 1, 1, 0, 1, 0, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_234 1, 1, 1, 0, 1, 0, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_235 1, 1, 1, 0, 1, 0, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_236 1, 1, 1, 0, 1, 1, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_237 1, 1, 1, 0, 1, 1, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_238 1, 1, 1, 0, 1, 1, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_239 1, 1, 1, 0, 1, 1, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_240 1, 1, 1, 1, 0, 0, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_241 1, 1, 1, 1, 0, 0, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_242 1, 1, 1, 1, 0, 0, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_243 1, 1, 1, 1, 0, 0, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_244 1, 1, 1, 1, 0, 1, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_245 1, 1, 1, 1, 0, 1, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_246 1, 1, 1, 1, 0, 1, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_247 1, 1, 1, 1, 0, 1, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_248 1, 1, 1, 1, 1, 0, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_249 1, 1, 1, 1, 1, 0, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_250 1, 1, 1, 1, 1, 0, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_251 1, 1, 1, 1, 1, 0, 1, 1
+#define ML99_PRIV_NAT_TO_BITS_252 1, 1, 1, 1, 1, 1, 0, 0
+#define ML99_PRIV_NAT_TO_BITS_253 1, 1, 1, 1, 1, 1, 0, 1
+#define ML99_PRIV_NAT_TO_BITS_254 1, 1, 1, 1, 1, 1, 1, 0
+#define ML99_PRIV_NAT_TO_BITS_255 1, 1, 1, 1, 1, 1, 1, 1
+#endif
+#endif
+
+#endif // ML99_NAT_BITS_H
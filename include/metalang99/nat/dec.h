@@ -1,73 +1,79 @@
 #ifndef ML99_NAT_DEC_H
 #define ML99_NAT_DEC_H
 
+#include <metalang99/nat/max.h>
+
 #define ML99_PRIV_DEC(x)     ML99_PRIV_DEC_AUX(x)
 #define ML99_PRIV_DEC_AUX(x) ML99_PRIV_DEC_##x
 
-#define ML99_PRIV_DEC_0   255
-#define ML99_PRIV_DEC_1   0
-#define ML99_PRIV_DEC_2   1
-#define ML99_PRIV_DEC_3   2
-#define ML99_PRIV_DEC_4   3
-#define ML99_PRIV_DEC_5   4
-#define ML99_PRIV_DEC_6   5
-#define ML99_PRIV_DEC_7   6
-#define ML99_PRIV_DEC_8   7
-#define ML99_PRIV_DEC_9   8
-#define ML99_PRIV_DEC_10  9
-#define ML99_PRIV_DEC_11  10
-#define ML99_PRIV_DEC_12  11
-#define ML99_PRIV_DEC_13  12
-#define ML99_PRIV_DEC_14  13
-#define ML99_PRIV_DEC_15  14
-#define ML99_PRIV_DEC_16  15
-#define ML99_PRIV_DEC_17  16
-#define ML99_PRIV_DEC_18  17
-#define ML99_PRIV_DEC_19  18
-#define ML99_PRIV_DEC_20  19
-#define ML99_PRIV_DEC_21  20
-#define ML99_PRIV_DEC_22  21
-#define ML99_PRIV_DEC_23  22
-#define ML99_PRIV_DEC_24  23
-#define ML99_PRIV_DEC_25  24
-#define ML99_PRIV_DEC_26  25
-#define ML99_PRIV_DEC_27  26
-#define ML99_PRIV_DEC_28  27
-#define ML99_PRIV_DEC_29  28
-#define ML99_PRIV_DEC_30  29
-#define ML99_PRIV_DEC_31  30
-#define ML99_PRIV_DEC_32  31
-#define ML99_PRIV_DEC_33  32
-#define ML99_PRIV_DEC_34  33
-#define ML99_PRIV_DEC_35  34
-#define ML99_PRIV_DEC_36  35
-#define ML99_PRIV_DEC_37  36
-#define ML99_PRIV_DEC_38  37
-#define ML99_PRIV_DEC_39  38
-#define ML99_PRIV_DEC_40  39
-#define ML99_PRIV_DEC_41  40
-#define ML99_PRIV_DEC_42  41
-#define ML99_PRIV_DEC_43  42
-#define ML99_PRIV_DEC_44  43
-#define ML99_PRIV_DEC_45  44
-#define ML99_PRIV_DEC_46  45
-#define ML99_PRIV_DEC_47  46
-#define ML99_PRIV_DEC_48  47
-#define ML99_PRIV_DEC_49  48
-#define ML99_PRIV_DEC_50  49
-#define ML99_PRIV_DEC_51  50
-#define ML99_PRIV_DEC_52  51
-#define ML99_PRIV_DEC_53  52
-#define ML99_PRIV_DEC_54  53
-#define ML99_PRIV_DEC_55  54
-#define ML99_PRIV_DEC_56  55
-#define ML99_PRIV_DEC_57  56
-#define ML99_PRIV_DEC_58  57
-#define ML99_PRIV_DEC_59  58
-#define ML99_PRIV_DEC_60  59
-#define ML99_PRIV_DEC_61  60
-#define ML99_PRIV_DEC_62  61
-#define ML99_PRIV_DEC_63  62
+// Generated by scripts/gen-tables.py.
+#define ML99_PRIV_DEC_1  0
+#define ML99_PRIV_DEC_2  1
+#define ML99_PRIV_DEC_3  2
+#define ML99_PRIV_DEC_4  3
+#define ML99_PRIV_DEC_5  4
+#define ML99_PRIV_DEC_6  5
+#define ML99_PRIV_DEC_7  6
+#define ML99_PRIV_DEC_8  7
+#define ML99_PRIV_DEC_9  8
+#define ML99_PRIV_DEC_10 9
+#define ML99_PRIV_DEC_11 10
+#define ML99_PRIV_DEC_12 11
+#define ML99_PRIV_DEC_13 12
+#define ML99_PRIV_DEC_14 13
+#define ML99_PRIV_DEC_15 14
+#define ML99_PRIV_DEC_16 15
+#define ML99_PRIV_DEC_17 16
+#define ML99_PRIV_DEC_18 17
+#define ML99_PRIV_DEC_19 18
+#define ML99_PRIV_DEC_20 19
+#define ML99_PRIV_DEC_21 20
+#define ML99_PRIV_DEC_22 21
+#define ML99_PRIV_DEC_23 22
+#define ML99_PRIV_DEC_24 23
+#define ML99_PRIV_DEC_25 24
+#define ML99_PRIV_DEC_26 25
+#define ML99_PRIV_DEC_27 26
+#define ML99_PRIV_DEC_28 27
+#define ML99_PRIV_DEC_29 28
+#define ML99_PRIV_DEC_30 29
+#define ML99_PRIV_DEC_31 30
+#define ML99_PRIV_DEC_32 31
+#define ML99_PRIV_DEC_33 32
+#define ML99_PRIV_DEC_34 33
+#define ML99_PRIV_DEC_35 34
+#define ML99_PRIV_DEC_36 35
+#define ML99_PRIV_DEC_37 36
+#define ML99_PRIV_DEC_38 37
+#define ML99_PRIV_DEC_39 38
+#define ML99_PRIV_DEC_40 39
+#define ML99_PRIV_DEC_41 40
+#define ML99_PRIV_DEC_42 41
+#define ML99_PRIV_DEC_43 42
+#define ML99_PRIV_DEC_44 43
+#define ML99_PRIV_DEC_45 44
+#define ML99_PRIV_DEC_46 45
+#define ML99_PRIV_DEC_47 46
+#define ML99_PRIV_DEC_48 47
+#define ML99_PRIV_DEC_49 48
+#define ML99_PRIV_DEC_50 49
+#define ML99_PRIV_DEC_51 50
+#define ML99_PRIV_DEC_52 51
+#define ML99_PRIV_DEC_53 52
+#define ML99_PRIV_DEC_54 53
+#define ML99_PRIV_DEC_55 54
+#define ML99_PRIV_DEC_56 55
+#define ML99_PRIV_DEC_57 56
+#define ML99_PRIV_DEC_58 57
+#define ML99_PRIV_DEC_59 58
+#define ML99_PRIV_DEC_60 59
+#define ML99_PRIV_DEC_61 60
+#define ML99_PRIV_DEC_62 61
+#define ML99_PRIV_DEC_63 62
+
+#if ML99_PRIV_NAT_MAX == 63
+#define ML99_PRIV_DEC_0 63
+#else
 #define ML99_PRIV_DEC_64  63
 #define ML99_PRIV_DEC_65  64
 #define ML99_PRIV_DEC_66  65
@@ -132,6 +138,11 @@
 #define ML99_PRIV_DEC_125 124
 #define ML99_PRIV_DEC_126 125
 #define ML99_PRIV_DEC_127 126
+
+#if ML99_PRIV_NAT_MAX == 127
+#define ML99_PRIV_DEC_0 127
+#else
+#define ML99_PRIV_DEC_0   255
 #define ML99_PRIV_DEC_128 127
 #define ML99_PRIV_DEC_129 128
 #define ML99_PRIV_DEC_130 129
@@ -260,5 +271,7 @@
 #define ML99_PRIV_DEC_253 252
 #define ML99_PRIV_DEC_254 253
 #define ML99_PRIV_DEC_255 254
+#endif
+#endif
 
 #endif // ML99_NAT_DEC_H
@@ -0,0 +1,275 @@
+#ifndef ML99_NAT_DIGITS_H
+#define ML99_NAT_DIGITS_H
+
+#include <metalang99/nat/max.h>
+
+// `ML99_PRIV_NAT_TO_DIGITS_x` is the decimal digits `h, t, o` of `x`.
+
+#define ML99_PRIV_NAT_TO_DIGITS(x)     ML99_PRIV_NAT_TO_DIGITS_AUX(x)
+#define ML99_PRIV_NAT_TO_DIGITS_AUX(x) ML99_PRIV_NAT_TO_DIGITS_##x
+
+// Generated by scripts/gen-tables.py.
+#define ML99_PRIV_NAT_TO_DIGITS_0  0, 0, 0
+#define ML99_PRIV_NAT_TO_DIGITS_1  0, 0, 1
+#define ML99_PRIV_NAT_TO_DIGITS_2  0, 0, 2
+#define ML99_PRIV_NAT_TO_DIGITS_3  0, 0, 3
+#define ML99_PRIV_NAT_TO_DIGITS_4  0, 0, 4
+#define ML99_PRIV_NAT_TO_DIGITS_5  0, 0, 5
+#define ML99_PRIV_NAT_TO_DIGITS_6  0, 0, 6
+#define ML99_PRIV_NAT_TO_DIGITS_7  0, 0, 7
+#define ML99_PRIV_NAT_TO_DIGITS_8  0, 0, 8
+#define ML99_PRIV_NAT_TO_DIGITS_9  0, 0, 9
+#define ML99_PRIV_NAT_TO_DIGITS_10 0, 1, 0
+#define ML99_PRIV_NAT_TO_DIGITS_11 0, 1, 1
+#define ML99_PRIV_NAT_TO_DIGITS_12 0, 1, 2
+#define ML99_PRIV_NAT_TO_DIGITS_13 0, 1, 3
+#define ML99_PRIV_NAT_TO_DIGITS_14 0, 1, 4
+#define ML99_PRIV_NAT_TO_DIGITS_15 0, 1, 5
+#define ML99_PRIV_NAT_TO_DIGITS_16 0, 1, 6
+#define ML99_PRIV_NAT_TO_DIGITS_17 0, 1, 7
+#define ML99_PRIV_NAT_TO_DIGITS_18 0, 1, 8
+#define ML99_PRIV_NAT_TO_DIGITS_19 0, 1, 9
+#define ML99_PRIV_NAT_TO_DIGITS_20 0, 2, 0
+#define ML99_PRIV_NAT_TO_DIGITS_21 0, 2, 1
+#define ML99_PRIV_NAT_TO_DIGITS_22 0, 2, 2
+#define ML99_PRIV_NAT_TO_DIGITS_23 0, 2, 3
+#define ML99_PRIV_NAT_TO_DIGITS_24 0, 2, 4
+#define ML99_PRIV_NAT_TO_DIGITS_25 0, 2, 5
+#define ML99_PRIV_NAT_TO_DIGITS_26 0, 2, 6
+#define ML99_PRIV_NAT_TO_DIGITS_27 0, 2, 7
+#define ML99_PRIV_NAT_TO_DIGITS_28 0, 2, 8
+#define ML99_PRIV_NAT_TO_DIGITS_29 0, 2, 9
+#define ML99_PRIV_NAT_TO_DIGITS_30 0, 3, 0
+#define ML99_PRIV_NAT_TO_DIGITS_31 0, 3, 1
+#define ML99_PRIV_NAT_TO_DIGITS_32 0, 3, 2
+#define ML99_PRIV_NAT_TO_DIGITS_33 0, 3, 3
+#define ML99_PRIV_NAT_TO_DIGITS_34 0, 3, 4
+#define ML99_PRIV_NAT_TO_DIGITS_35 0, 3, 5
+#define ML99_PRIV_NAT_TO_DIGITS_36 0, 3, 6
+#define ML99_PRIV_NAT_TO_DIGITS_37 0, 3, 7
+#define ML99_PRIV_NAT_TO_DIGITS_38 0, 3, 8
+#define ML99_PRIV_NAT_TO_DIGITS_39 0, 3, 9
+#define ML99_PRIV_NAT_TO_DIGITS_40 0, 4, 0
+#define ML99_PRIV_NAT_TO_DIGITS_41 0, 4, 1
+#define ML99_PRIV_NAT_TO_DIGITS_42 0, 4, 2
+#define ML99_PRIV_NAT_TO_DIGITS_43 0, 4, 3
+#define ML99_PRIV_NAT_TO_DIGITS_44 0, 4, 4
+#define ML99_PRIV_NAT_TO_DIGITS_45 0, 4, 5
+#define ML99_PRIV_NAT_TO_DIGITS_46 0, 4, 6
+#define ML99_PRIV_NAT_TO_DIGITS_47 0, 4, 7
+#define ML99_PRIV_NAT_TO_DIGITS_48 0, 4, 8
+#define ML99_PRIV_NAT_TO_DIGITS_49 0, 4, 9
+#define ML99_PRIV_NAT_TO_DIGITS_50 0, 5, 0
+#define ML99_PRIV_NAT_TO_DIGITS_51 0, 5, 1
+#define ML99_PRIV_NAT_TO_DIGITS_52 0, 5, 2
+#define ML99_PRIV_NAT_TO_DIGITS_53 0, 5, 3
+#define ML99_PRIV_NAT_TO_DIGITS_54 0, 5, 4
+#define ML99_PRIV_NAT_TO_DIGITS_55 0, 5, 5
+#define ML99_PRIV_NAT_TO_DIGITS_56 0, 5, 6
+#define ML99_PRIV_NAT_TO_DIGITS_57 0, 5, 7
+#define ML99_PRIV_NAT_TO_DIGITS_58 0, 5, 8
+#define ML99_PRIV_NAT_TO_DIGITS_59 0, 5, 9
+#define ML99_PRIV_NAT_TO_DIGITS_60 0, 6, 0
+#define ML99_PRIV_NAT_TO_DIGITS_61 0, 6, 1
+#define ML99_PRIV_NAT_TO_DIGITS_62 0, 6, 2
+#define ML99_PRIV_NAT_TO_DIGITS_63 0, 6, 3
+
+#if ML99_PRIV_NAT_MAX > 63
+#define ML99_PRIV_NAT_TO_DIGITS_64  0, 6, 4
+#define ML99_PRIV_NAT_TO_DIGITS_65  0, 6, 5
+#define ML99_PRIV_NAT_TO_DIGITS_66  0, 6, 6
+#define ML99_PRIV_NAT_TO_DIGITS_67  0, 6, 7
+#define ML99_PRIV_NAT_TO_DIGITS_68  0, 6, 8
+#define ML99_PRIV_NAT_TO_DIGITS_69  0, 6, 9
+#define ML99_PRIV_NAT_TO_DIGITS_70  0, 7, 0
+#define ML99_PRIV_NAT_TO_DIGITS_71  0, 7, 1
+#define ML99_PRIV_NAT_TO_DIGITS_72  0, 7, 2
+#define ML99_PRIV_NAT_TO_DIGITS_73  0, 7, 3
+#define ML99_PRIV_NAT_TO_DIGITS_74  0, 7, 4
+#define ML99_PRIV_NAT_TO_DIGITS_75  0, 7, 5
+#define ML99_PRIV_NAT_TO_DIGITS_76  0, 7, 6
+#define ML99_PRIV_NAT_TO_DIGITS_77  0, 7, 7
+#define ML99_PRIV_NAT_TO_DIGITS_78  0, 7, 8
+#define ML99_PRIV_NAT_TO_DIGITS_79  0, 7, 9
+#define ML99_PRIV_NAT_TO_DIGITS_80  0, 8, 0
+#define ML99_PRIV_NAT_TO_DIGITS_81  0, 8, 1
+#define ML99_PRIV_NAT_TO_DIGITS_82  0, 8, 2
+#define ML99_PRIV_NAT_TO_DIGITS_83  0, 8, 3
+#define ML99_PRIV_NAT_TO_DIGITS_84  0, 8, 4
+#define ML99_PRIV_NAT_TO_DIGITS_85  0, 8, 5
+#define ML99_PRIV_NAT_TO_DIGITS_86  0, 8, 6
+#define ML99_PRIV_NAT_TO_DIGITS_87  0, 8, 7
+#define ML99_PRIV_NAT_TO_DIGITS_88  0, 8, 8
+#define ML99_PRIV_NAT_TO_DIGITS_89  0, 8, 9
+#define ML99_PRIV_NAT_TO_DIGITS_90  0, 9, 0
+#define ML99_PRIV_NAT_TO_DIGITS_91  0, 9, 1
+#define ML99_PRIV_NAT_TO_DIGITS_92  0, 9, 2
+#define ML99_PRIV_NAT_TO_DIGITS_93  0, 9, 3
+#define ML99_PRIV_NAT_TO_DIGITS_94  0, 9, 4
+#define ML99_PRIV_NAT_TO_DIGITS_95  0, 9, 5
+#define ML99_PRIV_NAT_TO_DIGITS_96  0, 9, 6
+#define ML99_PRIV_NAT_TO_DIGITS_97  0, 9, 7
+#define ML99_PRIV_NAT_TO_DIGITS_98  0, 9, 8
+#define ML99_PRIV_NAT_TO_DIGITS_99  0, 9, 9
+#define ML99_PRIV_NAT_TO_DIGITS_100 1, 0, 0
+#define ML99_PRIV_NAT_TO_DIGITS_101 1, 0, 1
+#define ML99_PRIV_NAT_TO_DIGITS_102 1, 0, 2
+#define ML99_PRIV_NAT_TO_DIGITS_103 1, 0, 3
+#define ML99_PRIV_NAT_TO_DIGITS_104 1, 0, 4
+#define ML99_PRIV_NAT_TO_DIGITS_105 1, 0, 5
+#define ML99_PRIV_NAT_TO_DIGITS_106 1, 0, 6
+#define ML99_PRIV_NAT_TO_DIGITS_107 1, 0, 7
+#define ML99_PRIV_NAT_TO_DIGITS_108 1, 0, 8
+#define ML99_PRIV_NAT_TO_DIGITS_109 1, 0, 9
+#define ML99_PRIV_NAT_TO_DIGITS_110 1, 1, 0
+#define ML99_PRIV_NAT_TO_DIGITS_111 1, 1, 1
+#define ML99_PRIV_NAT_TO_DIGITS_112 1, 1, 2
+#define ML99_PRIV_NAT_TO_DIGITS_113 1, 1, 3
+#define ML99_PRIV_NAT_TO_DIGITS_114 1, 1, 4
+#define ML99_PRIV_NAT_TO_DIGITS_115 1, 1, 5
+#define ML99_PRIV_NAT_TO_DIGITS_116 1, 1, 6
+#define ML99_PRIV_NAT_TO_DIGITS_117 1, 1, 7
+#define ML99_PRIV_NAT_TO_DIGITS_118 1, 1, 8
+#define ML99_PRIV_NAT_TO_DIGITS_119 1, 1, 9
+#define ML99_PRIV_NAT_TO_DIGITS_120 1, 2, 0
+#define ML99_PRIV_NAT_TO_DIGITS_121 1, 2, 1
+#define ML99_PRIV_NAT_TO_DIGITS_122 1, 2, 2
+#define ML99_PRIV_NAT_TO_DIGITS_123 1, 2, 3
+#define ML99_PRIV_NAT_TO_DIGITS_124 1, 2, 4
+#define ML99_PRIV_NAT_TO_DIGITS_125 1, 2, 5
+#define ML99_PRIV_NAT_TO_DIGITS_126 1, 2, 6
+#define ML99_PRIV_NAT_TO_DIGITS_127 1, 2, 7
+
+#if ML99_PRIV_NAT_MAX > 127
+#define ML99_PRIV_NAT_TO_DIGITS_128 1, 2, 8
+#define ML99_PRIV_NAT_TO_DIGITS_129 1, 2, 9
+#define ML99_PRIV_NAT_TO_DIGITS_130 1, 3, 0
+#define ML99_PRIV_NAT_TO_DIGITS_131 1, 3, 1
+#define ML99_PRIV_NAT_TO_DIGITS_132 1, 3, 2
+#define ML99_PRIV_NAT_TO_DIGITS_133 1, 3, 3
+#define ML99_PRIV_NAT_TO_DIGITS_134 1, 3, 4
+#define ML99_PRIV_NAT_TO_DIGITS_135 1, 3, 5
+#define ML99_PRIV_NAT_TO_DIGITS_136 1, 3, 6
+#define ML99_PRIV_NAT_TO_DIGITS_137 1, 3, 7
+#define ML99_PRIV_NAT_TO_DIGITS_138 1, 3, 8
+#define ML99_PRIV_NAT_TO_DIGITS_139 1, 3, 9
+#define ML99_PRIV_NAT_TO_DIGITS_140 1, 4, 0
+#define ML99_PRIV_NAT_TO_DIGITS_141 1, 4, 1
+#define ML99_PRIV_NAT_TO_DIGITS_142 1, 4, 2
+#define ML99_PRIV_NAT_TO_DIGITS_143 1, 4, 3
+#define ML99_PRIV_NAT_TO_DIGITS_144 1, 4, 4
+#define ML99_PRIV_NAT_TO_DIGITS_145 1, 4, 5
+#define ML99_PRIV_NAT_TO_DIGITS_146 1, 4, 6
+#define ML99_PRIV_NAT_TO_DIGITS_147 1, 4, 7
+#define ML99_PRIV_NAT_TO_DIGITS_148 1, 4, 8
+#define ML99_PRIV_NAT_TO_DIGITS_149 1, 4, 9
+#define ML99_PRIV_NAT_TO_DIGITS_150 1, 5, 0
+#define ML99_PRIV_NAT_TO_DIGITS_151 1, 5, 1
+#define ML99_PRIV_NAT_TO_DIGITS_152 1, 5, 2
+#define ML99_PRIV_NAT_TO_DIGITS_153 1, 5, 3
+#define ML99_PRIV_NAT_TO_DIGITS_154 1, 5, 4
+#define ML99_PRIV_NAT_TO_DIGITS_155 1, 5, 5
+#define ML99_PRIV_NAT_TO_DIGITS_156 1, 5, 6
+#define ML99_PRIV_NAT_TO_DIGITS_157 1, 5, 7
+#define ML99_PRIV_NAT_TO_DIGITS_158 1, 5, 8
+#define ML99_PRIV_NAT_TO_DIGITS_159 1, 5, 9
+#define ML99_PRIV_NAT_TO_DIGITS_160 1, 6, 0
+#define ML99_PRIV_NAT_TO_DIGITS_161 1, 6, 1
+#define ML99_PRIV_NAT_TO_DIGITS_162 1, 6, 2
+#define ML99_PRIV_NAT_TO_DIGITS_163 1, 6, 3
+#define ML99_PRIV_NAT_TO_DIGITS_164 1, 6, 4
+#define ML99_PRIV_NAT_TO_DIGITS_165 1, 6, 5
+#define ML99_PRIV_NAT_TO_DIGITS_166 1, 6, 6
+#define ML99_PRIV_NAT_TO_DIGITS_167 1, 6, 7
+#define ML99_PRIV_NAT_TO_DIGITS_168 1, 6, 8
+#define ML99_PRIV_NAT_TO_DIGITS_169 1, 6, 9
+#define ML99_PRIV_NAT_TO_DIGITS_170 1, 7, 0
+#define ML99_PRIV_NAT_TO_DIGITS_171 1, 7, 1
+#define ML99_PRIV_NAT_TO_DIGITS_172 1, 7, 2
+#define ML99_PRIV_NAT_TO_DIGITS_173 1, 7, 3
+#define ML99_PRIV_NAT_TO_DIGITS_174 1, 7, 4
+#define ML99_PRIV_NAT_TO_DIGITS_175 1, 7, 5
+#define ML99_PRIV_NAT_TO_DIGITS_176 1, 7, 6
+#define ML99_PRIV_NAT_TO_DIGITS_177 1, 7, 7
+#define ML99_PRIV_NAT_TO_DIGITS_178 1, 7, 8
+#define ML99_PRIV_NAT_TO_DIGITS_179 1, 7, 9
+#define ML99_PRIV_NAT_TO_DIGITS_180 1, 8, 0
+#define ML99_PRIV_NAT_TO_DIGITS_181 1, 8, 1
+#define ML99_PRIV_NAT_TO_DIGITS_182 1, 8, 2
+#define ML99_PRIV_NAT_TO_DIGITS_183 1, 8, 3
+#define ML99_PRIV_NAT_TO_DIGITS_184 1, 8, 4
+#define ML99_PRIV_NAT_TO_DIGITS_185 1, 8, 5
+#define ML99_PRIV_NAT_TO_DIGITS_186 1, 8, 6
+#define ML99_PRIV_NAT_TO_DIGITS_187 1, 8, 7
+#define ML99_PRIV_NAT_TO_DIGITS_188 1, 8, 8
+#define ML99_PRIV_NAT_TO_DIGITS_189 1, 8, 9
+#define ML99_PRIV_NAT_TO_DIGITS_190 1, 9, 0
+#define ML99_PRIV_NAT_TO_DIGITS_191 1, 9, 1
+#define ML99_PRIV_NAT_TO_DIGITS_192 1, 9, 2
+#define ML99_PRIV_NAT_TO_DIGITS_193 1, 9, 3
+#define ML99_PRIV_NAT_TO_DIGITS_194 1, 9, 4
+#define ML99_PRIV_NAT_TO_DIGITS_195 1, 9, 5
+#define ML99_PRIV_NAT_TO_DIGITS_196 1, 9, 6
+#define ML99_PRIV_NAT_TO_DIGITS_197 1, 9, 7
+#define ML99_PRIV_NAT_TO_DIGITS_198 1, 9, 8
+#define ML99_PRIV_NAT_TO_DIGITS_199 1, 9, 9
+#define ML99_PRIV_NAT_TO_DIGITS_200 2, 0, 0
+#define ML99_PRIV_NAT_TO_DIGITS_201 2, 0, 1
+#define ML99_PRIV_NAT_TO_DIGITS_202 2, 0, 2
+#define ML99_PRIV_NAT_TO_DIGITS_203 2, 0, 3
+#define ML99_PRIV_NAT_TO_DIGITS_204 2, 0, 4
+#define ML99_PRIV_NAT_TO_DIGITS_205 2, 0, 5
+#define ML99_PRIV_NAT_TO_DIGITS_206 2, 0, 6
+#define ML99_PRIV_NAT_TO_DIGITS_207 2, 0, 7
+#define ML99_PRIV_NAT_TO_DIGITS_208 2, 0, 8
+#define ML99_PRIV_NAT_TO_DIGITS_209 2, 0, 9
+#define ML99_PRIV_NAT_TO_DIGITS_210 2, 1, 0
+#define ML99_PRIV_NAT_TO_DIGITS_211 2, 1, 1
+#define ML99_PRIV_NAT_TO_DIGITS_212 2, 1, 2
+#define ML99_PRIV_NAT_TO_DIGITS_213 2, 1, 3
+#define ML99_PRIV_NAT_TO_DIGITS_214 2, 1, 4
+#define ML99_PRIV_NAT_TO_DIGITS_215 2, 1, 5
+#define ML99_PRIV_NAT_TO_DIGITS_216 2, 1, 6
+#define ML99_PRIV_NAT_TO_DIGITS_217 2, 1, 7
+#define ML99_PRIV_NAT_TO_DIGITS_218 2, 1, 8
+#define ML99_PRIV_NAT_TO_DIGITS_219 2, 1, 9
+#define ML99_PRIV_NAT_TO_DIGITS_220 2, 2, 0
+#define ML99_PRIV_NAT_TO_DIGITS_221 2, 2, 1
+#define ML99_PRIV_NAT_TO_DIGITS_222 2, 2, 2
+#define ML99_PRIV_NAT_TO_DIGITS_223 2, 2, 3
+#define ML99_PRIV_NAT_TO_DIGITS_224 2, 2, 4
+#define ML99_PRIV_NAT_TO_DIGITS_225 2, 2, 5
+#define ML99_PRIV_NAT_TO_DIGITS_226 2, 2, 6
+#define ML99_PRIV_NAT_TO_DIGITS_227 2, 2, 7
+#define ML99_PRIV_NAT_TO_DIGITS_228 2, 2, 8
+#define ML99_PRIV_NAT_TO_DIGITS_229 2, 2, 9
+#define ML99_PRIV_NAT_TO_DIGITS_230 2, 3, 0
+#define ML99_PRIV_NAT_TO_DIGITS_231 2, 3, 1
+#define ML99_PRIV_NAT_TO_DIGITS_232 2, 3, 2
+#define ML99_PRIV_NAT_TO_DIGITS_233 2, 3, 3
+#define ML99_PRIV_NAT_TO_DIGITS_234 2, 3, 4
+#define ML99_PRIV_NAT_TO_DIGITS_235 2, 3, 5
+#define ML99_PRIV_NAT_TO_DIGITS_236 2, 3, 6
+#define ML99_PRIV_NAT_TO_DIGITS_237 2, 3, 7
+#define ML99_PRIV_NAT_TO_DIGITS_238 2, 3, 8
+#define ML99_PRIV_NAT_TO_DIGITS_239 2, 3, 9
+#define ML99_PRIV_NAT_TO_DIGITS_240 2, 4, 0
+#define ML99_PRIV_NAT_TO_DIGITS_241 2, 4, 1
+#define ML99_PRIV_NAT_TO_DIGITS_242 2, 4, 2
+#define ML99_PRIV_NAT_TO_DIGITS_243 2, 4, 3
+#define ML99_PRIV_NAT_TO_DIGITS_244 2, 4, 4
+#define ML99_PRIV_NAT_TO_DIGITS_245 2, 4, 5
+#define ML99_PRIV_NAT_TO_DIGITS_246 2, 4, 6
+#define ML99_PRIV_NAT_TO_DIGITS_247 2, 4, 7
+#define ML99_PRIV_NAT_TO_DIGITS_248 2, 4, 8
+#define ML99_PRIV_NAT_TO_DIGITS_249 2, 4, 9
+#define ML99_PRIV_NAT_TO_DIGITS_250 2, 5, 0
+#define ML99_PRIV_NAT_TO_DIGITS_251 2, 5, 1
+#define ML99_PRIV_NAT_TO_DIGITS_252 2, 5, 2
+#define ML99_PRIV_NAT_TO_DIGITS_253 2, 5, 3
+#define ML99_PRIV_NAT_TO_DIGITS_254 2, 5, 4
+#define ML99_PRIV_NAT_TO_DIGITS_255 2, 5, 5
+#endif
+#endif
+
+#endif // ML99_NAT_DIGITS_H
@@ -1,75 +1,79 @@
 #ifndef ML99_NAT_EQ_H
 #define ML99_NAT_EQ_H
 
+#include <metalang99/nat/max.h>
 #include <metalang99/priv/util.h>
 
 #define ML99_PRIV_NAT_EQ(x, y)     ML99_PRIV_NAT_EQ_AUX(x, y)
 #define ML99_PRIV_NAT_EQ_AUX(x, y) ML99_PRIV_IS_TUPLE_FAST(ML99_PRIV_NAT_EQ_##x##_##y)
 
-#define ML99_PRIV_NAT_EQ_0_0     ()
-#define ML99_PRIV_NAT_EQ_1_1     ()
-#define ML99_PRIV_NAT_EQ_2_2     ()
-#define ML99_PRIV_NAT_EQ_3_3     ()
-#define ML99_PRIV_NAT_EQ_4_4     ()
-#define ML99_PRIV_NAT_EQ_5_5     ()
-#define ML99_PRIV_NAT_EQ_6_6     ()
-#define ML99_PRIV_NAT_EQ_7_7     ()
-#define ML99_PRIV_NAT_EQ_8_8     ()
-#define ML99_PRIV_NAT_EQ_9_9     ()
-#define ML99_PRIV_NAT_EQ_10_10   ()
-#define ML99_PRIV_NAT_EQ_11_11   ()
-#define ML99_PRIV_NAT_EQ_12_12   ()
-#define ML99_PRIV_NAT_EQ_13_13   ()
-#define ML99_PRIV_NAT_EQ_14_14   ()
-#define ML99_PRIV_NAT_EQ_15_15   ()
-#define ML99_PRIV_NAT_EQ_16_16   ()
-#define ML99_PRIV_NAT_EQ_17_17   ()
-#define ML99_PRIV_NAT_EQ_18_18   ()
-#define ML99_PRIV_NAT_EQ_19_19   ()
-#define ML99_PRIV_NAT_EQ_20_20   ()
-#define ML99_PRIV_NAT_EQ_21_21   ()
-#define ML99_PRIV_NAT_EQ_22_22   ()
-#define ML99_PRIV_NAT_EQ_23_23   ()
-#define ML99_PRIV_NAT_EQ_24_24   ()
-#define ML99_PRIV_NAT_EQ_25_25   ()
-#define ML99_PRIV_NAT_EQ_26_26   ()
-#define ML99_PRIV_NAT_EQ_27_27   ()
-#define ML99_PRIV_NAT_EQ_28_28   ()
-#define ML99_PRIV_NAT_EQ_29_29   ()
-#define ML99_PRIV_NAT_EQ_30_30   ()
-#define ML99_PRIV_NAT_EQ_31_31   ()
-#define ML99_PRIV_NAT_EQ_32_32   ()
-#define ML99_PRIV_NAT_EQ_33_33   ()
-#define ML99_PRIV_NAT_EQ_34_34   ()
-#define ML99_PRIV_NAT_EQ_35_35   ()
-#define ML99_PRIV_NAT_EQ_36_36   ()
-#define ML99_PRIV_NAT_EQ_37_37   ()
-#define ML99_PRIV_NAT_EQ_38_38   ()
-#define ML99_PRIV_NAT_EQ_39_39   ()
-#define ML99_PRIV_NAT_EQ_40_40   ()
-#define ML99_PRIV_NAT_EQ_41_41   ()
-#define ML99_PRIV_NAT_EQ_42_42   ()
-#define ML99_PRIV_NAT_EQ_43_43   ()
-#define ML99_PRIV_NAT_EQ_44_44   ()
-#define ML99_PRIV_NAT_EQ_45_45   ()
-#define ML99_PRIV_NAT_EQ_46_46   ()
-#define ML99_PRIV_NAT_EQ_47_47   ()
-#define ML99_PRIV_NAT_EQ_48_48   ()
-#define ML99_PRIV_NAT_EQ_49_49   ()
-#define ML99_PRIV_NAT_EQ_50_50   ()
-#define ML99_PRIV_NAT_EQ_51_51   ()
-#define ML99_PRIV_NAT_EQ_52_52   ()
-#define ML99_PRIV_NAT_EQ_53_53   ()
-#define ML99_PRIV_NAT_EQ_54_54   ()
-#define ML99_PRIV_NAT_EQ_55_55   ()
-#define ML99_PRIV_NAT_EQ_56_56   ()
-#define ML99_PRIV_NAT_EQ_57_57   ()
-#define ML99_PRIV_NAT_EQ_58_58   ()
-#define ML99_PRIV_NAT_EQ_59_59   ()
-#define ML99_PRIV_NAT_EQ_60_60   ()
-#define ML99_PRIV_NAT_EQ_61_61   ()
-#define ML99_PRIV_NAT_EQ_62_62   ()
-#define ML99_PRIV_NAT_EQ_63_63   ()
+// Generated by scripts/gen-tables.py.
+#define ML99_PRIV_NAT_EQ_0_0   ()
+#define ML99_PRIV_NAT_EQ_1_1   ()
+#define ML99_PRIV_NAT_EQ_2_2   ()
+#define ML99_PRIV_NAT_EQ_3_3   ()
+#define ML99_PRIV_NAT_EQ_4_4   ()
+#define ML99_PRIV_NAT_EQ_5_5   ()
+#define ML99_PRIV_NAT_EQ_6_6   ()
+#define ML99_PRIV_NAT_EQ_7_7   ()
+#define ML99_PRIV_NAT_EQ_8_8   ()
+#define ML99_PRIV_NAT_EQ_9_9   ()
+#define ML99_PRIV_NAT_EQ_10_10 ()
+#define ML99_PRIV_NAT_EQ_11_11 ()
+#define ML99_PRIV_NAT_EQ_12_12 ()
+#define ML99_PRIV_NAT_EQ_13_13 ()
+#define ML99_PRIV_NAT_EQ_14_14 ()
+#define ML99_PRIV_NAT_EQ_15_15 ()
+#define ML99_PRIV_NAT_EQ_16_16 ()
+#define ML99_PRIV_NAT_EQ_17_17 ()
+#define ML99_PRIV_NAT_EQ_18_18 ()
+#define ML99_PRIV_NAT_EQ_19_19 ()
+#define ML99_PRIV_NAT_EQ_20_20 ()
+#define ML99_PRIV_NAT_EQ_21_21 ()
+#define ML99_PRIV_NAT_EQ_22_22 ()
+#define ML99_PRIV_NAT_EQ_23_23 ()
+#define ML99_PRIV_NAT_EQ_24_24 ()
+#define ML99_PRIV_NAT_EQ_25_25 ()
+#define ML99_PRIV_NAT_EQ_26_26 ()
+#define ML99_PRIV_NAT_EQ_27_27 ()
+#define ML99_PRIV_NAT_EQ_28_28 ()
+#define ML99_PRIV_NAT_EQ_29_29 ()
+#define ML99_PRIV_NAT_EQ_30_30 ()
+#define ML99_PRIV_NAT_EQ_31_31 ()
+#define ML99_PRIV_NAT_EQ_32_32 ()
+#define ML99_PRIV_NAT_EQ_33_33 ()
+#define ML99_PRIV_NAT_EQ_34_34 ()
+#define ML99_PRIV_NAT_EQ_35_35 ()
+#define ML99_PRIV_NAT_EQ_36_36 ()
+#define ML99_PRIV_NAT_EQ_37_37 ()
+#define ML99_PRIV_NAT_EQ_38_38 ()
+#define ML99_PRIV_NAT_EQ_39_39 ()
+#define ML99_PRIV_NAT_EQ_40_40 ()
+#define ML99_PRIV_NAT_EQ_41_41 ()
+#define ML99_PRIV_NAT_EQ_42_42 ()
+#define ML99_PRIV_NAT_EQ_43_43 ()
+#define ML99_PRIV_NAT_EQ_44_44 ()
+#define ML99_PRIV_NAT_EQ_45_45 ()
+#define ML99_PRIV_NAT_EQ_46_46 ()
+#define ML99_PRIV_NAT_EQ_47_47 ()
+#define ML99_PRIV_NAT_EQ_48_48 ()
+#define ML99_PRIV_NAT_EQ_49_49 ()
+#define ML99_PRIV_NAT_EQ_50_50 ()
+#define ML99_PRIV_NAT_EQ_51_51 ()
+#define ML99_PRIV_NAT_EQ_52_52 ()
+#define ML99_PRIV_NAT_EQ_53_53 ()
+#define ML99_PRIV_NAT_EQ_54_54 ()
+#define ML99_PRIV_NAT_EQ_55_55 ()
+#define ML99_PRIV_NAT_EQ_56_56 ()
+#define ML99_PRIV_NAT_EQ_57_57 ()
+#define ML99_PRIV_NAT_EQ_58_58 ()
+#define ML99_PRIV_NAT_EQ_59_59 ()
+#define ML99_PRIV_NAT_EQ_60_60 ()
+#define ML99_PRIV_NAT_EQ_61_61 ()
+#define ML99_PRIV_NAT_EQ_62_62 ()
+#define ML99_PRIV_NAT_EQ_63_63 ()
+
+#if ML99_PRIV_NAT_MAX > 63
 #define ML99_PRIV_NAT_EQ_64_64   ()
 #define ML99_PRIV_NAT_EQ_65_65   ()
 #define ML99_PRIV_NAT_EQ_66_66   ()
@@ -134,6 +138,8 @@
 #define ML99_PRIV_NAT_EQ_125_125 ()
 #define ML99_PRIV_NAT_EQ_126_126 ()
 #define ML99_PRIV_NAT_EQ_127_127 ()
+
+#if ML99_PRIV_NAT_MAX > 127
 #define ML99_PRIV_NAT_EQ_128_128 ()
 #define ML99_PRIV_NAT_EQ_129_129 ()
 #define ML99_PRIV_NAT_EQ_130_130 ()
@@ -262,5 +268,7 @@
 #define ML99_PRIV_NAT_EQ_253_253 ()
 #define ML99_PRIV_NAT_EQ_254_254 ()
 #define ML99_PRIV_NAT_EQ_255_255 ()
+#endif
+#endif
 
 #endif // ML99_NAT_EQ_H
@@ -0,0 +1,300 @@
+#ifndef ML99_NAT_FROM_BITS_H
+#define ML99_NAT_FROM_BITS_H
+
+#include <metalang99/nat/bits.h>
+#include <metalang99/nat/max.h>
+
+/* `ML99_PRIV_NAT_FROM_BITS_b7...b0` is the natural number of the binary digits `b7`, ..., `b0`.
+ * `ML99_PRIV_NAT_FROM_BITS` ignores the digits beyond those of `ML99_PRIV_NAT_MAX`, so that a
+ * result that does not fit wraps around like `ML99_PRIV_INC` and `ML99_PRIV_DEC`. */
+
+#define ML99_PRIV_NAT_FROM_BITS(...) ML99_PRIV_NAT_FROM_BITS_AUX(__VA_ARGS__)
+
+/* `ML99_PRIV_NAT_MSB` is the most significant binary digit of `ML99_PRIV_NAT_MAX`. Thus,
+ * `ML99_PRIV_NAT_SHL(b, x)` is the overflow bit and the value of `2 * x + b`, modulo
+ * `ML99_PRIV_NAT_MAX + 1`. */
+
+#if ML99_PRIV_NAT_MAX == 63
+#define ML99_PRIV_NAT_FROM_BITS_AUX(_b7, _b6, b5, b4, b3, b2, b1, b0)                              \
+    ML99_PRIV_NAT_FROM_BITS_00##b5##b4##b3##b2##b1##b0
+#define ML99_PRIV_NAT_MSB(_b7, _b6, b5, ...) b5
+#elif ML99_PRIV_NAT_MAX == 127
+#define ML99_PRIV_NAT_FROM_BITS_AUX(_b7, b6, b5, b4, b3, b2, b1, b0)                               \
+    ML99_PRIV_NAT_FROM_BITS_0##b6##b5##b4##b3##b2##b1##b0
+#define ML99_PRIV_NAT_MSB(_b7, b6, ...) b6
+#else
+#define ML99_PRIV_NAT_FROM_BITS_AUX(b7, b6, b5, b4, b3, b2, b1, b0)                                \
+    ML99_PRIV_NAT_FROM_BITS_##b7##b6##b5##b4##b3##b2##b1##b0
+#define ML99_PRIV_NAT_MSB(b7, ...) b7
+#endif
+
+#define ML99_PRIV_NAT_SHL(b, x)    ML99_PRIV_NAT_SHL_AUX(b, ML99_PRIV_NAT_TO_BITS(x))
+#define ML99_PRIV_NAT_SHL_AUX(...) ML99_PRIV_NAT_SHL_BITS(__VA_ARGS__)
+#define ML99_PRIV_NAT_SHL_BITS(b, b7, b6, b5, b4, b3, b2, b1, b0)                                  \
+    ML99_PRIV_NAT_MSB(b7, b6, b5, b4, b3, b2, b1, b0),                                             \
+        ML99_PRIV_NAT_FROM_BITS(b6, b5, b4, b3, b2, b1, b0, b)
+
+// Generated by scripts/gen-tables.py.
+#define ML99_PRIV_NAT_FROM_BITS_00000000 0
+#define ML99_PRIV_NAT_FROM_BITS_00000001 1
+#define ML99_PRIV_NAT_FROM_BITS_00000010 2
+#define ML99_PRIV_NAT_FROM_BITS_00000011 3
+#define ML99_PRIV_NAT_FROM_BITS_00000100 4
+#define ML99_PRIV_NAT_FROM_BITS_00000101 5
+#define ML99_PRIV_NAT_FROM_BITS_00000110 6
+#define ML99_PRIV_NAT_FROM_BITS_00000111 7
+#define ML99_PRIV_NAT_FROM_BITS_00001000 8
+#define ML99_PRIV_NAT_FROM_BITS_00001001 9
+#define ML99_PRIV_NAT_FROM_BITS_00001010 10
+#define ML99_PRIV_NAT_FROM_BITS_00001011 11
+#define ML99_PRIV_NAT_FROM_BITS_00001100 12
+#define ML99_PRIV_NAT_FROM_BITS_00001101 13
+#define ML99_PRIV_NAT_FROM_BITS_00001110 14
+#define ML99_PRIV_NAT_FROM_BITS_00001111 15
+#define ML99_PRIV_NAT_FROM_BITS_00010000 16
+#define ML99_PRIV_NAT_FROM_BITS_00010001 17
+#define ML99_PRIV_NAT_FROM_BITS_00010010 18
+#define ML99_PRIV_NAT_FROM_BITS_00010011 19
+#define ML99_PRIV_NAT_FROM_BITS_00010100 20
+#define ML99_PRIV_NAT_FROM_BITS_00010101 21
+#define ML99_PRIV_NAT_FROM_BITS_00010110 22
+#define ML99_PRIV_NAT_FROM_BITS_00010111 23
+#define ML99_PRIV_NAT_FROM_BITS_00011000 24
+#define ML99_PRIV_NAT_FROM_BITS_00011001 25
+#define ML99_PRIV_NAT_FROM_BITS_00011010 26
+#define ML99_PRIV_NAT_FROM_BITS_00011011 27
+#define ML99_PRIV_NAT_FROM_BITS_00011100 28
+#define ML99_PRIV_NAT_FROM_BITS_00011101 29
+#define ML99_PRIV_NAT_FROM_BITS_00011110 30
+#define ML99_PRIV_NAT_FROM_BITS_00011111 31
+#define ML99_PRIV_NAT_FROM_BITS_00100000 32
+#define ML99_PRIV_NAT_FROM_BITS_00100001 33
+#define ML99_PRIV_NAT_FROM_BITS_00100010 34
+#define ML99_PRIV_NAT_FROM_BITS_00100011 35
+#define ML99_PRIV_NAT_FROM_BITS_00100100 36
+#define ML99_PRIV_NAT_FROM_BITS_00100101 37
+#define ML99_PRIV_NAT_FROM_BITS_00100110 38
+#define ML99_PRIV_NAT_FROM_BITS_00100111 39
+#define ML99_PRIV_NAT_FROM_BITS_00101000 40
+#define ML99_PRIV_NAT_FROM_BITS_00101001 41
+#define ML99_PRIV_NAT_FROM_BITS_00101010 42
+#define ML99_PRIV_NAT_FROM_BITS_00101011 43
+#define ML99_PRIV_NAT_FROM_BITS_00101100 44
+#define ML99_PRIV_NAT_FROM_BITS_00101101 45
+#define ML99_PRIV_NAT_FROM_BITS_00101110 46
+#define ML99_PRIV_NAT_FROM_BITS_00101111 47
+#define ML99_PRIV_NAT_FROM_BITS_00110000 48
+#define ML99_PRIV_NAT_FROM_BITS_00110001 49
+#define ML99_PRIV_NAT_FROM_BITS_00110010 50
+#define ML99_PRIV_NAT_FROM_BITS_00110011 51
+#define ML99_PRIV_NAT_FROM_BITS_00110100 52
+#define ML99_PRIV_NAT_FROM_BITS_00110101 53
+#define ML99_PRIV_NAT_FROM_BITS_00110110 54
+#define ML99_PRIV_NAT_FROM_BITS_00110111 55
+#define ML99_PRIV_NAT_FROM_BITS_00111000 56
+#define ML99_PRIV_NAT_FROM_BITS_00111001 57
+#define ML99_PRIV_NAT_FROM_BITS_00111010 58
+#define ML99_PRIV_NAT_FROM_BITS_00111011 59
+#define ML99_PRIV_NAT_FROM_BITS_00111100 60
+#define ML99_PRIV_NAT_FROM_BITS_00111101 61
+#define ML99_PRIV_NAT_FROM_BITS_00111110 62
+#define ML99_PRIV_NAT_FROM_BITS_00111111 63
+
+#if ML99_PRIV_NAT_MAX > 63
+#define ML99_PRIV_NAT_FROM_BITS_01000000 64
+#define ML99_PRIV_NAT_FROM_BITS_01000001 65
+#define ML99_PRIV_NAT_FROM_BITS_01000010 66
+#define ML99_PRIV_NAT_FROM_BITS_01000011 67
+#define ML99_PRIV_NAT_FROM_BITS_01000100 68
+#define ML99_PRIV_NAT_FROM_BITS_01000101 69
+#define ML99_PRIV_NAT_FROM_BITS_01000110 70
+#define ML99_PRIV_NAT_FROM_BITS_01000111 71
+#define ML99_PRIV_NAT_FROM_BITS_01001000 72
+#define ML99_PRIV_NAT_FROM_BITS_01001001 73
+#define ML99_PRIV_NAT_FROM_BITS_01001010 74
+#define ML99_PRIV_NAT_FROM_BITS_01001011 75
+#define ML99_PRIV_NAT_FROM_BITS_01001100 76
+#define ML99_PRIV_NAT_FROM_BITS_01001101 77
+#define ML99_PRIV_NAT_FROM_BITS_01001110 78
+#define ML99_PRIV_NAT_FROM_BITS_01001111 79
+#define ML99_PRIV_NAT_FROM_BITS_01010000 80
+#define ML99_PRIV_NAT_FROM_BITS_01010001 81
+#define ML99_PRIV_NAT_FROM_BITS_01010010 82
+#define ML99_PRIV_NAT_FROM_BITS_01010011 83
+#define ML99_PRIV_NAT_FROM_BITS_01010100 84
+#define ML99_PRIV_NAT_FROM_BITS_01010101 85
+#define ML99_PRIV_NAT_FROM_BITS_01010110 86
+#define ML99_PRIV_NAT_FROM_BITS_01010111 87
+#define ML99_PRIV_NAT_FROM_BITS_01011000 88
+#define ML99_PRIV_NAT_FROM_BITS_01011001 89
+#define ML99_PRIV_NAT_FROM_BITS_01011010 90
+#define ML99_PRIV_NAT_FROM_BITS_01011011 91
+#define ML99_PRIV_NAT_FROM_BITS_01011100 92
+#define ML99_PRIV_NAT_FROM_BITS_01011101 93
+#define ML99_PRIV_NAT_FROM_BITS_01011110 94
+#define ML99_PRIV_NAT_FROM_BITS_01011111 95
+#define ML99_PRIV_NAT_FROM_BITS_01100000 96
+#define ML99_PRIV_NAT_FROM_BITS_01100001 97
+#define ML99_PRIV_NAT_FROM_BITS_01100010 98
+#define ML99_PRIV_NAT_FROM_BITS_01100011 99
+#define ML99_PRIV_NAT_FROM_BITS_01100100 100
+#define ML99_PRIV_NAT_FROM_BITS_01100101 101
+#define ML99_PRIV_NAT_FROM_BITS_01100110 102
+#define ML99_PRIV_NAT_FROM_BITS_01100111 103
+#define ML99_PRIV_NAT_FROM_BITS_01101000 104
+#define ML99_PRIV_NAT_FROM_BITS_01101001 105
+#define ML99_PRIV_NAT_FROM_BITS_01101010 106
+#define ML99_PRIV_NAT_FROM_BITS_01101011 107
+#define ML99_PRIV_NAT_FROM_BITS_01101100 108
+#define ML99_PRIV_NAT_FROM_BITS_01101101 109
+#define ML99_PRIV_NAT_FROM_BITS_01101110 110
+#define ML99_PRIV_NAT_FROM_BITS_01101111 111
+#define ML99_PRIV_NAT_FROM_BITS_01110000 112
+#define ML99_PRIV_NAT_FROM_BITS_01110001 113
+#define ML99_PRIV_NAT_FROM_BITS_01110010 114
+#define ML99_PRIV_NAT_FROM_BITS_01110011 115
+#define ML99_PRIV_NAT_FROM_BITS_01110100 116
+#define ML99_PRIV_NAT_FROM_BITS_01110101 117
+#define ML99_PRIV_NAT_FROM_BITS_01110110 118
+#define ML99_PRIV_NAT_FROM_BITS_01110111 119
+#define ML99_PRIV_NAT_FROM_BITS_01111000 120
+#define ML99_PRIV_NAT_FROM_BITS_01111001 121
+#define ML99_PRIV_NAT_FROM_BITS_01111010 122
+#define ML99_PRIV_NAT_FROM_BITS_01111011 123
+#define ML99_PRIV_NAT_FROM_BITS_01111100 124
+#define ML99_PRIV_NAT_FROM_BITS_01111101 125
+#define ML99_PRIV_NAT_FROM_BITS_01111110 126
+#define ML99_PRIV_NAT_FROM_BITS_01111111 127
+
+#if ML99_PRIV_NAT_MAX > 127
+#define ML99_PRIV_NAT_FROM_BITS_10000000 128
+#define ML99_PRIV_NAT_FROM_BITS_10000001 129
+#define ML99_PRIV_NAT_FROM_BITS_10000010 130
+#define ML99_PRIV_NAT_FROM_BITS_10000011 131
+#define ML99_PRIV_NAT_FROM_BITS_10000100 132
+#define ML99_PRIV_NAT_FROM_BITS_10000101 133
+#define ML99_PRIV_NAT_FROM_BITS_10000110 134
+#define ML99_PRIV_NAT_FROM_BITS_10000111 135
+#define ML99_PRIV_NAT_FROM_BITS_10001000 136
+#define ML99_PRIV_NAT_FROM_BITS_10001001 137
+#define ML99_PRIV_NAT_FROM_BITS_10001010 138
+#define ML99_PRIV_NAT_FROM_BITS_10001011 139
+#define ML99_PRIV_NAT_FROM_BITS_10001100 140
+#define ML99_PRIV_NAT_FROM_BITS_10001101 141
+#define ML99_PRIV_NAT_FROM_BITS_10001110 142
+#define ML99_PRIV_NAT_FROM_BITS_10001111 143
+#define ML99_PRIV_NAT_FROM_BITS_10010000 144
+#define ML99_PRIV_NAT_FROM_BITS_10010001 145
+#define ML99_PRIV_NAT_FROM_BITS_10010010 146
+#define ML99_PRIV_NAT_FROM_BITS_10010011 147
+#define ML99_PRIV_NAT_FROM_BITS_10010100 148
+#define ML99_PRIV_NAT_FROM_BITS_10010101 149
+#define ML99_PRIV_NAT_FROM_BITS_10010110 150
+#define ML99_PRIV_NAT_FROM_BITS_10010111 151
+#define ML99_PRIV_NAT_FROM_BITS_10011000 152
+#define ML99_PRIV_NAT_FROM_BITS_10011001 153
+#define ML99_PRIV_NAT_FROM_BITS_10011010 154
+#define ML99_PRIV_NAT_FROM_BITS_10011011 155
+#define ML99_PRIV_NAT_FROM_BITS_10011100 156
+#define ML99_PRIV_NAT_FROM_BITS_10011101 157
+#define ML99_PRIV_NAT_FROM_BITS_10011110 158
+#define ML99_PRIV_NAT_FROM_BITS_10011111 159
+#define ML99_PRIV_NAT_FROM_BITS_10100000 160
+#define ML99_PRIV_NAT_FROM_BITS_10100001 161
+#define ML99_PRIV_NAT_FROM_BITS_10100010 162
+#define ML99_PRIV_NAT_FROM_BITS_10100011 163
+#define ML99_PRIV_NAT_FROM_BITS_10100100 164
+#define ML99_PRIV_NAT_FROM_BITS_10100101 165
+#define ML99_PRIV_NAT_FROM_BITS_10100110 166
+#define ML99_PRIV_NAT_FROM_BITS_10100111 167
+#define ML99_PRIV_NAT_FROM_BITS_10101000 168
+#define ML99_PRIV_NAT_FROM_BITS_10101001 169
+#define ML99_PRIV_NAT_FROM_BITS_10101010 170
+#define ML99_PRIV_NAT_FROM_BITS_10101011 171
+#define ML99_PRIV_NAT_FROM_BITS_10101100 172
+#define ML99_PRIV_NAT_FROM_BITS_10101101 173
+#define ML99_PRIV_NAT_FROM_BITS_10101110 174
+#define ML99_PRIV_NAT_FROM_BITS_10101111 175
+#define ML99_PRIV_NAT_FROM_BITS_10110000 176
+#define ML99_PRIV_NAT_FROM_BITS_10110001 177
+#define ML99_PRIV_NAT_FROM_BITS_10110010 178
+#define ML99_PRIV_NAT_FROM_BITS_10110011 179
+#define ML99_PRIV_NAT_FROM_BITS_10110100 180
+#define ML99_PRIV_NAT_FROM_BITS_10110101 181
+#define ML99_PRIV_NAT_FROM_BITS_10110110 182
+#define ML99_PRIV_NAT_FROM_BITS_10110111 183
+#define ML99_PRIV_NAT_FROM_BITS_10111000 184
+#define ML99_PRIV_NAT_FROM_BITS_10111001 185
+#define ML99_PRIV_NAT_FROM_BITS_10111010 186
+#define ML99_PRIV_NAT_FROM_BITS_10111011 187
+#define ML99_PRIV_NAT_FROM_BITS_10111100 188
+#define ML99_PRIV_NAT_FROM_BITS_10111101 189
+#define ML99_PRIV_NAT_FROM_BITS_10111110 190
+#define ML99_PRIV_NAT_FROM_BITS_10111111 191
+#define ML99_PRIV_NAT_FROM_BITS_11000000 192
+#define ML99_PRIV_NAT_FROM_BITS_11000001 193
+#define ML99_PRIV_NAT_FROM_BITS_11000010 194
+#define ML99_PRIV_NAT_FROM_BITS_11000011 195
+#define ML99_PRIV_NAT_FROM_BITS_11000100 196
+#define ML99_PRIV_NAT_FROM_BITS_11000101 197
+#define ML99_PRIV_NAT_FROM_BITS_11000110 198
+#define ML99_PRIV_NAT_FROM_BITS_11000111 199
+#define ML99_PRIV_NAT_FROM_BITS_11001000 200
+#define ML99_PRIV_NAT_FROM_BITS_11001001 201
+#define ML99_PRIV_NAT_FROM_BITS_11001010 202
+#define ML99_PRIV_NAT_FROM_BITS_11001011 203
+#define ML99_PRIV_NAT_FROM_BITS_11001100 204
+#define ML99_PRIV_NAT_FROM_BITS_11001101 205
+#define ML99_PRIV_NAT_FROM_BITS_11001110 206
+#define ML99_PRIV_NAT_FROM_BITS_11001111 207
+#define ML99_PRIV_NAT_FROM_BITS_11010000 208
+#define ML99_PRIV_NAT_FROM_BITS_11010001 209
+#define ML99_PRIV_NAT_FROM_BITS_11010010 210
+#define ML99_PRIV_NAT_FROM_BITS_11010011 211
+#define ML99_PRIV_NAT_FROM_BITS_11010100 212
+#define ML99_PRIV_NAT_FROM_BITS_11010101 213
+#define ML99_PRIV_NAT_FROM_BITS_11010110 214
+#define ML99_PRIV_NAT_FROM_BITS_11010111 215
+#define ML99_PRIV_NAT_FROM_BITS_11011000 216
+#define ML99_PRIV_NAT_FROM_BITS_11011001 217
+#define ML99_PRIV_NAT_FROM_BITS_11011010 218
+#define ML99_PRIV_NAT_FROM_BITS_11011011 219
+#define ML99_PRIV_NAT_FROM_BITS_11011100 220
+#define ML99_PRIV_NAT_FROM_BITS_11011101 221
+#define ML99_PRIV_NAT_FROM_BITS_11011110 222
+#define ML99_PRIV_NAT_FROM_BITS_11011111 223
+#define ML99_PRIV_NAT_FROM_BITS_11100000 224
+#define ML99_PRIV_NAT_FROM_BITS_11100001 225
+#define ML99_PRIV_NAT_FROM_BITS_11100010 226
+#define ML99_PRIV_NAT_FROM_BITS_11100011 227
+#define ML99_PRIV_NAT_FROM_BITS_11100100 228
+#define ML99_PRIV_NAT_FROM_BITS_11100101 229
+#define ML99_PRIV_NAT_FROM_BITS_11100110 230
+#define ML99_PRIV_NAT_FROM_BITS_11100111 231
+#define ML99_PRIV_NAT_FROM_BITS_11101000 232
+#define ML99_PRIV_NAT_FROM_BITS_11101001 233
+#define ML99_PRIV_NAT_FROM_BITS_11101010 234
+#define ML99_PRIV_NAT_FROM_BITS_11101011 235
+#define ML99_PRIV_NAT_FROM_BITS_11101100 236
+#define ML99_PRIV_NAT_FROM_BITS_11101101 237
+#define ML99_PRIV_NAT_FROM_BITS_11101110 238
+#define ML99_PRIV_NAT_FROM_BITS_11101111 239
+#define ML99_PRIV_NAT_FROM_BITS_11110000 240
+#define ML99_PRIV_NAT_FROM_BITS_11110001 241
+#define ML99_PRIV_NAT_FROM_BITS_11110010 242
+#define ML99_PRIV_NAT_FROM_BITS_11110011 243
+#define ML99_PRIV_NAT_FROM_BITS_11110100 244
+#define ML99_PRIV_NAT_FROM_BITS_11110101 245
+#define ML99_PRIV_NAT_FROM_BITS_11110110 246
+#define ML99_PRIV_NAT_FROM_BITS_11110111 247
+#define ML99_PRIV_NAT_FROM_BITS_11111000 248
+#define ML99_PRIV_NAT_FROM_BITS_11111001 249
+#define ML99_PRIV_NAT_FROM_BITS_11111010 250
+#define ML99_PRIV_NAT_FROM_BITS_11111011 251
+#define ML99_PRIV_NAT_FROM_BITS_11111100 252
+#define ML99_PRIV_NAT_FROM_BITS_11111101 253
+#define ML99_PRIV_NAT_FROM_BITS_11111110 254
+#define ML99_PRIV_NAT_FROM_BITS_11111111 255
+#endif
+#endif
+#endif // ML99_NAT_FROM_BITS_H
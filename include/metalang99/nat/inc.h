@@ -1,72 +1,79 @@
 #ifndef ML99_NAT_INC_H
 #define ML99_NAT_INC_H
 
+#include <metalang99/nat/max.h>
+
 #define ML99_PRIV_INC(x)     ML99_PRIV_INC_AUX(x)
 #define ML99_PRIV_INC_AUX(x) ML99_PRIV_INC_##x
 
-#define ML99_PRIV_INC_0   1
-#define ML99_PRIV_INC_1   2
-#define ML99_PRIV_INC_2   3
-#define ML99_PRIV_INC_3   4
-#define ML99_PRIV_INC_4   5
-#define ML99_PRIV_INC_5   6
-#define ML99_PRIV_INC_6   7
-#define ML99_PRIV_INC_7   8
-#define ML99_PRIV_INC_8   9
-#define ML99_PRIV_INC_9   10
-#define ML99_PRIV_INC_10  11
-#define ML99_PRIV_INC_11  12
-#define ML99_PRIV_INC_12  13
-#define ML99_PRIV_INC_13  14
-#define ML99_PRIV_INC_14  15
-#define ML99_PRIV_INC_15  16
-#define ML99_PRIV_INC_16  17
-#define ML99_PRIV_INC_17  18
-#define ML99_PRIV_INC_18  19
-#define ML99_PRIV_INC_19  20
-#define ML99_PRIV_INC_20  21
-#define ML99_PRIV_INC_21  22
-#define ML99_PRIV_INC_22  23
-#define ML99_PRIV_INC_23  24
-#define ML99_PRIV_INC_24  25
-#define ML99_PRIV_INC_25  26
-#define ML99_PRIV_INC_26  27
-#define ML99_PRIV_INC_27  28
-#define ML99_PRIV_INC_28  29
-#define ML99_PRIV_INC_29  30
-#define ML99_PRIV_INC_30  31
-#define ML99_PRIV_INC_31  32
-#define ML99_PRIV_INC_32  33
-#define ML99_PRIV_INC_33  34
-#define ML99_PRIV_INC_34  35
-#define ML99_PRIV_INC_35  36
-#define ML99_PRIV_INC_36  37
-#define ML99_PRIV_INC_37  38
-#define ML99_PRIV_INC_38  39
-#define ML99_PRIV_INC_39  40
-#define ML99_PRIV_INC_40  41
-#define ML99_PRIV_INC_41  42
-#define ML99_PRIV_INC_42  43
-#define ML99_PRIV_INC_43  44
-#define ML99_PRIV_INC_44  45
-#define ML99_PRIV_INC_45  46
-#define ML99_PRIV_INC_46  47
-#define ML99_PRIV_INC_47  48
-#define ML99_PRIV_INC_48  49
-#define ML99_PRIV_INC_49  50
-#define ML99_PRIV_INC_50  51
-#define ML99_PRIV_INC_51  52
-#define ML99_PRIV_INC_52  53
-#define ML99_PRIV_INC_53  54
-#define ML99_PRIV_INC_54  55
-#define ML99_PRIV_INC_55  56
-#define ML99_PRIV_INC_56  57
-#define ML99_PRIV_INC_57  58
-#define ML99_PRIV_INC_58  59
-#define ML99_PRIV_INC_59  60
-#define ML99_PRIV_INC_60  61
-#define ML99_PRIV_INC_61  62
-#define ML99_PRIV_INC_62  63
+// Generated by scripts/gen-tables.py.
+#define ML99_PRIV_INC_0  1
+#define ML99_PRIV_INC_1  2
+#define ML99_PRIV_INC_2  3
+#define ML99_PRIV_INC_3  4
+#define ML99_PRIV_INC_4  5
+#define ML99_PRIV_INC_5  6
+#define ML99_PRIV_INC_6  7
+#define ML99_PRIV_INC_7  8
+#define ML99_PRIV_INC_8  9
+#define ML99_PRIV_INC_9  10
+#define ML99_PRIV_INC_10 11
+#define ML99_PRIV_INC_11 12
+#define ML99_PRIV_INC_12 13
+#define ML99_PRIV_INC_13 14
+#define ML99_PRIV_INC_14 15
+#define ML99_PRIV_INC_15 16
+#define ML99_PRIV_INC_16 17
+#define ML99_PRIV_INC_17 18
+#define ML99_PRIV_INC_18 19
+#define ML99_PRIV_INC_19 20
+#define ML99_PRIV_INC_20 21
+#define ML99_PRIV_INC_21 22
+#define ML99_PRIV_INC_22 23
+#define ML99_PRIV_INC_23 24
+#define ML99_PRIV_INC_24 25
+#define ML99_PRIV_INC_25 26
+#define ML99_PRIV_INC_26 27
+#define ML99_PRIV_INC_27 28
+#define ML99_PRIV_INC_28 29
+#define ML99_PRIV_INC_29 30
+#define ML99_PRIV_INC_30 31
+#define ML99_PRIV_INC_31 32
+#define ML99_PRIV_INC_32 33
+#define ML99_PRIV_INC_33 34
+#define ML99_PRIV_INC_34 35
+#define ML99_PRIV_INC_35 36
+#define ML99_PRIV_INC_36 37
+#define ML99_PRIV_INC_37 38
+#define ML99_PRIV_INC_38 39
+#define ML99_PRIV_INC_39 40
+#define ML99_PRIV_INC_40 41
+#define ML99_PRIV_INC_41 42
+#define ML99_PRIV_INC_42 43
+#define ML99_PRIV_INC_43 44
+#define ML99_PRIV_INC_44 45
+#define ML99_PRIV_INC_45 46
+#define ML99_PRIV_INC_46 47
+#define ML99_PRIV_INC_47 48
+#define ML99_PRIV_INC_48 49
+#define ML99_PRIV_INC_49 50
+#define ML99_PRIV_INC_50 51
+#define ML99_PRIV_INC_51 52
+#define ML99_PRIV_INC_52 53
+#define ML99_PRIV_INC_53 54
+#define ML99_PRIV_INC_54 55
+#define ML99_PRIV_INC_55 56
+#define ML99_PRIV_INC_56 57
+#define ML99_PRIV_INC_57 58
+#define ML99_PRIV_INC_58 59
+#define ML99_PRIV_INC_59 60
+#define ML99_PRIV_INC_60 61
+#define ML99_PRIV_INC_61 62
+#define ML99_PRIV_INC_62 63
+
+#if ML99_PRIV_NAT_MAX == 63
+#define ML99_PRIV_INC_63 0
+#else
 #define ML99_PRIV_INC_63  64
 #define ML99_PRIV_INC_64  65
 #define ML99_PRIV_INC_65  66
@@ -131,6 +138,10 @@
 #define ML99_PRIV_INC_124 125
 #define ML99_PRIV_INC_125 126
 #define ML99_PRIV_INC_126 127
+
+#if ML99_PRIV_NAT_MAX == 127
+#define ML99_PRIV_INC_127 0
+#else
 #define ML99_PRIV_INC_127 128
 #define ML99_PRIV_INC_128 129
 #define ML99_PRIV_INC_129 130
@@ -260,5 +271,7 @@
 #define ML99_PRIV_INC_253 254
 #define ML99_PRIV_INC_254 255
 #define ML99_PRIV_INC_255 0
+#endif
+#endif
 
 #endif // ML99_NAT_INC_H
@@ -0,0 +1,17 @@
+#ifndef ML99_NAT_MAX_H
+#define ML99_NAT_MAX_H
+
+/* The tables of natural numbers cover [0; ML99_PRIV_NAT_MAX], which is selected by `ML99_NAT_MAX`
+ * (see `nat.h`). A smaller maximum makes every translation unit parse fewer macros. */
+
+// Generated by scripts/gen-tables.py.
+#ifdef ML99_NAT_MAX
+#if ML99_NAT_MAX != 63 && ML99_NAT_MAX != 127 && ML99_NAT_MAX != 255
+#error ML99_NAT_MAX must be 63, 127, or 255.
+#endif
+#define ML99_PRIV_NAT_MAX ML99_NAT_MAX
+#else
+#define ML99_PRIV_NAT_MAX 255
+#endif
+
+#endif // ML99_NAT_MAX_H
@@ -0,0 +1,44 @@
+#ifndef ML99_NAT_MUL_H
+#define ML99_NAT_MUL_H
+
+#include <metalang99/nat/add.h>
+#include <metalang99/nat/bits.h>
+#include <metalang99/nat/from_bits.h>
+
+#include <metalang99/priv/util.h>
+
+/* `x * y` (mod 256) is computed by the shift-and-add method, one step per bit of `y`, from the most
+ * significant one: `p := 2 * p + b * x`. The steps are nested calls of the same macro, which is
+ * allowed since each one is an argument of another. */
+
+#define ML99_PRIV_NAT_MUL(x, y)    ML99_PRIV_NAT_MUL_AUX(x, ML99_PRIV_NAT_TO_BITS(y))
+#define ML99_PRIV_NAT_MUL_AUX(...) ML99_PRIV_NAT_MUL_BITS(__VA_ARGS__)
+
+#define ML99_PRIV_NAT_MUL_BITS(x, b7, b6, b5, b4, b3, b2, b1, b0)                                 \
+    ML99_PRIV_NAT_MUL_STEP(                                                                        \
+        x,                                                                                         \
+        b0,                                                                                        \
+        ML99_PRIV_NAT_MUL_STEP(                                                                    \
+            x,                                                                                     \
+            b1,                                                                                    \
+            ML99_PRIV_NAT_MUL_STEP(                                                                \
+                x,                                                                                 \
+                b2,                                                                                \
+                ML99_PRIV_NAT_MUL_STEP(                                                            \
+                    x,                                                                             \
+                    b3,                                                                            \
+                    ML99_PRIV_NAT_MUL_STEP(                                                        \
+                        x,                                                                         \
+                        b4,                                                                        \
+                        ML99_PRIV_NAT_MUL_STEP(                                                    \
+                            x,                                                                     \
+                            b5,                                                                    \
+                            ML99_PRIV_NAT_MUL_STEP(                                                \
+                                x,                                                                 \
+                                b6,                                                                \
+                                ML99_PRIV_NAT_MUL_STEP(x, b7, 0))))))))
+
+#define ML99_PRIV_NAT_MUL_STEP(x, b, p)                                                            \
+    ML99_PRIV_NAT_ADD(ML99_PRIV_SND(ML99_PRIV_NAT_SHL(0, p)), ML99_PRIV_IF(b, x, 0))
+
+#endif // ML99_NAT_MUL_H
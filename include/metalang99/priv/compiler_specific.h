@@ -30,6 +30,24 @@
 #endif
 // } (ML99_PRIV_C11_STATIC_ASSERT_AVAILABLE)
 
+// ML99_PRIV_VA_OPT_AVAILABLE {
+
+/*
+ * `__VA_OPT__` is standard since C23 and C++20; GCC 13 also accepts it, together with variadic
+ * macros called without variadic arguments, in its pre-C23 `-std=c2x` mode. Older modes are not
+ * detected even if the compiler supports `__VA_OPT__` as an extension, since it is diagnosed under
+ * `-pedantic`.
+ */
+#if defined(__cplusplus) && __cplusplus >= 202002L
+#define ML99_PRIV_VA_OPT_AVAILABLE
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 202311L
+#define ML99_PRIV_VA_OPT_AVAILABLE
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ > 201710L && !defined(__clang__) &&            \
+    __GNUC__ >= 13
+#define ML99_PRIV_VA_OPT_AVAILABLE
+#endif
+// } (ML99_PRIV_VA_OPT_AVAILABLE)
+
 // ML99_PRIV_EMIT_ERROR {
 
 #ifdef ML99_PRIV_C11_STATIC_ASSERT_AVAILABLE
@@ -1,6 +1,7 @@
 #ifndef ML99_PRIV_UTIL_H
 #define ML99_PRIV_UTIL_H
 
+#include <metalang99/priv/compiler_specific.h>
 #include <metalang99/priv/logical.h>
 
 #define ML99_PRIV_CAT(x, y)           ML99_PRIV_PRIMITIVE_CAT(x, y)
@@ -11,6 +12,7 @@
 
 #define ML99_PRIV_EXPAND(...) __VA_ARGS__
 #define ML99_PRIV_EMPTY(...)
+#define ML99_PRIV_UNTUPLE(x)  ML99_PRIV_EXPAND x
 
 #define ML99_PRIV_HEAD(...)        ML99_PRIV_HEAD_AUX(__VA_ARGS__, ~)
 #define ML99_PRIV_HEAD_AUX(x, ...) x
@@ -25,15 +27,34 @@
 #define ML99_PRIV_IF_0(_x, y)    y
 #define ML99_PRIV_IF_1(x, _y)    x
 
-#define ML99_PRIV_IS_TUPLE(x)      ML99_PRIV_NOT(ML99_PRIV_IS_UNTUPLE(x))
-#define ML99_PRIV_IS_TUPLE_FAST(x) ML99_PRIV_NOT(ML99_PRIV_IS_UNTUPLE_FAST(x))
+#define ML99_PRIV_IS_TUPLE(x) ML99_PRIV_NOT(ML99_PRIV_IS_UNTUPLE(x))
 
 #define ML99_PRIV_IS_UNTUPLE(x)                                                                    \
     ML99_PRIV_IF(ML99_PRIV_IS_DOUBLE_TUPLE_BEGINNING(x), 1, ML99_PRIV_IS_UNTUPLE_FAST(x))
 
+#ifdef ML99_PRIV_VA_OPT_AVAILABLE
+
+/* `ML99_PRIV_EMPTY x` is empty if and only if @p x is a tuple. */
+#define ML99_PRIV_IS_TUPLE_FAST(x)   ML99_PRIV_VA_OPT_EMPTY(ML99_PRIV_EMPTY x)
+#define ML99_PRIV_IS_UNTUPLE_FAST(x) ML99_PRIV_VA_OPT_NON_EMPTY(ML99_PRIV_EMPTY x)
+
+#define ML99_PRIV_VA_OPT_EMPTY(...)                                                                \
+    ML99_PRIV_PRIMITIVE_CAT(ML99_PRIV_VA_OPT_NOT_, __VA_OPT__(1))
+#define ML99_PRIV_VA_OPT_NON_EMPTY(...) ML99_PRIV_PRIMITIVE_CAT(ML99_PRIV_VA_OPT_, __VA_OPT__(1))
+
+#define ML99_PRIV_VA_OPT_NOT_  1
+#define ML99_PRIV_VA_OPT_NOT_1 0
+#define ML99_PRIV_VA_OPT_      0
+#define ML99_PRIV_VA_OPT_1     1
+
+#else
+
+#define ML99_PRIV_IS_TUPLE_FAST(x)          ML99_PRIV_NOT(ML99_PRIV_IS_UNTUPLE_FAST(x))
 #define ML99_PRIV_IS_UNTUPLE_FAST(x)        ML99_PRIV_SND(ML99_PRIV_IS_UNTUPLE_FAST_TEST x, 1)
 #define ML99_PRIV_IS_UNTUPLE_FAST_TEST(...) ~, 0
 
+#endif // ML99_PRIV_VA_OPT_AVAILABLE
+
 /**
  * Checks whether @p x takes the form `(...) (...) ...`.
  *
@@ -48,9 +69,21 @@
 #define ML99_PRIV_IS_DOUBLE_TUPLE_BEGINNING_TEST_0(...) ML99_PRIV_EMPTY()
 #define ML99_PRIV_IS_DOUBLE_TUPLE_BEGINNING_TEST_1(...) ,
 
+#ifdef ML99_PRIV_VA_OPT_AVAILABLE
+
+/* The trailing `~` makes `x,` (an empty second argument) count as containing a comma. */
+#define ML99_PRIV_CONTAINS_COMMA(...) ML99_PRIV_CONTAINS_COMMA_AUX(__VA_ARGS__ ~)
+#define ML99_PRIV_CONTAINS_COMMA_AUX(_x, ...)                                                      \
+    ML99_PRIV_PRIMITIVE_CAT(ML99_PRIV_VA_OPT_, __VA_OPT__(1))
+
+#else
+
 #define ML99_PRIV_CONTAINS_COMMA(...)                      ML99_PRIV_X_AS_COMMA(__VA_ARGS__, ML99_PRIV_COMMA, ~)
 #define ML99_PRIV_X_AS_COMMA(_head, x, ...)                ML99_PRIV_CONTAINS_COMMA_RESULT(x, 0, 1, ~)
 #define ML99_PRIV_CONTAINS_COMMA_RESULT(x, _, result, ...) result
-#define ML99_PRIV_COMMA                                    ,
+
+#endif // ML99_PRIV_VA_OPT_AVAILABLE
+
+#define ML99_PRIV_COMMA ,
 
 #endif // ML99_PRIV_UTIL_H
@@ -16,6 +16,9 @@
 #ifndef ML99_TUPLE_H
 #define ML99_TUPLE_H
 
+#include <metalang99/nat/bits.h>
+#include <metalang99/variadics/slice.h>
+
 #include <metalang99/priv/util.h>
 
 #include <metalang99/lang.h>
@@ -172,7 +175,7 @@
 /**
  * Expands to a metafunction extracting the @p i -indexed element of a tuple.
  *
- * @p i can range from 0 to 7, inclusively.
+ * @p i can range from 0 to 63, inclusively.
  *
  * # Examples
  *
@@ -229,6 +232,90 @@
  */
 #define ML99_tuplePrepend(x, ...) ML99_call(ML99_tuplePrepend, x, __VA_ARGS__)
 
+/**
+ * Applies @p f to all the elements of the tuple @p x.
+ *
+ * The elements are handled eight per reduction step, without converting @p x to a list.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/nat.h>
+ * #include <metalang99/tuple.h>
+ *
+ * // (4, 5, 6)
+ * ML99_tupleMap(ML99_appl(v(ML99_add), v(3)), v((1, 2, 3)))
+ * @endcode
+ */
+#define ML99_tupleMap(f, x) ML99_call(ML99_tupleMap, f, x)
+
+/**
+ * Extracts the elements of the tuple @p x that satisfy the predicate @p f.
+ *
+ * The elements are handled eight per reduction step, without converting @p x to a list. If no
+ * element satisfies @p f, the result is `()`.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/nat.h>
+ * #include <metalang99/tuple.h>
+ *
+ * // (14, 7, 65, 10)
+ * ML99_tupleFilter(ML99_appl(v(ML99_lesser), v(3)), v((14, 0, 1, 7, 2, 65, 3, 10)))
+ * @endcode
+ */
+#define ML99_tupleFilter(f, x) ML99_call(ML99_tupleFilter, f, x)
+
+/**
+ * Concatenates the tuple @p x with the tuple @p other.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/tuple.h>
+ *
+ * // (1, 2, 3, 4, 5)
+ * ML99_tupleConcat(v((1, 2, 3)), v((4, 5)))
+ * @endcode
+ */
+#define ML99_tupleConcat(x, other) ML99_call(ML99_tupleConcat, x, other)
+
+/**
+ * Extracts the elements of the tuple @p x from the @p i -indexed one up to, but not including,
+ * the @p j -indexed one.
+ *
+ * Takes a constant number of reduction steps. @p i must not be greater than @p j, and @p j must
+ * not be greater than the count of elements in @p x, which is at most 63. If @p i is equal to
+ * @p j, the result is `()`.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/tuple.h>
+ *
+ * // (2, 3)
+ * ML99_tupleSlice(v(1), v(3), v((1, 2, 3, 4)))
+ * @endcode
+ */
+#define ML99_tupleSlice(i, j, x) ML99_call(ML99_tupleSlice, i, j, x)
+
+/**
+ * Reverses the order of the elements in the tuple @p x.
+ *
+ * The elements are handled eight per reduction step.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/tuple.h>
+ *
+ * // (3, 2, 1)
+ * ML99_tupleReverse(v((1, 2, 3)))
+ * @endcode
+ */
+#define ML99_tupleReverse(x) ML99_call(ML99_tupleReverse, x)
+
 /**
  * A shortcut for `ML99_variadicsForEach(f, ML99_untuple(x))`.
  */
@@ -258,16 +345,17 @@
  */
 #define ML99_assertIsTuple(x) ML99_call(ML99_assertIsTuple, x)
 
-#define ML99_TUPLE(...)            (__VA_ARGS__)
-#define ML99_UNTUPLE(x)            ML99_PRIV_EXPAND x
-#define ML99_IS_TUPLE(x)           ML99_PRIV_IS_TUPLE(x)
-#define ML99_IS_UNTUPLE(x)         ML99_PRIV_IS_UNTUPLE(x)
-#define ML99_TUPLE_COUNT(x)        ML99_VARIADICS_COUNT(ML99_UNTUPLE(x))
-#define ML99_TUPLE_IS_SINGLE(x)    ML99_VARIADICS_IS_SINGLE(ML99_UNTUPLE(x))
-#define ML99_TUPLE_GET(i)          ML99_PRIV_CAT(ML99_PRIV_TUPLE_GET_, i)
-#define ML99_TUPLE_TAIL(x)         ML99_VARIADICS_TAIL(ML99_UNTUPLE(x))
-#define ML99_TUPLE_APPEND(x, ...)  (ML99_UNTUPLE(x), __VA_ARGS__)
-#define ML99_TUPLE_PREPEND(x, ...) (__VA_ARGS__, ML99_UNTUPLE(x))
+#define ML99_TUPLE(...)             (__VA_ARGS__)
+#define ML99_UNTUPLE(x)             ML99_PRIV_EXPAND x
+#define ML99_IS_TUPLE(x)            ML99_PRIV_IS_TUPLE(x)
+#define ML99_IS_UNTUPLE(x)          ML99_PRIV_IS_UNTUPLE(x)
+#define ML99_TUPLE_COUNT(x)         ML99_VARIADICS_COUNT(ML99_UNTUPLE(x))
+#define ML99_TUPLE_IS_SINGLE(x)     ML99_VARIADICS_IS_SINGLE(ML99_UNTUPLE(x))
+#define ML99_TUPLE_GET(i)           ML99_PRIV_CAT(ML99_PRIV_TUPLE_GET_, i)
+#define ML99_TUPLE_TAIL(x)          ML99_VARIADICS_TAIL(ML99_UNTUPLE(x))
+#define ML99_TUPLE_APPEND(x, ...)   (ML99_UNTUPLE(x), __VA_ARGS__)
+#define ML99_TUPLE_PREPEND(x, ...)  (__VA_ARGS__, ML99_UNTUPLE(x))
+#define ML99_TUPLE_CONCAT(x, other) (ML99_UNTUPLE(x), ML99_UNTUPLE(other))
 
 #ifndef DOXYGEN_IGNORE
 
@@ -284,39 +372,376 @@
 
 #define ML99_PRIV_UNTUPLE_CHECKED_AUX(x) v(ML99_UNTUPLE(x))
 
-#define ML99_PRIV_tupleGet_0(x) ML99_call(ML99_PRIV_tupleGet_0, x)
-#define ML99_PRIV_tupleGet_1(x) ML99_call(ML99_PRIV_tupleGet_1, x)
-#define ML99_PRIV_tupleGet_2(x) ML99_call(ML99_PRIV_tupleGet_2, x)
-#define ML99_PRIV_tupleGet_3(x) ML99_call(ML99_PRIV_tupleGet_3, x)
-#define ML99_PRIV_tupleGet_4(x) ML99_call(ML99_PRIV_tupleGet_4, x)
-#define ML99_PRIV_tupleGet_5(x) ML99_call(ML99_PRIV_tupleGet_5, x)
-#define ML99_PRIV_tupleGet_6(x) ML99_call(ML99_PRIV_tupleGet_6, x)
-#define ML99_PRIV_tupleGet_7(x) ML99_call(ML99_PRIV_tupleGet_7, x)
-
-#define ML99_PRIV_tupleGet_0_IMPL(x) v(ML99_TUPLE_GET(0)(x))
-#define ML99_PRIV_tupleGet_1_IMPL(x) v(ML99_TUPLE_GET(1)(x))
-#define ML99_PRIV_tupleGet_2_IMPL(x) v(ML99_TUPLE_GET(2)(x))
-#define ML99_PRIV_tupleGet_3_IMPL(x) v(ML99_TUPLE_GET(3)(x))
-#define ML99_PRIV_tupleGet_4_IMPL(x) v(ML99_TUPLE_GET(4)(x))
-#define ML99_PRIV_tupleGet_5_IMPL(x) v(ML99_TUPLE_GET(5)(x))
-#define ML99_PRIV_tupleGet_6_IMPL(x) v(ML99_TUPLE_GET(6)(x))
-#define ML99_PRIV_tupleGet_7_IMPL(x) v(ML99_TUPLE_GET(7)(x))
-
-#define ML99_PRIV_TUPLE_GET_0(x) ML99_VARIADICS_GET(0)(ML99_UNTUPLE(x))
-#define ML99_PRIV_TUPLE_GET_1(x) ML99_VARIADICS_GET(1)(ML99_UNTUPLE(x))
-#define ML99_PRIV_TUPLE_GET_2(x) ML99_VARIADICS_GET(2)(ML99_UNTUPLE(x))
-#define ML99_PRIV_TUPLE_GET_3(x) ML99_VARIADICS_GET(3)(ML99_UNTUPLE(x))
-#define ML99_PRIV_TUPLE_GET_4(x) ML99_VARIADICS_GET(4)(ML99_UNTUPLE(x))
-#define ML99_PRIV_TUPLE_GET_5(x) ML99_VARIADICS_GET(5)(ML99_UNTUPLE(x))
-#define ML99_PRIV_TUPLE_GET_6(x) ML99_VARIADICS_GET(6)(ML99_UNTUPLE(x))
-#define ML99_PRIV_TUPLE_GET_7(x) ML99_VARIADICS_GET(7)(ML99_UNTUPLE(x))
-
 #define ML99_tupleTail_IMPL(x) v(ML99_TUPLE_TAIL(x))
 
-#define ML99_tupleAppend_IMPL(x, ...)  v(ML99_TUPLE_APPEND(x, __VA_ARGS__))
-#define ML99_tuplePrepend_IMPL(x, ...) v(ML99_TUPLE_PREPEND(x, __VA_ARGS__))
-#define ML99_tupleForEach_IMPL(f, x)   ML99_variadicsForEach_IMPL(f, ML99_UNTUPLE(x))
-#define ML99_tupleForEachI_IMPL(f, x)  ML99_variadicsForEachI_IMPL(f, ML99_UNTUPLE(x))
+#define ML99_tupleAppend_IMPL(x, ...)   v(ML99_TUPLE_APPEND(x, __VA_ARGS__))
+#define ML99_tuplePrepend_IMPL(x, ...)  v(ML99_TUPLE_PREPEND(x, __VA_ARGS__))
+#define ML99_tupleForEach_IMPL(f, x)    ML99_variadicsForEach_IMPL(f, ML99_UNTUPLE(x))
+#define ML99_tupleForEachI_IMPL(f, x)   ML99_variadicsForEachI_IMPL(f, ML99_UNTUPLE(x))
+#define ML99_tupleConcat_IMPL(x, other) v(ML99_TUPLE_CONCAT(x, other))
+
+/* `ML99_tupleMap`, `ML99_tupleFilter`, and `ML99_tupleReverse` pass the elements to a metafunction
+ * followed by the `~` sentinel, so that elements are left if there is more than one argument after
+ * them, and a chunk of eight is left if there are more than eight. */
+
+#define ML99_PRIV_TUPLE_ITEMS_LEFT(...) ML99_PRIV_VARIADICS_MORE_THAN_1(__VA_ARGS__)
+#define ML99_PRIV_TUPLE_CHUNK_LEFT(...) ML99_PRIV_VARIADICS_MORE_THAN_8(__VA_ARGS__)
+
+// ML99_tupleMap {
+
+/* As in `ML99_vecMap`, the mapped elements are emitted as terms separated by `v(,)`, and a
+ * metafunction that continues with the rest of the elements is called unevaluated, so that the
+ * whole result becomes the argument of `ML99_PRIV_tupleOf`. */
+
+#define ML99_tupleMap_IMPL(f, x)                                                                   \
+    ML99_call(ML99_PRIV_tupleOf, ML99_callUneval(ML99_PRIV_tupleMapProgress, f, ML99_UNTUPLE(x), ~))
+
+#define ML99_PRIV_tupleOf_IMPL(...) v((__VA_ARGS__))
+
+#define ML99_PRIV_tupleMapProgress_IMPL(f, ...)                                                    \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_TUPLE_CHUNK_LEFT(__VA_ARGS__),                                                   \
+        ML99_PRIV_tupleMapChunk,                                                                   \
+        ML99_PRIV_tupleMapOne)                                                                     \
+    (f, __VA_ARGS__)
+
+#define ML99_PRIV_tupleMapChunk(f, _1, _2, _3, _4, _5, _6, _7, _8, ...)                            \
+    ML99_appl_IMPL(f, _1), v(,), ML99_appl_IMPL(f, _2), v(,), ML99_appl_IMPL(f, _3), v(,),         \
+        ML99_appl_IMPL(f, _4), v(,), ML99_appl_IMPL(f, _5), v(,), ML99_appl_IMPL(f, _6), v(,),     \
+        ML99_appl_IMPL(f, _7), v(,),                                                               \
+        ML99_appl_IMPL(f, _8) ML99_PRIV_IF(                                                        \
+            ML99_PRIV_TUPLE_ITEMS_LEFT(__VA_ARGS__),                                               \
+            ML99_PRIV_tupleMapNext,                                                                \
+            ML99_PRIV_EMPTY)(f, __VA_ARGS__)
+#define ML99_PRIV_tupleMapOne(f, x, ...)                                                           \
+    ML99_appl_IMPL(f, x) ML99_PRIV_IF(                                                             \
+        ML99_PRIV_TUPLE_ITEMS_LEFT(__VA_ARGS__),                                                   \
+        ML99_PRIV_tupleMapNext,                                                                    \
+        ML99_PRIV_EMPTY)(f, __VA_ARGS__)
+
+#define ML99_PRIV_tupleMapNext(f, ...)                                                             \
+    , v(,), ML99_callUneval(ML99_PRIV_tupleMapProgress, f, __VA_ARGS__)
+// } (ML99_tupleMap)
+
+// ML99_tupleFilter {
+
+/* As in `ML99_vecFilter`, a chunk of elements is first passed to `f`, and then each element is
+ * kept according to its bit. The kept elements are accumulated as `(, x1, ..., xm)`. */
+
+#define ML99_tupleFilter_IMPL(f, x) ML99_PRIV_tupleFilterProgress(f, (), ML99_UNTUPLE(x), ~)
+
+#define ML99_PRIV_tupleFilterProgress(f, kept, ...)                                                \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_TUPLE_CHUNK_LEFT(__VA_ARGS__),                                                   \
+        ML99_PRIV_tupleFilterChunk,                                                                \
+        ML99_PRIV_tupleFilterOne)                                                                  \
+    (f, kept, __VA_ARGS__)
+
+#define ML99_PRIV_tupleFilterChunk(f, kept, _1, _2, _3, _4, _5, _6, _7, _8, ...)                   \
+    ML99_call(                                                                                     \
+        ML99_PRIV_tupleFilterKeepChunk,                                                            \
+        v(f, kept),                                                                                \
+        ML99_appl_IMPL(f, _1),                                                                     \
+        ML99_appl_IMPL(f, _2),                                                                     \
+        ML99_appl_IMPL(f, _3),                                                                     \
+        ML99_appl_IMPL(f, _4),                                                                     \
+        ML99_appl_IMPL(f, _5),                                                                     \
+        ML99_appl_IMPL(f, _6),                                                                     \
+        ML99_appl_IMPL(f, _7),                                                                     \
+        ML99_appl_IMPL(f, _8),                                                                     \
+        v(_1, _2, _3, _4, _5, _6, _7, _8, __VA_ARGS__))
+#define ML99_PRIV_tupleFilterOne(f, kept, x, ...)                                                  \
+    ML99_call(ML99_PRIV_tupleFilterKeepOne, v(f, kept), ML99_appl_IMPL(f, x), v(x, __VA_ARGS__))
+
+#define ML99_PRIV_tupleFilterKeepChunk_IMPL(                                                       \
+    f, kept, b1, b2, b3, b4, b5, b6, b7, b8, _1, _2, _3, _4, _5, _6, _7, _8, ...)                  \
+    ML99_PRIV_tupleFilterNext(                                                                     \
+        f,                                                                                         \
+        (ML99_PRIV_EXPAND kept ML99_PRIV_TUPLE_KEEP_##b1(_1) ML99_PRIV_TUPLE_KEEP_##b2(_2)         \
+             ML99_PRIV_TUPLE_KEEP_##b3(_3) ML99_PRIV_TUPLE_KEEP_##b4(_4)                           \
+                 ML99_PRIV_TUPLE_KEEP_##b5(_5) ML99_PRIV_TUPLE_KEEP_##b6(_6)                       \
+                     ML99_PRIV_TUPLE_KEEP_##b7(_7) ML99_PRIV_TUPLE_KEEP_##b8(_8)),                 \
+        __VA_ARGS__)
+#define ML99_PRIV_tupleFilterKeepOne_IMPL(f, kept, b, x, ...)                                      \
+    ML99_PRIV_tupleFilterNext(f, (ML99_PRIV_EXPAND kept ML99_PRIV_TUPLE_KEEP_##b(x)), __VA_ARGS__)
+
+#define ML99_PRIV_tupleFilterNext(f, kept, ...)                                                    \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_TUPLE_ITEMS_LEFT(__VA_ARGS__),                                                   \
+        ML99_PRIV_tupleFilterProgress,                                                             \
+        ML99_PRIV_tupleFilterDone)                                                                 \
+    (f, kept, __VA_ARGS__)
+#define ML99_PRIV_tupleFilterDone(_f, kept, ...)                                                   \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_CONTAINS_COMMA kept,                                                             \
+        ML99_PRIV_tupleFilterKept,                                                                 \
+        ML99_PRIV_tupleFilterNone)                                                                 \
+    kept
+#define ML99_PRIV_tupleFilterKept(_, ...) v((__VA_ARGS__))
+#define ML99_PRIV_tupleFilterNone(_)      v(())
+
+#define ML99_PRIV_TUPLE_KEEP_0(x)
+#define ML99_PRIV_TUPLE_KEEP_1(x) , x
+// } (ML99_tupleFilter)
+
+// ML99_tupleSlice {
+
+#define ML99_tupleSlice_IMPL(i, j, x)                                                              \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_NAT_LESSER(j, i),                                                                \
+        ML99_PRIV_tupleSliceRangeError,                                                            \
+        ML99_PRIV_IF(                                                                              \
+            ML99_PRIV_NAT_LESSER(ML99_TUPLE_COUNT(x), j),                                          \
+            ML99_PRIV_tupleSliceIndexError,                                                        \
+            ML99_PRIV_IF(                                                                          \
+                ML99_PRIV_NAT_LESSER(i, j),                                                        \
+                ML99_PRIV_tupleSliceItems,                                                         \
+                ML99_PRIV_tupleSliceEmpty)))                                                       \
+    (i, j, x)
+
+/* The first `j` items are taken before the first `i` of them are dropped, so that `j - i` is never
+ * computed. Since `i < j`, an item is left after the drop, so no sentinel is needed. */
+#define ML99_PRIV_tupleSliceItems(i, j, x)                                                         \
+    v((ML99_PRIV_VARIADICS_DROP(i, ML99_PRIV_VARIADICS_TAKE(j, ML99_UNTUPLE(x), ~))))
+#define ML99_PRIV_tupleSliceEmpty(_i, _j, _x) v(())
+
+#define ML99_PRIV_tupleSliceRangeError(i, j, _x) ML99_fatal(ML99_tupleSlice, i is greater than j)
+#define ML99_PRIV_tupleSliceIndexError(_i, j, _x)                                                  \
+    ML99_fatal(ML99_tupleSlice, index j is out of range)
+// } (ML99_tupleSlice)
+
+// ML99_tupleReverse {
+
+/* The reversed elements are accumulated as `(xk, ..., x1)`, eight more at a time while a chunk is
+ * left. */
+
+#define ML99_tupleReverse_IMPL(x) ML99_PRIV_tupleReverseStart(ML99_UNTUPLE(x), ~)
+#define ML99_PRIV_tupleReverseStart(...)       ML99_PRIV_tupleReverseStartAux(__VA_ARGS__)
+#define ML99_PRIV_tupleReverseStartAux(x, ...) ML99_PRIV_tupleReverseNext((x), __VA_ARGS__)
+
+#define ML99_PRIV_tupleReverseProgress_IMPL(acc, ...)                                              \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_TUPLE_CHUNK_LEFT(__VA_ARGS__),                                                   \
+        ML99_PRIV_tupleReverseChunk,                                                               \
+        ML99_PRIV_tupleReverseOne)                                                                 \
+    (acc, __VA_ARGS__)
+
+#define ML99_PRIV_tupleReverseChunk(acc, _1, _2, _3, _4, _5, _6, _7, _8, ...)                      \
+    ML99_PRIV_tupleReverseNext(                                                                    \
+        (_8, _7, _6, _5, _4, _3, _2, _1, ML99_PRIV_EXPAND acc),                                    \
+        __VA_ARGS__)
+#define ML99_PRIV_tupleReverseOne(acc, x, ...)                                                     \
+    ML99_PRIV_tupleReverseNext((x, ML99_PRIV_EXPAND acc), __VA_ARGS__)
+
+#define ML99_PRIV_tupleReverseNext(acc, ...)                                                       \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_TUPLE_ITEMS_LEFT(__VA_ARGS__),                                                   \
+        ML99_PRIV_tupleReverseContinue,                                                            \
+        ML99_PRIV_tupleReverseDone)                                                                \
+    (acc, __VA_ARGS__)
+#define ML99_PRIV_tupleReverseContinue(acc, ...)                                                   \
+    ML99_callUneval(ML99_PRIV_tupleReverseProgress, acc, __VA_ARGS__)
+#define ML99_PRIV_tupleReverseDone(acc, ...) v(acc)
+// } (ML99_tupleReverse)
+
+// ML99_tupleGet {
+
+// Generated by scripts/gen-tables.py.
+#define ML99_PRIV_tupleGet_0(x)  ML99_call(ML99_PRIV_tupleGet_0, x)
+#define ML99_PRIV_tupleGet_1(x)  ML99_call(ML99_PRIV_tupleGet_1, x)
+#define ML99_PRIV_tupleGet_2(x)  ML99_call(ML99_PRIV_tupleGet_2, x)
+#define ML99_PRIV_tupleGet_3(x)  ML99_call(ML99_PRIV_tupleGet_3, x)
+#define ML99_PRIV_tupleGet_4(x)  ML99_call(ML99_PRIV_tupleGet_4, x)
+#define ML99_PRIV_tupleGet_5(x)  ML99_call(ML99_PRIV_tupleGet_5, x)
+#define ML99_PRIV_tupleGet_6(x)  ML99_call(ML99_PRIV_tupleGet_6, x)
+#define ML99_PRIV_tupleGet_7(x)  ML99_call(ML99_PRIV_tupleGet_7, x)
+#define ML99_PRIV_tupleGet_8(x)  ML99_call(ML99_PRIV_tupleGet_8, x)
+#define ML99_PRIV_tupleGet_9(x)  ML99_call(ML99_PRIV_tupleGet_9, x)
+#define ML99_PRIV_tupleGet_10(x) ML99_call(ML99_PRIV_tupleGet_10, x)
+#define ML99_PRIV_tupleGet_11(x) ML99_call(ML99_PRIV_tupleGet_11, x)
+#define ML99_PRIV_tupleGet_12(x) ML99_call(ML99_PRIV_tupleGet_12, x)
+#define ML99_PRIV_tupleGet_13(x) ML99_call(ML99_PRIV_tupleGet_13, x)
+#define ML99_PRIV_tupleGet_14(x) ML99_call(ML99_PRIV_tupleGet_14, x)
+#define ML99_PRIV_tupleGet_15(x) ML99_call(ML99_PRIV_tupleGet_15, x)
+#define ML99_PRIV_tupleGet_16(x) ML99_call(ML99_PRIV_tupleGet_16, x)
+#define ML99_PRIV_tupleGet_17(x) ML99_call(ML99_PRIV_tupleGet_17, x)
+#define ML99_PRIV_tupleGet_18(x) ML99_call(ML99_PRIV_tupleGet_18, x)
+#define ML99_PRIV_tupleGet_19(x) ML99_call(ML99_PRIV_tupleGet_19, x)
+#define ML99_PRIV_tupleGet_20(x) ML99_call(ML99_PRIV_tupleGet_20, x)
+#define ML99_PRIV_tupleGet_21(x) ML99_call(ML99_PRIV_tupleGet_21, x)
+#define ML99_PRIV_tupleGet_22(x) ML99_call(ML99_PRIV_tupleGet_22, x)
+#define ML99_PRIV_tupleGet_23(x) ML99_call(ML99_PRIV_tupleGet_23, x)
+#define ML99_PRIV_tupleGet_24(x) ML99_call(ML99_PRIV_tupleGet_24, x)
+#define ML99_PRIV_tupleGet_25(x) ML99_call(ML99_PRIV_tupleGet_25, x)
+#define ML99_PRIV_tupleGet_26(x) ML99_call(ML99_PRIV_tupleGet_26, x)
+#define ML99_PRIV_tupleGet_27(x) ML99_call(ML99_PRIV_tupleGet_27, x)
+#define ML99_PRIV_tupleGet_28(x) ML99_call(ML99_PRIV_tupleGet_28, x)
+#define ML99_PRIV_tupleGet_29(x) ML99_call(ML99_PRIV_tupleGet_29, x)
+#define ML99_PRIV_tupleGet_30(x) ML99_call(ML99_PRIV_tupleGet_30, x)
+#define ML99_PRIV_tupleGet_31(x) ML99_call(ML99_PRIV_tupleGet_31, x)
+#define ML99_PRIV_tupleGet_32(x) ML99_call(ML99_PRIV_tupleGet_32, x)
+#define ML99_PRIV_tupleGet_33(x) ML99_call(ML99_PRIV_tupleGet_33, x)
+#define ML99_PRIV_tupleGet_34(x) ML99_call(ML99_PRIV_tupleGet_34, x)
+#define ML99_PRIV_tupleGet_35(x) ML99_call(ML99_PRIV_tupleGet_35, x)
+#define ML99_PRIV_tupleGet_36(x) ML99_call(ML99_PRIV_tupleGet_36, x)
+#define ML99_PRIV_tupleGet_37(x) ML99_call(ML99_PRIV_tupleGet_37, x)
+#define ML99_PRIV_tupleGet_38(x) ML99_call(ML99_PRIV_tupleGet_38, x)
+#define ML99_PRIV_tupleGet_39(x) ML99_call(ML99_PRIV_tupleGet_39, x)
+#define ML99_PRIV_tupleGet_40(x) ML99_call(ML99_PRIV_tupleGet_40, x)
+#define ML99_PRIV_tupleGet_41(x) ML99_call(ML99_PRIV_tupleGet_41, x)
+#define ML99_PRIV_tupleGet_42(x) ML99_call(ML99_PRIV_tupleGet_42, x)
+#define ML99_PRIV_tupleGet_43(x) ML99_call(ML99_PRIV_tupleGet_43, x)
+#define ML99_PRIV_tupleGet_44(x) ML99_call(ML99_PRIV_tupleGet_44, x)
+#define ML99_PRIV_tupleGet_45(x) ML99_call(ML99_PRIV_tupleGet_45, x)
+#define ML99_PRIV_tupleGet_46(x) ML99_call(ML99_PRIV_tupleGet_46, x)
+#define ML99_PRIV_tupleGet_47(x) ML99_call(ML99_PRIV_tupleGet_47, x)
+#define ML99_PRIV_tupleGet_48(x) ML99_call(ML99_PRIV_tupleGet_48, x)
+#define ML99_PRIV_tupleGet_49(x) ML99_call(ML99_PRIV_tupleGet_49, x)
+#define ML99_PRIV_tupleGet_50(x) ML99_call(ML99_PRIV_tupleGet_50, x)
+#define ML99_PRIV_tupleGet_51(x) ML99_call(ML99_PRIV_tupleGet_51, x)
+#define ML99_PRIV_tupleGet_52(x) ML99_call(ML99_PRIV_tupleGet_52, x)
+#define ML99_PRIV_tupleGet_53(x) ML99_call(ML99_PRIV_tupleGet_53, x)
+#define ML99_PRIV_tupleGet_54(x) ML99_call(ML99_PRIV_tupleGet_54, x)
+#define ML99_PRIV_tupleGet_55(x) ML99_call(ML99_PRIV_tupleGet_55, x)
+#define ML99_PRIV_tupleGet_56(x) ML99_call(ML99_PRIV_tupleGet_56, x)
+#define ML99_PRIV_tupleGet_57(x) ML99_call(ML99_PRIV_tupleGet_57, x)
+#define ML99_PRIV_tupleGet_58(x) ML99_call(ML99_PRIV_tupleGet_58, x)
+#define ML99_PRIV_tupleGet_59(x) ML99_call(ML99_PRIV_tupleGet_59, x)
+#define ML99_PRIV_tupleGet_60(x) ML99_call(ML99_PRIV_tupleGet_60, x)
+#define ML99_PRIV_tupleGet_61(x) ML99_call(ML99_PRIV_tupleGet_61, x)
+#define ML99_PRIV_tupleGet_62(x) ML99_call(ML99_PRIV_tupleGet_62, x)
+#define ML99_PRIV_tupleGet_63(x) ML99_call(ML99_PRIV_tupleGet_63, x)
+
+#define ML99_PRIV_tupleGet_0_IMPL(x)  v(ML99_TUPLE_GET(0)(x))
+#define ML99_PRIV_tupleGet_1_IMPL(x)  v(ML99_TUPLE_GET(1)(x))
+#define ML99_PRIV_tupleGet_2_IMPL(x)  v(ML99_TUPLE_GET(2)(x))
+#define ML99_PRIV_tupleGet_3_IMPL(x)  v(ML99_TUPLE_GET(3)(x))
+#define ML99_PRIV_tupleGet_4_IMPL(x)  v(ML99_TUPLE_GET(4)(x))
+#define ML99_PRIV_tupleGet_5_IMPL(x)  v(ML99_TUPLE_GET(5)(x))
+#define ML99_PRIV_tupleGet_6_IMPL(x)  v(ML99_TUPLE_GET(6)(x))
+#define ML99_PRIV_tupleGet_7_IMPL(x)  v(ML99_TUPLE_GET(7)(x))
+#define ML99_PRIV_tupleGet_8_IMPL(x)  v(ML99_TUPLE_GET(8)(x))
+#define ML99_PRIV_tupleGet_9_IMPL(x)  v(ML99_TUPLE_GET(9)(x))
+#define ML99_PRIV_tupleGet_10_IMPL(x) v(ML99_TUPLE_GET(10)(x))
+#define ML99_PRIV_tupleGet_11_IMPL(x) v(ML99_TUPLE_GET(11)(x))
+#define ML99_PRIV_tupleGet_12_IMPL(x) v(ML99_TUPLE_GET(12)(x))
+#define ML99_PRIV_tupleGet_13_IMPL(x) v(ML99_TUPLE_GET(13)(x))
+#define ML99_PRIV_tupleGet_14_IMPL(x) v(ML99_TUPLE_GET(14)(x))
+#define ML99_PRIV_tupleGet_15_IMPL(x) v(ML99_TUPLE_GET(15)(x))
+#define ML99_PRIV_tupleGet_16_IMPL(x) v(ML99_TUPLE_GET(16)(x))
+#define ML99_PRIV_tupleGet_17_IMPL(x) v(ML99_TUPLE_GET(17)(x))
+#define ML99_PRIV_tupleGet_18_IMPL(x) v(ML99_TUPLE_GET(18)(x))
+#define ML99_PRIV_tupleGet_19_IMPL(x) v(ML99_TUPLE_GET(19)(x))
+#define ML99_PRIV_tupleGet_20_IMPL(x) v(ML99_TUPLE_GET(20)(x))
+#define ML99_PRIV_tupleGet_21_IMPL(x) v(ML99_TUPLE_GET(21)(x))
+#define ML99_PRIV_tupleGet_22_IMPL(x) v(ML99_TUPLE_GET(22)(x))
+#define ML99_PRIV_tupleGet_23_IMPL(x) v(ML99_TUPLE_GET(23)(x))
+#define ML99_PRIV_tupleGet_24_IMPL(x) v(ML99_TUPLE_GET(24)(x))
+#define ML99_PRIV_tupleGet_25_IMPL(x) v(ML99_TUPLE_GET(25)(x))
+#define ML99_PRIV_tupleGet_26_IMPL(x) v(ML99_TUPLE_GET(26)(x))
+#define ML99_PRIV_tupleGet_27_IMPL(x) v(ML99_TUPLE_GET(27)(x))
+#define ML99_PRIV_tupleGet_28_IMPL(x) v(ML99_TUPLE_GET(28)(x))
+#define ML99_PRIV_tupleGet_29_IMPL(x) v(ML99_TUPLE_GET(29)(x))
+#define ML99_PRIV_tupleGet_30_IMPL(x) v(ML99_TUPLE_GET(30)(x))
+#define ML99_PRIV_tupleGet_31_IMPL(x) v(ML99_TUPLE_GET(31)(x))
+#define ML99_PRIV_tupleGet_32_IMPL(x) v(ML99_TUPLE_GET(32)(x))
+#define ML99_PRIV_tupleGet_33_IMPL(x) v(ML99_TUPLE_GET(33)(x))
+#define ML99_PRIV_tupleGet_34_IMPL(x) v(ML99_TUPLE_GET(34)(x))
+#define ML99_PRIV_tupleGet_35_IMPL(x) v(ML99_TUPLE_GET(35)(x))
+#define ML99_PRIV_tupleGet_36_IMPL(x) v(ML99_TUPLE_GET(36)(x))
+#define ML99_PRIV_tupleGet_37_IMPL(x) v(ML99_TUPLE_GET(37)(x))
+#define ML99_PRIV_tupleGet_38_IMPL(x) v(ML99_TUPLE_GET(38)(x))
+#define ML99_PRIV_tupleGet_39_IMPL(x) v(ML99_TUPLE_GET(39)(x))
+#define ML99_PRIV_tupleGet_40_IMPL(x) v(ML99_TUPLE_GET(40)(x))
+#define ML99_PRIV_tupleGet_41_IMPL(x) v(ML99_TUPLE_GET(41)(x))
+#define ML99_PRIV_tupleGet_42_IMPL(x) v(ML99_TUPLE_GET(42)(x))
+#define ML99_PRIV_tupleGet_43_IMPL(x) v(ML99_TUPLE_GET(43)(x))
+#define ML99_PRIV_tupleGet_44_IMPL(x) v(ML99_TUPLE_GET(44)(x))
+#define ML99_PRIV_tupleGet_45_IMPL(x) v(ML99_TUPLE_GET(45)(x))
+#define ML99_PRIV_tupleGet_46_IMPL(x) v(ML99_TUPLE_GET(46)(x))
+#define ML99_PRIV_tupleGet_47_IMPL(x) v(ML99_TUPLE_GET(47)(x))
+#define ML99_PRIV_tupleGet_48_IMPL(x) v(ML99_TUPLE_GET(48)(x))
+#define ML99_PRIV_tupleGet_49_IMPL(x) v(ML99_TUPLE_GET(49)(x))
+#define ML99_PRIV_tupleGet_50_IMPL(x) v(ML99_TUPLE_GET(50)(x))
+#define ML99_PRIV_tupleGet_51_IMPL(x) v(ML99_TUPLE_GET(51)(x))
+#define ML99_PRIV_tupleGet_52_IMPL(x) v(ML99_TUPLE_GET(52)(x))
+#define ML99_PRIV_tupleGet_53_IMPL(x) v(ML99_TUPLE_GET(53)(x))
+#define ML99_PRIV_tupleGet_54_IMPL(x) v(ML99_TUPLE_GET(54)(x))
+#define ML99_PRIV_tupleGet_55_IMPL(x) v(ML99_TUPLE_GET(55)(x))
+#define ML99_PRIV_tupleGet_56_IMPL(x) v(ML99_TUPLE_GET(56)(x))
+#define ML99_PRIV_tupleGet_57_IMPL(x) v(ML99_TUPLE_GET(57)(x))
+#define ML99_PRIV_tupleGet_58_IMPL(x) v(ML99_TUPLE_GET(58)(x))
+#define ML99_PRIV_tupleGet_59_IMPL(x) v(ML99_TUPLE_GET(59)(x))
+#define ML99_PRIV_tupleGet_60_IMPL(x) v(ML99_TUPLE_GET(60)(x))
+#define ML99_PRIV_tupleGet_61_IMPL(x) v(ML99_TUPLE_GET(61)(x))
+#define ML99_PRIV_tupleGet_62_IMPL(x) v(ML99_TUPLE_GET(62)(x))
+#define ML99_PRIV_tupleGet_63_IMPL(x) v(ML99_TUPLE_GET(63)(x))
+
+#define ML99_PRIV_TUPLE_GET_0(x)  ML99_VARIADICS_GET(0)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_1(x)  ML99_VARIADICS_GET(1)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_2(x)  ML99_VARIADICS_GET(2)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_3(x)  ML99_VARIADICS_GET(3)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_4(x)  ML99_VARIADICS_GET(4)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_5(x)  ML99_VARIADICS_GET(5)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_6(x)  ML99_VARIADICS_GET(6)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_7(x)  ML99_VARIADICS_GET(7)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_8(x)  ML99_VARIADICS_GET(8)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_9(x)  ML99_VARIADICS_GET(9)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_10(x) ML99_VARIADICS_GET(10)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_11(x) ML99_VARIADICS_GET(11)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_12(x) ML99_VARIADICS_GET(12)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_13(x) ML99_VARIADICS_GET(13)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_14(x) ML99_VARIADICS_GET(14)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_15(x) ML99_VARIADICS_GET(15)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_16(x) ML99_VARIADICS_GET(16)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_17(x) ML99_VARIADICS_GET(17)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_18(x) ML99_VARIADICS_GET(18)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_19(x) ML99_VARIADICS_GET(19)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_20(x) ML99_VARIADICS_GET(20)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_21(x) ML99_VARIADICS_GET(21)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_22(x) ML99_VARIADICS_GET(22)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_23(x) ML99_VARIADICS_GET(23)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_24(x) ML99_VARIADICS_GET(24)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_25(x) ML99_VARIADICS_GET(25)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_26(x) ML99_VARIADICS_GET(26)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_27(x) ML99_VARIADICS_GET(27)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_28(x) ML99_VARIADICS_GET(28)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_29(x) ML99_VARIADICS_GET(29)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_30(x) ML99_VARIADICS_GET(30)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_31(x) ML99_VARIADICS_GET(31)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_32(x) ML99_VARIADICS_GET(32)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_33(x) ML99_VARIADICS_GET(33)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_34(x) ML99_VARIADICS_GET(34)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_35(x) ML99_VARIADICS_GET(35)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_36(x) ML99_VARIADICS_GET(36)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_37(x) ML99_VARIADICS_GET(37)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_38(x) ML99_VARIADICS_GET(38)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_39(x) ML99_VARIADICS_GET(39)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_40(x) ML99_VARIADICS_GET(40)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_41(x) ML99_VARIADICS_GET(41)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_42(x) ML99_VARIADICS_GET(42)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_43(x) ML99_VARIADICS_GET(43)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_44(x) ML99_VARIADICS_GET(44)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_45(x) ML99_VARIADICS_GET(45)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_46(x) ML99_VARIADICS_GET(46)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_47(x) ML99_VARIADICS_GET(47)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_48(x) ML99_VARIADICS_GET(48)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_49(x) ML99_VARIADICS_GET(49)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_50(x) ML99_VARIADICS_GET(50)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_51(x) ML99_VARIADICS_GET(51)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_52(x) ML99_VARIADICS_GET(52)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_53(x) ML99_VARIADICS_GET(53)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_54(x) ML99_VARIADICS_GET(54)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_55(x) ML99_VARIADICS_GET(55)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_56(x) ML99_VARIADICS_GET(56)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_57(x) ML99_VARIADICS_GET(57)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_58(x) ML99_VARIADICS_GET(58)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_59(x) ML99_VARIADICS_GET(59)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_60(x) ML99_VARIADICS_GET(60)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_61(x) ML99_VARIADICS_GET(61)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_62(x) ML99_VARIADICS_GET(62)(ML99_UNTUPLE(x))
+#define ML99_PRIV_TUPLE_GET_63(x) ML99_VARIADICS_GET(63)(ML99_UNTUPLE(x))
+// } (ML99_tupleGet)
 
 #define ML99_assertIsTuple_IMPL(x)                                                                 \
     ML99_PRIV_IF(ML99_IS_UNTUPLE(x), ML99_PRIV_NOT_TUPLE_ERROR(x), v(ML99_PRIV_EMPTY()))
@@ -345,16 +770,78 @@
 #define ML99_tuplePrepend_ARITY   2
 #define ML99_tupleForEach_ARITY   2
 #define ML99_tupleForEachI_ARITY  2
+#define ML99_tupleMap_ARITY       2
+#define ML99_tupleFilter_ARITY    2
+#define ML99_tupleConcat_ARITY    2
+#define ML99_tupleSlice_ARITY     3
+#define ML99_tupleReverse_ARITY   1
 #define ML99_assertIsTuple_ARITY  1
 
-#define ML99_PRIV_tupleGet_0_ARITY 1
-#define ML99_PRIV_tupleGet_1_ARITY 1
-#define ML99_PRIV_tupleGet_2_ARITY 1
-#define ML99_PRIV_tupleGet_3_ARITY 1
-#define ML99_PRIV_tupleGet_4_ARITY 1
-#define ML99_PRIV_tupleGet_5_ARITY 1
-#define ML99_PRIV_tupleGet_6_ARITY 1
-#define ML99_PRIV_tupleGet_7_ARITY 1
+// Generated by scripts/gen-tables.py.
+#define ML99_PRIV_tupleGet_0_ARITY  1
+#define ML99_PRIV_tupleGet_1_ARITY  1
+#define ML99_PRIV_tupleGet_2_ARITY  1
+#define ML99_PRIV_tupleGet_3_ARITY  1
+#define ML99_PRIV_tupleGet_4_ARITY  1
+#define ML99_PRIV_tupleGet_5_ARITY  1
+#define ML99_PRIV_tupleGet_6_ARITY  1
+#define ML99_PRIV_tupleGet_7_ARITY  1
+#define ML99_PRIV_tupleGet_8_ARITY  1
+#define ML99_PRIV_tupleGet_9_ARITY  1
+#define ML99_PRIV_tupleGet_10_ARITY 1
+#define ML99_PRIV_tupleGet_11_ARITY 1
+#define ML99_PRIV_tupleGet_12_ARITY 1
+#define ML99_PRIV_tupleGet_13_ARITY 1
+#define ML99_PRIV_tupleGet_14_ARITY 1
+#define ML99_PRIV_tupleGet_15_ARITY 1
+#define ML99_PRIV_tupleGet_16_ARITY 1
+#define ML99_PRIV_tupleGet_17_ARITY 1
+#define ML99_PRIV_tupleGet_18_ARITY 1
+#define ML99_PRIV_tupleGet_19_ARITY 1
+#define ML99_PRIV_tupleGet_20_ARITY 1
+#define ML99_PRIV_tupleGet_21_ARITY 1
+#define ML99_PRIV_tupleGet_22_ARITY 1
+#define ML99_PRIV_tupleGet_23_ARITY 1
+#define ML99_PRIV_tupleGet_24_ARITY 1
+#define ML99_PRIV_tupleGet_25_ARITY 1
+#define ML99_PRIV_tupleGet_26_ARITY 1
+#define ML99_PRIV_tupleGet_27_ARITY 1
+#define ML99_PRIV_tupleGet_28_ARITY 1
+#define ML99_PRIV_tupleGet_29_ARITY 1
+#define ML99_PRIV_tupleGet_30_ARITY 1
+#define ML99_PRIV_tupleGet_31_ARITY 1
+#define ML99_PRIV_tupleGet_32_ARITY 1
+#define ML99_PRIV_tupleGet_33_ARITY 1
+#define ML99_PRIV_tupleGet_34_ARITY 1
+#define ML99_PRIV_tupleGet_35_ARITY 1
+#define ML99_PRIV_tupleGet_36_ARITY 1
+#define ML99_PRIV_tupleGet_37_ARITY 1
+#define ML99_PRIV_tupleGet_38_ARITY 1
+#define ML99_PRIV_tupleGet_39_ARITY 1
+#define ML99_PRIV_tupleGet_40_ARITY 1
+#define ML99_PRIV_tupleGet_41_ARITY 1
+#define ML99_PRIV_tupleGet_42_ARITY 1
+#define ML99_PRIV_tupleGet_43_ARITY 1
+#define ML99_PRIV_tupleGet_44_ARITY 1
+#define ML99_PRIV_tupleGet_45_ARITY 1
+#define ML99_PRIV_tupleGet_46_ARITY 1
+#define ML99_PRIV_tupleGet_47_ARITY 1
+#define ML99_PRIV_tupleGet_48_ARITY 1
+#define ML99_PRIV_tupleGet_49_ARITY 1
+#define ML99_PRIV_tupleGet_50_ARITY 1
+#define ML99_PRIV_tupleGet_51_ARITY 1
+#define ML99_PRIV_tupleGet_52_ARITY 1
+#define ML99_PRIV_tupleGet_53_ARITY 1
+#define ML99_PRIV_tupleGet_54_ARITY 1
+#define ML99_PRIV_tupleGet_55_ARITY 1
+#define ML99_PRIV_tupleGet_56_ARITY 1
+#define ML99_PRIV_tupleGet_57_ARITY 1
+#define ML99_PRIV_tupleGet_58_ARITY 1
+#define ML99_PRIV_tupleGet_59_ARITY 1
+#define ML99_PRIV_tupleGet_60_ARITY 1
+#define ML99_PRIV_tupleGet_61_ARITY 1
+#define ML99_PRIV_tupleGet_62_ARITY 1
+#define ML99_PRIV_tupleGet_63_ARITY 1
 // } (Arity specifiers)
 
 #endif // DOXYGEN_IGNORE
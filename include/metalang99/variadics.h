@@ -11,6 +11,8 @@
 #define ML99_VARIADICS_H
 
 #include <metalang99/nat/inc.h>
+#include <metalang99/variadics/count.h>
+#include <metalang99/variadics/slice.h>
 
 #include <metalang99/priv/util.h>
 
@@ -20,7 +22,8 @@
 /**
  * Computes a count of its arguments.
  *
- * At most 63 arguments are acceptable.
+ * At most #ML99_NAT_MAX arguments are acceptable. More than 32 arguments are counted in chunks of
+ * 32 per reduction step.
  *
  * # Examples
  *
@@ -56,7 +59,8 @@
 /**
  * Expands to a metafunction extracting the @p i -indexed argument.
  *
- * @p i can range from 0 to 7, inclusively.
+ * @p i can range from 0 to 63, inclusively. It takes a constant number of macro expansions however
+ * large @p i and the arguments are.
  *
  * # Examples
  *
@@ -125,6 +129,26 @@
  */
 #define ML99_variadicsForEachI(f, ...) ML99_call(ML99_variadicsForEachI, f, __VA_ARGS__)
 
+/**
+ * Like #ML99_VARIADICS_COUNT, but counts at most @p n arguments.
+ *
+ * @p n must be a literal from 1 to 8, 16, 32, or 63. The count scans only @p n + 1 slots instead
+ * of 64, which makes it cheaper for macros expanded many times with few arguments.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/variadics.h>
+ *
+ * // 3
+ * ML99_VARIADICS_COUNT_UPTO(4, ~, ~, ~)
+ * @endcode
+ *
+ * @note If there are more than @p n arguments, the result is unspecified.
+ */
+#define ML99_VARIADICS_COUNT_UPTO(n, ...)                                                          \
+    ML99_PRIV_CAT(ML99_PRIV_VARIADICS_COUNT_UPTO_, n)(__VA_ARGS__)
+
 #define ML99_VARIADICS_COUNT(...)     ML99_PRIV_VARIADICS_COUNT(__VA_ARGS__)
 #define ML99_VARIADICS_IS_SINGLE(...) ML99_NOT(ML99_PRIV_CONTAINS_COMMA(__VA_ARGS__))
 #define ML99_VARIADICS_GET(i)         ML99_PRIV_CAT(ML99_PRIV_VARIADICS_GET_, i)
@@ -132,59 +156,66 @@
 
 #ifndef DOXYGEN_IGNORE
 
-#define ML99_variadicsCount_IMPL(...)    v(ML99_VARIADICS_COUNT(__VA_ARGS__))
 #define ML99_variadicsIsSingle_IMPL(...) v(ML99_VARIADICS_IS_SINGLE(__VA_ARGS__))
 
-#define ML99_PRIV_variadicsGet_0(...) ML99_call(ML99_PRIV_variadicsGet_0, __VA_ARGS__)
-#define ML99_PRIV_variadicsGet_1(...) ML99_call(ML99_PRIV_variadicsGet_1, __VA_ARGS__)
-#define ML99_PRIV_variadicsGet_2(...) ML99_call(ML99_PRIV_variadicsGet_2, __VA_ARGS__)
-#define ML99_PRIV_variadicsGet_3(...) ML99_call(ML99_PRIV_variadicsGet_3, __VA_ARGS__)
-#define ML99_PRIV_variadicsGet_4(...) ML99_call(ML99_PRIV_variadicsGet_4, __VA_ARGS__)
-#define ML99_PRIV_variadicsGet_5(...) ML99_call(ML99_PRIV_variadicsGet_5, __VA_ARGS__)
-#define ML99_PRIV_variadicsGet_6(...) ML99_call(ML99_PRIV_variadicsGet_6, __VA_ARGS__)
-#define ML99_PRIV_variadicsGet_7(...) ML99_call(ML99_PRIV_variadicsGet_7, __VA_ARGS__)
-
-#define ML99_PRIV_variadicsGet_0_IMPL(...) v(ML99_VARIADICS_GET(0)(__VA_ARGS__))
-#define ML99_PRIV_variadicsGet_1_IMPL(...) v(ML99_VARIADICS_GET(1)(__VA_ARGS__))
-#define ML99_PRIV_variadicsGet_2_IMPL(...) v(ML99_VARIADICS_GET(2)(__VA_ARGS__))
-#define ML99_PRIV_variadicsGet_3_IMPL(...) v(ML99_VARIADICS_GET(3)(__VA_ARGS__))
-#define ML99_PRIV_variadicsGet_4_IMPL(...) v(ML99_VARIADICS_GET(4)(__VA_ARGS__))
-#define ML99_PRIV_variadicsGet_5_IMPL(...) v(ML99_VARIADICS_GET(5)(__VA_ARGS__))
-#define ML99_PRIV_variadicsGet_6_IMPL(...) v(ML99_VARIADICS_GET(6)(__VA_ARGS__))
-#define ML99_PRIV_variadicsGet_7_IMPL(...) v(ML99_VARIADICS_GET(7)(__VA_ARGS__))
-
-#define ML99_PRIV_VARIADICS_GET_0(...) ML99_PRIV_VARIADICS_GET_AUX_0(__VA_ARGS__, ~)
-#define ML99_PRIV_VARIADICS_GET_1(...) ML99_PRIV_VARIADICS_GET_AUX_1(__VA_ARGS__, ~)
-#define ML99_PRIV_VARIADICS_GET_2(...) ML99_PRIV_VARIADICS_GET_AUX_2(__VA_ARGS__, ~)
-#define ML99_PRIV_VARIADICS_GET_3(...) ML99_PRIV_VARIADICS_GET_AUX_3(__VA_ARGS__, ~)
-#define ML99_PRIV_VARIADICS_GET_4(...) ML99_PRIV_VARIADICS_GET_AUX_4(__VA_ARGS__, ~)
-#define ML99_PRIV_VARIADICS_GET_5(...) ML99_PRIV_VARIADICS_GET_AUX_5(__VA_ARGS__, ~)
-#define ML99_PRIV_VARIADICS_GET_6(...) ML99_PRIV_VARIADICS_GET_AUX_6(__VA_ARGS__, ~)
-#define ML99_PRIV_VARIADICS_GET_7(...) ML99_PRIV_VARIADICS_GET_AUX_7(__VA_ARGS__, ~)
+#define ML99_variadicsTail_IMPL(...) v(ML99_VARIADICS_TAIL(__VA_ARGS__))
 
-#define ML99_PRIV_VARIADICS_GET_AUX_0(a, ...)                             a
-#define ML99_PRIV_VARIADICS_GET_AUX_1(_a, b, ...)                         b
-#define ML99_PRIV_VARIADICS_GET_AUX_2(_a, _b, c, ...)                     c
-#define ML99_PRIV_VARIADICS_GET_AUX_3(_a, _b, _c, d, ...)                 d
-#define ML99_PRIV_VARIADICS_GET_AUX_4(_a, _b, _c, _d, e, ...)             e
-#define ML99_PRIV_VARIADICS_GET_AUX_5(_a, _b, _c, _d, _e, f, ...)         f
-#define ML99_PRIV_VARIADICS_GET_AUX_6(_a, _b, _c, _d, _e, _f, g, ...)     g
-#define ML99_PRIV_VARIADICS_GET_AUX_7(_a, _b, _c, _d, _e, _f, _g, h, ...) h
+// ML99_variadicsCount_IMPL {
 
-#define ML99_variadicsTail_IMPL(...) v(ML99_VARIADICS_TAIL(__VA_ARGS__))
+/* Up to 32 arguments are counted by a single `ML99_PRIV_VARIADICS_COUNT_UPTO_32`; before that, each
+ * reduction step drops 32 of them and increments the number `k` of dropped chunks, and the rest is
+ * counted by `ML99_PRIV_VARIADICS_COUNT_AFTER_k`. */
+
+#define ML99_variadicsCount_IMPL(...)                                                              \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_VARIADICS_MORE_THAN_32(__VA_ARGS__),                                             \
+        ML99_PRIV_variadicsCountChunk,                                                             \
+        ML99_PRIV_variadicsCountDone)                                                              \
+    (0, __VA_ARGS__)
+
+#define ML99_PRIV_variadicsCountAux_IMPL(k, ...)                                                   \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_VARIADICS_MORE_THAN_32(__VA_ARGS__),                                             \
+        ML99_PRIV_variadicsCountChunk,                                                             \
+        ML99_PRIV_variadicsCountLast)                                                              \
+    (k, __VA_ARGS__)
+
+#define ML99_PRIV_variadicsCountDone(_k, ...) v(ML99_PRIV_VARIADICS_COUNT_UPTO_32(__VA_ARGS__))
+#define ML99_PRIV_variadicsCountLast(k, ...)                                                       \
+    v(ML99_PRIV_CAT(ML99_PRIV_VARIADICS_COUNT_AFTER_, k)(__VA_ARGS__))
+#define ML99_PRIV_variadicsCountChunk(k, ...)                                                      \
+    ML99_callUneval(ML99_PRIV_variadicsCountAux, ML99_PRIV_INC(k), ML99_PRIV_DROP_32(__VA_ARGS__))
+// } (ML99_variadicsCount_IMPL)
 
 // ML99_variadicsForEach_IMPL {
 
+/* Both `ML99_variadicsForEach` and `ML99_variadicsForEachI` handle eight arguments per reduction
+ * step while more than eight of them are left, and then one argument per step. */
+
 #define ML99_variadicsForEach_IMPL(f, ...)                                                         \
     ML99_PRIV_IF(                                                                                  \
-        ML99_VARIADICS_IS_SINGLE(__VA_ARGS__),                                                     \
-        ML99_PRIV_variadicsForEachDone,                                                            \
-        ML99_PRIV_variadicsForEachProgress)                                                        \
+        ML99_PRIV_VARIADICS_MORE_THAN_8(__VA_ARGS__),                                              \
+        ML99_PRIV_variadicsForEachChunk,                                                           \
+        ML99_PRIV_IF(                                                                              \
+            ML99_VARIADICS_IS_SINGLE(__VA_ARGS__),                                                 \
+            ML99_PRIV_variadicsForEachDone,                                                        \
+            ML99_PRIV_variadicsForEachProgress))                                                   \
     (f, __VA_ARGS__)
 
 #define ML99_PRIV_variadicsForEachDone(f, x) ML99_appl_IMPL(f, x)
 #define ML99_PRIV_variadicsForEachProgress(f, x, ...)                                              \
     ML99_TERMS(ML99_appl_IMPL(f, x), ML99_callUneval(ML99_variadicsForEach, f, __VA_ARGS__))
+#define ML99_PRIV_variadicsForEachChunk(f, _1, _2, _3, _4, _5, _6, _7, _8, ...)                    \
+    ML99_TERMS(                                                                                    \
+        ML99_appl_IMPL(f, _1),                                                                     \
+        ML99_appl_IMPL(f, _2),                                                                     \
+        ML99_appl_IMPL(f, _3),                                                                     \
+        ML99_appl_IMPL(f, _4),                                                                     \
+        ML99_appl_IMPL(f, _5),                                                                     \
+        ML99_appl_IMPL(f, _6),                                                                     \
+        ML99_appl_IMPL(f, _7),                                                                     \
+        ML99_appl_IMPL(f, _8),                                                                     \
+        ML99_callUneval(ML99_variadicsForEach, f, __VA_ARGS__))
 // } (ML99_variadicsForEach_IMPL)
 
 // ML99_variadicsForEachI_IMPL {
@@ -193,9 +224,12 @@
 
 #define ML99_PRIV_variadicsForEachIAux_IMPL(f, i, ...)                                             \
     ML99_PRIV_IF(                                                                                  \
-        ML99_VARIADICS_IS_SINGLE(__VA_ARGS__),                                                     \
-        ML99_PRIV_variadicsForEachIDone,                                                           \
-        ML99_PRIV_variadicsForEachIProgress)                                                       \
+        ML99_PRIV_VARIADICS_MORE_THAN_8(__VA_ARGS__),                                              \
+        ML99_PRIV_variadicsForEachIChunk,                                                          \
+        ML99_PRIV_IF(                                                                              \
+            ML99_VARIADICS_IS_SINGLE(__VA_ARGS__),                                                 \
+            ML99_PRIV_variadicsForEachIDone,                                                       \
+            ML99_PRIV_variadicsForEachIProgress))                                                  \
     (f, i, __VA_ARGS__)
 
 #define ML99_PRIV_variadicsForEachIDone(f, i, x) ML99_appl2_IMPL(f, x, i)
@@ -203,37 +237,245 @@
     ML99_TERMS(                                                                                    \
         ML99_appl2_IMPL(f, x, i),                                                                  \
         ML99_callUneval(ML99_PRIV_variadicsForEachIAux, f, ML99_PRIV_INC(i), __VA_ARGS__))
+#define ML99_PRIV_variadicsForEachIChunk(f, i, _1, _2, _3, _4, _5, _6, _7, _8, ...)                \
+    ML99_TERMS(                                                                                    \
+        ML99_appl2_IMPL(f, _1, i),                                                                 \
+        ML99_appl2_IMPL(f, _2, ML99_PRIV_VARIADICS_ADD_1(i)),                                      \
+        ML99_appl2_IMPL(f, _3, ML99_PRIV_VARIADICS_ADD_2(i)),                                      \
+        ML99_appl2_IMPL(f, _4, ML99_PRIV_VARIADICS_ADD_3(i)),                                      \
+        ML99_appl2_IMPL(f, _5, ML99_PRIV_VARIADICS_ADD_4(i)),                                      \
+        ML99_appl2_IMPL(f, _6, ML99_PRIV_VARIADICS_ADD_5(i)),                                      \
+        ML99_appl2_IMPL(f, _7, ML99_PRIV_VARIADICS_ADD_6(i)),                                      \
+        ML99_appl2_IMPL(f, _8, ML99_PRIV_VARIADICS_ADD_7(i)),                                      \
+        ML99_callUneval(                                                                           \
+            ML99_PRIV_variadicsForEachIAux,                                                        \
+            f,                                                                                     \
+            ML99_PRIV_VARIADICS_ADD_8(i),                                                          \
+            __VA_ARGS__))
+
+#define ML99_PRIV_VARIADICS_ADD_1(i) ML99_PRIV_INC(i)
+#define ML99_PRIV_VARIADICS_ADD_2(i) ML99_PRIV_INC(ML99_PRIV_VARIADICS_ADD_1(i))
+#define ML99_PRIV_VARIADICS_ADD_3(i) ML99_PRIV_INC(ML99_PRIV_VARIADICS_ADD_2(i))
+#define ML99_PRIV_VARIADICS_ADD_4(i) ML99_PRIV_INC(ML99_PRIV_VARIADICS_ADD_3(i))
+#define ML99_PRIV_VARIADICS_ADD_5(i) ML99_PRIV_INC(ML99_PRIV_VARIADICS_ADD_4(i))
+#define ML99_PRIV_VARIADICS_ADD_6(i) ML99_PRIV_INC(ML99_PRIV_VARIADICS_ADD_5(i))
+#define ML99_PRIV_VARIADICS_ADD_7(i) ML99_PRIV_INC(ML99_PRIV_VARIADICS_ADD_6(i))
+#define ML99_PRIV_VARIADICS_ADD_8(i) ML99_PRIV_INC(ML99_PRIV_VARIADICS_ADD_7(i))
 // } (ML99_variadicsForEachI_IMPL)
 
-/*
- * The StackOverflow solution: <https://stackoverflow.com/a/2124385/13166656>.
- *
- * This macro supports at most 63 arguments because C99 allows implementations to handle only 127
- * parameters/arguments per macro definition/invocation (C99 | 5.2.4 Environmental limits), and
- * `ML99_PRIV_VARIADICS_COUNT_AUX` already accepts 64 arguments.
- */
-// clang-format off
-#define ML99_PRIV_VARIADICS_COUNT(...) \
-    ML99_PRIV_VARIADICS_COUNT_AUX( \
-        __VA_ARGS__, \
-        63, 62, 61, 60, 59, 58, 57, 56, 55, 54, \
-        53, 52, 51, 50, 49, 48, 47, 46, 45, 44, \
-        43, 42, 41, 40, 39, 38, 37, 36, 35, 34, \
-        33, 32, 31, 30, 29, 28, 27, 26, 25, 24, \
-        23, 22, 21, 20, 19, 18, 17, 16, 15, 14, \
-        13, 12, 11, 10,  9,  8,  7,  6,  5,  4, \
-         3,  2,  1,  ~)
-
-#define ML99_PRIV_VARIADICS_COUNT_AUX( \
-     _1,  _2,  _3,  _4,  _5,  _6,  _7,  _8,  _9, _10, \
-    _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, \
-    _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, \
-    _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, \
-    _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, \
-    _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, \
-    _61, _62, _63, x, ...) \
-        x
-// clang-format on
+// ML99_variadicsGet {
+
+/* `ML99_PRIV_VARIADICS_GET_i` selects the argument through its parameters if `i` is lesser than 8,
+ * and otherwise drops `i` arguments by `ML99_PRIV_VARIADICS_DROP`. */
+
+#define ML99_PRIV_VARIADICS_GET_AUX_0(a, ...)                             a
+#define ML99_PRIV_VARIADICS_GET_AUX_1(_a, b, ...)                         b
+#define ML99_PRIV_VARIADICS_GET_AUX_2(_a, _b, c, ...)                     c
+#define ML99_PRIV_VARIADICS_GET_AUX_3(_a, _b, _c, d, ...)                 d
+#define ML99_PRIV_VARIADICS_GET_AUX_4(_a, _b, _c, _d, e, ...)             e
+#define ML99_PRIV_VARIADICS_GET_AUX_5(_a, _b, _c, _d, _e, f, ...)         f
+#define ML99_PRIV_VARIADICS_GET_AUX_6(_a, _b, _c, _d, _e, _f, g, ...)     g
+#define ML99_PRIV_VARIADICS_GET_AUX_7(_a, _b, _c, _d, _e, _f, _g, h, ...) h
+
+#define ML99_PRIV_VARIADICS_GET_AT(i, ...)                                                         \
+    ML99_PRIV_HEAD(ML99_PRIV_VARIADICS_DROP(i, __VA_ARGS__, ~))
+
+// Generated by scripts/gen-tables.py.
+#define ML99_PRIV_variadicsGet_0(...)  ML99_call(ML99_PRIV_variadicsGet_0, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_1(...)  ML99_call(ML99_PRIV_variadicsGet_1, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_2(...)  ML99_call(ML99_PRIV_variadicsGet_2, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_3(...)  ML99_call(ML99_PRIV_variadicsGet_3, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_4(...)  ML99_call(ML99_PRIV_variadicsGet_4, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_5(...)  ML99_call(ML99_PRIV_variadicsGet_5, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_6(...)  ML99_call(ML99_PRIV_variadicsGet_6, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_7(...)  ML99_call(ML99_PRIV_variadicsGet_7, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_8(...)  ML99_call(ML99_PRIV_variadicsGet_8, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_9(...)  ML99_call(ML99_PRIV_variadicsGet_9, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_10(...) ML99_call(ML99_PRIV_variadicsGet_10, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_11(...) ML99_call(ML99_PRIV_variadicsGet_11, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_12(...) ML99_call(ML99_PRIV_variadicsGet_12, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_13(...) ML99_call(ML99_PRIV_variadicsGet_13, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_14(...) ML99_call(ML99_PRIV_variadicsGet_14, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_15(...) ML99_call(ML99_PRIV_variadicsGet_15, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_16(...) ML99_call(ML99_PRIV_variadicsGet_16, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_17(...) ML99_call(ML99_PRIV_variadicsGet_17, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_18(...) ML99_call(ML99_PRIV_variadicsGet_18, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_19(...) ML99_call(ML99_PRIV_variadicsGet_19, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_20(...) ML99_call(ML99_PRIV_variadicsGet_20, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_21(...) ML99_call(ML99_PRIV_variadicsGet_21, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_22(...) ML99_call(ML99_PRIV_variadicsGet_22, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_23(...) ML99_call(ML99_PRIV_variadicsGet_23, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_24(...) ML99_call(ML99_PRIV_variadicsGet_24, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_25(...) ML99_call(ML99_PRIV_variadicsGet_25, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_26(...) ML99_call(ML99_PRIV_variadicsGet_26, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_27(...) ML99_call(ML99_PRIV_variadicsGet_27, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_28(...) ML99_call(ML99_PRIV_variadicsGet_28, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_29(...) ML99_call(ML99_PRIV_variadicsGet_29, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_30(...) ML99_call(ML99_PRIV_variadicsGet_30, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_31(...) ML99_call(ML99_PRIV_variadicsGet_31, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_32(...) ML99_call(ML99_PRIV_variadicsGet_32, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_33(...) ML99_call(ML99_PRIV_variadicsGet_33, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_34(...) ML99_call(ML99_PRIV_variadicsGet_34, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_35(...) ML99_call(ML99_PRIV_variadicsGet_35, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_36(...) ML99_call(ML99_PRIV_variadicsGet_36, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_37(...) ML99_call(ML99_PRIV_variadicsGet_37, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_38(...) ML99_call(ML99_PRIV_variadicsGet_38, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_39(...) ML99_call(ML99_PRIV_variadicsGet_39, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_40(...) ML99_call(ML99_PRIV_variadicsGet_40, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_41(...) ML99_call(ML99_PRIV_variadicsGet_41, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_42(...) ML99_call(ML99_PRIV_variadicsGet_42, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_43(...) ML99_call(ML99_PRIV_variadicsGet_43, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_44(...) ML99_call(ML99_PRIV_variadicsGet_44, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_45(...) ML99_call(ML99_PRIV_variadicsGet_45, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_46(...) ML99_call(ML99_PRIV_variadicsGet_46, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_47(...) ML99_call(ML99_PRIV_variadicsGet_47, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_48(...) ML99_call(ML99_PRIV_variadicsGet_48, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_49(...) ML99_call(ML99_PRIV_variadicsGet_49, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_50(...) ML99_call(ML99_PRIV_variadicsGet_50, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_51(...) ML99_call(ML99_PRIV_variadicsGet_51, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_52(...) ML99_call(ML99_PRIV_variadicsGet_52, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_53(...) ML99_call(ML99_PRIV_variadicsGet_53, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_54(...) ML99_call(ML99_PRIV_variadicsGet_54, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_55(...) ML99_call(ML99_PRIV_variadicsGet_55, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_56(...) ML99_call(ML99_PRIV_variadicsGet_56, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_57(...) ML99_call(ML99_PRIV_variadicsGet_57, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_58(...) ML99_call(ML99_PRIV_variadicsGet_58, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_59(...) ML99_call(ML99_PRIV_variadicsGet_59, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_60(...) ML99_call(ML99_PRIV_variadicsGet_60, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_61(...) ML99_call(ML99_PRIV_variadicsGet_61, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_62(...) ML99_call(ML99_PRIV_variadicsGet_62, __VA_ARGS__)
+#define ML99_PRIV_variadicsGet_63(...) ML99_call(ML99_PRIV_variadicsGet_63, __VA_ARGS__)
+
+#define ML99_PRIV_variadicsGet_0_IMPL(...)  v(ML99_VARIADICS_GET(0)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_1_IMPL(...)  v(ML99_VARIADICS_GET(1)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_2_IMPL(...)  v(ML99_VARIADICS_GET(2)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_3_IMPL(...)  v(ML99_VARIADICS_GET(3)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_4_IMPL(...)  v(ML99_VARIADICS_GET(4)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_5_IMPL(...)  v(ML99_VARIADICS_GET(5)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_6_IMPL(...)  v(ML99_VARIADICS_GET(6)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_7_IMPL(...)  v(ML99_VARIADICS_GET(7)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_8_IMPL(...)  v(ML99_VARIADICS_GET(8)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_9_IMPL(...)  v(ML99_VARIADICS_GET(9)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_10_IMPL(...) v(ML99_VARIADICS_GET(10)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_11_IMPL(...) v(ML99_VARIADICS_GET(11)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_12_IMPL(...) v(ML99_VARIADICS_GET(12)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_13_IMPL(...) v(ML99_VARIADICS_GET(13)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_14_IMPL(...) v(ML99_VARIADICS_GET(14)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_15_IMPL(...) v(ML99_VARIADICS_GET(15)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_16_IMPL(...) v(ML99_VARIADICS_GET(16)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_17_IMPL(...) v(ML99_VARIADICS_GET(17)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_18_IMPL(...) v(ML99_VARIADICS_GET(18)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_19_IMPL(...) v(ML99_VARIADICS_GET(19)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_20_IMPL(...) v(ML99_VARIADICS_GET(20)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_21_IMPL(...) v(ML99_VARIADICS_GET(21)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_22_IMPL(...) v(ML99_VARIADICS_GET(22)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_23_IMPL(...) v(ML99_VARIADICS_GET(23)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_24_IMPL(...) v(ML99_VARIADICS_GET(24)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_25_IMPL(...) v(ML99_VARIADICS_GET(25)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_26_IMPL(...) v(ML99_VARIADICS_GET(26)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_27_IMPL(...) v(ML99_VARIADICS_GET(27)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_28_IMPL(...) v(ML99_VARIADICS_GET(28)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_29_IMPL(...) v(ML99_VARIADICS_GET(29)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_30_IMPL(...) v(ML99_VARIADICS_GET(30)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_31_IMPL(...) v(ML99_VARIADICS_GET(31)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_32_IMPL(...) v(ML99_VARIADICS_GET(32)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_33_IMPL(...) v(ML99_VARIADICS_GET(33)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_34_IMPL(...) v(ML99_VARIADICS_GET(34)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_35_IMPL(...) v(ML99_VARIADICS_GET(35)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_36_IMPL(...) v(ML99_VARIADICS_GET(36)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_37_IMPL(...) v(ML99_VARIADICS_GET(37)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_38_IMPL(...) v(ML99_VARIADICS_GET(38)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_39_IMPL(...) v(ML99_VARIADICS_GET(39)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_40_IMPL(...) v(ML99_VARIADICS_GET(40)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_41_IMPL(...) v(ML99_VARIADICS_GET(41)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_42_IMPL(...) v(ML99_VARIADICS_GET(42)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_43_IMPL(...) v(ML99_VARIADICS_GET(43)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_44_IMPL(...) v(ML99_VARIADICS_GET(44)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_45_IMPL(...) v(ML99_VARIADICS_GET(45)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_46_IMPL(...) v(ML99_VARIADICS_GET(46)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_47_IMPL(...) v(ML99_VARIADICS_GET(47)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_48_IMPL(...) v(ML99_VARIADICS_GET(48)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_49_IMPL(...) v(ML99_VARIADICS_GET(49)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_50_IMPL(...) v(ML99_VARIADICS_GET(50)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_51_IMPL(...) v(ML99_VARIADICS_GET(51)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_52_IMPL(...) v(ML99_VARIADICS_GET(52)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_53_IMPL(...) v(ML99_VARIADICS_GET(53)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_54_IMPL(...) v(ML99_VARIADICS_GET(54)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_55_IMPL(...) v(ML99_VARIADICS_GET(55)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_56_IMPL(...) v(ML99_VARIADICS_GET(56)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_57_IMPL(...) v(ML99_VARIADICS_GET(57)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_58_IMPL(...) v(ML99_VARIADICS_GET(58)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_59_IMPL(...) v(ML99_VARIADICS_GET(59)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_60_IMPL(...) v(ML99_VARIADICS_GET(60)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_61_IMPL(...) v(ML99_VARIADICS_GET(61)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_62_IMPL(...) v(ML99_VARIADICS_GET(62)(__VA_ARGS__))
+#define ML99_PRIV_variadicsGet_63_IMPL(...) v(ML99_VARIADICS_GET(63)(__VA_ARGS__))
+
+#define ML99_PRIV_VARIADICS_GET_0(...)  ML99_PRIV_VARIADICS_GET_AUX_0(__VA_ARGS__, ~)
+#define ML99_PRIV_VARIADICS_GET_1(...)  ML99_PRIV_VARIADICS_GET_AUX_1(__VA_ARGS__, ~)
+#define ML99_PRIV_VARIADICS_GET_2(...)  ML99_PRIV_VARIADICS_GET_AUX_2(__VA_ARGS__, ~)
+#define ML99_PRIV_VARIADICS_GET_3(...)  ML99_PRIV_VARIADICS_GET_AUX_3(__VA_ARGS__, ~)
+#define ML99_PRIV_VARIADICS_GET_4(...)  ML99_PRIV_VARIADICS_GET_AUX_4(__VA_ARGS__, ~)
+#define ML99_PRIV_VARIADICS_GET_5(...)  ML99_PRIV_VARIADICS_GET_AUX_5(__VA_ARGS__, ~)
+#define ML99_PRIV_VARIADICS_GET_6(...)  ML99_PRIV_VARIADICS_GET_AUX_6(__VA_ARGS__, ~)
+#define ML99_PRIV_VARIADICS_GET_7(...)  ML99_PRIV_VARIADICS_GET_AUX_7(__VA_ARGS__, ~)
+#define ML99_PRIV_VARIADICS_GET_8(...)  ML99_PRIV_VARIADICS_GET_AT(8, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_9(...)  ML99_PRIV_VARIADICS_GET_AT(9, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_10(...) ML99_PRIV_VARIADICS_GET_AT(10, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_11(...) ML99_PRIV_VARIADICS_GET_AT(11, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_12(...) ML99_PRIV_VARIADICS_GET_AT(12, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_13(...) ML99_PRIV_VARIADICS_GET_AT(13, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_14(...) ML99_PRIV_VARIADICS_GET_AT(14, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_15(...) ML99_PRIV_VARIADICS_GET_AT(15, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_16(...) ML99_PRIV_VARIADICS_GET_AT(16, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_17(...) ML99_PRIV_VARIADICS_GET_AT(17, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_18(...) ML99_PRIV_VARIADICS_GET_AT(18, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_19(...) ML99_PRIV_VARIADICS_GET_AT(19, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_20(...) ML99_PRIV_VARIADICS_GET_AT(20, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_21(...) ML99_PRIV_VARIADICS_GET_AT(21, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_22(...) ML99_PRIV_VARIADICS_GET_AT(22, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_23(...) ML99_PRIV_VARIADICS_GET_AT(23, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_24(...) ML99_PRIV_VARIADICS_GET_AT(24, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_25(...) ML99_PRIV_VARIADICS_GET_AT(25, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_26(...) ML99_PRIV_VARIADICS_GET_AT(26, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_27(...) ML99_PRIV_VARIADICS_GET_AT(27, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_28(...) ML99_PRIV_VARIADICS_GET_AT(28, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_29(...) ML99_PRIV_VARIADICS_GET_AT(29, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_30(...) ML99_PRIV_VARIADICS_GET_AT(30, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_31(...) ML99_PRIV_VARIADICS_GET_AT(31, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_32(...) ML99_PRIV_VARIADICS_GET_AT(32, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_33(...) ML99_PRIV_VARIADICS_GET_AT(33, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_34(...) ML99_PRIV_VARIADICS_GET_AT(34, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_35(...) ML99_PRIV_VARIADICS_GET_AT(35, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_36(...) ML99_PRIV_VARIADICS_GET_AT(36, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_37(...) ML99_PRIV_VARIADICS_GET_AT(37, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_38(...) ML99_PRIV_VARIADICS_GET_AT(38, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_39(...) ML99_PRIV_VARIADICS_GET_AT(39, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_40(...) ML99_PRIV_VARIADICS_GET_AT(40, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_41(...) ML99_PRIV_VARIADICS_GET_AT(41, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_42(...) ML99_PRIV_VARIADICS_GET_AT(42, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_43(...) ML99_PRIV_VARIADICS_GET_AT(43, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_44(...) ML99_PRIV_VARIADICS_GET_AT(44, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_45(...) ML99_PRIV_VARIADICS_GET_AT(45, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_46(...) ML99_PRIV_VARIADICS_GET_AT(46, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_47(...) ML99_PRIV_VARIADICS_GET_AT(47, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_48(...) ML99_PRIV_VARIADICS_GET_AT(48, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_49(...) ML99_PRIV_VARIADICS_GET_AT(49, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_50(...) ML99_PRIV_VARIADICS_GET_AT(50, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_51(...) ML99_PRIV_VARIADICS_GET_AT(51, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_52(...) ML99_PRIV_VARIADICS_GET_AT(52, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_53(...) ML99_PRIV_VARIADICS_GET_AT(53, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_54(...) ML99_PRIV_VARIADICS_GET_AT(54, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_55(...) ML99_PRIV_VARIADICS_GET_AT(55, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_56(...) ML99_PRIV_VARIADICS_GET_AT(56, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_57(...) ML99_PRIV_VARIADICS_GET_AT(57, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_58(...) ML99_PRIV_VARIADICS_GET_AT(58, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_59(...) ML99_PRIV_VARIADICS_GET_AT(59, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_60(...) ML99_PRIV_VARIADICS_GET_AT(60, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_61(...) ML99_PRIV_VARIADICS_GET_AT(61, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_62(...) ML99_PRIV_VARIADICS_GET_AT(62, __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_GET_63(...) ML99_PRIV_VARIADICS_GET_AT(63, __VA_ARGS__)
+// } (ML99_variadicsGet)
 
 // Arity specifiers {
 
@@ -243,14 +485,71 @@
 #define ML99_variadicsForEach_ARITY  2
 #define ML99_variadicsForEachI_ARITY 2
 
-#define ML99_PRIV_variadicsGet_0_ARITY 1
-#define ML99_PRIV_variadicsGet_1_ARITY 1
-#define ML99_PRIV_variadicsGet_2_ARITY 1
-#define ML99_PRIV_variadicsGet_3_ARITY 1
-#define ML99_PRIV_variadicsGet_4_ARITY 1
-#define ML99_PRIV_variadicsGet_5_ARITY 1
-#define ML99_PRIV_variadicsGet_6_ARITY 1
-#define ML99_PRIV_variadicsGet_7_ARITY 1
+// Generated by scripts/gen-tables.py.
+#define ML99_PRIV_variadicsGet_0_ARITY  1
+#define ML99_PRIV_variadicsGet_1_ARITY  1
+#define ML99_PRIV_variadicsGet_2_ARITY  1
+#define ML99_PRIV_variadicsGet_3_ARITY  1
+#define ML99_PRIV_variadicsGet_4_ARITY  1
+#define ML99_PRIV_variadicsGet_5_ARITY  1
+#define ML99_PRIV_variadicsGet_6_ARITY  1
+#define ML99_PRIV_variadicsGet_7_ARITY  1
+#define ML99_PRIV_variadicsGet_8_ARITY  1
+#define ML99_PRIV_variadicsGet_9_ARITY  1
+#define ML99_PRIV_variadicsGet_10_ARITY 1
+#define ML99_PRIV_variadicsGet_11_ARITY 1
+#define ML99_PRIV_variadicsGet_12_ARITY 1
+#define ML99_PRIV_variadicsGet_13_ARITY 1
+#define ML99_PRIV_variadicsGet_14_ARITY 1
+#define ML99_PRIV_variadicsGet_15_ARITY 1
+#define ML99_PRIV_variadicsGet_16_ARITY 1
+#define ML99_PRIV_variadicsGet_17_ARITY 1
+#define ML99_PRIV_variadicsGet_18_ARITY 1
+#define ML99_PRIV_variadicsGet_19_ARITY 1
+#define ML99_PRIV_variadicsGet_20_ARITY 1
+#define ML99_PRIV_variadicsGet_21_ARITY 1
+#define ML99_PRIV_variadicsGet_22_ARITY 1
+#define ML99_PRIV_variadicsGet_23_ARITY 1
+#define ML99_PRIV_variadicsGet_24_ARITY 1
+#define ML99_PRIV_variadicsGet_25_ARITY 1
+#define ML99_PRIV_variadicsGet_26_ARITY 1
+#define ML99_PRIV_variadicsGet_27_ARITY 1
+#define ML99_PRIV_variadicsGet_28_ARITY 1
+#define ML99_PRIV_variadicsGet_29_ARITY 1
+#define ML99_PRIV_variadicsGet_30_ARITY 1
+#define ML99_PRIV_variadicsGet_31_ARITY 1
+#define ML99_PRIV_variadicsGet_32_ARITY 1
+#define ML99_PRIV_variadicsGet_33_ARITY 1
+#define ML99_PRIV_variadicsGet_34_ARITY 1
+#define ML99_PRIV_variadicsGet_35_ARITY 1
+#define ML99_PRIV_variadicsGet_36_ARITY 1
+#define ML99_PRIV_variadicsGet_37_ARITY 1
+#define ML99_PRIV_variadicsGet_38_ARITY 1
+#define ML99_PRIV_variadicsGet_39_ARITY 1
+#define ML99_PRIV_variadicsGet_40_ARITY 1
+#define ML99_PRIV_variadicsGet_41_ARITY 1
+#define ML99_PRIV_variadicsGet_42_ARITY 1
+#define ML99_PRIV_variadicsGet_43_ARITY 1
+#define ML99_PRIV_variadicsGet_44_ARITY 1
+#define ML99_PRIV_variadicsGet_45_ARITY 1
+#define ML99_PRIV_variadicsGet_46_ARITY 1
+#define ML99_PRIV_variadicsGet_47_ARITY 1
+#define ML99_PRIV_variadicsGet_48_ARITY 1
+#define ML99_PRIV_variadicsGet_49_ARITY 1
+#define ML99_PRIV_variadicsGet_50_ARITY 1
+#define ML99_PRIV_variadicsGet_51_ARITY 1
+#define ML99_PRIV_variadicsGet_52_ARITY 1
+#define ML99_PRIV_variadicsGet_53_ARITY 1
+#define ML99_PRIV_variadicsGet_54_ARITY 1
+#define ML99_PRIV_variadicsGet_55_ARITY 1
+#define ML99_PRIV_variadicsGet_56_ARITY 1
+#define ML99_PRIV_variadicsGet_57_ARITY 1
+#define ML99_PRIV_variadicsGet_58_ARITY 1
+#define ML99_PRIV_variadicsGet_59_ARITY 1
+#define ML99_PRIV_variadicsGet_60_ARITY 1
+#define ML99_PRIV_variadicsGet_61_ARITY 1
+#define ML99_PRIV_variadicsGet_62_ARITY 1
+#define ML99_PRIV_variadicsGet_63_ARITY 1
 // } (Arity specifiers)
 
 #endif // DOXYGEN_IGNORE
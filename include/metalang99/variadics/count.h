@@ -0,0 +1,148 @@
+#ifndef ML99_VARIADICS_COUNT_H
+#define ML99_VARIADICS_COUNT_H
+
+/*
+ * The StackOverflow solution: <https://stackoverflow.com/a/2124385/13166656>.
+ *
+ * This macro supports at most 63 arguments because C99 allows implementations to handle only 127
+ * parameters/arguments per macro definition/invocation (C99 | 5.2.4 Environmental limits), and
+ * `ML99_PRIV_VARIADICS_COUNT_AUX` already accepts 64 arguments.
+ */
+// clang-format off
+#define ML99_PRIV_VARIADICS_COUNT(...) \
+    ML99_PRIV_VARIADICS_COUNT_AUX( \
+        __VA_ARGS__, \
+        63, 62, 61, 60, 59, 58, 57, 56, 55, 54, \
+        53, 52, 51, 50, 49, 48, 47, 46, 45, 44, \
+        43, 42, 41, 40, 39, 38, 37, 36, 35, 34, \
+        33, 32, 31, 30, 29, 28, 27, 26, 25, 24, \
+        23, 22, 21, 20, 19, 18, 17, 16, 15, 14, \
+        13, 12, 11, 10,  9,  8,  7,  6,  5,  4, \
+         3,  2,  1,  ~)
+
+#define ML99_PRIV_VARIADICS_COUNT_AUX( \
+     _1,  _2,  _3,  _4,  _5,  _6,  _7,  _8,  _9, _10, \
+    _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, \
+    _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, \
+    _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, \
+    _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, \
+    _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, \
+    _61, _62, _63, x, ...) \
+        x
+// clang-format on
+
+/*
+ * `ML99_PRIV_VARIADICS_COUNT_UPTO_n(...)` counts at most `n` arguments, for `n` from 1 to 8, 16,
+ * 32, and 63. It pushes only `n + 1` values through the selecting macro instead of 64, which
+ * matters for macros expanded many times with few arguments.
+ */
+// clang-format off
+#define ML99_PRIV_VARIADICS_COUNT_UPTO_1(...) 1
+
+#define ML99_PRIV_VARIADICS_COUNT_UPTO_2(...) \
+    ML99_PRIV_VARIADICS_COUNT_AUX_2(__VA_ARGS__, 2, 1, ~)
+#define ML99_PRIV_VARIADICS_COUNT_AUX_2(_1, _2, x, ...) x
+#define ML99_PRIV_VARIADICS_COUNT_UPTO_3(...) \
+    ML99_PRIV_VARIADICS_COUNT_AUX_3(__VA_ARGS__, 3, 2, 1, ~)
+#define ML99_PRIV_VARIADICS_COUNT_AUX_3(_1, _2, _3, x, ...) x
+#define ML99_PRIV_VARIADICS_COUNT_UPTO_4(...) \
+    ML99_PRIV_VARIADICS_COUNT_AUX_4(__VA_ARGS__, 4, 3, 2, 1, ~)
+#define ML99_PRIV_VARIADICS_COUNT_AUX_4(_1, _2, _3, _4, x, ...) x
+#define ML99_PRIV_VARIADICS_COUNT_UPTO_5(...) \
+    ML99_PRIV_VARIADICS_COUNT_AUX_5(__VA_ARGS__, 5, 4, 3, 2, 1, ~)
+#define ML99_PRIV_VARIADICS_COUNT_AUX_5(_1, _2, _3, _4, _5, x, ...) x
+#define ML99_PRIV_VARIADICS_COUNT_UPTO_6(...) \
+    ML99_PRIV_VARIADICS_COUNT_AUX_6(__VA_ARGS__, 6, 5, 4, 3, 2, 1, ~)
+#define ML99_PRIV_VARIADICS_COUNT_AUX_6(_1, _2, _3, _4, _5, _6, x, ...) x
+#define ML99_PRIV_VARIADICS_COUNT_UPTO_7(...) \
+    ML99_PRIV_VARIADICS_COUNT_AUX_7(__VA_ARGS__, 7, 6, 5, 4, 3, 2, 1, ~)
+#define ML99_PRIV_VARIADICS_COUNT_AUX_7(_1, _2, _3, _4, _5, _6, _7, x, ...) x
+#define ML99_PRIV_VARIADICS_COUNT_UPTO_8(...) \
+    ML99_PRIV_VARIADICS_COUNT_AUX_8(__VA_ARGS__, 8, 7, 6, 5, 4, 3, 2, 1, ~)
+#define ML99_PRIV_VARIADICS_COUNT_AUX_8(_1, _2, _3, _4, _5, _6, _7, _8, x, ...) x
+
+#define ML99_PRIV_VARIADICS_COUNT_UPTO_16(...) \
+    ML99_PRIV_VARIADICS_COUNT_AUX_16( \
+        __VA_ARGS__, \
+        16, 15, 14, 13, 12, 11, 10,  9,  8,  7, \
+         6,  5,  4,  3,  2,  1,  ~)
+#define ML99_PRIV_VARIADICS_COUNT_AUX_16( \
+     _1,  _2,  _3,  _4,  _5,  _6,  _7,  _8,  _9, _10, \
+    _11, _12, _13, _14, _15, _16, x, ...) \
+        x
+
+#define ML99_PRIV_VARIADICS_COUNT_UPTO_32(...) \
+    ML99_PRIV_VARIADICS_COUNT_AUX_32( \
+        __VA_ARGS__, \
+        32, 31, 30, 29, 28, 27, 26, 25, 24, 23, \
+        22, 21, 20, 19, 18, 17, 16, 15, 14, 13, \
+        12, 11, 10,  9,  8,  7,  6,  5,  4,  3, \
+         2,  1,  ~)
+#define ML99_PRIV_VARIADICS_COUNT_AUX_32( \
+     _1,  _2,  _3,  _4,  _5,  _6,  _7,  _8,  _9, _10, \
+    _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, \
+    _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, \
+    _31, _32, x, ...) \
+        x
+
+#define ML99_PRIV_VARIADICS_COUNT_UPTO_63 ML99_PRIV_VARIADICS_COUNT
+// clang-format on
+
+/*
+ * `ML99_PRIV_VARIADICS_COUNT_AFTER_k(...)` counts at most 32 arguments that follow `k` chunks of 32
+ * arguments, for `k` from 0 to 7: the values that it selects from are offset by `32 * k`.
+ */
+// clang-format off
+#define ML99_PRIV_VARIADICS_COUNT_AFTER_0 ML99_PRIV_VARIADICS_COUNT_UPTO_32
+#define ML99_PRIV_VARIADICS_COUNT_AFTER_1(...) \
+    ML99_PRIV_VARIADICS_COUNT_AUX_32( \
+        __VA_ARGS__, \
+        64, 63, 62, 61, 60, 59, 58, 57, 56, 55, \
+        54, 53, 52, 51, 50, 49, 48, 47, 46, 45, \
+        44, 43, 42, 41, 40, 39, 38, 37, 36, 35, \
+        34, 33, ~)
+#define ML99_PRIV_VARIADICS_COUNT_AFTER_2(...) \
+    ML99_PRIV_VARIADICS_COUNT_AUX_32( \
+        __VA_ARGS__, \
+        96, 95, 94, 93, 92, 91, 90, 89, 88, 87, \
+        86, 85, 84, 83, 82, 81, 80, 79, 78, 77, \
+        76, 75, 74, 73, 72, 71, 70, 69, 68, 67, \
+        66, 65, ~)
+#define ML99_PRIV_VARIADICS_COUNT_AFTER_3(...) \
+    ML99_PRIV_VARIADICS_COUNT_AUX_32( \
+        __VA_ARGS__, \
+        128, 127, 126, 125, 124, 123, 122, 121, 120, 119, \
+        118, 117, 116, 115, 114, 113, 112, 111, 110, 109, \
+        108, 107, 106, 105, 104, 103, 102, 101, 100,  99, \
+         98,  97, ~)
+#define ML99_PRIV_VARIADICS_COUNT_AFTER_4(...) \
+    ML99_PRIV_VARIADICS_COUNT_AUX_32( \
+        __VA_ARGS__, \
+        160, 159, 158, 157, 156, 155, 154, 153, 152, 151, \
+        150, 149, 148, 147, 146, 145, 144, 143, 142, 141, \
+        140, 139, 138, 137, 136, 135, 134, 133, 132, 131, \
+        130, 129, ~)
+#define ML99_PRIV_VARIADICS_COUNT_AFTER_5(...) \
+    ML99_PRIV_VARIADICS_COUNT_AUX_32( \
+        __VA_ARGS__, \
+        192, 191, 190, 189, 188, 187, 186, 185, 184, 183, \
+        182, 181, 180, 179, 178, 177, 176, 175, 174, 173, \
+        172, 171, 170, 169, 168, 167, 166, 165, 164, 163, \
+        162, 161, ~)
+#define ML99_PRIV_VARIADICS_COUNT_AFTER_6(...) \
+    ML99_PRIV_VARIADICS_COUNT_AUX_32( \
+        __VA_ARGS__, \
+        224, 223, 222, 221, 220, 219, 218, 217, 216, 215, \
+        214, 213, 212, 211, 210, 209, 208, 207, 206, 205, \
+        204, 203, 202, 201, 200, 199, 198, 197, 196, 195, \
+        194, 193, ~)
+#define ML99_PRIV_VARIADICS_COUNT_AFTER_7(...) \
+    ML99_PRIV_VARIADICS_COUNT_AUX_32( \
+        __VA_ARGS__, \
+        256, 255, 254, 253, 252, 251, 250, 249, 248, 247, \
+        246, 245, 244, 243, 242, 241, 240, 239, 238, 237, \
+        236, 235, 234, 233, 232, 231, 230, 229, 228, 227, \
+        226, 225, ~)
+// clang-format on
+
+#endif // ML99_VARIADICS_COUNT_H
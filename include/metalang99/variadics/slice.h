@@ -0,0 +1,151 @@
+#ifndef ML99_VARIADICS_SLICE_H
+#define ML99_VARIADICS_SLICE_H
+
+#include <metalang99/nat/bits.h>
+
+#include <metalang99/priv/util.h>
+
+/* `ML99_PRIV_VARIADICS_DROP(n, ...)` removes the first `n` arguments, and
+ * `ML99_PRIV_VARIADICS_TAKE(n, ...)` keeps only them. Both take a constant number of macro
+ * expansions per bit of `n`: a set bit `2^k` drops (takes) `2^k` arguments at once, and
+ * `ML99_PRIV_DROP_2k` (`ML99_PRIV_TAKE_2k`) is `ML99_PRIV_DROP_k` (`ML99_PRIV_TAKE_k`) applied
+ * twice. The arguments must be followed by a sentinel, such as `~`, so that a variadic parameter
+ * always receives at least one argument; `ML99_PRIV_VARIADICS_DROP` keeps the sentinel.
+ * `ML99_PRIV_VARIADICS_TAKE` accumulates the taken arguments after a dummy head, so `n` must not
+ * be 0. */
+
+#define ML99_PRIV_VARIADICS_DROP(n, ...)                                                           \
+    ML99_PRIV_VARIADICS_DROP_AUX(ML99_PRIV_NAT_TO_BITS(n), __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_DROP_AUX(...) ML99_PRIV_VARIADICS_DROP_BITS(__VA_ARGS__)
+
+#define ML99_PRIV_VARIADICS_DROP_BITS(b7, b6, b5, b4, b3, b2, b1, b0, ...)                         \
+    ML99_PRIV_DROP_1_##b0(ML99_PRIV_DROP_2_##b1(ML99_PRIV_DROP_4_##b2(ML99_PRIV_DROP_8_##b3(       \
+        ML99_PRIV_DROP_16_##b4(ML99_PRIV_DROP_32_##b5(                                             \
+            ML99_PRIV_DROP_64_##b6(ML99_PRIV_DROP_128_##b7(__VA_ARGS__))))))))
+
+#define ML99_PRIV_VARIADICS_TAKE(n, ...)                                                           \
+    ML99_PRIV_VARIADICS_TAKE_AUX(ML99_PRIV_NAT_TO_BITS(n), __VA_ARGS__)
+#define ML99_PRIV_VARIADICS_TAKE_AUX(...) ML99_PRIV_VARIADICS_TAKE_BITS(__VA_ARGS__)
+
+#define ML99_PRIV_VARIADICS_TAKE_BITS(b7, b6, b5, b4, b3, b2, b1, b0, ...)                         \
+    ML99_PRIV_VARIADICS_TAKE_END(ML99_PRIV_TAKE_1_##b0(ML99_PRIV_TAKE_2_##b1(                      \
+        ML99_PRIV_TAKE_4_##b2(ML99_PRIV_TAKE_8_##b3(ML99_PRIV_TAKE_16_##b4(                        \
+            ML99_PRIV_TAKE_32_##b5(ML99_PRIV_TAKE_64_##b6(                                         \
+                ML99_PRIV_TAKE_128_##b7((~), __VA_ARGS__)))))))))
+
+#define ML99_PRIV_VARIADICS_TAKE_END(...)            ML99_PRIV_VARIADICS_TAKE_END_AUX(__VA_ARGS__)
+#define ML99_PRIV_VARIADICS_TAKE_END_AUX(taken, ...) ML99_PRIV_TAIL taken
+
+/* `ML99_PRIV_VARIADICS_MORE_THAN_k(...)`, where `k` is a power of two up to 32, checks whether
+ * there are more than `k` arguments, however many of them there are: there are more than `2k`
+ * arguments if there are more than `k` of them and then more than `k` after the first `k`, so that
+ * `ML99_PRIV_DROP_k` is invoked only if there are enough arguments to drop. */
+
+#define ML99_PRIV_VARIADICS_MORE_THAN_1(...) ML99_PRIV_CONTAINS_COMMA(__VA_ARGS__)
+#define ML99_PRIV_VARIADICS_MORE_THAN_2(...)                                                       \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_VARIADICS_MORE_THAN_1(__VA_ARGS__),                                              \
+        ML99_PRIV_VARIADICS_MORE_THAN_2_AUX,                                                       \
+        ML99_PRIV_VARIADICS_NOT_MORE)                                                              \
+    (__VA_ARGS__)
+#define ML99_PRIV_VARIADICS_MORE_THAN_4(...)                                                       \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_VARIADICS_MORE_THAN_2(__VA_ARGS__),                                              \
+        ML99_PRIV_VARIADICS_MORE_THAN_4_AUX,                                                       \
+        ML99_PRIV_VARIADICS_NOT_MORE)                                                              \
+    (__VA_ARGS__)
+#define ML99_PRIV_VARIADICS_MORE_THAN_8(...)                                                       \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_VARIADICS_MORE_THAN_4(__VA_ARGS__),                                              \
+        ML99_PRIV_VARIADICS_MORE_THAN_8_AUX,                                                       \
+        ML99_PRIV_VARIADICS_NOT_MORE)                                                              \
+    (__VA_ARGS__)
+#define ML99_PRIV_VARIADICS_MORE_THAN_16(...)                                                      \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_VARIADICS_MORE_THAN_8(__VA_ARGS__),                                              \
+        ML99_PRIV_VARIADICS_MORE_THAN_16_AUX,                                                      \
+        ML99_PRIV_VARIADICS_NOT_MORE)                                                              \
+    (__VA_ARGS__)
+#define ML99_PRIV_VARIADICS_MORE_THAN_32(...)                                                      \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_VARIADICS_MORE_THAN_16(__VA_ARGS__),                                             \
+        ML99_PRIV_VARIADICS_MORE_THAN_32_AUX,                                                      \
+        ML99_PRIV_VARIADICS_NOT_MORE)                                                              \
+    (__VA_ARGS__)
+
+#define ML99_PRIV_VARIADICS_MORE_THAN_2_AUX(...)                                                   \
+    ML99_PRIV_VARIADICS_MORE_THAN_1(ML99_PRIV_DROP_1(__VA_ARGS__))
+#define ML99_PRIV_VARIADICS_MORE_THAN_4_AUX(...)                                                   \
+    ML99_PRIV_VARIADICS_MORE_THAN_2(ML99_PRIV_DROP_2(__VA_ARGS__))
+#define ML99_PRIV_VARIADICS_MORE_THAN_8_AUX(...)                                                   \
+    ML99_PRIV_VARIADICS_MORE_THAN_4(ML99_PRIV_DROP_4(__VA_ARGS__))
+#define ML99_PRIV_VARIADICS_MORE_THAN_16_AUX(...)                                                  \
+    ML99_PRIV_VARIADICS_MORE_THAN_8(ML99_PRIV_DROP_8(__VA_ARGS__))
+#define ML99_PRIV_VARIADICS_MORE_THAN_32_AUX(...)                                                  \
+    ML99_PRIV_VARIADICS_MORE_THAN_16(ML99_PRIV_DROP_16(__VA_ARGS__))
+
+#define ML99_PRIV_VARIADICS_NOT_MORE(...) 0
+
+// Dropping {
+
+#define ML99_PRIV_DROP_1(_1, ...)                             __VA_ARGS__
+#define ML99_PRIV_DROP_2(_1, _2, ...)                         __VA_ARGS__
+#define ML99_PRIV_DROP_4(_1, _2, _3, _4, ...)                 __VA_ARGS__
+#define ML99_PRIV_DROP_8(_1, _2, _3, _4, _5, _6, _7, _8, ...) __VA_ARGS__
+
+#define ML99_PRIV_DROP_16(...)  ML99_PRIV_DROP_8_1(ML99_PRIV_DROP_8(__VA_ARGS__))
+#define ML99_PRIV_DROP_32(...)  ML99_PRIV_DROP_16_1(ML99_PRIV_DROP_16(__VA_ARGS__))
+#define ML99_PRIV_DROP_64(...)  ML99_PRIV_DROP_32_1(ML99_PRIV_DROP_32(__VA_ARGS__))
+#define ML99_PRIV_DROP_128(...) ML99_PRIV_DROP_64_1(ML99_PRIV_DROP_64(__VA_ARGS__))
+
+#define ML99_PRIV_DROP_1_0(...)   __VA_ARGS__
+#define ML99_PRIV_DROP_1_1(...)   ML99_PRIV_DROP_1(__VA_ARGS__)
+#define ML99_PRIV_DROP_2_0(...)   __VA_ARGS__
+#define ML99_PRIV_DROP_2_1(...)   ML99_PRIV_DROP_2(__VA_ARGS__)
+#define ML99_PRIV_DROP_4_0(...)   __VA_ARGS__
+#define ML99_PRIV_DROP_4_1(...)   ML99_PRIV_DROP_4(__VA_ARGS__)
+#define ML99_PRIV_DROP_8_0(...)   __VA_ARGS__
+#define ML99_PRIV_DROP_8_1(...)   ML99_PRIV_DROP_8(__VA_ARGS__)
+#define ML99_PRIV_DROP_16_0(...)  __VA_ARGS__
+#define ML99_PRIV_DROP_16_1(...)  ML99_PRIV_DROP_16(__VA_ARGS__)
+#define ML99_PRIV_DROP_32_0(...)  __VA_ARGS__
+#define ML99_PRIV_DROP_32_1(...)  ML99_PRIV_DROP_32(__VA_ARGS__)
+#define ML99_PRIV_DROP_64_0(...)  __VA_ARGS__
+#define ML99_PRIV_DROP_64_1(...)  ML99_PRIV_DROP_64(__VA_ARGS__)
+#define ML99_PRIV_DROP_128_0(...) __VA_ARGS__
+#define ML99_PRIV_DROP_128_1(...) ML99_PRIV_DROP_128(__VA_ARGS__)
+// } (Dropping)
+
+// Taking {
+
+#define ML99_PRIV_TAKE_1(taken, _1, ...)     (ML99_PRIV_EXPAND taken, _1), __VA_ARGS__
+#define ML99_PRIV_TAKE_2(taken, _1, _2, ...) (ML99_PRIV_EXPAND taken, _1, _2), __VA_ARGS__
+#define ML99_PRIV_TAKE_4(taken, _1, _2, _3, _4, ...)                                               \
+    (ML99_PRIV_EXPAND taken, _1, _2, _3, _4), __VA_ARGS__
+#define ML99_PRIV_TAKE_8(taken, _1, _2, _3, _4, _5, _6, _7, _8, ...)                               \
+    (ML99_PRIV_EXPAND taken, _1, _2, _3, _4, _5, _6, _7, _8), __VA_ARGS__
+
+#define ML99_PRIV_TAKE_16(...)  ML99_PRIV_TAKE_8_1(ML99_PRIV_TAKE_8(__VA_ARGS__))
+#define ML99_PRIV_TAKE_32(...)  ML99_PRIV_TAKE_16_1(ML99_PRIV_TAKE_16(__VA_ARGS__))
+#define ML99_PRIV_TAKE_64(...)  ML99_PRIV_TAKE_32_1(ML99_PRIV_TAKE_32(__VA_ARGS__))
+#define ML99_PRIV_TAKE_128(...) ML99_PRIV_TAKE_64_1(ML99_PRIV_TAKE_64(__VA_ARGS__))
+
+#define ML99_PRIV_TAKE_1_0(...)   __VA_ARGS__
+#define ML99_PRIV_TAKE_1_1(...)   ML99_PRIV_TAKE_1(__VA_ARGS__)
+#define ML99_PRIV_TAKE_2_0(...)   __VA_ARGS__
+#define ML99_PRIV_TAKE_2_1(...)   ML99_PRIV_TAKE_2(__VA_ARGS__)
+#define ML99_PRIV_TAKE_4_0(...)   __VA_ARGS__
+#define ML99_PRIV_TAKE_4_1(...)   ML99_PRIV_TAKE_4(__VA_ARGS__)
+#define ML99_PRIV_TAKE_8_0(...)   __VA_ARGS__
+#define ML99_PRIV_TAKE_8_1(...)   ML99_PRIV_TAKE_8(__VA_ARGS__)
+#define ML99_PRIV_TAKE_16_0(...)  __VA_ARGS__
+#define ML99_PRIV_TAKE_16_1(...)  ML99_PRIV_TAKE_16(__VA_ARGS__)
+#define ML99_PRIV_TAKE_32_0(...)  __VA_ARGS__
+#define ML99_PRIV_TAKE_32_1(...)  ML99_PRIV_TAKE_32(__VA_ARGS__)
+#define ML99_PRIV_TAKE_64_0(...)  __VA_ARGS__
+#define ML99_PRIV_TAKE_64_1(...)  ML99_PRIV_TAKE_64(__VA_ARGS__)
+#define ML99_PRIV_TAKE_128_0(...) __VA_ARGS__
+#define ML99_PRIV_TAKE_128_1(...) ML99_PRIV_TAKE_128(__VA_ARGS__)
+// } (Taking)
+
+#endif // ML99_VARIADICS_SLICE_H
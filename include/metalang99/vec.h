@@ -0,0 +1,458 @@
+/**
+ * @file
+ * Flat vectors.
+ *
+ * A vector is an immutable sequence represented as `(n, x1, ..., xn)`, where `n` is its length:
+ * the items are kept in a single tuple, so that #ML99_vecLen and #ML99_vecGet take a constant
+ * number of reduction steps, and #ML99_vecMap, #ML99_vecFilter, and #ML99_vecFoldl handle eight
+ * items at once. Unlike lists, vectors cannot share their tails; if a needed function is missed,
+ * #ML99_vecToList converts a vector to a list.
+ *
+ * Since the items are separated by commas, an item that contains a comma must be parenthesised.
+ * A vector can hold at most #ML99_NAT_MAX items.
+ *
+ * `metalang99.h` does not include this header.
+ */
+
+#ifndef ML99_VEC_H
+#define ML99_VEC_H
+
+#include <metalang99/variadics/slice.h>
+
+#include <metalang99/priv/util.h>
+
+#include <metalang99/lang.h>
+#include <metalang99/list.h>
+#include <metalang99/nat.h>
+
+/**
+ * Constructs a vector from its arguments.
+ *
+ * At most #ML99_NAT_MAX arguments are acceptable.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/vec.h>
+ *
+ * // (3, 1, 2, 3)
+ * ML99_vec(v(1, 2, 3))
+ * @endcode
+ */
+#define ML99_vec(...) ML99_call(ML99_vec, __VA_ARGS__)
+
+/**
+ * The empty vector.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/vec.h>
+ *
+ * // (0)
+ * ML99_vecEmpty()
+ * @endcode
+ */
+#define ML99_vecEmpty(...) ML99_callUneval(ML99_vecEmpty, )
+
+/**
+ * Converts @p list to a vector.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/vec.h>
+ *
+ * // (3, 1, 2, 3)
+ * ML99_vecFromList(ML99_list(v(1, 2, 3)))
+ * @endcode
+ */
+#define ML99_vecFromList(list) ML99_call(ML99_vecFromList, list)
+
+/**
+ * Converts @p vec to a list.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/vec.h>
+ *
+ * // ML99_list(v(1, 2, 3))
+ * ML99_vecToList(ML99_vec(v(1, 2, 3)))
+ * @endcode
+ */
+#define ML99_vecToList(vec) ML99_call(ML99_vecToList, vec)
+
+/**
+ * Computes the length of @p vec.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/vec.h>
+ *
+ * // 3
+ * ML99_vecLen(ML99_vec(v(1, 2, 3)))
+ * @endcode
+ */
+#define ML99_vecLen(vec) ML99_call(ML99_vecLen, vec)
+
+/**
+ * Checks whether @p vec is empty.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/vec.h>
+ *
+ * // 1
+ * ML99_vecIsEmpty(ML99_vecEmpty())
+ *
+ * // 0
+ * ML99_vecIsEmpty(ML99_vec(v(1, 2, 3)))
+ * @endcode
+ */
+#define ML99_vecIsEmpty(vec) ML99_call(ML99_vecIsEmpty, vec)
+
+/**
+ * Extracts the @p i -indexed element of @p vec.
+ *
+ * @p i must be lesser than the length of @p vec.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/vec.h>
+ *
+ * // 3
+ * ML99_vecGet(v(2), ML99_vec(v(1, 2, 3)))
+ * @endcode
+ */
+#define ML99_vecGet(i, vec) ML99_call(ML99_vecGet, i, vec)
+
+/**
+ * Applies @p f to all the items in @p vec.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/nat.h>
+ * #include <metalang99/vec.h>
+ *
+ * // (3, 4, 5, 6)
+ * ML99_vecMap(ML99_appl(v(ML99_add), v(3)), ML99_vec(v(1, 2, 3)))
+ * @endcode
+ */
+#define ML99_vecMap(f, vec) ML99_call(ML99_vecMap, f, vec)
+
+/**
+ * Extracts the items from @p vec that satisfy the predicate @p f.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/nat.h>
+ * #include <metalang99/vec.h>
+ *
+ * // (4, 14, 7, 65, 10)
+ * ML99_vecFilter(ML99_appl(v(ML99_lesser), v(3)), ML99_vec(v(14, 0, 1, 7, 2, 65, 3, 10)))
+ * @endcode
+ */
+#define ML99_vecFilter(f, vec) ML99_call(ML99_vecFilter, f, vec)
+
+/**
+ * A left-associative fold over @p vec.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/nat.h>
+ * #include <metalang99/vec.h>
+ *
+ * // 6
+ * ML99_vecFoldl(v(ML99_add), v(0), ML99_vec(v(1, 2, 3)))
+ * @endcode
+ */
+#define ML99_vecFoldl(f, init, vec) ML99_call(ML99_vecFoldl, f, init, vec)
+
+/**
+ * Concatenates @p vec with @p other.
+ *
+ * The resulting vector must contain at most #ML99_NAT_MAX items.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/vec.h>
+ *
+ * // (5, 1, 2, 3, 4, 5)
+ * ML99_vecConcat(ML99_vec(v(1, 2, 3)), ML99_vec(v(4, 5)))
+ * @endcode
+ */
+#define ML99_vecConcat(vec, other) ML99_call(ML99_vecConcat, vec, other)
+
+/**
+ * Places all the items in @p vec as-is, separated by commas.
+ *
+ * # Examples
+ *
+ * @code
+ * #include <metalang99/vec.h>
+ *
+ * // 1, 2, 3
+ * ML99_vecUnwrapCommaSep(ML99_vec(v(1, 2, 3)))
+ * @endcode
+ */
+#define ML99_vecUnwrapCommaSep(vec) ML99_call(ML99_vecUnwrapCommaSep, vec)
+
+#define ML99_VEC_EMPTY(...)    (0)
+#define ML99_VEC_LEN(vec)      ML99_PRIV_HEAD vec
+#define ML99_VEC_IS_EMPTY(vec) ML99_NAT_EQ(ML99_PRIV_HEAD vec, 0)
+#define ML99_VEC_GET(i, vec)   ML99_PRIV_HEAD(ML99_PRIV_VARIADICS_DROP(i, ML99_PRIV_TAIL vec, ~))
+
+#ifndef DOXYGEN_IGNORE
+
+#define ML99_vec_IMPL(...)      ML99_vecFromList(ML99_sizedList_IMPL(__VA_ARGS__))
+#define ML99_vecEmpty_IMPL(...) v(ML99_VEC_EMPTY())
+
+/* All the functions below that walk through the items of a non-empty vector pass them to a
+ * metafunction followed by the `~` sentinel, so that the items are left if there is more than one
+ * argument after them. */
+
+#define ML99_PRIV_VEC_IF_EMPTY(vec, f, g) ML99_PRIV_IF(ML99_VEC_IS_EMPTY(vec), f, g)
+
+#define ML99_PRIV_VEC_ITEMS_LEFT(...) ML99_PRIV_VARIADICS_MORE_THAN_1(__VA_ARGS__)
+#define ML99_PRIV_VEC_CHUNK_LEFT(...) ML99_PRIV_VARIADICS_MORE_THAN_8(__VA_ARGS__)
+
+// Conversions {
+
+#define ML99_vecFromList_IMPL(list) ML99_call(ML99_PRIV_vecFromSized, ML99_listSized_IMPL(list))
+
+#define ML99_PRIV_vecFromSized_IMPL(list) ML99_match_IMPL(list, ML99_PRIV_vecFromSized_)
+#define ML99_PRIV_vecFromSized_nil_IMPL(_) v(ML99_VEC_EMPTY())
+#define ML99_PRIV_vecFromSized_sized_IMPL(n, items) v((n, ML99_PRIV_EXPAND items))
+
+#define ML99_vecToList_IMPL(vec)                                                                   \
+    ML99_PRIV_VEC_IF_EMPTY(vec, ML99_PRIV_vecToListEmpty, ML99_PRIV_vecToListItems)(vec)
+#define ML99_PRIV_vecToListEmpty(_vec) v(ML99_NIL())
+#define ML99_PRIV_vecToListItems(vec)  ML99_list_IMPL(ML99_PRIV_TAIL vec)
+
+#define ML99_vecUnwrapCommaSep_IMPL(vec)                                                           \
+    ML99_PRIV_VEC_IF_EMPTY(vec, ML99_PRIV_vecUnwrapEmpty, ML99_PRIV_vecUnwrapItems)(vec)
+#define ML99_PRIV_vecUnwrapEmpty(_vec) v(ML99_PRIV_EMPTY())
+#define ML99_PRIV_vecUnwrapItems(vec)  v(ML99_PRIV_TAIL vec)
+// } (Conversions)
+
+// Accessors {
+
+#define ML99_vecLen_IMPL(vec)     v(ML99_VEC_LEN(vec))
+#define ML99_vecIsEmpty_IMPL(vec) v(ML99_VEC_IS_EMPTY(vec))
+
+#define ML99_vecGet_IMPL(i, vec)                                                                   \
+    ML99_PRIV_IF(ML99_NAT_LESSER(i, ML99_VEC_LEN(vec)), ML99_PRIV_vecGet, ML99_PRIV_vecGetError)   \
+    (i, vec)
+#define ML99_PRIV_vecGet(i, vec)       v(ML99_VEC_GET(i, vec))
+#define ML99_PRIV_vecGetError(i, _vec) ML99_fatal(ML99_vecGet, index i is out of range)
+// } (Accessors)
+
+// ML99_vecMap {
+
+/* The mapped items are emitted as terms separated by `v(,)`, and a metafunction that continues
+ * with the rest of the items is called unevaluated, so that the whole result of `ML99_vecMap`
+ * becomes the argument of `ML99_PRIV_vecOf`. */
+
+#define ML99_vecMap_IMPL(f, vec)                                                                   \
+    ML99_PRIV_VEC_IF_EMPTY(vec, ML99_PRIV_vecMapEmpty, ML99_PRIV_vecMapItems)(f, vec)
+#define ML99_PRIV_vecMapEmpty(_f, _vec) v(ML99_VEC_EMPTY())
+#define ML99_PRIV_vecMapItems(f, vec)                                                              \
+    ML99_call(                                                                                     \
+        ML99_PRIV_vecOf,                                                                           \
+        v(ML99_VEC_LEN(vec)),                                                                      \
+        ML99_callUneval(ML99_PRIV_vecMapProgress, f, ML99_PRIV_TAIL vec, ~))
+
+#define ML99_PRIV_vecOf_IMPL(n, ...) v((n, __VA_ARGS__))
+
+#define ML99_PRIV_vecMapProgress_IMPL(f, ...)                                                      \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_VEC_CHUNK_LEFT(__VA_ARGS__),                                                     \
+        ML99_PRIV_vecMapChunk,                                                                     \
+        ML99_PRIV_vecMapOne)                                                                       \
+    (f, __VA_ARGS__)
+
+#define ML99_PRIV_vecMapChunk(f, _1, _2, _3, _4, _5, _6, _7, _8, ...)                              \
+    ML99_appl_IMPL(f, _1), v(,), ML99_appl_IMPL(f, _2), v(,), ML99_appl_IMPL(f, _3), v(,),         \
+        ML99_appl_IMPL(f, _4), v(,), ML99_appl_IMPL(f, _5), v(,), ML99_appl_IMPL(f, _6), v(,),     \
+        ML99_appl_IMPL(f, _7), v(,),                                                               \
+        ML99_appl_IMPL(f, _8) ML99_PRIV_IF(                                                        \
+            ML99_PRIV_VEC_ITEMS_LEFT(__VA_ARGS__),                                                 \
+            ML99_PRIV_vecMapNext,                                                                  \
+            ML99_PRIV_EMPTY)(f, __VA_ARGS__)
+#define ML99_PRIV_vecMapOne(f, x, ...)                                                             \
+    ML99_appl_IMPL(f, x) ML99_PRIV_IF(                                                             \
+        ML99_PRIV_VEC_ITEMS_LEFT(__VA_ARGS__),                                                     \
+        ML99_PRIV_vecMapNext,                                                                      \
+        ML99_PRIV_EMPTY)(f, __VA_ARGS__)
+
+#define ML99_PRIV_vecMapNext(f, ...)                                                               \
+    , v(,), ML99_callUneval(ML99_PRIV_vecMapProgress, f, __VA_ARGS__)
+// } (ML99_vecMap)
+
+// ML99_vecFilter {
+
+/* The kept items are accumulated as `(, x1, ..., xm)` along with their count `m`: a chunk of
+ * items is first passed to `f`, and then each item is kept according to its bit. */
+
+#define ML99_vecFilter_IMPL(f, vec)                                                                \
+    ML99_PRIV_VEC_IF_EMPTY(vec, ML99_PRIV_vecMapEmpty, ML99_PRIV_vecFilterItems)(f, vec)
+#define ML99_PRIV_vecFilterItems(f, vec)                                                           \
+    ML99_PRIV_vecFilterProgress(f, 0, (), ML99_PRIV_TAIL vec, ~)
+
+#define ML99_PRIV_vecFilterProgress(f, m, kept, ...)                                               \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_VEC_CHUNK_LEFT(__VA_ARGS__),                                                     \
+        ML99_PRIV_vecFilterChunk,                                                                  \
+        ML99_PRIV_vecFilterOne)                                                                    \
+    (f, m, kept, __VA_ARGS__)
+
+#define ML99_PRIV_vecFilterChunk(f, m, kept, _1, _2, _3, _4, _5, _6, _7, _8, ...)                  \
+    ML99_call(                                                                                     \
+        ML99_PRIV_vecFilterKeepChunk,                                                              \
+        v(f, m, kept),                                                                             \
+        ML99_appl_IMPL(f, _1),                                                                     \
+        ML99_appl_IMPL(f, _2),                                                                     \
+        ML99_appl_IMPL(f, _3),                                                                     \
+        ML99_appl_IMPL(f, _4),                                                                     \
+        ML99_appl_IMPL(f, _5),                                                                     \
+        ML99_appl_IMPL(f, _6),                                                                     \
+        ML99_appl_IMPL(f, _7),                                                                     \
+        ML99_appl_IMPL(f, _8),                                                                     \
+        v(_1, _2, _3, _4, _5, _6, _7, _8, __VA_ARGS__))
+#define ML99_PRIV_vecFilterOne(f, m, kept, x, ...)                                                 \
+    ML99_call(ML99_PRIV_vecFilterKeepOne, v(f, m, kept), ML99_appl_IMPL(f, x), v(x, __VA_ARGS__))
+
+#define ML99_PRIV_vecFilterKeepChunk_IMPL(                                                         \
+    f, m, kept, b1, b2, b3, b4, b5, b6, b7, b8, _1, _2, _3, _4, _5, _6, _7, _8, ...)               \
+    ML99_PRIV_vecFilterNext(                                                                       \
+        f,                                                                                         \
+        ML99_PRIV_VEC_ADD_BITS(m, b1, b2, b3, b4, b5, b6, b7, b8),                                 \
+        (ML99_PRIV_EXPAND kept ML99_PRIV_VEC_KEEP_##b1(_1) ML99_PRIV_VEC_KEEP_##b2(_2)             \
+             ML99_PRIV_VEC_KEEP_##b3(_3) ML99_PRIV_VEC_KEEP_##b4(_4) ML99_PRIV_VEC_KEEP_##b5(_5)   \
+                 ML99_PRIV_VEC_KEEP_##b6(_6) ML99_PRIV_VEC_KEEP_##b7(_7)                           \
+                     ML99_PRIV_VEC_KEEP_##b8(_8)),                                                 \
+        __VA_ARGS__)
+#define ML99_PRIV_vecFilterKeepOne_IMPL(f, m, kept, b, x, ...)                                     \
+    ML99_PRIV_vecFilterNext(                                                                       \
+        f,                                                                                         \
+        ML99_PRIV_VEC_INC_##b(m),                                                                  \
+        (ML99_PRIV_EXPAND kept ML99_PRIV_VEC_KEEP_##b(x)),                                         \
+        __VA_ARGS__)
+
+#define ML99_PRIV_vecFilterNext(f, m, kept, ...)                                                   \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_VEC_ITEMS_LEFT(__VA_ARGS__),                                                     \
+        ML99_PRIV_vecFilterProgress,                                                               \
+        ML99_PRIV_vecFilterDone)                                                                   \
+    (f, m, kept, __VA_ARGS__)
+#define ML99_PRIV_vecFilterDone(_f, m, kept, ...) v((m ML99_PRIV_EXPAND kept))
+
+#define ML99_PRIV_VEC_ADD_BITS(m, b1, b2, b3, b4, b5, b6, b7, b8)                                  \
+    ML99_PRIV_VEC_INC_##b8(ML99_PRIV_VEC_INC_##b7(ML99_PRIV_VEC_INC_##b6(ML99_PRIV_VEC_INC_##b5(   \
+        ML99_PRIV_VEC_INC_##b4(                                                                    \
+            ML99_PRIV_VEC_INC_##b3(ML99_PRIV_VEC_INC_##b2(ML99_PRIV_VEC_INC_##b1(m))))))))
+
+#define ML99_PRIV_VEC_INC_0(m) m
+#define ML99_PRIV_VEC_INC_1(m) ML99_PRIV_INC(m)
+
+#define ML99_PRIV_VEC_KEEP_0(x)
+#define ML99_PRIV_VEC_KEEP_1(x) , x
+// } (ML99_vecFilter)
+
+// ML99_vecFoldl {
+
+#define ML99_vecFoldl_IMPL(f, init, vec)                                                           \
+    ML99_PRIV_VEC_IF_EMPTY(vec, ML99_PRIV_vecFoldlEmpty, ML99_PRIV_vecFoldlItems)(f, init, vec)
+#define ML99_PRIV_vecFoldlEmpty(_f, init, _vec) v(init)
+#define ML99_PRIV_vecFoldlItems(f, init, vec)                                                      \
+    ML99_PRIV_vecFoldlProgress_IMPL(f, init, ML99_PRIV_TAIL vec, ~)
+
+#define ML99_PRIV_vecFoldlProgress_IMPL(f, acc, ...)                                               \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_VEC_CHUNK_LEFT(__VA_ARGS__),                                                     \
+        ML99_PRIV_vecFoldlChunk,                                                                   \
+        ML99_PRIV_vecFoldlOne)                                                                     \
+    (f, acc, __VA_ARGS__)
+
+#define ML99_PRIV_vecFoldlChunk(f, acc, _1, _2, _3, _4, _5, _6, _7, _8, ...)                       \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_VEC_ITEMS_LEFT(__VA_ARGS__),                                                     \
+        ML99_PRIV_vecFoldlNext,                                                                    \
+        ML99_PRIV_vecFoldlLast)                                                                    \
+    (f,                                                                                            \
+     ML99_appl2(                                                                                   \
+         v(f),                                                                                     \
+         ML99_appl2(                                                                               \
+             v(f),                                                                                 \
+             ML99_appl2(                                                                           \
+                 v(f),                                                                             \
+                 ML99_appl2(                                                                       \
+                     v(f),                                                                         \
+                     ML99_appl2(                                                                   \
+                         v(f),                                                                     \
+                         ML99_appl2(                                                               \
+                             v(f),                                                                 \
+                             ML99_appl2(v(f), ML99_appl2_IMPL(f, acc, _1), v(_2)),                 \
+                             v(_3)),                                                               \
+                         v(_4)),                                                                   \
+                     v(_5)),                                                                       \
+                 v(_6)),                                                                           \
+             v(_7)),                                                                               \
+         v(_8)),                                                                                   \
+     __VA_ARGS__)
+#define ML99_PRIV_vecFoldlOne(f, acc, x, ...)                                                      \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_VEC_ITEMS_LEFT(__VA_ARGS__),                                                     \
+        ML99_PRIV_vecFoldlNext,                                                                    \
+        ML99_PRIV_vecFoldlLast)                                                                    \
+    (f, ML99_appl2_IMPL(f, acc, x), __VA_ARGS__)
+
+#define ML99_PRIV_vecFoldlNext(f, acc, ...)                                                        \
+    ML99_call(ML99_PRIV_vecFoldlProgress, v(f), acc, v(__VA_ARGS__))
+#define ML99_PRIV_vecFoldlLast(_f, acc, ...) acc
+// } (ML99_vecFoldl)
+
+// ML99_vecConcat {
+
+#define ML99_vecConcat_IMPL(vec, other)                                                            \
+    ML99_PRIV_VEC_IF_EMPTY(                                                                        \
+        vec,                                                                                       \
+        ML99_PRIV_vecConcatFirstEmpty,                                                             \
+        ML99_PRIV_VEC_IF_EMPTY(other, ML99_PRIV_vecConcatSecondEmpty, ML99_PRIV_vecConcatItems))   \
+    (vec, other)
+#define ML99_PRIV_vecConcatFirstEmpty(_vec, other)  v(other)
+#define ML99_PRIV_vecConcatSecondEmpty(vec, _other) v(vec)
+#define ML99_PRIV_vecConcatItems(vec, other)                                                       \
+    v((ML99_PRIV_NAT_ADD(ML99_VEC_LEN(vec), ML99_VEC_LEN(other)),                                  \
+       ML99_PRIV_TAIL vec,                                                                         \
+       ML99_PRIV_TAIL other))
+// } (ML99_vecConcat)
+
+// Arity specifiers {
+
+#define ML99_vec_ARITY               1
+#define ML99_vecEmpty_ARITY          1
+#define ML99_vecFromList_ARITY       1
+#define ML99_vecToList_ARITY         1
+#define ML99_vecLen_ARITY            1
+#define ML99_vecIsEmpty_ARITY        1
+#define ML99_vecGet_ARITY            2
+#define ML99_vecMap_ARITY            2
+#define ML99_vecFilter_ARITY         2
+#define ML99_vecFoldl_ARITY          3
+#define ML99_vecConcat_ARITY         2
+#define ML99_vecUnwrapCommaSep_ARITY 1
+
+// } (Arity specifiers)
+
+#endif // DOXYGEN_IGNORE
+
+#endif // ML99_VEC_H
@@ -0,0 +1,221 @@
+#!/usr/bin/env python3
+
+# Sweep the input size of the standard library operations and show how their cost grows.
+#
+# Every case is a metaprogram parameterised by `N` (a number of items or a natural number). For each
+# size, the script generates it, counts its reduction steps with `ML99_EVAL_STEPS`, and times its
+# preprocessing like `scripts/bench.py` does. The steps do not depend on the machine, so their
+# growth exponent between the two largest sizes (`1` is linear, `2` is quadratic) tells which
+# operations are superlinear; the times are plotted against `N` as bars.
+#
+# Usage: ./scripts/bench-scaling.py [--sizes 4,16,64,255] [--filter list] [--csv out.csv]
+
+import argparse
+import csv
+import json
+import math
+import os
+import statistics
+import subprocess
+import sys
+import tempfile
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+
+from bench import command, compiler_flags, time_command  # noqa: E402
+
+PRELUDE = """\
+#include <metalang99.h>
+
+#define F_IMPL(x) v(x)
+#define F_ARITY   1
+
+#define MATCH_IMPL(x)       ML99_match(ML99_just(v(x)), v(MATCH_))
+#define MATCH_just_IMPL(x)  v(x)
+#define MATCH_nothing_IMPL  v(~)
+#define MATCH_ARITY         1
+
+#define ITEM(i) [i] = i
+
+#define FIB_IMPL(self, i) \\
+    ML99_IF( \\
+        ML99_NAT_LESSER(i, 2), \\
+        v(i), \\
+        ML99_add(ML99_appl(v(self), v(ML99_DEC(i))), ML99_appl(v(self), v(ML99_DEC(ML99_DEC(i))))))
+#define FIB_ARITY 2
+"""
+
+# `(name, term)`, where `{items}` is `0, 1, ..., N - 1`, `{list}` is `ML99_list(v({items}))`,
+# `{types}` is a list of `N` types, `{n}` is `N`, and `{half}` is `N / 2`.
+CASES = [
+    # list.h
+    ("ML99_list", "{list}"),
+    ("ML99_listLen", "ML99_listLen({list})"),
+    ("ML99_listReverse", "ML99_listReverse({list})"),
+    ("ML99_listAppend", "ML99_listAppend({list}, {list})"),
+    ("ML99_listGet", "ML99_listGet(v({last}), {list})"),
+    ("ML99_listFoldl", "ML99_listFoldl(v(ML99_max), v(0), {list})"),
+    ("ML99_listMap", "ML99_listUnwrap(ML99_listMap(v(ML99_inc), {list}))"),
+    ("ML99_listFilter", "ML99_listFilter(ML99_appl(v(ML99_lesser), v({half})), {list})"),
+    ("ML99_listEq", "ML99_listEq(v(ML99_natEq), {list}, {list})"),
+    ("ML99_listContainsNat", "ML99_listContainsNat(v({last}), {list})"),
+    ("ML99_listTake", "ML99_listTake(v({half}), {list})"),
+    ("ML99_listZip", "ML99_listZip({list}, {list})"),
+    ("ML99_listPartition", "ML99_listPartition(ML99_appl(v(ML99_lesser), v({half})), {list})"),
+    ("ML99_listUnzip", "ML99_listUnzip(ML99_listZip({list}, {list}))"),
+    ("ML99_listSortNat", "ML99_listSortNat({list})"),
+    # nat.h
+    ("ML99_natEq", "ML99_natEq(v({n}), v({n}))"),
+    ("ML99_lesser", "ML99_lesser(v({half}), v({n}))"),
+    ("ML99_add", "ML99_add(v({half}), v({half}))"),
+    ("ML99_sub", "ML99_sub(v({n}), v({half}))"),
+    ("ML99_mul", "ML99_mul(v(1), v({n}))"),
+    ("ML99_div", "ML99_div(v({n}), v(2))"),
+    # variadics.h, tuple.h
+    ("ML99_variadicsForEach", "ML99_variadicsForEach(v(F), v({items}))"),
+    ("ML99_tupleForEach", "ML99_tupleForEach(v(F), v(({items})))"),
+    ("ML99_tupleMap", "ML99_tupleMap(v(F), v(({items})))"),
+    ("ML99_tupleFilter", "ML99_tupleFilter(ML99_appl(v(ML99_lesser), v({half})), v(({items})))"),
+    ("ML99_tupleReverse", "ML99_tupleReverse(v(({items})))"),
+    # gen.h
+    ("ML99_indexedParams", "ML99_indexedParams({types})"),
+    ("ML99_indexedFields", "ML99_indexedFields({types})"),
+    ("ML99_indexedArgs", "ML99_indexedArgs(v({n}))"),
+    ("ML99_genArray", "ML99_genArray(v({n}), v(ITEM))"),
+    # control.h
+    ("ML99_fixMemo", "ML99_fixMemo(v(FIB), v({n}))"),
+    # datatype.h
+    ("ML99_match", "ML99_listUnwrap(ML99_listMap(v(MATCH), {list}))"),
+]
+
+# A growth exponent of steps above this is reported as superlinear. The time exponent is measured
+# on top of the cost of `#include <metalang99.h>` and an empty `ML99_EVAL`; it is about 2 for linear
+# list operations, since every reduction step carries the whole list along.
+SUPERLINEAR = 1.3
+
+
+def instantiate(term, n):
+    items = ", ".join(str(i) for i in range(n))
+    types = f"ML99_list(v({', '.join(['int'] * n)}))"
+
+    return term.format(
+        items=items, list=f"ML99_list(v({items}))", types=types, n=n, half=n // 2, last=n - 1
+    )
+
+
+def count_steps(cc, tmp, term):
+    path = os.path.join(tmp, "steps.c")
+
+    with open(path, "w") as f:
+        f.write(f"#define ML99_PROFILE\n{PRELUDE}\nML99_STEPS: ML99_EVAL_STEPS({term})\n")
+
+    result = subprocess.run(command(cc, "preprocess", path), capture_output=True, text=True)
+    line = next((l for l in result.stdout.splitlines() if l.startswith("ML99_STEPS:")), None)
+
+    # `ML99_EVAL_STEPS` expands to an arithmetic expression of integer literals.
+    if result.returncode != 0 or line is None:
+        sys.exit(f"`{term[:80]}...` failed:\n{result.stderr}")
+
+    expr = line[len("ML99_STEPS:") :]
+
+    if not set(expr) <= set("0123456789+*() "):
+        sys.exit(f"`{term[:80]}...` did not evaluate:\n{expr[:400]}")
+
+    return eval(expr)
+
+
+def time_eval(cc, tmp, term, repeat):
+    path = os.path.join(tmp, "time.c")
+
+    with open(path, "w") as f:
+        f.write(f"{PRELUDE}\nML99_EVAL({term})\n")
+
+    cmd = command(cc, "preprocess", path)
+    time_command(cmd)
+
+    return statistics.median(time_command(cmd) for _ in range(repeat))
+
+
+def growth(rows, key, base=0.0):
+    (n1, a), (n2, b) = [(r["n"], r[key] - base) for r in rows[-2:]]
+
+    if a <= 0 or b <= 0:
+        return 0.0
+    return math.log(b / a) / math.log(n2 / n1)
+
+
+def plot(name, rows, base, width=40):
+    longest = max(r["time"] for r in rows)
+    steps_growth, time_growth = growth(rows, "steps"), growth(rows, "time", base)
+    mark = "  SUPERLINEAR" if steps_growth > SUPERLINEAR else ""
+
+    print(f"\n{name} (steps ~ N^{steps_growth:.2f}, time ~ N^{time_growth:.2f}){mark}")
+
+    for r in rows:
+        bar = "#" * max(1, round(r["time"] / longest * width))
+        print(f"  N={r['n']:<4} {r['steps']:>7} steps {r['time']:>7.3f}s {bar}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Sweep the input size of Metalang99 operations.")
+    parser.add_argument("--cc", default=os.environ.get("CC", "gcc"), help="the compiler to use")
+    parser.add_argument("--sizes", default="4,16,64,255", help="comma-separated values of N")
+    parser.add_argument("--repeat", type=int, default=3, help="timed runs per case and size")
+    parser.add_argument("--filter", default="", help="run only cases containing this string")
+    parser.add_argument("--json", help="write the results to this JSON file")
+    parser.add_argument("--csv", help="write the results to this CSV file")
+    args = parser.parse_args()
+
+    sizes = sorted(int(n) for n in args.sizes.split(","))
+
+    if len(sizes) < 2 or sizes[0] < 1 or sizes[-1] > 255:
+        parser.error("--sizes must list at least two values of N from 1 to 255")
+
+    results = {}
+
+    with tempfile.TemporaryDirectory() as tmp:
+        base = time_eval(args.cc, tmp, "v(~)", args.repeat)
+        print(f"Base (header and empty ML99_EVAL): {base:.3f}s")
+
+        for name, term in CASES:
+            if args.filter not in name:
+                continue
+
+            rows = []
+
+            for n in sizes:
+                t = instantiate(term, n)
+                rows.append(
+                    {
+                        "n": n,
+                        "steps": count_steps(args.cc, tmp, t),
+                        "time": time_eval(args.cc, tmp, t, args.repeat),
+                    }
+                )
+
+            results[name] = rows
+            plot(name, rows, base)
+
+    superlinear = [name for name, rows in results.items() if growth(rows, "steps") > SUPERLINEAR]
+
+    if superlinear:
+        print(f"\nSuperlinear in N: {', '.join(superlinear)}")
+
+    if args.json:
+        with open(args.json, "w") as f:
+            report = {"cc": args.cc, "cc_flags": compiler_flags(args.cc), "base": base}
+            json.dump({**report, "results": results}, f, indent=4)
+            f.write("\n")
+
+    if args.csv:
+        with open(args.csv, "w", newline="") as f:
+            writer = csv.writer(f)
+            writer.writerow(["case", "n", "steps", "time"])
+
+            for name, rows in results.items():
+                for r in rows:
+                    writer.writerow([name, r["n"], r["steps"], f"{r['time']:.6f}"])
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,504 @@
+#!/usr/bin/env python3
+
+# Time the benchmarks from `bench/` and optionally compare them against a stored baseline.
+#
+# Every benchmark is timed `--repeat` times in two modes: `preprocess` (`-E`, the part Metalang99 is
+# responsible for) and `compile` (a full compilation of the preprocessed output). The min, median,
+# and standard deviation of each are printed along with the peak resident memory of the compiler and
+# the size of the `-E` output in bytes and tokens, and can be written as JSON (`--json`) or CSV
+# (`--csv`). The end-to-end benchmarks adapted from `examples/` also report their reduction steps.
+#
+# `--cc` can be repeated to run the same suite on several compilers (GCC, Clang, MSVC's `cl`, and
+# TCC are recognised and get the flags of `tests/CMakeLists.txt`); their medians are then printed
+# side by side. `--report` prints the same table from JSON files of earlier runs, e.g. of CI jobs on
+# different systems.
+#
+# A JSON file written by a previous run can be passed as `--baseline`: a benchmark whose median
+# grows by more than `--threshold` percent (and by more than `--min-delta` seconds, to ignore the
+# noise of tiny benchmarks), whose peak memory grows by more than `--mem-threshold` percent, or
+# whose reduction steps grow at all, is reported as a regression, and the script exits with status 1.
+#
+# The `#include` benchmarks also give the cost of each public header over an empty file: the extra
+# `-E` median and the number of macros that it defines, which GCC and Clang list with `-dM`. They
+# are printed next to those of `--baseline`, and a header whose macros grow by more than
+# `--macro-threshold` percent is a regression too. `--include` benchmarks the headers of another
+# tree, e.g. of a checkout of the baseline.
+#
+# Usage: ./scripts/bench.py [--cc gcc] [--cc clang] [--repeat 5] [--json out.json]
+#                           [--baseline old.json]
+
+import argparse
+import csv
+import functools
+import json
+import os
+import re
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+MODES = ["preprocess", "compile"]
+
+# Identifiers and numbers, string and character literals, and single punctuators: a C token count
+# that is good enough to compare the outputs of two runs.
+TOKEN = re.compile(r"[A-Za-z_0-9.]+|\"(?:\\.|[^\"\\])*\"|'(?:\\.|[^'\\])*'|\S")
+
+# `(file, extra flags)` in the order they are run.
+BENCHES = [
+    ("compare_25_items.h", []),
+    ("compare_25_items_nat.h", []),
+    ("dedup_keywords.h", []),
+    ("gen_table_of_4096_items.h", []),
+    ("list_of_63_items.h", []),
+    ("list_of_256_items.h", []),
+    ("100_v.h", []),
+    ("100_call.h", []),
+    ("many_call_in_arg_pos.h", []),
+] + [
+    # The fixed costs of parsing the headers and of a single `ML99_EVAL` at each `ML99_REC_DEPTH`.
+    (file, [f"-DML99_REC_DEPTH={depth}"])
+    for depth in [1, 16, 64, 256]
+    for file in ["header_only.h", "1000_tiny_evals.h"]
+]
+
+# The end-to-end benchmarks adapted from `examples/` (see `bench/stress.h`) and the values of their
+# input size `N`.
+STRESS = [
+    ("ackermann.h", [4, 8, 16]),
+    ("factorial.h", [4, 8, 16]),
+    ("binary_tree.h", [3, 5, 7]),
+    ("lambda_calculus.h", [1, 2, 4]),
+]
+
+BENCHES += [(file, [f"-DN={n}"]) for file, sizes in STRESS for n in sizes]
+
+# `STRESS` of `bench/stress.h` yields the reduction steps as `ml99_bench_steps = <expression>;`.
+STEPS = re.compile(r"ml99_bench_steps = ([0-9+*() ]+);")
+
+# The same settings as `tests/CMakeLists.txt`, so that we measure what users get.
+COMPILER_FLAGS = {
+    "gcc": ["-ftrack-macro-expansion=0"],
+    "clang": ["-fmacro-backtrace-limit=1"],
+    # Enable a standard-conforming C99/C11 preprocessor.
+    "msvc": ["/nologo", "/std:c11"],
+    "tcc": ["-DML99_ALLOW_POOR_DIAGNOSTICS"],
+    "cc": [],
+}
+
+# The headers under test, which `--include` can replace by those of another tree, e.g. of the
+# baseline.
+INCLUDE = os.path.join(ROOT, "include")
+
+OBJECT = os.path.join(tempfile.gettempdir(), "metalang99-bench.obj")
+
+
+def bench_name(file, flags):
+    return " ".join([file] + flags)
+
+
+def headers():
+    """Every public header, each of which is parsed in an otherwise empty translation unit."""
+    files = os.listdir(os.path.join(INCLUDE, "metalang99"))
+    return ["metalang99.h"] + sorted(f"metalang99/{f}" for f in files if f.endswith(".h"))
+
+
+def suite(tmp):
+    """`(name, path, extra flags)` of every benchmark, writing the header ones to `tmp`."""
+    benches = [
+        (bench_name(file, flags), os.path.join(ROOT, "bench", file), flags)
+        for file, flags in BENCHES
+    ]
+
+    for header in [None] + headers():
+        name = "(empty file)" if header is None else f"#include <{header}>"
+        path = os.path.join(tmp, f"include_{len(benches)}.c")
+
+        with open(path, "w") as f:
+            f.write("" if header is None else f"{name}\n")
+
+        benches.append((name, path, []))
+
+    return benches
+
+
+@functools.lru_cache(maxsize=None)
+def compiler_kind(cc):
+    name = os.path.basename(cc).lower()
+
+    if name in ["cl", "cl.exe"]:
+        return "msvc"
+    if "tcc" in name:
+        return "tcc"
+
+    version = subprocess.run([cc, "--version"], capture_output=True, text=True).stdout
+
+    if "clang" in version:
+        return "clang"
+    if "Free Software Foundation" in version:
+        return "gcc"
+    return "cc"
+
+
+def compiler_flags(cc):
+    return COMPILER_FLAGS[compiler_kind(cc)]
+
+
+def command(cc, mode, path, flags=[]):
+    # The preprocessed output goes to stdout, which is discarded when timing.
+    kind = compiler_kind(cc)
+    include = INCLUDE
+
+    if kind == "msvc":
+        cmd = [cc, "/TC", path, "/I", include] + COMPILER_FLAGS[kind] + flags
+        return cmd + (["/EP"] if mode == "preprocess" else ["/c", f"/Fo{OBJECT}"])
+
+    cmd = [cc, path, "-I", include] + COMPILER_FLAGS[kind] + flags
+
+    # TCC has no `-x c` but compiles headers as C anyway.
+    if kind != "tcc":
+        cmd[1:1] = ["-x", "c"]
+
+    return cmd + (["-E", "-P"] if mode == "preprocess" else ["-c", "-o", os.devnull])
+
+
+def run_command(cmd):
+    start = time.perf_counter()
+    proc = subprocess.Popen(cmd, stdout=subprocess.DEVNULL, stderr=subprocess.PIPE, text=True)
+    stderr = proc.stderr.read()
+    rss = 0
+
+    # `os.wait4` gives the resource usage of this very child, unlike `RUSAGE_CHILDREN`, which holds
+    # the peak of all the children so far. Windows has neither, so there the peak memory is 0.
+    if hasattr(os, "wait4"):
+        _, status, usage = os.wait4(proc.pid, 0)
+        proc.returncode = os.waitstatus_to_exitcode(status)
+
+        # `ru_maxrss` is in kilobytes on Linux and in bytes on macOS.
+        rss = usage.ru_maxrss * (1 if sys.platform == "darwin" else 1024)
+    else:
+        proc.wait()
+
+    elapsed = time.perf_counter() - start
+    proc.stderr.close()
+
+    if proc.returncode != 0:
+        sys.exit(f"`{' '.join(cmd)}` failed:\n{stderr}")
+
+    return elapsed, rss
+
+
+def time_command(cmd):
+    return run_command(cmd)[0]
+
+
+def output_size(cc, path, flags):
+    cmd = command(cc, "preprocess", path, flags)
+    output = subprocess.run(cmd, capture_output=True, text=True, check=True).stdout
+
+    return {"output_bytes": len(output.encode()), "output_tokens": len(TOKEN.findall(output))}
+
+
+def count_steps(cc, path, flags):
+    """The reduction steps of a benchmark of `STRESS`, or `None` for the others."""
+    if os.path.basename(path) not in [file for file, _ in STRESS]:
+        return None
+
+    cmd = command(cc, "preprocess", path, flags + ["-DML99_PROFILE"])
+    output = subprocess.run(cmd, capture_output=True, text=True, check=True).stdout
+    match = STEPS.search(output)
+
+    if match is None:
+        sys.exit(f"`{' '.join(cmd)}` did not yield the reduction steps")
+
+    return eval(match.group(1))
+
+
+def count_macros(cc, path, flags):
+    """The macros defined at the end of `path`, or `None` if `cc` cannot list them."""
+    if compiler_kind(cc) not in ["gcc", "clang"]:
+        return None
+
+    cmd = command(cc, "preprocess", path, flags) + ["-dM"]
+    output = subprocess.run(cmd, capture_output=True, text=True, check=True).stdout
+
+    return sum(line.startswith("#define ") for line in output.splitlines())
+
+
+def run_bench(cmd, repeat, warmup):
+    for _ in range(warmup):
+        run_command(cmd)
+
+    runs = [run_command(cmd) for _ in range(repeat)]
+    samples = [elapsed for elapsed, _ in runs]
+
+    return {
+        "min": min(samples),
+        "median": statistics.median(samples),
+        "stddev": statistics.stdev(samples) if len(samples) > 1 else 0.0,
+        "peak_rss": max(rss for _, rss in runs),
+        "samples": samples,
+    }
+
+
+SIZES = ["peak_rss", "output_bytes", "output_tokens", "steps", "macros"]
+
+
+def write_csv(path, results):
+    with open(path, "w", newline="") as f:
+        writer = csv.writer(f)
+        writer.writerow(["cc", "bench", "mode", "min", "median", "stddev"] + SIZES)
+
+        for r in results:
+            stats = [f"{r[k]:.6f}" for k in ["min", "median", "stddev"]]
+            sizes = ["" if r.get(k) is None else r[k] for k in SIZES]
+            writer.writerow([r["cc"], r["bench"], r["mode"]] + stats + sizes)
+
+
+def load_results(path):
+    with open(path) as f:
+        report = json.load(f)
+
+    # Reports of a single compiler from before `--cc` could be repeated only name it once.
+    return [{"cc": report.get("cc"), **r} for r in report["results"]]
+
+
+def mib(n):
+    return n / (1024 * 1024)
+
+
+def side_by_side(results):
+    compilers = list(dict.fromkeys(r["cc"] for r in results))
+    rows = {}
+
+    for r in results:
+        rows.setdefault((r["bench"], r["mode"]), {})[r["cc"]] = r
+
+    print(f"\n{'bench':<40} {'mode':<10} " + " ".join(f"{cc:>16}" for cc in compilers))
+
+    for (bench, mode), by_cc in rows.items():
+        cells = [
+            f"{by_cc[cc]['median']:.3f}s {mib(by_cc[cc]['peak_rss']):.1f}M" if cc in by_cc else "-"
+            for cc in compilers
+        ]
+        print(f"{bench:<40} {mode:<10} " + " ".join(f"{cell:>16}" for cell in cells))
+
+
+def steps_column(before, after):
+    if None in [before, after] or before == after:
+        return ""
+    return f" {before} -> {after} steps"
+
+
+def compare(results, baseline, threshold, min_delta, mem_threshold):
+    old = {(r["cc"], r["bench"], r["mode"]): r for r in baseline}
+    regressions = []
+
+    print(f"\n{'bench':<40} {'mode':<10} {'old':>8} {'new':>8} {'change':>8} {'RSS':>8}")
+
+    for r in results:
+        key = (r["cc"], r["bench"], r["mode"])
+        name = f"{r['cc']}: {r['bench']}"
+
+        if key not in old:
+            print(f"{name:<40} {r['mode']:<10} {'-':>8} {r['median']:>8.3f} {'new':>8}")
+            continue
+
+        before, after = old[key]["median"], r["median"]
+        change = (after - before) / before * 100 if before > 0 else 0.0
+        rss_before, rss_after = old[key].get("peak_rss", 0), r["peak_rss"]
+        rss_change = (rss_after - rss_before) / rss_before * 100 if rss_before > 0 else 0.0
+
+        # Unlike the time and the memory, the steps do not depend on the machine, so any growth counts.
+        steps_before, steps_after = old[key].get("steps"), r.get("steps")
+        steps_grew = None not in [steps_before, steps_after] and steps_after > steps_before
+
+        regressed = change > threshold and after - before > min_delta
+        regressed = regressed or rss_change > mem_threshold or steps_grew
+        mark = "  REGRESSION" if regressed else ""
+
+        print(
+            f"{name:<40} {r['mode']:<10} {before:>8.3f} {after:>8.3f} {change:>+7.1f}% "
+            f"{rss_change:>+7.1f}%{steps_column(steps_before, steps_after)}{mark}"
+        )
+
+        if regressed:
+            regressions.append(key)
+
+    return regressions
+
+
+def is_header_bench(name):
+    return name == "(empty file)" or name.startswith("#include")
+
+
+def header_costs(results):
+    """`{(cc, header): (seconds, macros)}` over the `(empty file)` of each compiler."""
+    empty = {
+        r["cc"]: r for r in results if r["bench"] == "(empty file)" and r["mode"] == "preprocess"
+    }
+    costs = {}
+
+    for r in results:
+        if r["mode"] != "preprocess" or r["cc"] not in empty:
+            continue
+        if not r["bench"].startswith("#include"):
+            continue
+
+        base = empty[r["cc"]]
+        macros = None if r.get("macros") is None else r["macros"] - base["macros"]
+        costs[(r["cc"], r["bench"])] = (r["median"] - base["median"], macros)
+
+    return costs
+
+
+def macros_cell(macros):
+    return "-" if macros is None else str(macros)
+
+
+def print_header_costs(results, baseline, macro_threshold):
+    costs = header_costs(results)
+    old = header_costs(baseline or [])
+    regressions = []
+
+    if not costs:
+        return regressions
+
+    print(f"\n{'header cost':<40} {'ms':>8} {'macros':>8} {'old ms':>8} {'old':>8} {'change':>8}")
+
+    for (cc, bench), (seconds, macros) in costs.items():
+        name = bench if len({c for c, _ in costs}) == 1 else f"{cc}: {bench}"
+        line = f"{name:<40} {seconds * 1000:>8.1f} {macros_cell(macros):>8}"
+
+        if (cc, bench) in old:
+            old_seconds, old_macros = old[(cc, bench)]
+            line += f" {old_seconds * 1000:>8.1f} {macros_cell(old_macros):>8}"
+
+            # Like the steps, the macros do not depend on the machine.
+            if None not in [macros, old_macros]:
+                change = (macros - old_macros) / old_macros * 100 if old_macros > 0 else 0.0
+                line += f" {change:>+7.1f}%"
+
+                if change > macro_threshold:
+                    line += "  REGRESSION"
+                    regressions.append((cc, bench, "macros"))
+
+        print(line)
+
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Run the Metalang99 benchmarks.")
+    parser.add_argument(
+        "--cc", action="append", help="a compiler to use, can be repeated ($CC or gcc by default)"
+    )
+    parser.add_argument("--repeat", type=int, default=5, help="timed runs per benchmark and mode")
+    parser.add_argument("--warmup", type=int, default=1, help="untimed runs before the timed ones")
+    parser.add_argument("--mode", choices=MODES, action="append", help="run only these modes")
+    parser.add_argument("--filter", default="", help="run only benchmarks containing this string")
+    parser.add_argument("--json", help="write the results to this JSON file")
+    parser.add_argument("--csv", help="write the results to this CSV file")
+    parser.add_argument("--baseline", help="a JSON file of a previous run to compare against")
+    parser.add_argument("--include", help="benchmark the headers of this directory instead")
+    parser.add_argument(
+        "--threshold", type=float, default=10.0, help="the allowed median growth, in percent"
+    )
+    parser.add_argument(
+        "--min-delta", type=float, default=0.005, help="the ignored median growth, in seconds"
+    )
+    parser.add_argument(
+        "--mem-threshold", type=float, default=10.0, help="the allowed peak RSS growth, in percent"
+    )
+    parser.add_argument(
+        "--macro-threshold",
+        type=float,
+        default=0.0,
+        help="the allowed growth of the macros defined by a header, in percent",
+    )
+    parser.add_argument(
+        "--report", nargs="+", metavar="JSON", help="print the results of earlier runs side by side"
+    )
+    args = parser.parse_args()
+
+    if args.report:
+        side_by_side([r for path in args.report for r in load_results(path)])
+        return
+
+    if args.repeat < 1:
+        parser.error("--repeat must be at least 1")
+
+    if args.include:
+        global INCLUDE
+        INCLUDE = os.path.abspath(args.include)
+
+    compilers = args.cc or [os.environ.get("CC", "gcc")]
+    modes = args.mode or MODES
+    results = []
+
+    print(
+        f"{'bench':<40} {'mode':<10} {'min':>8} {'median':>8} {'stddev':>8} {'RSS MiB':>8} "
+        f"{'bytes':>8} {'tokens':>8} {'steps':>8}"
+    )
+
+    with tempfile.TemporaryDirectory() as tmp:
+        benches = suite(tmp)
+
+        for cc in compilers:
+            for name, path, flags in benches:
+                # The header costs are measured against the empty file, so it is always run.
+                if args.filter not in name and name != "(empty file)":
+                    continue
+
+                size = output_size(cc, path, flags)
+                size["steps"] = count_steps(cc, path, flags)
+                size["macros"] = count_macros(cc, path, flags) if is_header_bench(name) else None
+                steps = "-" if size["steps"] is None else size["steps"]
+                label = name if len(compilers) == 1 else f"{cc}: {name}"
+
+                for mode in modes:
+                    cmd = command(cc, mode, path, flags)
+                    r = {"cc": cc, "bench": name, "mode": mode}
+                    r.update(run_bench(cmd, args.repeat, args.warmup), **size)
+                    results.append(r)
+
+                    print(
+                        f"{label:<40} {mode:<10} {r['min']:>8.3f} {r['median']:>8.3f} "
+                        f"{r['stddev']:>8.3f} {mib(r['peak_rss']):>8.1f} {r['output_bytes']:>8} "
+                        f"{r['output_tokens']:>8} {steps:>8}"
+                    )
+
+    if len(compilers) > 1:
+        side_by_side(results)
+
+    report = {
+        "compilers": {cc: compiler_flags(cc) for cc in compilers},
+        "repeat": args.repeat,
+        "results": results,
+    }
+
+    if args.json:
+        with open(args.json, "w") as f:
+            json.dump(report, f, indent=4)
+            f.write("\n")
+
+    if args.csv:
+        write_csv(args.csv, results)
+
+    baseline = load_results(args.baseline) if args.baseline else None
+    regressions = print_header_costs(results, baseline, args.macro_threshold)
+
+    if baseline is not None:
+        regressions += compare(
+            results, baseline, args.threshold, args.min_delta, args.mem_threshold
+        )
+
+        if regressions:
+            sys.exit(f"\n{len(regressions)} regression(s).")
+
+
+if __name__ == "__main__":
+    main()
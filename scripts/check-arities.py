@@ -52,8 +52,9 @@ def gather_arity_specifiers(root):
     return arity_specifiers
 
 
-filenames = ["assert", "choice", "control", "either", "gen", "lang",
-             "list", "logical", "maybe", "nat", "ident", "tuple", "util", "variadics"]
+filenames = ["assert", "bignat", "choice", "control", "div", "either", "gen", "lang",
+             "list", "logical", "maybe", "nat", "ident", "identset", "tuple", "util",
+             "variadics", "vec"]
 
 for filename in filenames:
     check_file(filename)
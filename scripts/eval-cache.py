@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+
+# Evaluate the `ML99_EVAL_CACHED(key, ...)` sites of source files ahead of time and write their
+# results to a cache header.
+#
+# Every source is preprocessed with `ML99_EVAL_CACHE_DUMP` defined, under which `ML99_EVAL_CACHED`
+# evaluates its metaprogram as usual and surrounds the result with markers. The evaluation is thus
+# done by the same preprocessor, with the same includes and macros, as a real build. The header maps
+# every key to its result; compiling the sources with `-DML99_EVAL_CACHE_HEADER='"<header>"'` then
+# skips the evaluation.
+#
+# `--check` fails instead of writing if the header is missing or out of date, e.g. in CI.
+#
+# Usage: ./scripts/eval-cache.py -o cache.h [--cc gcc] [-I dir] [-D NAME=VALUE] [--check] file.c...
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+
+from bench import command  # noqa: E402
+
+ENTRY = re.compile(
+    r"ML99_PRIV_EVAL_CACHE_BEGIN\s+(\w+)\s+ML99_PRIV_EVAL_CACHE_SEP(.*?)ML99_PRIV_EVAL_CACHE_END",
+    re.DOTALL,
+)
+
+
+def collect(cc, flags, source):
+    cmd = command(cc, "preprocess", source, flags + ["-DML99_EVAL_CACHE_DUMP"])
+    result = subprocess.run(cmd, capture_output=True, text=True)
+
+    if result.returncode != 0:
+        sys.exit(f"{source}: preprocessing failed:\n{result.stderr}")
+
+    for key, value in ENTRY.findall(result.stdout):
+        value = " ".join(line.strip() for line in value.strip().splitlines())
+
+        if "ML99_PRIV_EVAL_CACHE_BEGIN" in value:
+            sys.exit(f"{source}: `{key}` contains another `ML99_EVAL_CACHED`")
+        if value.count("(") != value.count(")"):
+            sys.exit(f"{source}: the result of `{key}` has unbalanced parentheses")
+
+        yield key, value
+
+
+def generate(cc, flags, sources):
+    entries = {}
+
+    for source in sources:
+        for key, value in collect(cc, flags, source):
+            if entries.get(key, value) != value:
+                sys.exit(f"{source}: `{key}` is cached with two different results")
+
+            entries[key] = value
+
+    lines = [
+        f"// Generated by scripts/eval-cache.py from {', '.join(sources)}; do not edit.",
+        "//",
+        "// Regenerate it whenever the cached metaprograms, the macros they call, or Metalang99",
+        "// change.",
+        "",
+    ]
+    lines += [f"#define ML99_EVAL_CACHE_{key} ({value})" for key, value in sorted(entries.items())]
+
+    return "\n".join(lines) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Cache the results of ML99_EVAL_CACHED.")
+    parser.add_argument("sources", nargs="+", help="the files to evaluate")
+    parser.add_argument("-o", "--output", required=True, help="the cache header to write")
+    parser.add_argument("--cc", default=os.environ.get("CC", "gcc"), help="the compiler to use")
+    parser.add_argument("-I", dest="includes", action="append", default=[], help="include dir")
+    parser.add_argument("-D", dest="defines", action="append", default=[], help="macro definition")
+    parser.add_argument("--check", action="store_true", help="fail if the header is out of date")
+    args = parser.parse_args()
+
+    flags = [f"-I{d}" for d in args.includes] + [f"-D{d}" for d in args.defines]
+    header = generate(args.cc, flags, args.sources)
+
+    if args.check:
+        old = open(args.output).read() if os.path.exists(args.output) else None
+
+        if old != header:
+            sys.exit(f"{args.output} is out of date; run scripts/eval-cache.py without --check.")
+        return
+
+    with open(args.output, "w") as f:
+        f.write(header)
+
+
+if __name__ == "__main__":
+    main()
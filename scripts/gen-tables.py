@@ -0,0 +1,284 @@
+#!/usr/bin/env python3
+
+# Generate the lookup tables of `include/metalang99/nat/*.h`, `include/metalang99/bignat.h`, and
+# `include/metalang99/ident.h`, and the index selectors of `include/metalang99/variadics.h` and
+# `include/metalang99/tuple.h`.
+#
+# Only the tables are rewritten: each of them follows a `// Generated by scripts/gen-tables.py.`
+# line of a header and spans all the preprocessor directives and blank lines up to hand-written code
+# or the include guard, so that the rest of the header is kept intact.
+#
+# Usage: ./scripts/gen-tables.py [--check] [--nat-max 63,127,255]
+#
+#  --check    Do not write anything; fail if a header is out of date.
+#  --nat-max  The values that `ML99_NAT_MAX` can be configured to, each of 63, 127, and 255: the
+#             arithmetic wraps around by dropping the binary digits beyond the maximum, as selected
+#             by `ML99_PRIV_NAT_FROM_BITS_AUX` and `ML99_PRIV_NAT_MSB` of `nat/from_bits.h`.
+
+import argparse
+import os
+import re
+import sys
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+INCLUDE = os.path.join(ROOT, "include", "metalang99")
+
+MARKER = "// Generated by scripts/gen-tables.py.\n"
+NAT_MAX = "ML99_PRIV_NAT_MAX"
+
+C_KEYWORDS = [
+    "auto", "break", "case", "char", "const", "continue", "default", "do", "double", "else",
+    "enum", "extern", "float", "for", "goto", "if", "inline", "int", "long", "register",
+    "restrict", "return", "short", "signed", "sizeof", "static", "struct", "switch", "typedef",
+    "union", "unsigned", "void", "volatile", "while", "_Alignas", "_Alignof", "_Atomic", "_Bool",
+    "_Complex", "_Generic", "_Imaginary", "_Noreturn", "_Static_assert", "_Thread_local"]
+
+LOWERCASE = [chr(c) for c in range(ord("a"), ord("z") + 1)]
+UPPERCASE = [chr(c) for c in range(ord("A"), ord("Z") + 1)]
+DIGITS = [str(d) for d in range(10)]
+
+# The greatest index accepted by `ML99_variadicsGet` and `ML99_tupleGet`.
+GET_MAX = 63
+
+
+def block(defs):
+    width = max(len(name) for name, _ in defs)
+    return "".join(f"#define {name.ljust(width)} {value}".rstrip() + "\n" for name, value in defs)
+
+
+def blocks(*groups):
+    return "\n".join(block(defs) for defs in groups)
+
+
+# Natural numbers {
+
+# A table is a function from a maximum to a list of `(key, name, value)`. All the maximums share a
+# single header: the entries common to all of them are emitted first, and the rest is nested into
+# `#if` levels, from the smallest maximum to the largest one, so that a smaller maximum leaves most
+# of the table in skipped groups.
+def nat_levels(table, maxes, done=frozenset()):
+    entries = {m: {k: (n, v) for k, n, v in table(m) if k not in done} for m in maxes}
+    first = entries[maxes[0]]
+    common = [k for k in sorted(first) if all(entries[m].get(k) == first[k] for m in maxes)]
+
+    out = block([first[k] for k in common]) if common else ""
+    if len(maxes) == 1:
+        return out
+
+    done = done | set(common)
+    own = [k for k in sorted(first) if k not in done]
+    rest = nat_levels(table, maxes[1:], done)
+
+    if out:
+        out += "\n"
+    if own:
+        out += f"#if {NAT_MAX} == {maxes[0]}\n" + block([first[k] for k in own])
+        out += "#else\n" + rest + "#endif\n"
+    else:
+        out += f"#if {NAT_MAX} > {maxes[0]}\n" + rest + "#endif\n"
+    return out
+
+
+def nat_tables(*tables, maxes):
+    return "\n".join(nat_levels(table, maxes) for table in tables)
+
+
+def nat_inc(m):
+    return [(x, f"ML99_PRIV_INC_{x}", str((x + 1) % (m + 1))) for x in range(m + 1)]
+
+
+def nat_dec(m):
+    return [(x, f"ML99_PRIV_DEC_{x}", str((x - 1) % (m + 1))) for x in range(m + 1)]
+
+
+def nat_eq(m):
+    return [(x, f"ML99_PRIV_NAT_EQ_{x}_{x}", "()") for x in range(m + 1)]
+
+
+def nat_to_digits(m):
+    return [(x, f"ML99_PRIV_NAT_TO_DIGITS_{x}", f"{x // 100}, {x // 10 % 10}, {x % 10}")
+            for x in range(m + 1)]
+
+
+def nat_to_bits(m):
+    return [(x, f"ML99_PRIV_NAT_TO_BITS_{x}", ", ".join(str(x >> i & 1) for i in range(7, -1, -1)))
+            for x in range(m + 1)]
+
+
+def nat_from_bits(m):
+    return [(x, f"ML99_PRIV_NAT_FROM_BITS_{x:08b}", str(x)) for x in range(m + 1)]
+
+
+# `c, s1, s0` are the carry and the binary digits of `c + a1a0 + b1b0`, and `b, d1, d0` the borrow
+# and the binary digits of `a1a0 - c1c0 - b`.
+def nat_pairs(name, f):
+    return [(f"ML99_PRIV_NAT_{name}_PAIR_{c}_{a:02b}_{b:02b}", ", ".join(f(c, a, b)))
+            for c in range(2) for a in range(4) for b in range(4)]
+
+
+def nat_add_pairs():
+    return nat_pairs("ADD", lambda c, a, b: [str((c + a + b) >> 2), *f"{(c + a + b) % 4:02b}"])
+
+
+def nat_sub_pairs():
+    return nat_pairs("SUB", lambda b, a, c: [str(int(a - c - b < 0)), *f"{(a - c - b) % 4:02b}"])
+
+
+def big_nat_add_digits(c):
+    return [(f"ML99_PRIV_BIG_NAT_DIGIT_ADD_{c}_{a}_{b}", f"{(c + a + b) // 10}, {(c + a + b) % 10}")
+            for a in range(10) for b in range(10)]
+
+
+def big_nat_sub_digits(b):
+    return [(f"ML99_PRIV_BIG_NAT_DIGIT_SUB_{b}_{a}_{c}", f"{int(a < c + b)}, {(a - c - b) % 10}")
+            for a in range(10) for c in range(10)]
+
+
+def nat_max_check(maxes):
+    cond = " && ".join(f"ML99_NAT_MAX != {m}" for m in maxes)
+    names = [str(m) for m in maxes]
+    if len(names) > 1:
+        names = ", ".join(names[:-1]) + ("," if len(names) > 2 else "") + " or " + names[-1]
+    else:
+        names = names[0]
+    return (f"#ifdef ML99_NAT_MAX\n#if {cond}\n#error ML99_NAT_MAX must be {names}.\n#endif\n"
+            f"#define {NAT_MAX} ML99_NAT_MAX\n#else\n#define {NAT_MAX} {maxes[-1]}\n#endif\n")
+# } (Natural numbers)
+
+
+# Identifiers {
+
+def ident_detectors():
+    return blocks(
+        [(f"ML99_PRIV_C_KEYWORD_DETECTOR_{k}_{k}", "()") for k in C_KEYWORDS],
+        [("ML99_PRIV_UNDERSCORE_DETECTOR__", "()")],
+        [(f"ML99_PRIV_LOWER_DETECTOR_{c}_{c}", "()") for c in LOWERCASE],
+        [(f"ML99_PRIV_UPPER_DETECTOR_{c}_{c}", "()") for c in UPPERCASE],
+        [(f"ML99_PRIV_DIGIT_DETECTOR_{c}_{c}", "()") for c in DIGITS],
+        [(f"ML99_PRIV_CHAR_LIT_{c}", f"'{c}'") for c in LOWERCASE],
+        [(f"ML99_PRIV_CHAR_LIT_{c}", f"'{c}'") for c in UPPERCASE],
+        [(f"ML99_PRIV_CHAR_LIT_{c}", f"'{c}'") for c in DIGITS],
+        [("ML99_PRIV_CHAR_LIT__", "'_'")],
+        [(f"ML99_PRIV_CHAR_CLASS_{c}", "(lower)") for c in LOWERCASE],
+        [(f"ML99_PRIV_CHAR_CLASS_{c}", "(upper)") for c in UPPERCASE],
+        [(f"ML99_PRIV_CHAR_CLASS_{c}", "(digit)") for c in DIGITS],
+        [("ML99_PRIV_CHAR_CLASS__", "(underscore)")])
+# } (Identifiers)
+
+
+# Index selectors {
+
+# The arguments up to the 8th one are selected through the parameters of
+# `ML99_PRIV_VARIADICS_GET_AUX_i`, and the others by `ML99_PRIV_VARIADICS_GET_AT`.
+def variadics_get():
+    indices = range(GET_MAX + 1)
+    return blocks(
+        [(f"ML99_PRIV_variadicsGet_{i}(...)", f"ML99_call(ML99_PRIV_variadicsGet_{i}, __VA_ARGS__)")
+         for i in indices],
+        [(f"ML99_PRIV_variadicsGet_{i}_IMPL(...)", f"v(ML99_VARIADICS_GET({i})(__VA_ARGS__))")
+         for i in indices],
+        [(f"ML99_PRIV_VARIADICS_GET_{i}(...)",
+          f"ML99_PRIV_VARIADICS_GET_AUX_{i}(__VA_ARGS__, ~)" if i < 8
+          else f"ML99_PRIV_VARIADICS_GET_AT({i}, __VA_ARGS__)")
+         for i in indices])
+
+
+def tuple_get():
+    indices = range(GET_MAX + 1)
+    return blocks(
+        [(f"ML99_PRIV_tupleGet_{i}(x)", f"ML99_call(ML99_PRIV_tupleGet_{i}, x)") for i in indices],
+        [(f"ML99_PRIV_tupleGet_{i}_IMPL(x)", f"v(ML99_TUPLE_GET({i})(x))") for i in indices],
+        [(f"ML99_PRIV_TUPLE_GET_{i}(x)", f"ML99_VARIADICS_GET({i})(ML99_UNTUPLE(x))")
+         for i in indices])
+
+
+def get_arities(name):
+    return block([(f"ML99_PRIV_{name}_{i}_ARITY", "1") for i in range(GET_MAX + 1)])
+# } (Index selectors)
+
+
+# Replaces the region after the first `MARKER` that follows `pos` up to the first line that is
+# neither a preprocessor directive nor blank, trimmed of the trailing blank lines. Returns the new
+# text and the end of the region.
+def replace_region(text, filename, content, pos=0):
+    start = text.find(MARKER, pos)
+    if start == -1:
+        sys.exit(f"{filename}: no `{MARKER.strip()}` line")
+    start += len(MARKER)
+
+    end = start
+    for m in re.finditer(r".*\n", text[start:]):
+        line = m.group(0)
+        if line.strip() and not line.startswith("#"):
+            break
+        if line.startswith("#endif // ") or line.startswith("#ifndef DOXYGEN_IGNORE"):
+            break
+        end = start + m.end()
+    while text[start:end].endswith("\n\n"):
+        end -= 1
+
+    return text[:start] + content + text[end:], start + len(content)
+
+
+# Replaces the regions of a header with `contents`, one per `MARKER`, in order.
+def replace_regions(text, filename, contents):
+    if text.count(MARKER) != len(contents):
+        sys.exit(f"{filename}: expected {len(contents)} `{MARKER.strip()}` line(s)")
+
+    pos = 0
+    for content in contents:
+        text, pos = replace_region(text, filename, content, pos)
+    return text
+
+
+def generate(maxes):
+    return {
+        "nat/max.h": nat_max_check(maxes),
+        "nat/inc.h": nat_tables(nat_inc, maxes=maxes),
+        "nat/dec.h": nat_tables(nat_dec, maxes=maxes),
+        "nat/eq.h": nat_tables(nat_eq, maxes=maxes),
+        "nat/digits.h": nat_tables(nat_to_digits, maxes=maxes),
+        "nat/bits.h": nat_tables(nat_to_bits, maxes=maxes),
+        "nat/from_bits.h": nat_tables(nat_from_bits, maxes=maxes),
+        "nat/add.h": block(nat_add_pairs()),
+        "nat/sub.h": block(nat_sub_pairs()),
+        "bignat.h": blocks(*[big_nat_add_digits(c) for c in range(2)],
+                           *[big_nat_sub_digits(b) for b in range(2)]),
+        "ident.h": ident_detectors(),
+        "variadics.h": [variadics_get(), get_arities("variadicsGet")],
+        "tuple.h": [tuple_get(), get_arities("tupleGet")],
+    }
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--check", action="store_true")
+    parser.add_argument("--nat-max", default="63,127,255")
+    args = parser.parse_args()
+
+    maxes = sorted(int(m) for m in args.nat_max.split(","))
+    if not maxes or any(m not in [63, 127, 255] for m in maxes):
+        sys.exit("--nat-max: each maximum must be 63, 127, or 255")
+
+    outdated = []
+    for filename, contents in generate(maxes).items():
+        if isinstance(contents, str):
+            contents = [contents]
+
+        path = os.path.join(INCLUDE, filename)
+        with open(path) as f:
+            text = f.read()
+        new_text = replace_regions(text, filename, contents)
+        if new_text == text:
+            continue
+        outdated.append(filename)
+        if not args.check:
+            with open(path, "w") as f:
+                f.write(new_text)
+
+    if args.check and outdated:
+        sys.exit("Out of date (run scripts/gen-tables.py): " + ", ".join(outdated))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,36 @@
+#!/usr/bin/env python3
+
+# Print a `name:count` table of metafunction calls from the output of `ML99_EVAL_TRACE`.
+#
+# Usage: gcc -E -P -DML99_TRACE -Iinclude file.c | ./scripts/trace-histogram.py
+
+import re
+import sys
+from collections import Counter
+
+TRACE_LINE = re.compile(r"^\s*(\(\s*\w+\s*\)\s*)+$")
+TRACE_ENTRY = re.compile(r"\(\s*(\w+)\s*\)")
+
+
+def gather_calls(lines):
+    calls = Counter()
+
+    for line in lines:
+        if TRACE_LINE.match(line):
+            calls.update(TRACE_ENTRY.findall(line))
+
+    return calls
+
+
+def main():
+    calls = gather_calls(sys.stdin)
+    total = sum(calls.values())
+
+    for name, count in calls.most_common():
+        print(f"{name}:{count}")
+
+    print(f"total:{total}")
+
+
+if __name__ == "__main__":
+    main()
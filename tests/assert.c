@@ -1,4 +1,6 @@
 #include <metalang99/assert.h>
+#include <metalang99/logical.h>
+#include <metalang99/util.h>
 
 // This is used to check that `1 == 1` is put into parentheses automatically.
 #define COND 1 == 1
@@ -9,11 +11,21 @@ ML99_EVAL(ML99_assertEq(v(COND), v(COND)));
 ML99_ASSERT(v(COND));
 ML99_ASSERT_EQ(v(COND), v(COND));
 
+// Literal and non-literal operands can be mixed.
+ML99_ASSERT(ML99_true());
+ML99_ASSERT_EQ(ML99_not(v(0)), v(COND));
+ML99_ASSERT_EQ(v(COND), ML99_not(v(0)));
+ML99_ASSERT_EQ(ML99_not(v(0)), ML99_true());
+
+ML99_ASSERTS((v(COND)));
+ML99_ASSERTS((v(COND)), (ML99_true()), (ML99_not(v(0))));
+
 ML99_ASSERT_UNEVAL(COND);
 
 #undef COND
 
 ML99_ASSERT_EMPTY(v());
+ML99_ASSERT_EMPTY(ML99_empty());
 ML99_ASSERT_EMPTY_UNEVAL();
 
 int main(void) {}
@@ -0,0 +1,112 @@
+#include <metalang99/assert.h>
+#include <metalang99/bignat.h>
+#include <metalang99/util.h>
+
+#define BIG(...)  ML99_bigNatFromDigits(v(__VA_ARGS__))
+#define LIT(term) ML99_BIG_NAT_LIT(ML99_EVAL(term))
+
+int main(void) {
+
+    // ML99_bigNat, ML99_BIG_NAT, ML99_BIG_NAT_LIT {
+    {
+        ML99_ASSERT_UNEVAL(LIT(ML99_bigNat(v(0))) == 0);
+        ML99_ASSERT_UNEVAL(LIT(ML99_bigNat(v(7))) == 7);
+        ML99_ASSERT_UNEVAL(LIT(ML99_bigNat(v(40))) == 40);
+        ML99_ASSERT_UNEVAL(LIT(ML99_bigNat(v(255))) == 255);
+        ML99_ASSERT_UNEVAL(ML99_BIG_NAT_LIT(ML99_BIG_NAT(108)) == 108);
+    }
+    // }
+
+    // ML99_bigNatFromDigits {
+    {
+        ML99_ASSERT_UNEVAL(LIT(BIG(0)) == 0);
+        ML99_ASSERT_UNEVAL(LIT(BIG(0, 0, 0)) == 0);
+        ML99_ASSERT_UNEVAL(LIT(BIG(0, 0, 5)) == 5);
+        ML99_ASSERT_UNEVAL(LIT(BIG(1, 0, 2, 4)) == 1024);
+        ML99_ASSERT_UNEVAL(LIT(BIG(9, 8, 7, 6, 5, 4, 3, 2)) == 98765432);
+    }
+    // }
+
+    // ML99_bigNatInc, ML99_bigNatDec {
+    {
+        ML99_ASSERT_UNEVAL(LIT(ML99_bigNatInc(BIG(0))) == 1);
+        ML99_ASSERT_UNEVAL(LIT(ML99_bigNatInc(BIG(9))) == 10);
+        ML99_ASSERT_UNEVAL(LIT(ML99_bigNatInc(BIG(2, 5, 5))) == 256);
+        ML99_ASSERT_UNEVAL(LIT(ML99_bigNatInc(BIG(9, 9, 9, 9))) == 10000);
+        ML99_ASSERT_UNEVAL(LIT(ML99_bigNatInc(BIG(1, 2, 9, 9))) == 1300);
+
+        ML99_ASSERT_UNEVAL(LIT(ML99_bigNatDec(BIG(1))) == 0);
+        ML99_ASSERT_UNEVAL(LIT(ML99_bigNatDec(BIG(1, 0))) == 9);
+        ML99_ASSERT_UNEVAL(LIT(ML99_bigNatDec(BIG(2, 5, 6))) == 255);
+        ML99_ASSERT_UNEVAL(LIT(ML99_bigNatDec(BIG(1, 0, 0, 0, 0))) == 9999);
+        ML99_ASSERT_UNEVAL(LIT(ML99_bigNatDec(BIG(2, 0, 0, 0))) == 1999);
+    }
+    // }
+
+    // ML99_bigNatAdd {
+    {
+        ML99_ASSERT_UNEVAL(LIT(ML99_bigNatAdd(BIG(0), BIG(0))) == 0);
+        ML99_ASSERT_UNEVAL(LIT(ML99_bigNatAdd(BIG(1, 9), BIG(5))) == 24);
+        ML99_ASSERT_UNEVAL(LIT(ML99_bigNatAdd(BIG(5), BIG(1, 9))) == 24);
+        ML99_ASSERT_UNEVAL(LIT(ML99_bigNatAdd(BIG(2, 5, 5), BIG(2, 5, 5))) == 510);
+        ML99_ASSERT_UNEVAL(LIT(ML99_bigNatAdd(BIG(9, 9, 9), BIG(1))) == 1000);
+        ML99_ASSERT_UNEVAL(LIT(ML99_bigNatAdd(BIG(1), BIG(9, 9, 9, 9))) == 10000);
+        ML99_ASSERT_UNEVAL(LIT(ML99_bigNatAdd(BIG(1, 2, 3, 4), BIG(8, 7, 6, 6))) == 10000);
+        ML99_ASSERT_UNEVAL(LIT(ML99_bigNatAdd(BIG(4, 0, 9, 6), BIG(0))) == 4096);
+    }
+    // }
+
+    // ML99_bigNatSub {
+    {
+        ML99_ASSERT_UNEVAL(LIT(ML99_bigNatSub(BIG(0), BIG(0))) == 0);
+        ML99_ASSERT_UNEVAL(LIT(ML99_bigNatSub(BIG(5), BIG(5))) == 0);
+        ML99_ASSERT_UNEVAL(LIT(ML99_bigNatSub(BIG(1, 0, 0, 0), BIG(1))) == 999);
+        ML99_ASSERT_UNEVAL(LIT(ML99_bigNatSub(BIG(1, 0, 0, 0), BIG(9, 9, 9))) == 1);
+        ML99_ASSERT_UNEVAL(LIT(ML99_bigNatSub(BIG(1, 0, 0, 1), BIG(1, 0, 0, 0))) == 1);
+        ML99_ASSERT_UNEVAL(LIT(ML99_bigNatSub(BIG(1, 2, 3, 4), BIG(1, 2, 3, 4))) == 0);
+        ML99_ASSERT_UNEVAL(LIT(ML99_bigNatSub(BIG(5, 0, 3, 0), BIG(3, 0))) == 5000);
+        ML99_ASSERT_UNEVAL(LIT(ML99_bigNatSub(BIG(5, 0, 3, 0), BIG(4, 9, 8, 9))) == 41);
+    }
+    // }
+
+    // ML99_bigNatEq, ML99_bigNatLesser {
+    {
+        ML99_ASSERT(ML99_bigNatEq(BIG(0), BIG(0)));
+        ML99_ASSERT(ML99_bigNatEq(BIG(1, 0, 2, 4), BIG(1, 0, 2, 4)));
+        ML99_ASSERT(ML99_bigNatEq(BIG(0, 2, 5, 5), ML99_bigNat(v(255))));
+        ML99_ASSERT(ML99_not(ML99_bigNatEq(BIG(1, 0, 2, 4), BIG(1, 0, 2, 5))));
+        ML99_ASSERT(ML99_not(ML99_bigNatEq(BIG(1, 0, 2, 4), BIG(1, 0, 2))));
+        ML99_ASSERT(ML99_not(ML99_bigNatEq(BIG(1, 0, 2), BIG(1, 0, 2, 4))));
+
+        ML99_ASSERT(ML99_bigNatLesser(BIG(0), BIG(1)));
+        ML99_ASSERT(ML99_bigNatLesser(BIG(9, 9, 9), BIG(1, 0, 0, 0)));
+        ML99_ASSERT(ML99_bigNatLesser(BIG(1, 0, 2, 4), BIG(1, 0, 2, 5)));
+        ML99_ASSERT(ML99_bigNatLesser(BIG(5), BIG(1, 0, 0, 0, 0)));
+        ML99_ASSERT(ML99_not(ML99_bigNatLesser(BIG(1, 0, 0, 0), BIG(9, 9, 9))));
+        ML99_ASSERT(ML99_not(ML99_bigNatLesser(BIG(1, 0, 2, 4), BIG(1, 0, 2, 4))));
+        ML99_ASSERT(ML99_not(ML99_bigNatLesser(BIG(1, 0, 0, 0, 0), BIG(5))));
+    }
+    // }
+
+    // ML99_bigNatRepeat {
+    {
+#define F_IMPL(i) v(+ ML99_BIG_NAT_LIT(i))
+#define F_ARITY   1
+
+        ML99_ASSERT_UNEVAL((0 ML99_EVAL(ML99_bigNatRepeat(BIG(0), v(F)))) == 0);
+        ML99_ASSERT_UNEVAL((0 ML99_EVAL(ML99_bigNatRepeat(BIG(3), v(F)))) == 0 + 1 + 2);
+        ML99_ASSERT_UNEVAL((0 ML99_EVAL(ML99_bigNatRepeat(BIG(1, 0, 0, 0), v(F)))) == 499500);
+
+#undef F_IMPL
+#undef F_ARITY
+    }
+    // }
+
+    // ML99_bigNatTimes {
+    {
+        ML99_ASSERT_UNEVAL((0 ML99_EVAL(ML99_bigNatTimes(BIG(0), v(+1)))) == 0);
+        ML99_ASSERT_UNEVAL((0 ML99_EVAL(ML99_bigNatTimes(BIG(3), v(+1)))) == 3);
+        ML99_ASSERT_UNEVAL((0 ML99_EVAL(ML99_bigNatTimes(BIG(1, 2, 0, 0), v(+1)))) == 1200);
+    }
+    // }
+}
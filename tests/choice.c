@@ -37,6 +37,42 @@ int main(void) {
 #undef MATCH_FooB_IMPL
 #undef MATCH_FooC_IMPL
 
+#define MATCH_IMPL(foo, bar)            ML99_match2(v(foo), v(bar), v(MATCH_))
+#define MATCH_FooA_FooA_IMPL(x, y)      v(ML99_ASSERT_UNEVAL(x == 19 && y == 6))
+#define MATCH_FooA_FooB_IMPL(x, y, z)   v(ML99_ASSERT_UNEVAL(x == 19 && y == 1756 && z == 3))
+#define MATCH_FooB_FooC_IMPL(x, y, _)   v(ML99_ASSERT_UNEVAL(x == 1756 && y == 8))
+#define MATCH_FooC_FooC_IMPL(_, _other) v(ML99_ASSERT_UNEVAL(1))
+
+    // ML99_match2
+    {
+        ML99_EVAL(ML99_call(MATCH, ML99_choice(v(FooA), v(19)), ML99_choice(v(FooA), v(6))));
+        ML99_EVAL(ML99_call(MATCH, ML99_choice(v(FooA), v(19)), ML99_choice(v(FooB), v(1756, 3))));
+        ML99_EVAL(ML99_call(MATCH, ML99_choice(v(FooB), v(1756, 8)), ML99_choice(v(FooC), v(~))));
+        ML99_EVAL(ML99_call(MATCH, ML99_choice(v(FooC), v(~)), ML99_choice(v(FooC), v(~))));
+    }
+
+#undef MATCH_IMPL
+#undef MATCH_FooA_FooA_IMPL
+#undef MATCH_FooA_FooB_IMPL
+#undef MATCH_FooB_FooC_IMPL
+#undef MATCH_FooC_FooC_IMPL
+
+#define MATCH_IMPL(foo, bar)               ML99_match2WithArgs(v(foo), v(bar), v(MATCH_), v(3, 8))
+#define MATCH_FooA_FooB_IMPL(x, y, _3, _8)                                                         \
+    v(ML99_ASSERT_UNEVAL(x == 19 && y == 1756 && _3 == 3 && _8 == 8))
+#define MATCH_FooB_FooA_IMPL(x, y, _3, _8)                                                         \
+    v(ML99_ASSERT_UNEVAL(x == 1756 && y == 19 && _3 == 3 && _8 == 8))
+
+    // ML99_match2WithArgs
+    {
+        ML99_EVAL(ML99_call(MATCH, ML99_choice(v(FooA), v(19)), ML99_choice(v(FooB), v(1756))));
+        ML99_EVAL(ML99_call(MATCH, ML99_choice(v(FooB), v(1756)), ML99_choice(v(FooA), v(19))));
+    }
+
+#undef MATCH_IMPL
+#undef MATCH_FooA_FooB_IMPL
+#undef MATCH_FooB_FooA_IMPL
+
     // ML99_choiceTag
     { ML99_ASSERT_EQ(ML99_choiceTag(ML99_choice(v(5), v(1, 2, 3))), v(5)); }
 
@@ -1,6 +1,8 @@
 #include <metalang99/assert.h>
 #include <metalang99/control.h>
 #include <metalang99/logical.h>
+#include <metalang99/nat.h>
+#include <metalang99/variadics.h>
 
 int main(void) {
 
@@ -45,10 +47,21 @@ int main(void) {
         X(1516, 1, 9, 111, 119, 677, 62);
     }
 
-#undef X_IMPL
-#undef X_1_IMPL
-#undef X_2_IMPL
-#undef X_7_IMPL
+#undef X
+
+#define X(...) ML99_OVERLOAD_UPTO(8, X_, __VA_ARGS__)
+
+    // ML99_OVERLOAD_UPTO
+    {
+        X(123);
+        X(93145, 456);
+        X(1516, 1, 9, 111, 119, 677, 62);
+    }
+
+#undef X
+#undef X_1
+#undef X_2
+#undef X_7
 
 #define CHECK_EXPAND(args) CHECK(args)
 
@@ -56,19 +69,80 @@ int main(void) {
 #define F_IMPL(x)         v(, x)
 #define F_ARITY           1
 
+#define SUM_IMPL(x) v(+x)
+#define SUM_ARITY   1
+
     // ML99_repeat
-    { CHECK_EXPAND(ML99_EVAL(ML99_repeat(v(3), v(F)))); }
+    {
+        CHECK_EXPAND(ML99_EVAL(ML99_repeat(v(3), v(F))));
+
+        ML99_ASSERT_EMPTY(ML99_repeat(v(0), v(F)));
+
+        // More than one chunk of applications.
+        ML99_ASSERT_UNEVAL(ML99_VARIADICS_COUNT(ML99_EVAL(ML99_repeat(v(16), v(F)))) == 17);
+        ML99_ASSERT_UNEVAL(ML99_VARIADICS_COUNT(ML99_EVAL(ML99_repeat(v(40), v(F)))) == 41);
+        ML99_ASSERT_UNEVAL((0 ML99_EVAL(ML99_repeat(v(255), v(SUM)))) == 255 * 254 / 2);
+    }
 
 #undef CHECK
 #undef F_IMPL
 #undef F_ARITY
+#undef SUM_IMPL
+#undef SUM_ARITY
 
 #define CHECK(_, x, y, z) ML99_ASSERT_UNEVAL(x == 5 && y == 5 && z == 5)
 
     // ML99_times
-    { CHECK_EXPAND(ML99_EVAL(ML99_times(v(3), v(, 5)))); }
+    {
+        CHECK_EXPAND(ML99_EVAL(ML99_times(v(3), v(, 5))));
+
+        ML99_ASSERT_EMPTY(ML99_times(v(0), v(~)));
+        ML99_ASSERT_UNEVAL((0 ML99_EVAL(ML99_times(v(1), v(+1)))) == 1);
+        ML99_ASSERT_UNEVAL((0 ML99_EVAL(ML99_times(v(100), v(+1)))) == 100);
+        ML99_ASSERT_UNEVAL((0 ML99_EVAL(ML99_times(v(255), v(+1)))) == 255);
+    }
+
+#undef CHECK
+
+#define CHECK(x, y) ML99_ASSERT_UNEVAL(x == 5 && y == 6)
+
+#define FIB_IMPL(self, i)                                                                          \
+    ML99_IF(                                                                                       \
+        ML99_NAT_LESSER(i, 2),                                                                     \
+        v(i),                                                                                      \
+        ML99_add(                                                                                  \
+            ML99_appl(v(self), v(ML99_DEC(i))),                                                    \
+            ML99_appl(v(self), v(ML99_DEC(ML99_DEC(i))))))
+#define FIB_ARITY 2
+
+#define COUNT_IMPL(self, i)                                                                        \
+    ML99_IF(ML99_NAT_EQ(i, 0), v(0), ML99_inc(ML99_appl(v(self), v(ML99_DEC(i)))))
+#define COUNT_ARITY 2
+
+#define PAIR_IMPL(self, i) ML99_IF(ML99_NAT_EQ(i, 0), v(5, 6), ML99_appl(v(self), v(ML99_DEC(i))))
+#define PAIR_ARITY         2
+
+    // ML99_fixMemo
+    {
+        ML99_ASSERT_EQ(ML99_fixMemo(v(FIB), v(0)), v(0));
+        ML99_ASSERT_EQ(ML99_fixMemo(v(FIB), v(1)), v(1));
+        ML99_ASSERT_EQ(ML99_fixMemo(v(FIB), v(10)), v(55));
+        ML99_ASSERT_EQ(ML99_fixMemo(v(FIB), v(13)), v(233));
+
+        // The whole range of indices.
+        ML99_ASSERT_EQ(ML99_fixMemo(v(COUNT), v(255)), v(255));
+
+        // A result can contain commas.
+        CHECK_EXPAND(ML99_EVAL(ML99_fixMemo(v(PAIR), v(3))));
+    }
 
 #undef CHECK
+#undef FIB_IMPL
+#undef FIB_ARITY
+#undef COUNT_IMPL
+#undef COUNT_ARITY
+#undef PAIR_IMPL
+#undef PAIR_ARITY
 
 #undef CHECK_EXPAND
 }
@@ -0,0 +1,86 @@
+#include <metalang99/assert.h>
+#include <metalang99/div.h>
+#include <metalang99/maybe.h>
+#include <metalang99/tuple.h>
+
+int main(void) {
+
+    // ML99_div
+    {
+        ML99_ASSERT_EQ(ML99_div(v(15), v(1)), v(15));
+        ML99_ASSERT_EQ(ML99_div(v(15), v(15)), v(1));
+        ML99_ASSERT_EQ(ML99_div(v(45), v(3)), v(45 / 3));
+        ML99_ASSERT_EQ(ML99_div(v(ML99_NAT_MAX), v(5)), v(ML99_NAT_MAX / 5));
+        ML99_ASSERT_EQ(ML99_div(v(0), v(7)), v(0));
+        ML99_ASSERT_EQ(ML99_div(v(14), v(4)), v(14 / 4));
+        ML99_ASSERT_EQ(ML99_div(v(200), v(201)), v(0));
+        ML99_ASSERT_EQ(ML99_div(v(ML99_NAT_MAX), v(128)), v(1));
+    }
+
+    // ML99_divChecked
+    {
+        ML99_ASSERT(ML99_maybeEq(v(ML99_natEq), ML99_divChecked(v(15), v(1)), ML99_just(v(15))));
+        ML99_ASSERT(ML99_maybeEq(v(ML99_natEq), ML99_divChecked(v(15), v(15)), ML99_just(v(1))));
+        ML99_ASSERT(ML99_maybeEq(v(ML99_natEq), ML99_divChecked(v(45), v(3)), ML99_just(v(15))));
+        ML99_ASSERT(
+            ML99_maybeEq(v(ML99_natEq), ML99_divChecked(v(ML99_NAT_MAX), v(5)), ML99_just(v(51))));
+
+        ML99_ASSERT(ML99_maybeEq(v(ML99_natEq), ML99_divChecked(v(4), v(0)), ML99_nothing()));
+        ML99_ASSERT(ML99_maybeEq(v(ML99_natEq), ML99_divChecked(v(3), v(27)), ML99_nothing()));
+        ML99_ASSERT(ML99_maybeEq(v(ML99_natEq), ML99_divChecked(v(166), v(9)), ML99_nothing()));
+        ML99_ASSERT(ML99_maybeEq(v(ML99_natEq), ML99_divChecked(v(0), v(11)), ML99_nothing()));
+    }
+
+    // ML99_DIV_CHECKED
+    {
+        ML99_ASSERT(ML99_maybeEq(v(ML99_natEq), v(ML99_DIV_CHECKED(15, 1)), ML99_just(v(15))));
+        ML99_ASSERT(ML99_maybeEq(v(ML99_natEq), v(ML99_DIV_CHECKED(4, 0)), ML99_nothing()));
+    }
+
+    // ML99_mod
+    {
+        ML99_ASSERT_EQ(ML99_mod(v(0), v(1)), v(0 % 1));
+        ML99_ASSERT_EQ(ML99_mod(v(0), v(123)), v(0 % 123));
+
+        ML99_ASSERT_EQ(ML99_mod(v(1), v(28)), v(1 % 28));
+        ML99_ASSERT_EQ(ML99_mod(v(1), v(123)), v(1 % 123));
+
+        ML99_ASSERT_EQ(ML99_mod(v(1), v(1)), v(0));
+        ML99_ASSERT_EQ(ML99_mod(v(16), v(4)), v(0));
+        ML99_ASSERT_EQ(ML99_mod(v(ML99_NAT_MAX), v(ML99_NAT_MAX)), v(0));
+
+        ML99_ASSERT_EQ(ML99_mod(v(8), v(3)), v(8 % 3));
+        ML99_ASSERT_EQ(ML99_mod(v(10), v(4)), v(10 % 4));
+        ML99_ASSERT_EQ(ML99_mod(v(101), v(7)), v(101 % 7));
+
+        ML99_ASSERT_EQ(ML99_mod(v(13), v(14)), v(13 % 14));
+        ML99_ASSERT_EQ(ML99_mod(v(20), v(36)), v(20 % 36));
+        ML99_ASSERT_EQ(ML99_mod(v(16), v(ML99_NAT_MAX)), v(16 % ML99_NAT_MAX));
+    }
+
+    // ML99_divMod
+    {
+#define CHECK(x, y) CHECK_AUX(ML99_EVAL(ML99_divMod(v(x), v(y))), x, y)
+#define CHECK_AUX(...) CHECK_IMPL(__VA_ARGS__)
+#define CHECK_IMPL(q_r, x, y)                                                                      \
+    ML99_ASSERT_UNEVAL(ML99_TUPLE_GET(0)(q_r) == x / y && ML99_TUPLE_GET(1)(q_r) == x % y)
+
+        CHECK(0, 1);
+        CHECK(1, 1);
+        CHECK(14, 3);
+        CHECK(101, 7);
+        CHECK(13, 14);
+        CHECK(ML99_NAT_MAX, 2);
+        CHECK(ML99_NAT_MAX, ML99_NAT_MAX);
+
+#undef CHECK
+#undef CHECK_AUX
+#undef CHECK_IMPL
+    }
+
+    // ML99_div3
+    {
+        ML99_ASSERT_EQ(ML99_div3(v(30), v(2), v(3)), v(30 / 2 / 3));
+        ML99_ASSERT_EQ(ML99_div3(v(31), v(2), v(4)), v(31 / 2 / 4));
+    }
+}
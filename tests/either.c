@@ -1,7 +1,16 @@
 #include <metalang99/assert.h>
+#include <metalang99/control.h>
 #include <metalang99/either.h>
 #include <metalang99/nat.h>
 
+#define TRY_DEC_IMPL(x) ML99_IF(ML99_NAT_EQ(x, 0), ML99_left(v(x)), ML99_right(ML99_dec(v(x))))
+#define TRY_DEC_ARITY   1
+
+#define UNREACHABLE_IMPL(x) ML99_fatal(UNREACHABLE, must not be applied)
+#define UNREACHABLE_ARITY   1
+
+#define EITHER_NAT_EQ(either, other) ML99_eitherEq(v(ML99_natEq), either, other)
+
 int main(void) {
 
 #define MATCH_IMPL(either)  ML99_match(v(either), v(MATCH_))
@@ -63,4 +72,12 @@ int main(void) {
 
     // ML99_unwrapRight
     { ML99_ASSERT_EQ(ML99_unwrapRight(ML99_right(v(123))), v(123)); }
+
+    // ML99_eitherBind
+    {
+        ML99_ASSERT(EITHER_NAT_EQ(ML99_eitherBind(ML99_right(v(5)), v(TRY_DEC)), ML99_right(v(4))));
+        ML99_ASSERT(EITHER_NAT_EQ(ML99_eitherBind(ML99_right(v(0)), v(TRY_DEC)), ML99_left(v(0))));
+        ML99_ASSERT(
+            EITHER_NAT_EQ(ML99_eitherBind(ML99_left(v(123)), v(UNREACHABLE)), ML99_left(v(123))));
+    }
 }
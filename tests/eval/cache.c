@@ -0,0 +1,42 @@
+#include <metalang99/assert.h>
+#include <metalang99/lang.h>
+#include <metalang99/list.h>
+#include <metalang99/nat.h>
+
+// This file is built twice: with `ML99_EVAL_CACHE_HEADER` naming the cache written by
+// `scripts/eval-cache.py` from it, and without it.
+#ifdef ML99_EVAL_CACHE_HEADER
+#define CACHED 1
+#else
+#define CACHED 0
+#endif
+
+#define SQUARE_IMPL(x) ML99_mul(v(x), v(x))
+#define SQUARE_ARITY   1
+
+#define SQUARE_LIST ML99_listMap(v(SQUARE), ML99_list(v(0, 1, 2, 3, 4)))
+#define SQUARES     ML99_listUnwrapCommaSep(SQUARE_LIST)
+#define SQUARES_SUM ML99_listUnwrap(ML99_listIntersperse(v(+), SQUARE_LIST))
+
+static const int squares[] = {ML99_EVAL_CACHED(squares, SQUARES)};
+
+static const char greeting[] = ML99_EVAL_CACHED(greeting, v("Hello,  world!"));
+
+int main(void) {
+
+    // ML99_EVAL_IS_CACHED
+    {
+        ML99_ASSERT_UNEVAL(ML99_EVAL_IS_CACHED(squares) == CACHED);
+        ML99_ASSERT_UNEVAL(ML99_EVAL_IS_CACHED(greeting) == CACHED);
+        ML99_ASSERT_UNEVAL(ML99_EVAL_IS_CACHED(squaresSum) == CACHED);
+        ML99_ASSERT_UNEVAL(ML99_EVAL_IS_CACHED(neverCached) == 0);
+    }
+
+    // ML99_EVAL_CACHED
+    {
+        ML99_ASSERT_UNEVAL(sizeof squares / sizeof squares[0] == 5);
+        ML99_ASSERT_UNEVAL(ML99_EVAL_CACHED(sum, ML99_add(v(2), v(3))) == 5);
+        ML99_ASSERT_UNEVAL(ML99_EVAL_CACHED(squaresSum, SQUARES_SUM) == 0 + 1 + 4 + 9 + 16);
+        ML99_ASSERT_UNEVAL(sizeof greeting == sizeof "Hello,  world!");
+    }
+}
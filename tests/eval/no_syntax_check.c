@@ -0,0 +1,23 @@
+#define ML99_NO_SYNTAX_CHECK
+
+#include <metalang99/assert.h>
+#include <metalang99/lang.h>
+#include <metalang99/list.h>
+#include <metalang99/nat.h>
+
+#define F_IMPL(x, y) v(x + y)
+
+int main(void) {
+
+    // Well-formed metaprograms are evaluated as usual
+    {
+        ML99_ASSERT_EMPTY_UNEVAL(ML99_EVAL(v()));
+        ML99_ASSERT_EQ(ML99_call(F, v(1, 2)), v(1 + 2));
+        ML99_ASSERT_EQ(ML99_callUneval(F, 1, 2), v(1 + 2));
+        ML99_ASSERT_EQ(ML99_listLen(ML99_list(v(1, 2, 3))), v(3));
+        ML99_ASSERT(ML99_listEq(v(ML99_natEq), ML99_list(v(1, 2, 3)), ML99_list(v(1, 2, 3))));
+        ML99_ASSERT_UNEVAL(ML99_EVAL(ML99_call(F, ML99_abort(v(123)))) == 123);
+    }
+}
+
+#undef F_IMPL
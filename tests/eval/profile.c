@@ -0,0 +1,64 @@
+#define ML99_PROFILE
+
+#include <metalang99/assert.h>
+#include <metalang99/control.h>
+#include <metalang99/lang.h>
+#include <metalang99/list.h>
+#include <metalang99/nat.h>
+#include <metalang99/tuple.h>
+
+#define F_IMPL(x, y) v(x + y)
+#define G_IMPL(x)    v(x)
+#define G_ARITY      1
+
+int main(void) {
+
+    // ML99_EVAL_STEPS
+    {
+        ML99_ASSERT_UNEVAL(ML99_EVAL_STEPS(v(1)) == 1);
+
+        // Up to 8 consecutive values are folded in one step.
+        ML99_ASSERT_UNEVAL(ML99_EVAL_STEPS(v(1), v(2), v(3)) == 1);
+        ML99_ASSERT_UNEVAL(ML99_EVAL_STEPS(v(1), v(2), v(3), v(4), v(5), v(6), v(7), v(8)) == 1);
+        ML99_ASSERT_UNEVAL(
+            ML99_EVAL_STEPS(v(1), v(2), v(3), v(4), v(5), v(6), v(7), v(8), v(9)) == 2);
+
+        ML99_ASSERT_UNEVAL(ML99_EVAL_STEPS(ML99_callUneval(F, 1, 2)) == 2);
+        ML99_ASSERT_UNEVAL(ML99_EVAL_STEPS(v(abc ~ 123), ML99_callUneval(F, 1, 2)) == 3);
+
+        // If all the arguments are values, `ML99_call` is as cheap as `ML99_callUneval`.
+        ML99_ASSERT_UNEVAL(ML99_EVAL_STEPS(ML99_call(F, v(1, 2))) == 2);
+        ML99_ASSERT_UNEVAL(ML99_EVAL_STEPS(ML99_call(F, v(1), v(2))) == 2);
+        ML99_ASSERT_UNEVAL(ML99_EVAL_STEPS(ML99_call(F, v(1), ML99_callUneval(F, 2, 3))) == 6);
+    }
+
+    // Counters above 255
+    {
+        ML99_ASSERT_UNEVAL(ML99_EVAL_STEPS(ML99_repeat(v(200), v(G))) == 256 + 157);
+        ML99_ASSERT_UNEVAL(
+            ML99_EVAL_STEPS(ML99_listFoldl(v(ML99_add), v(0), ML99_list(v(1, 2, 3, 4, 5)))) <
+            ML99_EVAL_STEPS(ML99_listFoldl(v(ML99_add), v(0), ML99_list(v(1, 2, 3, 4, 5, 6)))));
+    }
+
+    // Results are the same as without profiling
+    {
+        ML99_ASSERT_EQ(ML99_call(F, v(1, 2)), v(3));
+        ML99_ASSERT_EQ(ML99_listFoldl(v(ML99_add), v(0), ML99_list(v(1, 2, 3, 4, 5))), v(15));
+        ML99_ASSERT_EQ(ML99_listLen(ML99_list(v(1, 2, 3))), v(3));
+        ML99_ASSERT_EMPTY(ML99_times(v(0), v(x)));
+
+        // A call is the last term of the arguments or the body of another call.
+        ML99_ASSERT(ML99_listEq(
+            v(ML99_natEq),
+            ML99_listTakeWhile(ML99_appl(v(ML99_greater), v(3)), ML99_list(v(1, 2, 3))),
+            ML99_list(v(1, 2))));
+        ML99_ASSERT_EQ(
+            ML99_listLen(ML99_tupleGet(1)(ML99_listPartition(
+                ML99_appl(v(ML99_greater), v(3)), ML99_list(v(1, 2, 3, 4, 5))))),
+            v(3));
+    }
+}
+
+#undef F_IMPL
+#undef G_IMPL
+#undef G_ARITY
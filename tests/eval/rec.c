@@ -22,4 +22,16 @@ ML99_ASSERT_UNEVAL(ML99_PRIV_REC_UNROLL(F(, 0)) == 678);
 #undef F_HOOK
 #undef XXXXXXXXXX
 
+#define F(i)          ML99_PRIV_IF(ML99_PRIV_NAT_EQ(i, 3), F_DONE, F_PROGRESS)(i)
+#define F_DONE(i)     ML99_PRIV_REC_CONTINUE(ML99_PRIV_REC_STOP)(~, i)
+#define F_PROGRESS(i) ML99_PRIV_REC_EMIT(F, i +)(ML99_PRIV_INC(i))
+#define F_HOOK()      F
+
+ML99_ASSERT_UNEVAL(ML99_PRIV_REC_UNROLL(F(0)) == 0 + 1 + 2 + 3);
+
+#undef F
+#undef F_DONE
+#undef F_PROGRESS
+#undef F_HOOK
+
 int main(void) {}
@@ -0,0 +1,37 @@
+#define ML99_REC_DEPTH 1
+
+#include <metalang99/assert.h>
+#include <metalang99/lang.h>
+#include <metalang99/nat.h>
+
+// Each `ML99_call(ITER, ...)` takes several reduction steps, so `ITER` over 2 * 256 iterations does
+// not fit into a single round of 1024 steps.
+#define ITER_IMPL(i, j)                                                                            \
+    ML99_PRIV_IF(                                                                                  \
+        ML99_PRIV_NAT_EQ(j, 0),                                                                    \
+        ML99_PRIV_IF(ML99_PRIV_NAT_EQ(i, 0), v(i), ML99_call(ITER, ML99_dec(v(i)), v(255))),       \
+        ML99_call(ITER, v(i), ML99_dec(v(j))))
+#define ITER_ARITY 2
+
+#define SUSPENDED ML99_EVAL(v(1 +), ML99_call(ITER, v(1, 255)), v(+1))
+
+// The state is a tuple, not the result.
+ML99_ASSERT_UNEVAL(ML99_PRIV_IS_TUPLE_FAST(SUSPENDED));
+ML99_ASSERT_UNEVAL(ML99_PRIV_IS_TUPLE_FAST(ML99_EVAL_RESUME(SUSPENDED)));
+
+// The results produced before the suspension are kept.
+ML99_ASSERT_UNEVAL(ML99_EVAL_RESUME(ML99_EVAL_RESUME(SUSPENDED)) == 2);
+
+// A metaprogram that is completed within one round is not affected.
+ML99_ASSERT_UNEVAL(ML99_EVAL(v(1 +), ML99_call(ITER, v(0, 3)), v(+1)) == 2);
+
+// `ML99_abort` after resumption.
+#define ABORT_IMPL(i)                                                                              \
+    ML99_PRIV_IF(ML99_PRIV_NAT_EQ(i, 0), ML99_abort(v(123)), ML99_call(ABORT, ML99_dec(v(i))))
+#define ABORT_ARITY 1
+
+#define SUSPENDED_ABORT ML99_EVAL(v(~), ML99_call(ITER, v(1, 255)), ML99_call(ABORT, v(5)))
+
+ML99_ASSERT_UNEVAL(ML99_EVAL_RESUME(ML99_EVAL_RESUME(SUSPENDED_ABORT)) == 123);
+
+int main(void) {}
@@ -0,0 +1,65 @@
+#define ML99_TRACE
+
+#include <metalang99/assert.h>
+#include <metalang99/lang.h>
+#include <metalang99/list.h>
+#include <metalang99/util.h>
+
+#define F_IMPL(x) ML99_call(G, v(x))
+#define G_IMPL(x) v(x)
+
+// A trace `(op1)(op2)...` is encoded as the integer `code(op1) + (code(op2) << 2) + ...`, so that
+// it is compared at compile-time, including the order and the number of its calls.
+#define CHECK(expected, ...)                                                                       \
+    ML99_ASSERT_UNEVAL(TRACE_CODE(ML99_EVAL_TRACE(__VA_ARGS__)) == TRACE_CODE(expected))
+
+#define TRACE_CODE(trace) (0 ML99_CAT(TRACE_0 trace, _END))
+#define TRACE_0(op)       +(TRACE_OP_##op << 0) TRACE_1
+#define TRACE_1(op)       +(TRACE_OP_##op << 2) TRACE_2
+#define TRACE_2(op)       +(TRACE_OP_##op << 4) TRACE_3
+#define TRACE_3(op)       +(TRACE_OP_##op << 6) TRACE_4
+#define TRACE_0_END
+#define TRACE_1_END
+#define TRACE_2_END
+#define TRACE_3_END
+#define TRACE_4_END
+#define TRACE_OP_F 1
+#define TRACE_OP_G 2
+
+int main(void) {
+
+    // ML99_EVAL_TRACE
+    {
+        CHECK(, v(1, 2, 3));
+        CHECK((F)(G), ML99_call(F, v(1)));
+        CHECK((F)(G), ML99_callUneval(F, 1));
+        CHECK((F)(G)(F)(G), ML99_call(F, v(1)), ML99_call(F, v(2)));
+        CHECK((G)(F)(G), ML99_call(F, ML99_call(G, v(1))));
+
+        ML99_ASSERT_UNEVAL(TRACE_CODE((F)(G)) != TRACE_CODE((G)(F)));
+        ML99_ASSERT_UNEVAL(TRACE_CODE((F)) != TRACE_CODE((F)(F)));
+    }
+
+    // ML99_TRACE implies ML99_PROFILE
+    {
+        ML99_ASSERT_UNEVAL(ML99_EVAL_STEPS(ML99_call(F, v(1))) == 3);
+        ML99_ASSERT_EQ(ML99_call(F, v(1)), v(1));
+        ML99_ASSERT_EQ(ML99_listLen(ML99_list(v(1, 2, 3))), v(3));
+    }
+}
+
+#undef F_IMPL
+#undef G_IMPL
+#undef CHECK
+#undef TRACE_CODE
+#undef TRACE_0
+#undef TRACE_1
+#undef TRACE_2
+#undef TRACE_3
+#undef TRACE_0_END
+#undef TRACE_1_END
+#undef TRACE_2_END
+#undef TRACE_3_END
+#undef TRACE_4_END
+#undef TRACE_OP_F
+#undef TRACE_OP_G
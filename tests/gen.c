@@ -18,6 +18,22 @@ static void
     (void)str;
 }
 
+#define TYPES_10 v(int, int, int, int, int, int, int, int, long long, const char *)
+
+static void test_indexed_params_variadics ML99_EVAL(ML99_indexedParamsVariadics(TYPES_10)) {
+    int i = _0 + _1 + _2 + _3 + _4 + _5 + _6 + _7;
+    long long ll = _8;
+    const char *str = _9;
+
+    (void)i;
+    (void)ll;
+    (void)str;
+}
+
+static int test_indexed_params_variadics_single ML99_EVAL(ML99_indexedParamsVariadics(v(int))) {
+    return _0;
+}
+
 int main(void) {
 
     // ML99_GEN_SYM
@@ -324,6 +340,37 @@ int main(void) {
         (void)str;
     }
 
+    // ML99_indexedParamsVariadics
+    {
+        ML99_ASSERT_UNEVAL(
+            ML99_TUPLE_COUNT(ML99_EVAL(ML99_indexedParamsVariadics(v(int, long, char)))) == 3);
+        ML99_ASSERT_UNEVAL(
+            ML99_TUPLE_COUNT(ML99_EVAL(ML99_indexedParamsVariadics(TYPES_10))) == 10);
+
+        (void)test_indexed_params_variadics;
+        (void)test_indexed_params_variadics_single;
+    }
+
+    // ML99_indexedFieldsVariadics
+    {
+        struct {
+            ML99_EVAL(ML99_indexedFieldsVariadics(TYPES_10))
+        } data = {0};
+
+        int i = data._0 + data._7;
+        long long ll = data._8;
+        const char *str = data._9;
+
+        struct {
+            ML99_EVAL(ML99_indexedFieldsVariadics(v(int)))
+        } single = {0};
+
+        (void)i;
+        (void)ll;
+        (void)str;
+        (void)single._0;
+    }
+
     // clang-format off
 
     // ML99_indexedInitializerList
@@ -374,7 +421,98 @@ int main(void) {
         assert(test.i == _0);
         assert(test.ll == _1);
         assert(test.str == _2);
+
+        ML99_ASSERT_UNEVAL(ML99_VARIADICS_COUNT(ML99_EVAL(ML99_indexedArgs(v(60)))) == 60);
+    }
+
+#define SQUARE(i)  ((i) * (i))
+#define CELL(i, j) ((i)*100 + (j))
+
+    // ML99_genArray
+    {
+        ML99_ASSERT_EMPTY(ML99_genArray(v(0), v(SQUARE)));
+
+        const int squares[] = ML99_EVAL(ML99_braced(ML99_genArray(v(4), v(SQUARE))));
+
+        assert(sizeof squares / sizeof squares[0] == 4);
+        assert(squares[0] == 0);
+        assert(squares[3] == 9);
+
+        const int many[] = ML99_EVAL(ML99_braced(ML99_genArray(v(200), v(SQUARE))));
+
+        assert(sizeof many / sizeof many[0] == 200);
+        assert(many[199] == 199 * 199);
     }
 
+    // ML99_genTable
+    {
+        ML99_ASSERT_EMPTY(ML99_genTable(v(0), v(3), v(CELL)));
+        ML99_ASSERT_EMPTY(ML99_genTable(v(3), v(0), v(CELL)));
+
+        const int table[] = ML99_EVAL(ML99_braced(ML99_genTable(v(30), v(50), v(CELL))));
+
+        assert(sizeof table / sizeof table[0] == 30 * 50);
+        assert(table[0] == 0);
+        assert(table[49] == 49);
+        assert(table[50] == 100);
+        assert(table[30 * 50 - 1] == 29 * 100 + 49);
+    }
+
+    // ML99_genArrayShard
+    {
+        ML99_ASSERT_EMPTY(ML99_genArrayShard(v(4), v(5), v(3), v(SQUARE)));
+
+        const int shards[] = {
+            ML99_EVAL(ML99_genArrayShard(v(0), v(3), v(200), v(SQUARE))),
+            ML99_EVAL(ML99_genArrayShard(v(1), v(3), v(200), v(SQUARE))),
+            ML99_EVAL(ML99_genArrayShard(v(2), v(3), v(200), v(SQUARE))),
+        };
+        const int whole[] = ML99_EVAL(ML99_braced(ML99_genArray(v(200), v(SQUARE))));
+
+        assert(sizeof shards == sizeof whole);
+        for (int i = 0; i < 200; i++) {
+            assert(shards[i] == whole[i]);
+        }
+
+        const int first[] = {ML99_EVAL(ML99_genArrayShard(v(0), v(3), v(200), v(SQUARE)))};
+        const int last[] = {ML99_EVAL(ML99_genArrayShard(v(2), v(3), v(200), v(SQUARE)))};
+
+        assert(sizeof first / sizeof first[0] == 67);
+        assert(sizeof last / sizeof last[0] == 66);
+        assert(last[0] == 134 * 134);
+
+        const int tail[] = {ML99_EVAL(ML99_genArrayShard(v(3), v(4), v(255), v(SQUARE)))};
+
+        assert(sizeof tail / sizeof tail[0] == 63);
+        assert(tail[62] == 254 * 254);
+    }
+
+    // ML99_genTableShard
+    {
+        ML99_ASSERT_EMPTY(ML99_genTableShard(v(1), v(2), v(1), v(3), v(CELL)));
+        ML99_ASSERT_EMPTY(ML99_genTableShard(v(0), v(2), v(3), v(0), v(CELL)));
+
+        const int shards[] = {
+            ML99_EVAL(ML99_genTableShard(v(0), v(4), v(30), v(50), v(CELL))),
+            ML99_EVAL(ML99_genTableShard(v(1), v(4), v(30), v(50), v(CELL))),
+            ML99_EVAL(ML99_genTableShard(v(2), v(4), v(30), v(50), v(CELL))),
+            ML99_EVAL(ML99_genTableShard(v(3), v(4), v(30), v(50), v(CELL))),
+        };
+        const int whole[] = ML99_EVAL(ML99_braced(ML99_genTable(v(30), v(50), v(CELL))));
+
+        assert(sizeof shards == sizeof whole);
+        for (int i = 0; i < 30 * 50; i++) {
+            assert(shards[i] == whole[i]);
+        }
+
+        const int second[] = {ML99_EVAL(ML99_genTableShard(v(1), v(4), v(30), v(50), v(CELL)))};
+
+        assert(sizeof second / sizeof second[0] == 8 * 50);
+        assert(second[0] == 8 * 100);
+    }
+
+#undef SQUARE
+#undef CELL
+
 // clang-format on
 }
@@ -1,6 +1,8 @@
 #include <metalang99/assert.h>
+#include <metalang99/choice.h>
 #include <metalang99/ident.h>
 #include <metalang99/logical.h>
+#include <metalang99/util.h>
 
 int main(void) {
 
@@ -380,6 +382,84 @@ int main(void) {
         ML99_ASSERT_UNEVAL(ML99_CHAR_LIT(_) == '_');
     }
 
+#define CLASS_lower_IMPL(x)      v(1)
+#define CLASS_upper_IMPL(x)      v(2)
+#define CLASS_digit_IMPL(x)      v(3)
+#define CLASS_underscore_IMPL(x) v(4)
+#define CLASS_other_IMPL(x)      v(5)
+
+    // ML99_charClass
+    {
+        ML99_ASSERT_EQ(ML99_match(ML99_charClass(v(a)), v(CLASS_)), v(1));
+        ML99_ASSERT_EQ(ML99_match(ML99_charClass(v(z)), v(CLASS_)), v(1));
+        ML99_ASSERT_EQ(ML99_match(ML99_charClass(v(A)), v(CLASS_)), v(2));
+        ML99_ASSERT_EQ(ML99_match(ML99_charClass(v(Z)), v(CLASS_)), v(2));
+        ML99_ASSERT_EQ(ML99_match(ML99_charClass(v(0)), v(CLASS_)), v(3));
+        ML99_ASSERT_EQ(ML99_match(ML99_charClass(v(9)), v(CLASS_)), v(3));
+        ML99_ASSERT_EQ(ML99_match(ML99_charClass(v(_)), v(CLASS_)), v(4));
+        ML99_ASSERT_EQ(ML99_match(ML99_charClass(v(kk)), v(CLASS_)), v(5));
+        ML99_ASSERT_EQ(ML99_match(ML99_charClass(v(0abc)), v(CLASS_)), v(5));
+    }
+
+#define CLASS_CHAR(choice)      CLASS_CHAR_AUX choice
+#define CLASS_CHAR_AUX(_tag, x) ML99_CHAR_LIT(x)
+#define CLASS_NUM(choice)       CLASS_NUM_AUX(ML99_CHOICE_TAG(choice))
+#define CLASS_NUM_AUX(tag)      ML99_CAT(CLASS_NUM_, tag)
+#define CLASS_NUM_lower         1
+#define CLASS_NUM_digit         3
+#define CLASS_NUM_other         5
+
+    // ML99_CHAR_CLASS
+    {
+        ML99_ASSERT_UNEVAL(CLASS_CHAR(ML99_CHAR_CLASS(q)) == 'q');
+        ML99_ASSERT_UNEVAL(CLASS_CHAR(ML99_CHAR_CLASS(_)) == '_');
+        ML99_ASSERT_UNEVAL(CLASS_NUM(ML99_CHAR_CLASS(v)) == 1);
+        ML99_ASSERT_UNEVAL(CLASS_NUM(ML99_CHAR_CLASS(7)) == 3);
+        ML99_ASSERT_UNEVAL(CLASS_NUM(ML99_CHAR_CLASS(xyz)) == 5);
+    }
+
+#define KIND_int    (type)
+#define KIND_double (type)
+#define KIND_if     (statement)
+
+#define KIND_type_IMPL(x)      v(1)
+#define KIND_statement_IMPL(x) v(2)
+#define KIND_other_IMPL(x)     v(3)
+
+    // ML99_identClassify
+    {
+        ML99_ASSERT_EQ(ML99_match(ML99_identClassify(v(KIND_), v(int)), v(KIND_)), v(1));
+        ML99_ASSERT_EQ(ML99_match(ML99_identClassify(v(KIND_), v(double)), v(KIND_)), v(1));
+        ML99_ASSERT_EQ(ML99_match(ML99_identClassify(v(KIND_), v(if)), v(KIND_)), v(2));
+        ML99_ASSERT_EQ(ML99_match(ML99_identClassify(v(KIND_), v(while)), v(KIND_)), v(3));
+    }
+
+    // ML99_IDENT_CLASSIFY
+    {
+        ML99_ASSERT_UNEVAL(CLASS_CHAR(ML99_IDENT_CLASSIFY(KIND_, 0)) == '0');
+        ML99_ASSERT_UNEVAL(CLASS_NUM(ML99_IDENT_CLASSIFY(KIND_, foo)) == 5);
+    }
+
+#undef CLASS_CHAR
+#undef CLASS_CHAR_AUX
+#undef CLASS_NUM
+#undef CLASS_NUM_AUX
+#undef CLASS_NUM_lower
+#undef CLASS_NUM_digit
+#undef CLASS_NUM_other
+#undef KIND_int
+#undef KIND_double
+#undef KIND_if
+#undef KIND_type_IMPL
+#undef KIND_statement_IMPL
+#undef KIND_other_IMPL
+
+#undef CLASS_lower_IMPL
+#undef CLASS_upper_IMPL
+#undef CLASS_digit_IMPL
+#undef CLASS_underscore_IMPL
+#undef CLASS_other_IMPL
+
 #define FST(...)        FST_AUX(__VA_ARGS__)
 #define FST_AUX(x, ...) x
 
@@ -0,0 +1,78 @@
+#include <metalang99/assert.h>
+#include <metalang99/ident.h>
+#include <metalang99/identset.h>
+#include <metalang99/logical.h>
+
+int main(void) {
+
+#define FOO_x_x ()
+#define FOO_y_y ()
+#define FOO_z_z ()
+
+#define SET ML99_identSetInsert(v(y), ML99_identSetInsert(v(x), ML99_identSet(v(FOO_))))
+
+    // ML99_identSet, ML99_identSetInsert, ML99_identSetLen, ML99_identSetItems
+    {
+        ML99_ASSERT_EQ(ML99_identSetLen(ML99_identSet(v(FOO_))), v(0));
+        ML99_ASSERT_EMPTY(ML99_identSetItems(ML99_identSet(v(FOO_))));
+
+        ML99_ASSERT_EQ(ML99_identSetLen(SET), v(2));
+        ML99_ASSERT_EQ(ML99_identSetLen(ML99_identSetInsert(v(x), SET)), v(2));
+        ML99_ASSERT_EQ(ML99_identSetLen(ML99_identSetInsert(v(z), SET)), v(3));
+        ML99_ASSERT(
+            ML99_identEq(v(FOO_), ML99_identSetItems(ML99_identSetRemove(v(x), SET)), v(y)));
+    }
+
+    // ML99_identSetContains, ML99_identSetRemove
+    {
+        ML99_ASSERT(ML99_not(ML99_identSetContains(v(x), ML99_identSet(v(FOO_)))));
+        ML99_ASSERT(ML99_identSetContains(v(x), SET));
+        ML99_ASSERT(ML99_identSetContains(v(y), SET));
+        ML99_ASSERT(ML99_not(ML99_identSetContains(v(z), SET)));
+
+        ML99_ASSERT(ML99_not(ML99_identSetContains(v(x), ML99_identSetRemove(v(x), SET))));
+        ML99_ASSERT(ML99_identSetContains(v(y), ML99_identSetRemove(v(x), SET)));
+        ML99_ASSERT_EQ(ML99_identSetLen(ML99_identSetRemove(v(z), SET)), v(2));
+        ML99_ASSERT_EQ(
+            ML99_identSetLen(ML99_identSetRemove(v(y), ML99_identSetRemove(v(x), SET))), v(0));
+    }
+
+#undef SET
+
+#define KEYWORDS                                                                                   \
+    ML99_identSetInsert(                                                                           \
+        v(void),                                                                                   \
+        ML99_identSetInsert(                                                                       \
+            v(return),                                                                             \
+            ML99_identSetInsert(                                                                   \
+                v(goto),                                                                           \
+                ML99_identSetInsert(                                                               \
+                    v(while),                                                                      \
+                    ML99_identSetInsert(                                                           \
+                        v(do),                                                                     \
+                        ML99_identSetInsert(                                                       \
+                            v(for),                                                                \
+                            ML99_identSetInsert(                                                   \
+                                v(else),                                                           \
+                                ML99_identSetInsert(                                               \
+                                    v(if),                                                         \
+                                    ML99_identSetInsert(                                           \
+                                        v(char),                                                   \
+                                        ML99_identSetInsert(                                       \
+                                            v(int),                                                \
+                                            ML99_identSet(v(ML99_C_KEYWORD_DETECTOR))))))))))))
+
+    // More than eight identifiers
+    {
+        ML99_ASSERT_EQ(ML99_identSetLen(KEYWORDS), v(10));
+        ML99_ASSERT_EQ(ML99_identSetLen(ML99_identSetInsert(v(void), KEYWORDS)), v(10));
+        ML99_ASSERT(ML99_identSetContains(v(int), KEYWORDS));
+        ML99_ASSERT(ML99_identSetContains(v(void), KEYWORDS));
+        ML99_ASSERT(ML99_not(ML99_identSetContains(v(static), KEYWORDS)));
+        ML99_ASSERT(
+            ML99_not(ML99_identSetContains(v(return), ML99_identSetRemove(v(return), KEYWORDS))));
+        ML99_ASSERT(ML99_identSetContains(v(void), ML99_identSetRemove(v(return), KEYWORDS)));
+    }
+
+#undef KEYWORDS
+}
@@ -37,6 +37,24 @@ int main(void) {
         ML99_ASSERT_EQ(ML99_callUneval(BAR, 5, 7), v(5 + 7));
     }
 
+#define BAZ_IMPL(x) ML99_TERMS(v(x), v(+1))
+
+    // Nested calls in argument positions, followed by other arguments or not
+    {
+        ML99_ASSERT_EQ(
+            ML99_call(
+                BAR,
+                ML99_call(BAR, v(1), v(2)),
+                ML99_call(BAR, v(3), ML99_call(BAR, v(4), v(5)))),
+            v(1 + 2 + 3 + 4 + 5));
+        ML99_ASSERT_EQ(
+            ML99_call(ML99_call(F, v(B), v(A), v(R)), v(1), ML99_call(BAZ, v(2))),
+            v(1 + 2 + 1));
+        ML99_ASSERT_EQ(ML99_call(BAR, ML99_call(BAZ, v(1)), ML99_call(BAZ, v(2))), v(1 + 1 + 2 + 1));
+    }
+
+#undef BAZ_IMPL
+
 #undef F_IMPL
 #undef BAR_IMPL
 
@@ -62,6 +80,46 @@ int main(void) {
 #undef OP_IMPL
 #undef ID_IMPL
 
+// Long sequences of values are evaluated in batches, which must not affect the result, either in
+// the argument position or not, and regardless of what follows a batch.
+#define F_IMPL(a, b, c, d, e, f, g, h, i, j) v(a##b##c##d##e##f##g##h##i##j)
+
+    ML99_ASSERT_EQ(
+        ML99_call(F, v(1), v(2), v(3), v(4), v(5), v(6), v(7), v(8), v(9), v(0)),
+        v(1234567890));
+    ML99_ASSERT_EQ(
+        ML99_call(
+            F,
+            v(1, 2, 3, 4),
+            v(5),
+            v(6),
+            ML99_callUneval(F, 7, , , , , , , , , ),
+            v(8),
+            v(9),
+            v(0)),
+        v(1234567890));
+    ML99_ASSERT_UNEVAL(
+        ML99_EVAL(v(1 +), v(2 +), v(3 +), v(4 +), v(5 +), v(6 +), v(7 +), v(8 +), v(9 +), v(10)) ==
+        55);
+
+#undef F_IMPL
+
+// The results of the top-level machine are emitted as they are computed, which must not affect
+// the output, including the commas inside results.
+#define F_IMPL(x) ML99_TERMS(v(x, ), ML99_call(G, v(x)))
+#define G_IMPL(x) v(x +)
+
+#define CHECK(...) CHECK_AUX(__VA_ARGS__)
+#define CHECK_AUX(a, b, c, d, e, f, g)                                                             \
+    ML99_ASSERT_UNEVAL(a == 1 && b == 2 && c == 3 && d == 3 && e == 7 && f == 5 && g == 1)
+
+    CHECK(ML99_EVAL(v(1, ), ML99_call(F, v(2)), v(1, ), ML99_call(F, v(3)), v(4, 5, ), v(1)));
+
+#undef F_IMPL
+#undef G_IMPL
+#undef CHECK
+#undef CHECK_AUX
+
     // ML99_abort
     {
         ML99_ASSERT_EMPTY(ML99_abort(v()));
@@ -82,6 +140,112 @@ int main(void) {
 
         // Ensure that `ML99_abort` immediately aborts interpretation even in an argument position.
         ML99_ASSERT_EQ(ML99_call(NonExistingF, ML99_abort(v(123))), v(123));
+
+// The results emitted by the top-level machine before `ML99_abort` must be discarded as well.
+#define F_IMPL(x) ML99_TERMS(v(~), ML99_call(G, v(x)))
+#define G_IMPL(x) v(x)
+
+        ML99_ASSERT_UNEVAL(
+            ML99_EVAL(v(~), ML99_call(F, v(~)), v(~), ML99_call(G, ML99_abort(v(123)))) == 123);
+        ML99_ASSERT_UNEVAL(
+            ML99_EVAL(ML99_call(F, v(~)), ML99_abort(ML99_call(F, v(~)), ML99_abort(v(123)))) ==
+            123);
+
+#undef F_IMPL
+#undef G_IMPL
+    }
+
+    // ML99_EVAL_STREAM
+    {
+#define F_IMPL(x) ML99_TERMS(v(x), v(+))
+#define G_IMPL(x) v(x)
+#define H_IMPL(x) v(x, )
+
+        ML99_ASSERT_UNEVAL(ML99_EVAL_STREAM(v(1)) == 1);
+        ML99_ASSERT_UNEVAL(ML99_EVAL_STREAM(v(1 +), ML99_call(F, v(2)), v(3)) == 6);
+
+        // Each term is evaluated independently, so `ML99_abort` aborts only the term it occurs in.
+        ML99_ASSERT_UNEVAL(
+            ML99_EVAL_STREAM(ML99_call(F, v(1)), ML99_call(G, ML99_abort(v(2 +))), v(3)) == 6);
+
+        // The commas inside results are kept.
+#define CHECK(...)         CHECK_AUX(__VA_ARGS__)
+#define CHECK_AUX(a, b, c) ML99_ASSERT_UNEVAL(a == 1 && b == 5 && c == 4)
+
+        CHECK(ML99_EVAL_STREAM(v(1, ), v(2 +), ML99_call(H, v(3)), v(4)));
+
+#undef CHECK
+#undef CHECK_AUX
+
+        // Exactly 63 terms.
+        ML99_ASSERT_UNEVAL(
+            ML99_EVAL_STREAM(
+                v(1 +), v(1 +), v(1 +), v(1 +), v(1 +), v(1 +), v(1 +), v(1 +), v(1 +), v(1 +),
+                v(1 +), v(1 +), v(1 +), v(1 +), v(1 +), v(1 +), v(1 +), v(1 +), v(1 +), v(1 +),
+                v(1 +), v(1 +), v(1 +), v(1 +), v(1 +), v(1 +), v(1 +), v(1 +), v(1 +), v(1 +),
+                v(1 +), v(1 +), v(1 +), v(1 +), v(1 +), v(1 +), v(1 +), v(1 +), v(1 +), v(1 +),
+                v(1 +), v(1 +), v(1 +), v(1 +), v(1 +), v(1 +), v(1 +), v(1 +), v(1 +), v(1 +),
+                v(1 +), v(1 +), v(1 +), v(1 +), v(1 +), v(1 +), v(1 +), v(1 +), v(1 +), v(1 +),
+                v(1 +), v(1 +), v(1)) == 63);
+
+#undef F_IMPL
+#undef G_IMPL
+#undef H_IMPL
+    }
+
+    // ML99_EVAL_MANY
+    {
+#define F_IMPL(x) ML99_TERMS(v(x), v(+))
+#define G_IMPL(x) v(x)
+
+        ML99_ASSERT_UNEVAL(ML99_EVAL_MANY((v(1))) == 1);
+        ML99_ASSERT_UNEVAL(ML99_EVAL_MANY((v(1 +), ML99_call(F, v(2)), v(3))) == 6);
+
+        // The results of each metaprogram are yielded separately, including the commas inside
+        // results.
+#define CHECK(results) CHECK_AUX(TUPLE_A results)
+#define CHECK_AUX(...) CHECK_IMPL(__VA_ARGS__)
+#define TUPLE_A(...)   __VA_ARGS__, TUPLE_B
+#define TUPLE_B(...)   __VA_ARGS__, TUPLE_C
+#define TUPLE_C(...)   __VA_ARGS__
+#define CHECK_IMPL(a, b, c, d, e)                                                                  \
+    ML99_ASSERT_UNEVAL(a == 1 && b == 5 && c == 4 && d == 3 && e == 6)
+
+        CHECK(ML99_EVAL_MANY(
+            (v(1, 2 +), v(3)),
+            (ML99_call(G, v(4)), v(, 3)),
+            (ML99_call(F, v(3)), v(3))));
+
+        // `ML99_abort` aborts only the metaprogram it occurs in.
+        CHECK(ML99_EVAL_MANY((v(1, 5)), (ML99_call(G, v(~)), ML99_abort(v(4, 3))), (v(6))));
+
+#undef CHECK
+#undef CHECK_AUX
+#undef TUPLE_A
+#undef TUPLE_B
+#undef TUPLE_C
+#undef CHECK_IMPL
+
+#undef F_IMPL
+#undef G_IMPL
+    }
+
+    // ML99_EVAL_WITH_FUEL
+    {
+#define F_IMPL(x) ML99_TERMS(v(x), v(+))
+#define G_IMPL(x) v(x)
+
+        ML99_ASSERT_UNEVAL(ML99_EVAL_WITH_FUEL(1, v(1)) == 1);
+        ML99_ASSERT_UNEVAL(ML99_EVAL_WITH_FUEL(100, v(1 +), ML99_call(F, v(2)), v(3)) == 6);
+        ML99_ASSERT_UNEVAL(ML99_EVAL_WITH_FUEL(100, v(~), ML99_abort(v(123)), v(~)) == 123);
+
+        // A metaprogram within the fuel is evaluated just as by `ML99_EVAL`.
+        ML99_ASSERT_UNEVAL(
+            ML99_EVAL_WITH_FUEL(1023, ML99_call(G, ML99_call(F, v(1))), ML99_call(F, v(2)), v(3)) ==
+            ML99_EVAL(ML99_call(G, ML99_call(F, v(1))), ML99_call(F, v(2)), v(3)));
+
+#undef F_IMPL
+#undef G_IMPL
     }
 
     // Partial application
@@ -116,6 +280,32 @@ int main(void) {
             ML99_ASSERT_EQ(ML99_appl4(v(F), v(10), v(5), v(7), v(8)), v(10578));
         }
 
+        // Several arguments applied to a closure at once
+        {
+            ML99_ASSERT_EQ(ML99_appl3(ML99_appl(v(F), v(10)), v(5), v(7), v(8)), v(10578));
+            ML99_ASSERT_EQ(ML99_appl2(ML99_appl2(v(F), v(10), v(5)), v(7), v(8)), v(10578));
+            ML99_ASSERT_EQ(
+                ML99_appl(ML99_appl2(ML99_appl(v(F), v(10)), v(5), v(7)), v(8)), v(10578));
+        }
+
+#define G_IMPL(a)    ML99_appl(v(F), v(a))
+#define H_IMPL(a, b) ML99_appl2(v(F), v(a), v(b))
+#define G_ARITY      1
+#define H_ARITY      2
+
+        // More arguments than the arity of a function that evaluates to a closure
+        {
+            ML99_ASSERT_EQ(ML99_appl4(v(G), v(10), v(5), v(7), v(8)), v(10578));
+            ML99_ASSERT_EQ(ML99_appl2(ML99_appl2(v(G), v(10), v(5)), v(7), v(8)), v(10578));
+            ML99_ASSERT_EQ(ML99_appl4(v(H), v(10), v(5), v(7), v(8)), v(10578));
+            ML99_ASSERT_EQ(ML99_appl(ML99_appl3(v(H), v(10), v(5), v(7)), v(8)), v(10578));
+        }
+
+#undef G_IMPL
+#undef H_IMPL
+#undef G_ARITY
+#undef H_ARITY
+
 #undef F_IMPL
 #undef F_ARITY
 
@@ -140,6 +330,21 @@ int main(void) {
     // ML99_compose
     { ML99_ASSERT_EQ(ML99_appl(ML99_compose(v(F), v(G)), v(3)), v((3 * 8) + 1)); }
 
+    // ML99_let
+    {
+        ML99_ASSERT_EQ(ML99_let(v(3), v(F)), v(3 + 1));
+        ML99_ASSERT_EQ(ML99_let(ML99_appl(v(G), v(3)), v(F)), v((3 * 8) + 1));
+        ML99_ASSERT_EQ(ML99_let(v(3), ML99_compose(v(F), v(G))), v((3 * 8) + 1));
+
+#define H_IMPL(a, x) v((a + x * x))
+#define H_ARITY      2
+
+        ML99_ASSERT_EQ(ML99_let(ML99_appl(v(F), v(2)), ML99_appl(v(H), v(1))), v(10));
+
+#undef H_IMPL
+#undef H_ARITY
+    }
+
 #undef F_IMPL
 #undef G_IMPL
 
@@ -1,5 +1,7 @@
 #include <metalang99/assert.h>
+#include <metalang99/div.h>
 #include <metalang99/list.h>
+#include <metalang99/maybe.h>
 #include <metalang99/nat.h>
 #include <metalang99/tuple.h>
 #include <metalang99/util.h>
@@ -26,6 +28,29 @@ int main(void) {
                             ML99_cons(v(5), ML99_cons(v(6), ML99_cons(v(7), ML99_nil())))))))));
     }
 
+#define ITEMS_1_TO_100                                                                             \
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, \
+        27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48,    \
+        49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70,    \
+        71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92,    \
+        93, 94, 95, 96, 97, 98, 99, 100
+
+    // ML99_list, ML99_sizedList with more than 63 items
+    {
+        ML99_ASSERT_EQ(ML99_listLen(ML99_list(v(ITEMS_1_TO_100))), v(100));
+        ML99_ASSERT_EQ(ML99_listLast(ML99_list(v(ITEMS_1_TO_100))), v(100));
+        ML99_ASSERT_EQ(ML99_listGet(v(64), ML99_list(v(ITEMS_1_TO_100))), v(65));
+
+        ML99_ASSERT_EQ(ML99_listLen(ML99_sizedList(v(ITEMS_1_TO_100))), v(100));
+        ML99_ASSERT_EQ(ML99_listGet(v(99), ML99_sizedList(v(ITEMS_1_TO_100))), v(100));
+
+        ML99_ASSERT(CMP_NATURALS(
+            ML99_listDrop(v(95), ML99_list(v(ITEMS_1_TO_100))),
+            ML99_list(v(96, 97, 98, 99, 100))));
+    }
+
+#undef ITEMS_1_TO_100
+
 #define F_IMPL(x, y) ML99_add(v(x), v(y))
 #define F_ARITY      1
 
@@ -119,10 +144,57 @@ int main(void) {
         ML99_ASSERT(ML99_not(ML99_listContains(v(ML99_natEq), v(187), ML99_list(v(1, 2, 3)))));
     }
 
+#define FOO_x_x ()
+#define FOO_y_y ()
+#define FOO_z_z ()
+
+    // ML99_listContainsNat, ML99_listContainsIdent
+    {
+        ML99_ASSERT(ML99_not(ML99_listContainsNat(v(1), ML99_nil())));
+        ML99_ASSERT(ML99_listContainsNat(v(1), ML99_list(v(1, 2, 3))));
+        ML99_ASSERT(ML99_listContainsNat(v(3), ML99_list(v(1, 2, 3))));
+        ML99_ASSERT(ML99_listContainsNat(v(9), ML99_list(v(1, 2, 3, 4, 5, 6, 7, 8, 9))));
+        ML99_ASSERT(ML99_not(ML99_listContainsNat(v(187), ML99_list(v(1, 2, 3, 4, 5, 6, 7, 8)))));
+        ML99_ASSERT(ML99_listContainsNat(v(2), ML99_sizedList(v(1, 2, 3))));
+        ML99_ASSERT(ML99_listContainsNat(v(9), ML99_range(v(0), v(10))));
+        ML99_ASSERT(ML99_not(ML99_listContainsNat(v(10), ML99_range(v(0), v(10)))));
+
+        ML99_ASSERT(ML99_not(ML99_listContainsIdent(v(FOO_), v(x), ML99_nil())));
+        ML99_ASSERT(ML99_listContainsIdent(v(FOO_), v(z), ML99_list(v(x, y, x, y, z))));
+        ML99_ASSERT(ML99_not(ML99_listContainsIdent(v(FOO_), v(z), ML99_list(v(x, y, x, y, x)))));
+    }
+
+#define KEYWORDS_EQ(list, other) ML99_listEqIdent(v(ML99_C_KEYWORD_DETECTOR), list, other)
+
+    // ML99_listDedup
+    {
+        ML99_ASSERT(ML99_isNil(ML99_listDedup(v(FOO_), ML99_nil())));
+        ML99_ASSERT(ML99_listEqIdent(
+            v(FOO_), ML99_listDedup(v(FOO_), ML99_list(v(x))), ML99_list(v(x))));
+        ML99_ASSERT(ML99_listEqIdent(
+            v(FOO_),
+            ML99_listDedup(v(FOO_), ML99_list(v(x, y, x, z, y, x))),
+            ML99_list(v(x, y, z))));
+
+        ML99_ASSERT(KEYWORDS_EQ(
+            ML99_listDedup(
+                v(ML99_C_KEYWORD_DETECTOR),
+                ML99_list(v(int, char, int, if, else, for, do, while, goto, return, for, break,
+                            int, void, break))),
+            ML99_list(v(int, char, if, else, for, do, while, goto, return, break, void))));
+    }
+
+#undef KEYWORDS_EQ
+
     // ML99_listUnwrap
     {
         ML99_ASSERT_EMPTY(ML99_listUnwrap(ML99_nil()));
         ML99_ASSERT_EQ(ML99_listUnwrap(ML99_list(v(18, +, 3, +, 6))), v(18 + 3 + 6));
+
+        // More than eight items.
+        ML99_ASSERT_EQ(
+            ML99_listUnwrap(ML99_list(v(1, +, 2, +, 3, +, 4, +, 5, +, 6, +, 7, +, 8, +, 9))),
+            v(45));
     }
 
     // ML99_LIST_EVAL
@@ -138,12 +210,21 @@ int main(void) {
     {
         ML99_ASSERT_EMPTY(ML99_listUnwrapCommaSep(ML99_nil()));
         CHECK_EXPAND(ML99_EVAL(ML99_listUnwrapCommaSep(ML99_list(v(1, 2, 3)))));
+
+        // More than eight items, some of them empty.
+        ML99_ASSERT_EQ(
+            ML99_variadicsCount(ML99_listUnwrapCommaSep(
+                ML99_list(v(1, 2, 3, 4, 5, 6, 7, 8, 9, , 11, 12, 13, 14, 15, 16, 17, )))),
+            v(18));
     }
 
     // ML99_LIST_EVAL_COMMA_SEP
     {
         ML99_ASSERT_EMPTY_UNEVAL(ML99_LIST_EVAL_COMMA_SEP(ML99_nil()));
         CHECK_EXPAND(ML99_EVAL(v(ML99_LIST_EVAL_COMMA_SEP(ML99_list(v(1, 2, 3))))));
+
+        ML99_ASSERT_UNEVAL(
+            ML99_VARIADICS_COUNT(ML99_LIST_EVAL_COMMA_SEP(ML99_listReplicate(v(20), v(~)))) == 20);
     }
 
 #undef CHECK
@@ -153,6 +234,9 @@ int main(void) {
         ML99_ASSERT(ML99_isNil(ML99_nil()));
         ML99_ASSERT(ML99_not(ML99_isNil(ML99_list(v(123)))));
         ML99_ASSERT(ML99_not(ML99_isNil(ML99_list(v(8, 214, 10, 0, 122)))));
+        ML99_ASSERT(ML99_not(ML99_isNil(ML99_sizedList(v(1, 2)))));
+        ML99_ASSERT(ML99_isNil(ML99_range(v(0), v(0))));
+        ML99_ASSERT(ML99_not(ML99_isNil(ML99_range(v(0), v(1)))));
     }
 
     // ML99_IS_NIL
@@ -167,6 +251,9 @@ int main(void) {
         ML99_ASSERT(ML99_not(ML99_isCons(ML99_nil())));
         ML99_ASSERT(ML99_isCons(ML99_list(v(123))));
         ML99_ASSERT(ML99_isCons(ML99_list(v(8, 214, 10, 0, 122))));
+        ML99_ASSERT(ML99_isCons(ML99_sizedList(v(1, 2))));
+        ML99_ASSERT(ML99_not(ML99_isCons(ML99_range(v(0), v(0)))));
+        ML99_ASSERT(ML99_isCons(ML99_range(v(0), v(1))));
     }
 
     // ML99_IS_CONS
@@ -227,6 +314,109 @@ int main(void) {
         ML99_ASSERT(CMP_NATURALS(ML99_listDrop(v(3), ML99_list(v(1, 2, 3))), ML99_nil()));
     }
 
+#define CMP_SIZED(lhs, rhs) CMP_NATURALS(ML99_listUnsized(lhs), rhs)
+#define SIZED_1_TO_10       ML99_sizedList(v(1, 2, 3, 4, 5, 6, 7, 8, 9, 10))
+
+    // ML99_sizedList, ML99_listSized, ML99_listUnsized, ML99_isSizedList
+    {
+        ML99_ASSERT(CMP_SIZED(ML99_sizedList(v(1)), ML99_list(v(1))));
+        ML99_ASSERT(CMP_SIZED(ML99_sizedList(v(1, 2, 3)), ML99_list(v(1, 2, 3))));
+        ML99_ASSERT(CMP_SIZED(ML99_listSized(ML99_list(v(1, 2, 3))), ML99_list(v(1, 2, 3))));
+        ML99_ASSERT(CMP_SIZED(ML99_listSized(ML99_sizedList(v(1, 2))), ML99_list(v(1, 2))));
+        ML99_ASSERT(CMP_SIZED(ML99_listSized(ML99_nil()), ML99_nil()));
+        ML99_ASSERT(CMP_SIZED(ML99_list(v(1, 2)), ML99_list(v(1, 2))));
+
+        ML99_ASSERT(ML99_isSizedList(ML99_sizedList(v(1, 2, 3))));
+        ML99_ASSERT(ML99_isSizedList(ML99_listSized(ML99_list(v(1, 2, 3)))));
+        ML99_ASSERT(ML99_not(ML99_isSizedList(ML99_list(v(1, 2, 3)))));
+        ML99_ASSERT(ML99_not(ML99_isSizedList(ML99_listSized(ML99_nil()))));
+        ML99_ASSERT(ML99_isCons(ML99_sizedList(v(1))));
+    }
+
+    // ML99_listLen, ML99_listGet, ML99_listTake, ML99_listDrop on sized lists
+    {
+        ML99_ASSERT_EQ(ML99_listLen(ML99_sizedList(v(1))), v(1));
+        ML99_ASSERT_EQ(ML99_listLen(SIZED_1_TO_10), v(10));
+
+        ML99_ASSERT_EQ(ML99_listGet(v(0), SIZED_1_TO_10), v(1));
+        ML99_ASSERT_EQ(ML99_listGet(v(5), SIZED_1_TO_10), v(6));
+        ML99_ASSERT_EQ(ML99_listGet(v(9), SIZED_1_TO_10), v(10));
+
+        ML99_ASSERT(CMP_SIZED(ML99_listTake(v(0), SIZED_1_TO_10), ML99_nil()));
+        ML99_ASSERT(CMP_SIZED(ML99_listTake(v(3), SIZED_1_TO_10), ML99_list(v(1, 2, 3))));
+        ML99_ASSERT(CMP_SIZED(ML99_listTake(v(200), ML99_sizedList(v(1, 2))), ML99_list(v(1, 2))));
+        ML99_ASSERT_EQ(ML99_listLen(ML99_listTake(v(7), SIZED_1_TO_10)), v(7));
+
+        ML99_ASSERT(CMP_SIZED(ML99_listDrop(v(0), ML99_sizedList(v(1, 2))), ML99_list(v(1, 2))));
+        ML99_ASSERT(CMP_SIZED(ML99_listDrop(v(7), SIZED_1_TO_10), ML99_list(v(8, 9, 10))));
+        ML99_ASSERT(CMP_SIZED(ML99_listDrop(v(10), SIZED_1_TO_10), ML99_nil()));
+        ML99_ASSERT(CMP_SIZED(ML99_listDrop(v(200), SIZED_1_TO_10), ML99_nil()));
+        ML99_ASSERT_EQ(ML99_listLen(ML99_listDrop(v(3), SIZED_1_TO_10)), v(7));
+
+        ML99_ASSERT(CMP_SIZED(
+            ML99_listDrop(v(2), ML99_listTake(v(5), SIZED_1_TO_10)),
+            ML99_list(v(3, 4, 5))));
+    }
+
+    // The other list functions on sized lists
+    {
+        ML99_ASSERT(CMP_NATURALS(ML99_sizedList(v(1, 2)), ML99_list(v(1, 2))));
+        ML99_ASSERT(CMP_NATURALS(ML99_list(v(1, 2)), ML99_sizedList(v(1, 2))));
+        ML99_ASSERT(CMP_NATURALS(ML99_sizedList(v(1, 2)), ML99_sizedList(v(1, 2))));
+        ML99_ASSERT(ML99_not(CMP_NATURALS(ML99_sizedList(v(1, 2)), ML99_nil())));
+        ML99_ASSERT(ML99_not(CMP_NATURALS(ML99_sizedList(v(1, 2)), ML99_list(v(1, 3)))));
+        ML99_ASSERT(ML99_listEqNat(ML99_sizedList(v(1, 2)), ML99_list(v(1, 2))));
+        ML99_ASSERT(ML99_listEqNat(
+            ML99_list(v(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10)),
+            ML99_cons(v(0), SIZED_1_TO_10)));
+        ML99_ASSERT(ML99_not(ML99_listEqNat(ML99_nil(), ML99_sizedList(v(1)))));
+
+        ML99_ASSERT_EQ(ML99_listHead(SIZED_1_TO_10), v(1));
+        ML99_ASSERT(CMP_NATURALS(ML99_listTail(ML99_sizedList(v(1, 2))), ML99_list(v(2))));
+        ML99_ASSERT_EQ(ML99_listLast(SIZED_1_TO_10), v(10));
+        ML99_ASSERT(CMP_NATURALS(ML99_listInit(ML99_sizedList(v(1, 2))), ML99_list(v(1))));
+
+        ML99_ASSERT(CMP_NATURALS(
+            ML99_listMap(v(ML99_inc), ML99_sizedList(v(1, 2, 3, 4, 5))),
+            ML99_list(v(2, 3, 4, 5, 6))));
+        ML99_ASSERT(CMP_NATURALS(
+            ML99_listMap(v(ML99_inc), ML99_cons(v(0), ML99_sizedList(v(1, 2)))),
+            ML99_list(v(1, 2, 3))));
+        ML99_ASSERT(CMP_NATURALS(
+            ML99_listMapI(v(ML99_add), ML99_sizedList(v(1, 2, 3))),
+            ML99_list(v(1, 3, 5))));
+        ML99_ASSERT(CMP_NATURALS(
+            ML99_listFilter(ML99_appl(v(ML99_lesser), v(7)), SIZED_1_TO_10),
+            ML99_list(v(8, 9, 10))));
+
+        ML99_ASSERT(CMP_NATURALS(
+            ML99_listReverse(ML99_sizedList(v(1, 2, 3))),
+            ML99_list(v(3, 2, 1))));
+        ML99_ASSERT(CMP_NATURALS(
+            ML99_listAppend(ML99_sizedList(v(1, 2)), ML99_sizedList(v(3))),
+            ML99_list(v(1, 2, 3))));
+        ML99_ASSERT_EQ(ML99_listFoldr(v(ML99_sub), v(0), ML99_sizedList(v(5, 3))), v(5 - 3));
+        ML99_ASSERT_EQ(ML99_listFoldl1(v(ML99_add), ML99_sizedList(v(1, 2, 3))), v(6));
+        ML99_ASSERT(CMP_NATURALS(
+            ML99_listSortNat(ML99_sizedList(v(3, 1, 2))),
+            ML99_list(v(1, 2, 3))));
+        ML99_ASSERT(ML99_listContains(v(ML99_natEq), v(3), ML99_sizedList(v(1, 2, 3))));
+        ML99_ASSERT_EQ(
+            ML99_listLen(ML99_listZip(ML99_sizedList(v(1, 2, 3)), ML99_list(v(3, 4)))),
+            v(2));
+
+        ML99_ASSERT_EQ(ML99_listUnwrap(ML99_sizedList(v(1, +, 2))), v(1 + 2));
+        ML99_ASSERT_EQ(
+            ML99_listUnwrap(ML99_cons(v(1), ML99_sizedList(v(+, 2, -, 3)))),
+            v(1 + 2 - 3));
+        ML99_ASSERT_EQ(
+            ML99_call(ML99_add, ML99_listUnwrapCommaSep(ML99_listTake(v(2), SIZED_1_TO_10))),
+            v(3));
+    }
+
+#undef SIZED_1_TO_10
+#undef CMP_SIZED
+
     // ML99_listDropWhile
     {
         ML99_ASSERT(ML99_listEq(
@@ -298,6 +488,20 @@ int main(void) {
         ML99_ASSERT(CMP_NATURALS(ML99_tupleGet(0)(UNZIPPED), ML99_list(v(1, 2))));
         ML99_ASSERT(CMP_NATURALS(ML99_tupleGet(1)(UNZIPPED), ML99_list(v(4, 5))));
 
+#undef UNZIPPED
+
+#define UNZIPPED                                                                                   \
+    ML99_listUnzip(ML99_listZip(                                                                   \
+        ML99_list(v(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11)),                                           \
+        ML99_list(v(12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22))))
+
+        ML99_ASSERT(CMP_NATURALS(
+            ML99_tupleGet(0)(UNZIPPED),
+            ML99_list(v(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11))));
+        ML99_ASSERT(CMP_NATURALS(
+            ML99_tupleGet(1)(UNZIPPED),
+            ML99_list(v(12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22))));
+
 #undef UNZIPPED
     }
 
@@ -313,6 +517,32 @@ int main(void) {
         ML99_ASSERT(ML99_not(CMP_NATURALS(ML99_list(v(0, 5, 6, 6)), ML99_list(v(6, 7)))));
     }
 
+    // ML99_listEqNat, ML99_listEqIdent
+    {
+        ML99_ASSERT(ML99_listEqNat(ML99_nil(), ML99_nil()));
+        ML99_ASSERT(ML99_not(ML99_listEqNat(ML99_nil(), ML99_list(v(25, 88, 1)))));
+        ML99_ASSERT(ML99_not(ML99_listEqNat(ML99_list(v(25, 88, 1)), ML99_nil())));
+
+        ML99_ASSERT(ML99_listEqNat(ML99_list(v(1, 2, 3)), ML99_list(v(1, 2, 3))));
+        ML99_ASSERT(ML99_listEqNat(
+            ML99_list(v(1, 2, 3, 4, 5, 6, 7, 8, 9)),
+            ML99_list(v(1, 2, 3, 4, 5, 6, 7, 8, 9))));
+        ML99_ASSERT(ML99_not(ML99_listEqNat(
+            ML99_list(v(1, 2, 3, 4, 5, 6, 7, 8, 9)),
+            ML99_list(v(1, 2, 3, 4, 5, 6, 7, 8, 0)))));
+        ML99_ASSERT(
+            ML99_not(ML99_listEqNat(ML99_list(v(1, 2, 3, 4)), ML99_list(v(1, 2, 3, 4, 5)))));
+        ML99_ASSERT(
+            ML99_not(ML99_listEqNat(ML99_list(v(1, 2, 3, 4, 5)), ML99_list(v(1, 2, 3, 4)))));
+
+        ML99_ASSERT(ML99_listEqIdent(v(FOO_), ML99_list(v(x, y, z)), ML99_list(v(x, y, z))));
+        ML99_ASSERT(ML99_not(ML99_listEqIdent(v(FOO_), ML99_list(v(x, y, z)), ML99_list(v(x, z)))));
+    }
+
+#undef FOO_x_x
+#undef FOO_y_y
+#undef FOO_z_z
+
     // ML99_listAppl
     {
         ML99_ASSERT_EQ(ML99_call(ML99_listAppl(v(ML99_add), ML99_nil()), v(6, 9)), v(6 + 9));
@@ -351,6 +581,20 @@ int main(void) {
     {
         ML99_ASSERT_EQ(ML99_listFoldl(v(ML99_cat), v(7), ML99_nil()), v(7));
         ML99_ASSERT(ML99_listFoldl(v(ML99_cat), v(A), ML99_list(v(BC, DEF, G))));
+        ML99_ASSERT(
+            ML99_listFoldl(ML99_appl(v(ML99_flip), v(ML99_cat)), v(G), ML99_list(v(DEF, BC, A))));
+
+        ML99_ASSERT_EQ(ML99_listFoldl(v(ML99_add), v(0), ML99_list(v(1, 2, 3, 4))), v(10));
+        ML99_ASSERT_EQ(
+            ML99_listFoldl(v(ML99_add), v(0), ML99_list(v(1, 2, 3, 4, 5, 6, 7, 8, 9))),
+            v(45));
+        ML99_ASSERT_EQ(ML99_listFoldl(v(ML99_sub), v(20), ML99_list(v(1, 2, 3, 4, 5))), v(5));
+        ML99_ASSERT_EQ(
+            ML99_listFoldl(ML99_appl(v(ML99_flip), v(ML99_sub)), v(1), ML99_list(v(5, 9))),
+            v(5));
+        ML99_ASSERT_EQ(
+            ML99_listFoldl(v(ML99_add), v(1), ML99_sizedList(v(1, 2, 3, 4, 5, 6))),
+            v(22));
     }
 
     // ML99_listFoldl1
@@ -366,6 +610,10 @@ int main(void) {
             v(ML99_natEq),
             ML99_listMap(ML99_appl(v(ML99_add), v(3)), ML99_list(v(1, 2, 3))),
             ML99_list(v(4, 5, 6))));
+        ML99_ASSERT(ML99_listEq(
+            v(ML99_natEq),
+            ML99_listMap(v(ML99_inc), ML99_list(v(1, 2, 3, 4, 5, 6, 7, 8, 9))),
+            ML99_list(v(2, 3, 4, 5, 6, 7, 8, 9, 10))));
     }
 
 #define A0 19
@@ -477,6 +725,36 @@ int main(void) {
             ML99_list(v(14, 7, 65))));
     }
 
+    // ML99_listFilterInPlace
+    {
+        ML99_ASSERT_EMPTY(ML99_listFilterInPlace(v(NonExistingF), ML99_nil()));
+        ML99_ASSERT_EMPTY(
+            ML99_listFilterInPlace(ML99_appl(v(ML99_lesser), v(5)), ML99_list(v(1, 0, 4))));
+        ML99_ASSERT_EQ(
+            ML99_listFilterInPlace(ML99_appl(v(ML99_lesser), v(5)), ML99_list(v(1, 9, 0))),
+            v(9));
+        ML99_ASSERT_EQ(
+            ML99_listFilterInPlace(v(ML99_isUntuple), ML99_list(v(+1, (~), +2, (~), +4))),
+            v(7));
+    }
+
+#define F_IMPL(x) ML99_if(ML99_natEq(v(x), v(0)), ML99_nothing(), ML99_just(ML99_dec(v(x))))
+#define F_ARITY   1
+
+    // ML99_listFilterMap
+    {
+        ML99_ASSERT(CMP_NATURALS(ML99_listFilterMap(v(NonExistingF), ML99_nil()), ML99_nil()));
+        ML99_ASSERT(CMP_NATURALS(ML99_listFilterMap(v(F), ML99_list(v(0, 0))), ML99_nil()));
+        ML99_ASSERT(
+            CMP_NATURALS(ML99_listFilterMap(v(F), ML99_list(v(1, 0, 3, 0))), ML99_list(v(0, 2))));
+        ML99_ASSERT(CMP_NATURALS(
+            ML99_listFilterMap(ML99_appl(v(ML99_const), ML99_just(v(5))), ML99_list(v(1, 2, 3))),
+            ML99_list(v(5, 5, 5))));
+    }
+
+#undef F_IMPL
+#undef F_ARITY
+
     // ML99_listReplicate
     {
         ML99_ASSERT(CMP_NATURALS(ML99_listReplicate(v(0), v(~)), ML99_nil()));
@@ -526,5 +804,263 @@ int main(void) {
 
 #undef PARTITIONED
         }
+
+        // More than a chunk of items
+        {
+#define PARTITIONED                                                                                \
+    ML99_listPartition(                                                                            \
+        ML99_appl(v(ML99_greater), v(10)),                                                         \
+        ML99_list(v(11, 1, 12, 2, 13, 3, 14, 4, 15, 5, 16, 6, 17, 7, 18, 8, 19, 9, 20)))
+
+            ML99_ASSERT(CMP_NATURALS(
+                ML99_tupleGet(0)(PARTITIONED),
+                ML99_list(v(1, 2, 3, 4, 5, 6, 7, 8, 9))));
+            ML99_ASSERT(CMP_NATURALS(
+                ML99_tupleGet(1)(PARTITIONED),
+                ML99_list(v(11, 12, 13, 14, 15, 16, 17, 18, 19, 20))));
+
+#undef PARTITIONED
+        }
+    }
+
+    // ML99_listPartitionBy
+    {
+#define F ML99_appl(ML99_flip(v(ML99_mod)), v(3))
+
+        ML99_ASSERT(
+            CMP_NATURALS(ML99_tupleGet(0)(ML99_listPartitionBy(v(1), F, ML99_nil())), ML99_nil()));
+
+        // The items of the same list keep their order
+        {
+#define PARTITIONED ML99_listPartitionBy(v(3), F, ML99_list(v(1, 2, 3, 4, 5, 6, 7, 8, 9, 10)))
+
+            ML99_ASSERT_EQ(ML99_tupleCount(PARTITIONED), v(3));
+            ML99_ASSERT(CMP_NATURALS(ML99_tupleGet(0)(PARTITIONED), ML99_list(v(3, 6, 9))));
+            ML99_ASSERT(CMP_NATURALS(ML99_tupleGet(1)(PARTITIONED), ML99_list(v(1, 4, 7, 10))));
+            ML99_ASSERT(CMP_NATURALS(ML99_tupleGet(2)(PARTITIONED), ML99_list(v(2, 5, 8))));
+
+#undef PARTITIONED
+        }
+
+        // Some lists are empty
+        {
+#define PARTITIONED ML99_listPartitionBy(v(5), F, ML99_list(v(2, 5, 8)))
+
+            ML99_ASSERT_EQ(ML99_tupleCount(PARTITIONED), v(5));
+            ML99_ASSERT(CMP_NATURALS(ML99_tupleGet(0)(PARTITIONED), ML99_nil()));
+            ML99_ASSERT(CMP_NATURALS(ML99_tupleGet(1)(PARTITIONED), ML99_nil()));
+            ML99_ASSERT(CMP_NATURALS(ML99_tupleGet(2)(PARTITIONED), ML99_list(v(2, 5, 8))));
+            ML99_ASSERT(CMP_NATURALS(ML99_tupleGet(4)(PARTITIONED), ML99_nil()));
+
+#undef PARTITIONED
+        }
+
+#undef F
+    }
+
+    // ML99_listSort, ML99_listSortNat
+    {
+        ML99_ASSERT(CMP_NATURALS(ML99_listSort(v(ML99_lesser), ML99_nil()), ML99_nil()));
+        ML99_ASSERT(CMP_NATURALS(ML99_listSort(v(ML99_lesser), ML99_list(v(7))), ML99_list(v(7))));
+        ML99_ASSERT(CMP_NATURALS(
+            ML99_listSort(v(ML99_lesser), ML99_list(v(5, 1, 8, 3, 2, 8, 0))),
+            ML99_list(v(0, 1, 2, 3, 5, 8, 8))));
+        ML99_ASSERT(CMP_NATURALS(
+            ML99_listSort(v(ML99_greater), ML99_list(v(5, 1, 8, 3, 2, 8, 0))),
+            ML99_list(v(8, 8, 5, 3, 2, 1, 0))));
+
+        ML99_ASSERT(CMP_NATURALS(ML99_listSortNat(ML99_nil()), ML99_nil()));
+        ML99_ASSERT(CMP_NATURALS(ML99_listSortNat(ML99_list(v(7))), ML99_list(v(7))));
+        ML99_ASSERT(CMP_NATURALS(
+            ML99_listSortNat(ML99_list(v(5, 1, 8, 3, 2, 8, 0))),
+            ML99_list(v(0, 1, 2, 3, 5, 8, 8))));
+    }
+
+    // ML99_listSort keeps equal items in their original order
+    {
+#define BY_KEY_IMPL(x, y) ML99_lesser(v(ML99_TUPLE_GET(0)(x)), v(ML99_TUPLE_GET(0)(y)))
+#define BY_KEY_ARITY      2
+#define TAG_IMPL(x)       v(ML99_TUPLE_GET(1)(x))
+#define TAG_ARITY         1
+
+        ML99_ASSERT(CMP_NATURALS(
+            ML99_listMap(
+                v(TAG),
+                ML99_listSort(
+                    v(BY_KEY),
+                    ML99_list(v((2, 0), (1, 1), (2, 2), (0, 3), (1, 4), (2, 5))))),
+            ML99_list(v(3, 1, 4, 0, 2, 5))));
+
+#undef BY_KEY_IMPL
+#undef BY_KEY_ARITY
+#undef TAG_IMPL
+#undef TAG_ARITY
+    }
+
+#define ITEMS_SHUFFLED                                                                             \
+    0, 97, 194, 36, 133, 230, 72, 169, 11, 108, 205, 47, 144, 241, 83, 180, 22, 119, 216, 58,      \
+        155, 252, 94, 191, 33, 130, 227, 69, 166, 8, 105, 202, 44, 141, 238, 80, 177, 19, 116,     \
+        213, 55, 152, 249, 91, 188, 30, 127, 224, 66, 163, 5, 102, 199, 41, 138, 235, 77, 174,     \
+        16, 113, 210, 52, 149, 246, 88, 185, 27, 124, 221, 63, 160, 2, 99, 196, 38, 135, 232, 74,  \
+        171, 13, 110, 207, 49, 146, 243, 85, 182, 24, 121, 218, 60, 157, 254, 96, 193, 35, 132,    \
+        229, 71, 168, 10, 107, 204, 46, 143, 240, 82, 179, 21, 118, 215, 57, 154, 251, 93, 190,    \
+        32, 129, 226, 68, 165, 7, 104, 201, 43, 140, 237, 79, 176, 18, 115, 212, 54, 151, 248,     \
+        90, 187, 29, 126, 223, 65, 162, 4, 101, 198, 40, 137, 234, 76, 173, 15, 112, 209, 51,      \
+        148, 245, 87, 184, 26, 123, 220, 62, 159, 1, 98, 195, 37, 134, 231, 73, 170, 12, 109,      \
+        206, 48, 145, 242, 84, 181, 23, 120, 217, 59, 156, 253, 95, 192, 34, 131, 228, 70, 167,    \
+        9, 106, 203, 45, 142, 239, 81, 178, 20, 117, 214, 56, 153, 250, 92, 189, 31, 128, 225,     \
+        67, 164, 6, 103, 200, 42, 139, 236, 78, 175, 17, 114, 211, 53, 150, 247, 89, 186, 28,      \
+        125, 222, 64, 161, 3, 100, 197, 39, 136, 233, 75, 172, 14, 111, 208, 50, 147, 244, 86,     \
+        183, 25, 122, 219, 61, 158
+
+#define ITEMS_0_TO_254                                                                             \
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,  \
+        26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,    \
+        48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69,    \
+        70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91,    \
+        92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110,     \
+        111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128,  \
+        129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146,  \
+        147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164,  \
+        165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182,  \
+        183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200,  \
+        201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218,  \
+        219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236,  \
+        237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254
+
+    // ML99_listSortNat with 255 items
+    {
+        ML99_ASSERT(CMP_NATURALS(
+            ML99_listSortNat(ML99_list(v(ITEMS_SHUFFLED))),
+            ML99_list(v(ITEMS_0_TO_254))));
+    }
+
+#undef ITEMS_SHUFFLED
+#undef ITEMS_0_TO_254
+
+    // ML99_listPipe
+    {
+#define LESSER_4 ML99_appl(v(ML99_lesser), v(4))
+#define DOUBLE   ML99_appl(v(ML99_mul), v(2))
+
+        ML99_ASSERT(CMP_NATURALS(ML99_listPipe(ML99_nil(), ML99_mapStage(DOUBLE)), ML99_nil()));
+        ML99_ASSERT(CMP_NATURALS(
+            ML99_listPipe(ML99_list(v(1, 5, 2, 6, 7)), ML99_mapStage(DOUBLE)),
+            ML99_list(v(2, 10, 4, 12, 14))));
+        ML99_ASSERT(CMP_NATURALS(
+            ML99_listPipe(ML99_list(v(1, 2, 3)), ML99_filterStage(LESSER_4)),
+            ML99_nil()));
+        ML99_ASSERT(CMP_NATURALS(
+            ML99_listPipe(
+                ML99_list(v(1, 5, 2, 6, 7)),
+                ML99_filterStage(LESSER_4),
+                ML99_mapStage(DOUBLE)),
+            ML99_list(v(10, 12, 14))));
+        ML99_ASSERT(CMP_NATURALS(
+            ML99_listPipe(
+                ML99_list(v(1, 5, 2, 6, 7)),
+                ML99_mapStage(DOUBLE),
+                ML99_filterStage(LESSER_4),
+                ML99_mapStage(v(ML99_inc))),
+            ML99_list(v(11, 13, 15))));
+
+        ML99_ASSERT_EQ(ML99_listPipe(ML99_nil(), ML99_foldStage(v(ML99_add), v(3))), v(3));
+        ML99_ASSERT_EQ(
+            ML99_listPipe(ML99_list(v(1, 5, 2, 6, 7)), ML99_foldStage(v(ML99_add), v(3))),
+            v(3 + 1 + 5 + 2 + 6 + 7));
+        ML99_ASSERT_EQ(
+            ML99_listPipe(
+                ML99_list(v(1, 5, 2, 6, 7)),
+                ML99_filterStage(LESSER_4),
+                ML99_mapStage(DOUBLE),
+                ML99_foldStage(v(ML99_sub), v(50))),
+            v(50 - 10 - 12 - 14));
+
+#undef LESSER_4
+#undef DOUBLE
+    }
+
+    // ML99_range, ML99_iterate, ML99_generator
+    {
+#define POWERS_OF_2 ML99_iterate(ML99_appl(v(ML99_mul), v(2)), v(1))
+#define COUNTDOWN                                                                                  \
+    ML99_generator(                                                                                \
+        v(20),                                                                                     \
+        ML99_appl(ML99_flip(v(ML99_sub)), v(5)),                                                   \
+        ML99_appl(v(ML99_natEq), v(0)))
+
+        ML99_ASSERT(CMP_NATURALS(ML99_listUnsized(ML99_range(v(3), v(3))), ML99_nil()));
+        ML99_ASSERT(CMP_NATURALS(ML99_listUnsized(ML99_range(v(3), v(6))), ML99_list(v(3, 4, 5))));
+        ML99_ASSERT(CMP_NATURALS(ML99_listUnsized(COUNTDOWN), ML99_list(v(20, 15, 10, 5))));
+
+        ML99_ASSERT_EQ(ML99_listFoldl(v(ML99_add), v(0), ML99_range(v(0), v(5))), v(10));
+        ML99_ASSERT_EQ(ML99_listFoldl(v(ML99_add), v(7), ML99_range(v(5), v(5))), v(7));
+        ML99_ASSERT_EQ(ML99_listFoldl(v(ML99_add), v(0), COUNTDOWN), v(20 + 15 + 10 + 5));
+
+        ML99_ASSERT(ML99_listContains(v(ML99_natEq), v(64), POWERS_OF_2));
+        ML99_ASSERT(ML99_not(ML99_listContains(v(ML99_natEq), v(7), ML99_range(v(0), v(5)))));
+
+        ML99_ASSERT(CMP_NATURALS(ML99_listTake(v(0), POWERS_OF_2), ML99_nil()));
+        ML99_ASSERT(CMP_NATURALS(ML99_listTake(v(4), POWERS_OF_2), ML99_list(v(1, 2, 4, 8))));
+        ML99_ASSERT(CMP_NATURALS(
+            ML99_listTake(v(4), ML99_range(v(0), v(2))),
+            ML99_list(v(0, 1))));
+
+        ML99_ASSERT(CMP_NATURALS(
+            ML99_listTakeWhile(ML99_appl(v(ML99_greater), v(10)), POWERS_OF_2),
+            ML99_list(v(1, 2, 4, 8))));
+
+        ML99_ASSERT(CMP_NATURALS(
+            ML99_listPipe(
+                ML99_range(v(0), v(10)),
+                ML99_filterStage(ML99_appl(v(ML99_lesser), v(6))),
+                ML99_mapStage(v(ML99_inc))),
+            ML99_list(v(8, 9, 10))));
+        ML99_ASSERT_EQ(
+            ML99_listPipe(ML99_range(v(1), v(21)), ML99_foldStage(v(ML99_add), v(0))),
+            v(210));
+
+        // The other list functions on lazy lists.
+        ML99_ASSERT_EQ(ML99_listHead(POWERS_OF_2), v(1));
+        ML99_ASSERT(CMP_NATURALS(ML99_listTail(ML99_range(v(0), v(3))), ML99_list(v(1, 2))));
+        ML99_ASSERT_EQ(ML99_listLast(COUNTDOWN), v(5));
+        ML99_ASSERT(CMP_NATURALS(ML99_listInit(COUNTDOWN), ML99_list(v(20, 15, 10))));
+        ML99_ASSERT(CMP_NATURALS(
+            ML99_listMapInitLast(v(ML99_inc), v(ML99_dec), COUNTDOWN),
+            ML99_list(v(21, 16, 11, 4))));
+        ML99_ASSERT_EQ(ML99_listLen(ML99_range(v(0), v(0))), v(0));
+        ML99_ASSERT_EQ(ML99_listLen(COUNTDOWN), v(4));
+        ML99_ASSERT_EQ(ML99_listGet(v(5), POWERS_OF_2), v(32));
+
+        ML99_ASSERT(ML99_isSizedList(ML99_listSized(COUNTDOWN)));
+        ML99_ASSERT(CMP_NATURALS(ML99_listSized(COUNTDOWN), ML99_list(v(20, 15, 10, 5))));
+
+        ML99_ASSERT(CMP_NATURALS(ML99_range(v(0), v(0)), ML99_nil()));
+        ML99_ASSERT(CMP_NATURALS(ML99_range(v(0), v(3)), ML99_list(v(0, 1, 2))));
+        ML99_ASSERT(CMP_NATURALS(ML99_range(v(0), v(3)), ML99_sizedList(v(0, 1, 2))));
+        ML99_ASSERT(ML99_not(CMP_NATURALS(ML99_range(v(0), v(3)), ML99_range(v(0), v(4)))));
+        ML99_ASSERT(ML99_listEqNat(ML99_range(v(0), v(3)), ML99_list(v(0, 1, 2))));
+        ML99_ASSERT(ML99_not(ML99_listEqNat(ML99_nil(), ML99_range(v(0), v(1)))));
+
+        ML99_ASSERT(CMP_NATURALS(
+            ML99_listMap(v(ML99_inc), ML99_range(v(0), v(3))),
+            ML99_list(v(1, 2, 3))));
+        ML99_ASSERT(CMP_NATURALS(
+            ML99_listFilter(ML99_appl(v(ML99_lesser), v(2)), ML99_range(v(0), v(6))),
+            ML99_list(v(3, 4, 5))));
+        ML99_ASSERT(CMP_NATURALS(
+            ML99_listFoldr(v(ML99_cons), v(ML99_NIL()), ML99_range(v(0), v(3))),
+            ML99_list(v(0, 1, 2))));
+        ML99_ASSERT(CMP_NATURALS(
+            ML99_listAppend(ML99_range(v(0), v(2)), ML99_range(v(5), v(7))),
+            ML99_list(v(0, 1, 5, 6))));
+        ML99_ASSERT(CMP_NATURALS(ML99_listReverse(COUNTDOWN), ML99_list(v(5, 10, 15, 20))));
+        ML99_ASSERT(CMP_NATURALS(ML99_listSortNat(COUNTDOWN), ML99_list(v(5, 10, 15, 20))));
+        ML99_ASSERT(CMP_NATURALS(ML99_listDrop(v(2), ML99_range(v(0), v(4))), ML99_list(v(2, 3))));
+        ML99_ASSERT_EQ(ML99_listLen(ML99_listZip(POWERS_OF_2, COUNTDOWN)), v(4));
+        ML99_ASSERT_EQ(ML99_call(ML99_add, ML99_listUnwrapCommaSep(ML99_range(v(3), v(5)))), v(7));
+
+#undef POWERS_OF_2
+#undef COUNTDOWN
     }
 }
@@ -1,5 +1,16 @@
 #include <metalang99/assert.h>
+#include <metalang99/list.h>
 #include <metalang99/logical.h>
+#include <metalang99/nat.h>
+
+#define HEAD_IS_ZERO_IMPL(list) ML99_natEq(ML99_listHead(v(list)), v(0))
+#define HEAD_IS_ZERO_ARITY      1
+
+#define STARTS_WITH_ZERO_IMPL(list) ML99_andThen(ML99_isCons(v(list)), v(HEAD_IS_ZERO), v(list))
+#define STARTS_WITH_ZERO_ARITY      1
+
+#define EMPTY_OR_ZERO_IMPL(list) ML99_orElse(ML99_isNil(v(list)), v(HEAD_IS_ZERO), v(list))
+#define EMPTY_OR_ZERO_ARITY      1
 
 int main(void) {
 
@@ -34,6 +45,36 @@ int main(void) {
         ML99_ASSERT_EQ(ML99_or(v(1), v(1)), v(1));
     }
 
+    // ML99_andThen
+    {
+        ML99_ASSERT_EQ(ML99_andThen(v(0), v(HEAD_IS_ZERO), ML99_nil()), v(0));
+        ML99_ASSERT_EQ(ML99_andThen(v(1), v(HEAD_IS_ZERO), ML99_list(v(0, 1))), v(1));
+        ML99_ASSERT_EQ(ML99_andThen(v(1), v(HEAD_IS_ZERO), ML99_list(v(1, 0))), v(0));
+
+        ML99_ASSERT_EQ(ML99_andThen(v(1), ML99_appl(v(ML99_natEq), v(5)), v(5)), v(1));
+
+        // As a predicate.
+        ML99_ASSERT_EQ(
+            ML99_listLen(ML99_listFilter(
+                v(STARTS_WITH_ZERO),
+                ML99_list(ML99_nil(), ML99_list(v(0)), ML99_list(v(1, 0)), ML99_list(v(0, 2))))),
+            v(2));
+    }
+
+    // ML99_orElse
+    {
+        ML99_ASSERT_EQ(ML99_orElse(v(1), v(HEAD_IS_ZERO), ML99_nil()), v(1));
+        ML99_ASSERT_EQ(ML99_orElse(v(0), v(HEAD_IS_ZERO), ML99_list(v(0, 1))), v(1));
+        ML99_ASSERT_EQ(ML99_orElse(v(0), v(HEAD_IS_ZERO), ML99_list(v(1, 0))), v(0));
+
+        // As a predicate.
+        ML99_ASSERT_EQ(
+            ML99_listLen(ML99_listTakeWhile(
+                v(EMPTY_OR_ZERO),
+                ML99_list(ML99_nil(), ML99_list(v(0)), ML99_list(v(1)), ML99_nil()))),
+            v(2));
+    }
+
     // ML99_xor
     {
         ML99_ASSERT_EQ(ML99_xor(v(0), v(0)), v(0));
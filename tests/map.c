@@ -0,0 +1,115 @@
+#include <metalang99/assert.h>
+#include <metalang99/list.h>
+#include <metalang99/logical.h>
+#include <metalang99/map.h>
+#include <metalang99/maybe.h>
+#include <metalang99/nat.h>
+
+#define FOO_a_a ()
+#define FOO_b_b ()
+#define FOO_c_c ()
+#define FOO_d_d ()
+#define FOO_e_e ()
+#define FOO_f_f ()
+#define FOO_g_g ()
+#define FOO_h_h ()
+#define FOO_i_i ()
+#define FOO_j_j ()
+
+int main(void) {
+
+#define NAT_MAP ML99_mapInsert(v(5), v(50), ML99_mapInsert(v(1), v(10), ML99_natMap()))
+
+#define IDENT_MAP                                                                                  \
+    ML99_mapInsert(v(b), v(2), ML99_mapInsert(v(a), v(1), ML99_identMap(v(FOO_))))
+
+#define BIG_IDENT_MAP                                                                              \
+    ML99_mapInsert(                                                                                \
+        v(j), v(10),                                                                               \
+        ML99_mapInsert(                                                                            \
+            v(i), v(9),                                                                            \
+            ML99_mapInsert(                                                                        \
+                v(h), v(8),                                                                        \
+                ML99_mapInsert(                                                                    \
+                    v(g), v(7),                                                                    \
+                    ML99_mapInsert(                                                                \
+                        v(f), v(6),                                                                \
+                        ML99_mapInsert(                                                            \
+                            v(e), v(5),                                                            \
+                            ML99_mapInsert(                                                        \
+                                v(d), v(4), ML99_mapInsert(v(c), v(3), IDENT_MAP))))))))
+
+#define GET_EQ(key, map, val) ML99_natEq(ML99_maybeUnwrap(ML99_mapGet(key, map)), val)
+
+    // ML99_natMap, ML99_identMap
+    {
+        ML99_ASSERT(ML99_isNil(ML99_mapKeys(ML99_natMap())));
+        ML99_ASSERT(ML99_isNil(ML99_mapKeys(ML99_identMap(v(FOO_)))));
+        ML99_ASSERT(ML99_isNothing(ML99_mapGet(v(0), ML99_natMap())));
+        ML99_ASSERT(ML99_isNothing(ML99_mapGet(v(a), ML99_identMap(v(FOO_)))));
+    }
+
+    // ML99_mapInsert, ML99_mapGet
+    {
+        ML99_ASSERT(GET_EQ(v(1), NAT_MAP, v(10)));
+        ML99_ASSERT(GET_EQ(v(5), NAT_MAP, v(50)));
+        ML99_ASSERT(ML99_isNothing(ML99_mapGet(v(0), NAT_MAP)));
+        ML99_ASSERT(ML99_isNothing(ML99_mapGet(v(3), NAT_MAP)));
+        ML99_ASSERT(ML99_isNothing(ML99_mapGet(v(100), NAT_MAP)));
+        ML99_ASSERT(GET_EQ(v(1), ML99_mapInsert(v(1), v(11), NAT_MAP), v(11)));
+        ML99_ASSERT(GET_EQ(v(200), ML99_mapInsert(v(200), v(7), NAT_MAP), v(7)));
+
+        ML99_ASSERT(GET_EQ(v(a), IDENT_MAP, v(1)));
+        ML99_ASSERT(GET_EQ(v(b), IDENT_MAP, v(2)));
+        ML99_ASSERT(ML99_isNothing(ML99_mapGet(v(c), IDENT_MAP)));
+        ML99_ASSERT(GET_EQ(v(a), ML99_mapInsert(v(a), v(3), IDENT_MAP), v(3)));
+
+        ML99_ASSERT(GET_EQ(v(a), BIG_IDENT_MAP, v(1)));
+        ML99_ASSERT(GET_EQ(v(h), BIG_IDENT_MAP, v(8)));
+        ML99_ASSERT(GET_EQ(v(i), BIG_IDENT_MAP, v(9)));
+        ML99_ASSERT(GET_EQ(v(j), BIG_IDENT_MAP, v(10)));
+        ML99_ASSERT(GET_EQ(v(j), ML99_mapInsert(v(j), v(0), BIG_IDENT_MAP), v(0)));
+    }
+
+    // ML99_mapContains
+    {
+        ML99_ASSERT(ML99_mapContains(v(5), NAT_MAP));
+        ML99_ASSERT(ML99_not(ML99_mapContains(v(2), NAT_MAP)));
+
+        ML99_ASSERT(ML99_mapContains(v(b), IDENT_MAP));
+        ML99_ASSERT(ML99_not(ML99_mapContains(v(c), IDENT_MAP)));
+        ML99_ASSERT(ML99_mapContains(v(j), BIG_IDENT_MAP));
+    }
+
+    // ML99_mapRemove
+    {
+        ML99_ASSERT(ML99_not(ML99_mapContains(v(1), ML99_mapRemove(v(1), NAT_MAP))));
+        ML99_ASSERT(ML99_mapContains(v(5), ML99_mapRemove(v(1), NAT_MAP)));
+        ML99_ASSERT(GET_EQ(v(5), ML99_mapRemove(v(100), NAT_MAP), v(50)));
+
+        ML99_ASSERT(ML99_not(ML99_mapContains(v(a), ML99_mapRemove(v(a), IDENT_MAP))));
+        ML99_ASSERT(GET_EQ(v(b), ML99_mapRemove(v(a), IDENT_MAP), v(2)));
+        ML99_ASSERT(GET_EQ(v(b), ML99_mapRemove(v(c), IDENT_MAP), v(2)));
+        ML99_ASSERT(
+            ML99_isNil(ML99_mapKeys(ML99_mapRemove(v(b), ML99_mapRemove(v(a), IDENT_MAP)))));
+        ML99_ASSERT(ML99_not(ML99_mapContains(v(i), ML99_mapRemove(v(i), BIG_IDENT_MAP))));
+        ML99_ASSERT(GET_EQ(v(j), ML99_mapRemove(v(i), BIG_IDENT_MAP), v(10)));
+    }
+
+    // ML99_mapKeys, ML99_mapValues
+    {
+        ML99_ASSERT(ML99_listEqNat(ML99_mapKeys(NAT_MAP), ML99_list(v(1, 5))));
+        ML99_ASSERT(ML99_listEqNat(ML99_mapValues(NAT_MAP), ML99_list(v(10, 50))));
+        ML99_ASSERT(ML99_listEqNat(ML99_mapKeys(ML99_mapRemove(v(1), NAT_MAP)), ML99_list(v(5))));
+
+        ML99_ASSERT(ML99_listEqIdent(v(FOO_), ML99_mapKeys(IDENT_MAP), ML99_list(v(a, b))));
+        ML99_ASSERT(ML99_listEqNat(ML99_mapValues(IDENT_MAP), ML99_list(v(1, 2))));
+        ML99_ASSERT(ML99_listEqNat(
+            ML99_mapValues(BIG_IDENT_MAP), ML99_list(v(1, 2, 3, 4, 5, 6, 7, 8, 9, 10))));
+    }
+
+#undef NAT_MAP
+#undef IDENT_MAP
+#undef BIG_IDENT_MAP
+#undef GET_EQ
+}
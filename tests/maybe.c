@@ -1,7 +1,17 @@
 #include <metalang99/assert.h>
+#include <metalang99/control.h>
 #include <metalang99/maybe.h>
 #include <metalang99/nat.h>
 
+#define CHECKED_DEC_IMPL(x) ML99_IF(ML99_NAT_EQ(x, 0), ML99_nothing(), ML99_just(ML99_dec(v(x))))
+#define CHECKED_DEC_ARITY   1
+
+// Fails if a stage after `ML99_nothing()` is applied.
+#define UNREACHABLE_IMPL(x) ML99_fatal(UNREACHABLE, must not be applied)
+#define UNREACHABLE_ARITY   1
+
+#define MAYBE_NAT_EQ(maybe, other) ML99_maybeEq(v(ML99_natEq), maybe, other)
+
 int main(void) {
 
 #define MATCH_IMPL(maybe)     ML99_match(v(maybe), v(MATCH_))
@@ -55,4 +65,38 @@ int main(void) {
 
     // ML99_maybeUnwrap
     { ML99_ASSERT_EQ(ML99_maybeUnwrap(ML99_just(v(123))), v(123)); }
+
+    // ML99_maybeBind
+    {
+        ML99_ASSERT(
+            MAYBE_NAT_EQ(ML99_maybeBind(ML99_just(v(5)), v(CHECKED_DEC)), ML99_just(v(4))));
+        ML99_ASSERT(ML99_isNothing(ML99_maybeBind(ML99_just(v(0)), v(CHECKED_DEC))));
+        ML99_ASSERT(ML99_isNothing(ML99_maybeBind(ML99_nothing(), v(UNREACHABLE))));
+    }
+
+    // ML99_maybeMap
+    {
+        ML99_ASSERT(MAYBE_NAT_EQ(ML99_maybeMap(ML99_just(v(5)), v(ML99_inc)), ML99_just(v(6))));
+        ML99_ASSERT(MAYBE_NAT_EQ(
+            ML99_maybeMap(ML99_just(v(5)), ML99_appl(v(ML99_add), v(3))),
+            ML99_just(v(8))));
+        ML99_ASSERT(ML99_isNothing(ML99_maybeMap(ML99_nothing(), v(UNREACHABLE))));
+    }
+
+    // ML99_maybeChain
+    {
+        ML99_ASSERT(
+            MAYBE_NAT_EQ(ML99_maybeChain(ML99_just(v(5)), v(CHECKED_DEC)), ML99_just(v(4))));
+        ML99_ASSERT(MAYBE_NAT_EQ(
+            ML99_maybeChain(ML99_just(v(5)), v(CHECKED_DEC), v(CHECKED_DEC), v(CHECKED_DEC)),
+            ML99_just(v(2))));
+
+        ML99_ASSERT(ML99_isNothing(ML99_maybeChain(ML99_nothing(), v(UNREACHABLE))));
+        ML99_ASSERT(ML99_isNothing(ML99_maybeChain(
+            ML99_just(v(1)),
+            v(CHECKED_DEC),
+            v(CHECKED_DEC),
+            v(UNREACHABLE),
+            v(UNREACHABLE))));
+    }
 }
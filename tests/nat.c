@@ -156,12 +156,36 @@ int main(void) {
         ML99_ASSERT(ML99_not(ML99_lesserEq(v(182), v(181))));
     }
 
+    // ML99_NAT_LESSER, ML99_NAT_LESSER_EQ, ML99_NAT_GREATER, ML99_NAT_GREATER_EQ
+    {
+        ML99_ASSERT_UNEVAL(ML99_NAT_LESSER(0, 1));
+        ML99_ASSERT_UNEVAL(ML99_NAT_LESSER(99, 100));
+        ML99_ASSERT_UNEVAL(ML99_NAT_LESSER(190, 209));
+        ML99_ASSERT_UNEVAL(!ML99_NAT_LESSER(123, 123));
+        ML99_ASSERT_UNEVAL(!ML99_NAT_LESSER(ML99_NAT_MAX, 0));
+
+        ML99_ASSERT_UNEVAL(ML99_NAT_LESSER_EQ(7, 7));
+        ML99_ASSERT_UNEVAL(ML99_NAT_LESSER_EQ(7, 70));
+        ML99_ASSERT_UNEVAL(!ML99_NAT_LESSER_EQ(71, 70));
+
+        ML99_ASSERT_UNEVAL(ML99_NAT_GREATER(201, 200));
+        ML99_ASSERT_UNEVAL(!ML99_NAT_GREATER(200, 200));
+        ML99_ASSERT_UNEVAL(!ML99_NAT_GREATER(2, 200));
+
+        ML99_ASSERT_UNEVAL(ML99_NAT_GREATER_EQ(ML99_NAT_MAX, ML99_NAT_MAX));
+        ML99_ASSERT_UNEVAL(ML99_NAT_GREATER_EQ(10, 9));
+        ML99_ASSERT_UNEVAL(!ML99_NAT_GREATER_EQ(0, 1));
+    }
+
     // ML99_add
     {
         ML99_ASSERT_EQ(ML99_add(v(0), v(0)), v(0));
         ML99_ASSERT_EQ(ML99_add(v(19), v(83)), v(19 + 83));
         ML99_ASSERT_EQ(ML99_add(v(8), v(4)), v(8 + 4));
         ML99_ASSERT_EQ(ML99_add(v(1), v(254)), v(1 + 254));
+        ML99_ASSERT_EQ(ML99_add(v(200), v(55)), v(ML99_NAT_MAX));
+        ML99_ASSERT_EQ(ML99_add(v(ML99_NAT_MAX), v(1)), v(0));
+        ML99_ASSERT_EQ(ML99_add(v(ML99_NAT_MAX), v(ML99_NAT_MAX)), v(254));
     }
 
     // ML99_sub
@@ -170,6 +194,9 @@ int main(void) {
         ML99_ASSERT_EQ(ML99_sub(v(5), v(3)), v(5 - 3));
         ML99_ASSERT_EQ(ML99_sub(v(105), v(19)), v(105 - 19));
         ML99_ASSERT_EQ(ML99_sub(v(ML99_NAT_MAX), v(40)), v(ML99_NAT_MAX - 40));
+        ML99_ASSERT_EQ(ML99_sub(v(100), v(91)), v(100 - 91));
+        ML99_ASSERT_EQ(ML99_sub(v(0), v(1)), v(ML99_NAT_MAX));
+        ML99_ASSERT_EQ(ML99_sub(v(0), v(ML99_NAT_MAX)), v(1));
     }
 
     // ML99_mul
@@ -178,63 +205,16 @@ int main(void) {
         ML99_ASSERT_EQ(ML99_mul(v(0), v(11)), v(0));
         ML99_ASSERT_EQ(ML99_mul(v(15), v(8)), v(15 * 8));
         ML99_ASSERT_EQ(ML99_mul(v(ML99_NAT_MAX), v(1)), v(ML99_NAT_MAX * 1));
+        ML99_ASSERT_EQ(ML99_mul(v(17), v(15)), v(17 * 15));
+        ML99_ASSERT_EQ(ML99_mul(v(16), v(16)), v(0));
+        ML99_ASSERT_EQ(ML99_mul(v(ML99_NAT_MAX), v(ML99_NAT_MAX)), v(1));
     }
 
-    // ML99_div
-    {
-        ML99_ASSERT_EQ(ML99_div(v(15), v(1)), v(15));
-        ML99_ASSERT_EQ(ML99_div(v(15), v(15)), v(1));
-        ML99_ASSERT_EQ(ML99_div(v(45), v(3)), v(45 / 3));
-        ML99_ASSERT_EQ(ML99_div(v(ML99_NAT_MAX), v(5)), v(ML99_NAT_MAX / 5));
-    }
-
-    // ML99_divChecked
-    {
-        ML99_ASSERT(ML99_maybeEq(v(ML99_natEq), ML99_divChecked(v(15), v(1)), ML99_just(v(15))));
-        ML99_ASSERT(ML99_maybeEq(v(ML99_natEq), ML99_divChecked(v(15), v(15)), ML99_just(v(1))));
-        ML99_ASSERT(ML99_maybeEq(v(ML99_natEq), ML99_divChecked(v(45), v(3)), ML99_just(v(15))));
-        ML99_ASSERT(
-            ML99_maybeEq(v(ML99_natEq), ML99_divChecked(v(ML99_NAT_MAX), v(5)), ML99_just(v(51))));
-
-        ML99_ASSERT(ML99_maybeEq(v(ML99_natEq), ML99_divChecked(v(4), v(0)), ML99_nothing()));
-        ML99_ASSERT(ML99_maybeEq(v(ML99_natEq), ML99_divChecked(v(3), v(27)), ML99_nothing()));
-        ML99_ASSERT(ML99_maybeEq(v(ML99_natEq), ML99_divChecked(v(166), v(9)), ML99_nothing()));
-        ML99_ASSERT(ML99_maybeEq(v(ML99_natEq), ML99_divChecked(v(0), v(11)), ML99_nothing()));
-    }
-
-    // ML99_DIV_CHECKED
-    {
-        ML99_ASSERT(ML99_maybeEq(v(ML99_natEq), v(ML99_DIV_CHECKED(15, 1)), ML99_just(v(15))));
-        ML99_ASSERT(ML99_maybeEq(v(ML99_natEq), v(ML99_DIV_CHECKED(4, 0)), ML99_nothing()));
-    }
-
-    // ML99_mod
-    {
-        ML99_ASSERT_EQ(ML99_mod(v(0), v(1)), v(0 % 1));
-        ML99_ASSERT_EQ(ML99_mod(v(0), v(123)), v(0 % 123));
-
-        ML99_ASSERT_EQ(ML99_mod(v(1), v(28)), v(1 % 28));
-        ML99_ASSERT_EQ(ML99_mod(v(1), v(123)), v(1 % 123));
-
-        ML99_ASSERT_EQ(ML99_mod(v(1), v(1)), v(0));
-        ML99_ASSERT_EQ(ML99_mod(v(16), v(4)), v(0));
-        ML99_ASSERT_EQ(ML99_mod(v(ML99_NAT_MAX), v(ML99_NAT_MAX)), v(0));
-
-        ML99_ASSERT_EQ(ML99_mod(v(8), v(3)), v(8 % 3));
-        ML99_ASSERT_EQ(ML99_mod(v(10), v(4)), v(10 % 4));
-        ML99_ASSERT_EQ(ML99_mod(v(101), v(7)), v(101 % 7));
-
-        ML99_ASSERT_EQ(ML99_mod(v(13), v(14)), v(13 % 14));
-        ML99_ASSERT_EQ(ML99_mod(v(20), v(36)), v(20 % 36));
-        ML99_ASSERT_EQ(ML99_mod(v(16), v(ML99_NAT_MAX)), v(16 % ML99_NAT_MAX));
-    }
-
-    // ML99_add3, ML99_sub3, ML99_mul3, ML99_div3
+    // ML99_add3, ML99_sub3, ML99_mul3
     {
         ML99_ASSERT_EQ(ML99_add3(v(8), v(2), v(4)), v(8 + 2 + 4));
         ML99_ASSERT_EQ(ML99_sub3(v(14), v(1), v(7)), v(14 - 1 - 7));
         ML99_ASSERT_EQ(ML99_mul3(v(3), v(2), v(6)), v(3 * 2 * 6));
-        ML99_ASSERT_EQ(ML99_div3(v(30), v(2), v(3)), v(30 / 2 / 3));
     }
 
     // ML99_min
@@ -242,6 +222,7 @@ int main(void) {
         ML99_ASSERT_EQ(ML99_min(v(0), v(1)), v(0));
         ML99_ASSERT_EQ(ML99_min(v(5), v(7)), v(5));
         ML99_ASSERT_EQ(ML99_min(v(200), v(ML99_NAT_MAX)), v(200));
+        ML99_ASSERT_EQ(ML99_min(v(9), v(9)), v(9));
     }
 
     // ML99_max
@@ -249,6 +230,7 @@ int main(void) {
         ML99_ASSERT_EQ(ML99_max(v(0), v(1)), v(1));
         ML99_ASSERT_EQ(ML99_max(v(5), v(7)), v(7));
         ML99_ASSERT_EQ(ML99_max(v(200), v(ML99_NAT_MAX)), v(ML99_NAT_MAX));
+        ML99_ASSERT_EQ(ML99_max(v(9), v(9)), v(9));
     }
 
     // ML99_assertIsNat
@@ -0,0 +1,45 @@
+#define ML99_NAT_MAX 63
+
+#include <metalang99/assert.h>
+#include <metalang99/div.h>
+#include <metalang99/nat.h>
+
+int main(void) {
+
+    // ML99_NAT_MAX
+    { ML99_ASSERT_UNEVAL(ML99_NAT_MAX == 63); }
+
+    // ML99_inc, ML99_dec
+    {
+        ML99_ASSERT_EQ(ML99_inc(v(62)), v(63));
+        ML99_ASSERT_EQ(ML99_inc(v(63)), v(0));
+        ML99_ASSERT_EQ(ML99_dec(v(0)), v(63));
+    }
+
+    // ML99_add, ML99_sub, ML99_mul
+    {
+        ML99_ASSERT_EQ(ML99_add(v(40), v(23)), v(63));
+        ML99_ASSERT_EQ(ML99_add(v(40), v(30)), v(6));
+        ML99_ASSERT_EQ(ML99_add(v(63), v(63)), v(62));
+        ML99_ASSERT_EQ(ML99_sub(v(5), v(7)), v(62));
+        ML99_ASSERT_EQ(ML99_sub(v(0), v(63)), v(1));
+        ML99_ASSERT_EQ(ML99_mul(v(7), v(9)), v(63));
+        ML99_ASSERT_EQ(ML99_mul(v(8), v(8)), v(0));
+        ML99_ASSERT_EQ(ML99_mul(v(63), v(63)), v(1));
+    }
+
+    // ML99_lesser, ML99_natEq
+    {
+        ML99_ASSERT(ML99_lesser(v(62), v(63)));
+        ML99_ASSERT(ML99_not(ML99_lesser(v(63), v(0))));
+        ML99_ASSERT(ML99_natEq(v(63), v(63)));
+    }
+
+    // ML99_divMod
+    {
+        ML99_ASSERT_EQ(ML99_div(v(63), v(2)), v(31));
+        ML99_ASSERT_EQ(ML99_mod(v(63), v(10)), v(3));
+        ML99_ASSERT_EQ(ML99_div(v(63), v(63)), v(1));
+        ML99_ASSERT_EQ(ML99_mod(v(62), v(63)), v(62));
+    }
+}
@@ -0,0 +1,45 @@
+#include "perf.h"
+
+#include <metalang99/control.h>
+#include <metalang99/gen.h>
+#include <metalang99/list.h>
+#include <metalang99/nat.h>
+
+#define F_IMPL(x) v(x)
+#define F_ARITY   1
+
+#define ITEM(i) [i] = i
+
+#define FIB_IMPL(self, i)                                                                          \
+    ML99_IF(                                                                                       \
+        ML99_NAT_LESSER(i, 2),                                                                     \
+        v(i),                                                                                      \
+        ML99_add(                                                                                  \
+            ML99_appl(v(self), v(ML99_DEC(i))),                                                    \
+            ML99_appl(v(self), v(ML99_DEC(ML99_DEC(i))))))
+#define FIB_ARITY 2
+
+int main(void) {
+
+    // gen.h
+    {
+        STEPS_AT_MOST(2, ML99_indexedArgs(v(64)));
+        STEPS_AT_MOST(2, ML99_genArray(v(64), v(ITEM)));
+        STEPS_AT_MOST(2, ML99_genArrayShard(v(1), v(4), v(255), v(ITEM)));
+        STEPS_AT_MOST(3 * 64, ML99_indexedParams(ML99_list(v(TYPES_64))));
+        STEPS_AT_MOST(3 * 64, ML99_indexedFields(ML99_list(v(TYPES_64))));
+    }
+
+    // control.h
+    {
+        STEPS_AT_MOST(2, ML99_times(v(64), v(~)));
+        STEPS_AT_MOST(3 * 64, ML99_repeat(v(64), v(F)));
+        STEPS_AT_MOST(16 * 64, ML99_fixMemo(v(FIB), v(64)));
+    }
+}
+
+#undef F_IMPL
+#undef F_ARITY
+#undef ITEM
+#undef FIB_IMPL
+#undef FIB_ARITY
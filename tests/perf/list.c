@@ -0,0 +1,83 @@
+#include "perf.h"
+
+#include <metalang99/div.h>
+#include <metalang99/list.h>
+#include <metalang99/nat.h>
+#include <metalang99/util.h>
+
+#define L16 ML99_list(v(ITEMS_16))
+#define L25 ML99_list(v(ITEMS_25))
+#define L64 ML99_list(v(ITEMS_64))
+
+int main(void) {
+
+    // Construction & destruction
+    {
+        STEPS_AT_MOST(16 / 4, L16);
+        STEPS_AT_MOST(64 / 4, L64);
+        STEPS_AT_MOST(64 / 2, ML99_listUnwrap(L64));
+        STEPS_AT_MOST(6 * 64, ML99_listReplicate(v(64), v(~)));
+    }
+
+    // Traversal
+    {
+        STEPS_AT_MOST(5 * 16, ML99_listLen(L16));
+        STEPS_AT_MOST(5 * 64, ML99_listLen(L64));
+        STEPS_AT_MOST(2 * 16, ML99_listReverse(L16));
+        STEPS_AT_MOST(2 * 64, ML99_listReverse(L64));
+        STEPS_AT_MOST(2 * 64, ML99_listGet(v(63), L64));
+        STEPS_AT_MOST(2 * 64, ML99_listLast(L64));
+        STEPS_AT_MOST(64, ML99_listContainsNat(v(99), L64));
+    }
+
+    // Folds & maps
+    {
+        STEPS_AT_MOST(5 * 16, ML99_listFoldl(v(ML99_add), v(0), L16));
+        STEPS_AT_MOST(5 * 64, ML99_listFoldl(v(ML99_max), v(0), L64));
+        STEPS_AT_MOST(7 * 16, ML99_listFoldr(v(ML99_max), v(0), L16));
+        STEPS_AT_MOST(7 * 64, ML99_listFoldr(v(ML99_max), v(0), L64));
+        STEPS_AT_MOST(4 * 16, ML99_listMap(v(ML99_inc), L16));
+        STEPS_AT_MOST(4 * 64, ML99_listMap(v(ML99_inc), L64));
+        STEPS_AT_MOST(6 * 64, ML99_listFilter(ML99_appl(v(ML99_lesser), v(32)), L64));
+        STEPS_AT_MOST(3 * 64, ML99_listPartition(ML99_appl(v(ML99_lesser), v(32)), L64));
+        STEPS_AT_MOST(
+            8 * 64,
+            ML99_listPartitionBy(v(4), ML99_appl(ML99_flip(v(ML99_mod)), v(4)), L64));
+    }
+
+    // Comparison
+    {
+        STEPS_AT_MOST(6 * 16, ML99_listEq(v(ML99_natEq), L16, L16));
+        STEPS_AT_MOST(6 * 25, ML99_listEq(v(ML99_natEq), L25, L25));
+        STEPS_AT_MOST(6 * 64, ML99_listEq(v(ML99_natEq), L64, L64));
+    }
+
+    // Slicing
+    {
+        STEPS_AT_MOST(4 * 64, ML99_listTake(v(32), L64));
+        STEPS_AT_MOST(64, ML99_listDrop(v(32), L64));
+        STEPS_AT_MOST(14 * 16, ML99_listTakeWhile(ML99_appl(v(ML99_greater), v(99)), L16));
+        STEPS_AT_MOST(14 * 64, ML99_listTakeWhile(ML99_appl(v(ML99_greater), v(99)), L64));
+        STEPS_AT_MOST(10 * 64, ML99_listDropWhile(ML99_appl(v(ML99_greater), v(99)), L64));
+        STEPS_AT_MOST(6 * 64, ML99_listInit(L64));
+    }
+
+    // Combination
+    {
+        STEPS_AT_MOST(6 * 16, ML99_listAppend(L16, L16));
+        STEPS_AT_MOST(6 * 64, ML99_listAppend(L64, L64));
+        STEPS_AT_MOST(6 * 64, ML99_listZip(L64, L64));
+        STEPS_AT_MOST(7 * 64, ML99_listUnzip(ML99_listZip(L64, L64)));
+        STEPS_AT_MOST(10 * 64, ML99_listIntersperse(v(~), L64));
+    }
+
+    // Sorting
+    {
+        STEPS_AT_MOST(5 * 16, ML99_listSortNat(L16));
+        STEPS_AT_MOST(5 * 64, ML99_listSortNat(L64));
+    }
+}
+
+#undef L16
+#undef L25
+#undef L64
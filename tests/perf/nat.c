@@ -0,0 +1,23 @@
+#include "perf.h"
+
+#include <metalang99/div.h>
+#include <metalang99/nat.h>
+
+// The arithmetic of `nat.h` is done by lookup tables, so its cost does not depend on the operands.
+int main(void) {
+
+    STEPS_AT_MOST(2, ML99_inc(v(0)));
+    STEPS_AT_MOST(2, ML99_inc(v(254)));
+    STEPS_AT_MOST(2, ML99_add(v(1), v(1)));
+    STEPS_AT_MOST(2, ML99_add(v(120), v(120)));
+    STEPS_AT_MOST(2, ML99_sub(v(1), v(1)));
+    STEPS_AT_MOST(2, ML99_sub(v(255), v(128)));
+    STEPS_AT_MOST(2, ML99_mul(v(1), v(1)));
+    STEPS_AT_MOST(2, ML99_mul(v(15), v(17)));
+    STEPS_AT_MOST(2, ML99_div(v(1), v(1)));
+    STEPS_AT_MOST(2, ML99_div(v(255), v(3)));
+    STEPS_AT_MOST(2, ML99_natEq(v(0), v(0)));
+    STEPS_AT_MOST(2, ML99_natEq(v(255), v(255)));
+    STEPS_AT_MOST(2, ML99_lesser(v(0), v(1)));
+    STEPS_AT_MOST(2, ML99_lesser(v(128), v(255)));
+}
@@ -0,0 +1,33 @@
+// The reduction-count tests of `tests/perf/` bound the number of reduction steps that the
+// standard library takes on inputs of fixed sizes. Unlike timings, the steps do not depend on the
+// machine, so an operation that becomes slower (e.g., quadratic instead of linear) fails the build.
+//
+// A bound is about 1.2 times the current count, written as a multiple of the input size `N` for the
+// operations linear in it. If a change makes an operation cheaper, tighten its bound.
+
+#ifndef ML99_TESTS_PERF_H
+#define ML99_TESTS_PERF_H
+
+#define ML99_PROFILE
+
+#include <metalang99/assert.h>
+#include <metalang99/lang.h>
+
+#define STEPS_AT_MOST(n, ...) ML99_ASSERT_UNEVAL(ML99_EVAL_STEPS(__VA_ARGS__) <= (n))
+
+#define ITEMS_16 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15
+#define ITEMS_25 ITEMS_16, 16, 17, 18, 19, 20, 21, 22, 23, 24
+
+#define ITEMS_64                                                                                   \
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,                                          \
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,                                \
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,                                \
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63
+
+#define TYPES_64                                                                                   \
+    int, int, int, int, int, int, int, int, int, int, int, int, int, int, int, int,                \
+    int, int, int, int, int, int, int, int, int, int, int, int, int, int, int, int,                \
+    int, int, int, int, int, int, int, int, int, int, int, int, int, int, int, int,                \
+    int, int, int, int, int, int, int, int, int, int, int, int, int, int, int, int
+
+#endif // ML99_TESTS_PERF_H
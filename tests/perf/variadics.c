@@ -0,0 +1,35 @@
+#include "perf.h"
+
+#include <metalang99/nat.h>
+#include <metalang99/tuple.h>
+#include <metalang99/variadics.h>
+
+#define F_IMPL(x) v(x)
+#define F_ARITY   1
+
+int main(void) {
+
+    // ML99_variadicsCount
+    {
+        STEPS_AT_MOST(2, ML99_variadicsCount(v(ITEMS_16)));
+        STEPS_AT_MOST(4, ML99_variadicsCount(v(ITEMS_64)));
+    }
+
+    // ML99_variadicsForEach, ML99_tupleForEach
+    {
+        STEPS_AT_MOST(3 * 16, ML99_variadicsForEach(v(F), v(ITEMS_16)));
+        STEPS_AT_MOST(3 * 64, ML99_variadicsForEach(v(F), v(ITEMS_64)));
+        STEPS_AT_MOST(3 * 64, ML99_tupleForEach(v(F), v((ITEMS_64))));
+    }
+
+    // ML99_tupleMap, ML99_tupleFilter, ML99_tupleReverse, ML99_tupleSlice
+    {
+        STEPS_AT_MOST(3 * 64, ML99_tupleMap(v(F), v((ITEMS_64))));
+        STEPS_AT_MOST(3 * 64, ML99_tupleFilter(ML99_appl(v(ML99_lesser), v(32)), v((ITEMS_64))));
+        STEPS_AT_MOST(64 / 3, ML99_tupleReverse(v((ITEMS_64))));
+        STEPS_AT_MOST(2, ML99_tupleSlice(v(16), v(48), v((ITEMS_64))));
+    }
+}
+
+#undef F_IMPL
+#undef F_ARITY
@@ -1,4 +1,6 @@
 #include <metalang99/assert.h>
+#include <metalang99/list.h>
+#include <metalang99/nat.h>
 #include <metalang99/tuple.h>
 
 int main(void) {
@@ -137,6 +139,26 @@ int main(void) {
         ML99_ASSERT_UNEVAL(ML99_TUPLE_GET(0)((19, 8, 7378)) == 19);
     }
 
+#define ITEMS_0_TO_99                                                                              \
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,  \
+        26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,    \
+        48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69,    \
+        70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91,    \
+        92, 93, 94, 95, 96, 97, 98, 99
+
+    // ML99_tupleGet, ML99_TUPLE_GET with indices greater than 7
+    {
+        ML99_ASSERT_EQ(ML99_tupleGet(8)(v((0, 1, 2, 3, 4, 5, 6, 7, 8))), v(8));
+        ML99_ASSERT_EQ(ML99_tupleGet(20)(v((ITEMS_0_TO_99))), v(20));
+        ML99_ASSERT_EQ(ML99_tupleGet(63)(v((ITEMS_0_TO_99))), v(63));
+
+        ML99_ASSERT_UNEVAL(ML99_TUPLE_GET(8)((0, 1, 2, 3, 4, 5, 6, 7, 8)) == 8);
+        ML99_ASSERT_UNEVAL(ML99_TUPLE_GET(37)((ITEMS_0_TO_99)) == 37);
+        ML99_ASSERT_UNEVAL(ML99_TUPLE_GET(63)((ITEMS_0_TO_99)) == 63);
+    }
+
+#undef ITEMS_0_TO_99
+
 #define CHECK_TAIL(...)            CHECK_TAIL_AUX(__VA_ARGS__)
 #define CHECK_TAIL_AUX(a, b, c, d) ML99_ASSERT_UNEVAL(a == 51 && b == 21 && c == 1 && d == 7378)
 
@@ -191,6 +213,94 @@ int main(void) {
 #undef F_IMPL
 #undef F_ARITY
 
+#define ITEMS_0_TO_19 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19
+#define F_IMPL(x)     v(+x)
+#define F_ARITY       1
+#define G_IMPL(x, i)  v(&&x == i)
+#define G_ARITY       2
+
+    // ML99_tupleForEach(I) with more than 8 items
+    {
+        ML99_ASSERT_UNEVAL((0 ML99_EVAL(ML99_tupleForEach(v(F), v((ITEMS_0_TO_19))))) == 190);
+        ML99_ASSERT_UNEVAL(1 ML99_EVAL(ML99_tupleForEachI(v(G), v((ITEMS_0_TO_19)))));
+    }
+
+#undef ITEMS_0_TO_19
+#undef F_IMPL
+#undef F_ARITY
+#undef G_IMPL
+#undef G_ARITY
+
+#define ITEMS_0_TO_19 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19
+#define ITEMS_19_TO_0 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0
+
+#define TUPLE_EQ(x, ...)                                                                           \
+    ML99_listEq(v(ML99_natEq), ML99_list(ML99_untuple(x)), ML99_list(v(__VA_ARGS__)))
+
+    // ML99_tupleMap
+    {
+        ML99_ASSERT(TUPLE_EQ(ML99_tupleMap(v(ML99_inc), v((5))), 6));
+        ML99_ASSERT(TUPLE_EQ(ML99_tupleMap(ML99_appl(v(ML99_add), v(3)), v((1, 2, 3))), 4, 5, 6));
+        ML99_ASSERT(TUPLE_EQ(
+            ML99_tupleMap(v(ML99_dec), v((1, 2, 3, 4, 5, 6, 7, 8))),
+            0, 1, 2, 3, 4, 5, 6, 7));
+        ML99_ASSERT(TUPLE_EQ(
+            ML99_tupleMap(ML99_appl(v(ML99_sub), v(19)), v((ITEMS_0_TO_19))),
+            ITEMS_19_TO_0));
+    }
+
+    // ML99_tupleFilter
+    {
+        ML99_ASSERT(TUPLE_EQ(
+            ML99_tupleFilter(ML99_appl(v(ML99_lesser), v(3)), v((14, 0, 1, 7, 2, 65, 3, 10))),
+            14, 7, 65, 10));
+        ML99_ASSERT(TUPLE_EQ(
+            ML99_tupleFilter(ML99_appl(v(ML99_lesser), v(15)), v((ITEMS_0_TO_19))),
+            16, 17, 18, 19));
+        ML99_ASSERT(TUPLE_EQ(
+            ML99_tupleFilter(ML99_appl(v(ML99_greater), v(3)), v((ITEMS_0_TO_19))),
+            0, 1, 2));
+        ML99_ASSERT_EMPTY(
+            ML99_untuple(ML99_tupleFilter(ML99_appl(v(ML99_lesser), v(3)), v((1, 2, 3)))));
+    }
+
+    // ML99_tupleConcat
+    {
+        ML99_ASSERT(TUPLE_EQ(ML99_tupleConcat(v((1, 2, 3)), v((4, 5))), 1, 2, 3, 4, 5));
+        ML99_ASSERT(TUPLE_EQ(ML99_tupleConcat(v((1)), v((2))), 1, 2));
+    }
+
+    // ML99_TUPLE_CONCAT
+    { ML99_ASSERT(TUPLE_EQ(v(ML99_TUPLE_CONCAT((1, 2), (3))), 1, 2, 3)); }
+
+    // ML99_tupleSlice
+    {
+        ML99_ASSERT(TUPLE_EQ(ML99_tupleSlice(v(1), v(3), v((1, 2, 3, 4))), 2, 3));
+        ML99_ASSERT(TUPLE_EQ(ML99_tupleSlice(v(0), v(4), v((1, 2, 3, 4))), 1, 2, 3, 4));
+        ML99_ASSERT(TUPLE_EQ(ML99_tupleSlice(v(3), v(4), v((1, 2, 3, 4))), 4));
+        ML99_ASSERT(TUPLE_EQ(
+            ML99_tupleSlice(v(7), v(17), v((ITEMS_0_TO_19))),
+            7, 8, 9, 10, 11, 12, 13, 14, 15, 16));
+        ML99_ASSERT(TUPLE_EQ(ML99_tupleSlice(v(0), v(1), v((1, 2, 3, 4))), 1));
+        ML99_ASSERT_EMPTY(ML99_untuple(ML99_tupleSlice(v(2), v(2), v((1, 2, 3, 4)))));
+        ML99_ASSERT_EMPTY(ML99_untuple(ML99_tupleSlice(v(0), v(0), v((1, 2, 3, 4)))));
+        ML99_ASSERT_EMPTY(ML99_untuple(ML99_tupleSlice(v(4), v(4), v((1, 2, 3, 4)))));
+    }
+
+    // ML99_tupleReverse
+    {
+        ML99_ASSERT(TUPLE_EQ(ML99_tupleReverse(v((1))), 1));
+        ML99_ASSERT(TUPLE_EQ(ML99_tupleReverse(v((1, 2, 3))), 3, 2, 1));
+        ML99_ASSERT(TUPLE_EQ(
+            ML99_tupleReverse(v((1, 2, 3, 4, 5, 6, 7, 8, 9))),
+            9, 8, 7, 6, 5, 4, 3, 2, 1));
+        ML99_ASSERT(TUPLE_EQ(ML99_tupleReverse(v((ITEMS_0_TO_19))), ITEMS_19_TO_0));
+    }
+
+#undef ITEMS_0_TO_19
+#undef ITEMS_19_TO_0
+#undef TUPLE_EQ
+
 #undef CHECK_EXPAND
 
     // ML99_assertIsTuple
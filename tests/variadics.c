@@ -45,6 +45,26 @@ int main(void) {
         ML99_ASSERT_UNEVAL(ML99_VARIADICS_GET(1)(19, 8, 7378) == 8);
     }
 
+#define ITEMS_0_TO_99                                                                              \
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,  \
+        26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,    \
+        48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69,    \
+        70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91,    \
+        92, 93, 94, 95, 96, 97, 98, 99
+
+    // ML99_variadicsGet, ML99_VARIADICS_GET with indices greater than 7
+    {
+        ML99_ASSERT_EQ(ML99_variadicsGet(8)(v(0, 1, 2, 3, 4, 5, 6, 7, 8)), v(8));
+        ML99_ASSERT_EQ(ML99_variadicsGet(20)(v(ITEMS_0_TO_99)), v(20));
+        ML99_ASSERT_EQ(ML99_variadicsGet(63)(v(ITEMS_0_TO_99)), v(63));
+
+        ML99_ASSERT_UNEVAL(ML99_VARIADICS_GET(8)(0, 1, 2, 3, 4, 5, 6, 7, 8) == 8);
+        ML99_ASSERT_UNEVAL(ML99_VARIADICS_GET(37)(ITEMS_0_TO_99) == 37);
+        ML99_ASSERT_UNEVAL(ML99_VARIADICS_GET(63)(ITEMS_0_TO_99) == 63);
+    }
+
+#undef ITEMS_0_TO_99
+
 #define CHECK_TAIL(...)            CHECK_TAIL_AUX(__VA_ARGS__)
 #define CHECK_TAIL_AUX(a, b, c, d) ML99_ASSERT_UNEVAL(a == 51 && b == 21 && c == 1 && d == 7378)
 
@@ -60,6 +80,7 @@ int main(void) {
 #define _5_ARGS  v(~, ~, ~, ~, ~)
 #define _10_ARGS _5_ARGS, _5_ARGS
 #define _50_ARGS _10_ARGS, _10_ARGS, _10_ARGS, _10_ARGS, _10_ARGS
+#define _100_ARGS _50_ARGS, _50_ARGS
 
     // ML99_variadicsCount
     {
@@ -76,6 +97,13 @@ int main(void) {
         ML99_ASSERT_EQ(ML99_variadicsCount(_10_ARGS), v(10));
         ML99_ASSERT_EQ(ML99_variadicsCount(_10_ARGS, v(~)), v(11));
         ML99_ASSERT_EQ(ML99_variadicsCount(_50_ARGS, _10_ARGS, v(~, ~, ~)), v(63));
+
+        // More than 63 arguments.
+        ML99_ASSERT_EQ(ML99_variadicsCount(_10_ARGS, _10_ARGS, _10_ARGS, v(~, ~)), v(32));
+        ML99_ASSERT_EQ(ML99_variadicsCount(_10_ARGS, _10_ARGS, _10_ARGS, v(~, ~, ~)), v(33));
+        ML99_ASSERT_EQ(ML99_variadicsCount(_50_ARGS, _10_ARGS, v(~, ~, ~, ~)), v(64));
+        ML99_ASSERT_EQ(ML99_variadicsCount(_100_ARGS), v(100));
+        ML99_ASSERT_EQ(ML99_variadicsCount(_100_ARGS, _100_ARGS, _50_ARGS, _5_ARGS), v(255));
     }
 
     // ML99_VARIADICS_COUNT
@@ -86,6 +114,26 @@ int main(void) {
         ML99_ASSERT_EQ(v(ML99_VARIADICS_COUNT(~, ~, ~)), v(3));
     }
 
+#define X10 ~, ~, ~, ~, ~, ~, ~, ~, ~, ~
+
+    // ML99_VARIADICS_COUNT_UPTO
+    {
+        ML99_ASSERT_UNEVAL(ML99_VARIADICS_COUNT_UPTO(1, ~) == 1);
+        ML99_ASSERT_UNEVAL(ML99_VARIADICS_COUNT_UPTO(2, ~) == 1);
+        ML99_ASSERT_UNEVAL(ML99_VARIADICS_COUNT_UPTO(2, ~, ~) == 2);
+        ML99_ASSERT_UNEVAL(ML99_VARIADICS_COUNT_UPTO(3, ~, ~) == 2);
+        ML99_ASSERT_UNEVAL(ML99_VARIADICS_COUNT_UPTO(4, ~, ~, ~, ~) == 4);
+        ML99_ASSERT_UNEVAL(ML99_VARIADICS_COUNT_UPTO(5, ~, ~, ~) == 3);
+        ML99_ASSERT_UNEVAL(ML99_VARIADICS_COUNT_UPTO(6, ~, ~, ~, ~, ~, ~) == 6);
+        ML99_ASSERT_UNEVAL(ML99_VARIADICS_COUNT_UPTO(7, ~) == 1);
+        ML99_ASSERT_UNEVAL(ML99_VARIADICS_COUNT_UPTO(8, ~, ~, ~, ~, ~, ~, ~, ~) == 8);
+        ML99_ASSERT_UNEVAL(ML99_VARIADICS_COUNT_UPTO(16, ~, ~, ~, ~, ~, ~, ~, ~, ~, ~) == 10);
+        ML99_ASSERT_UNEVAL(ML99_VARIADICS_COUNT_UPTO(32, X10, X10) == 20);
+        ML99_ASSERT_UNEVAL(ML99_VARIADICS_COUNT_UPTO(63, X10, X10, X10, X10, X10, X10) == 60);
+    }
+
+#undef X10
+
 #undef _5_ARGS
 #undef _10_ARGS
 #undef _50_ARGS
@@ -129,5 +177,23 @@ int main(void) {
 #undef F_IMPL
 #undef F_ARITY
 
+#define ITEMS_0_TO_19 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19
+#define F_IMPL(x)     v(+x)
+#define F_ARITY       1
+#define G_IMPL(x, i)  v(&&x == i)
+#define G_ARITY       2
+
+    // ML99_variadicsForEach(I) with more than 8 arguments
+    {
+        ML99_ASSERT_UNEVAL((0 ML99_EVAL(ML99_variadicsForEach(v(F), v(ITEMS_0_TO_19)))) == 190);
+        ML99_ASSERT_UNEVAL(1 ML99_EVAL(ML99_variadicsForEachI(v(G), v(ITEMS_0_TO_19))));
+    }
+
+#undef ITEMS_0_TO_19
+#undef F_IMPL
+#undef F_ARITY
+#undef G_IMPL
+#undef G_ARITY
+
 #undef CHECK_EXPAND
 }
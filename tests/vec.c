@@ -0,0 +1,125 @@
+#include <metalang99/assert.h>
+#include <metalang99/list.h>
+#include <metalang99/nat.h>
+#include <metalang99/vec.h>
+
+int main(void) {
+
+#define CMP_VEC(lhs, rhs) ML99_listEq(v(ML99_natEq), ML99_vecToList(lhs), rhs)
+
+#define ITEMS_1_TO_20 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20
+
+    // ML99_vec, ML99_vecEmpty, ML99_VEC_EMPTY
+    {
+        ML99_ASSERT(CMP_VEC(ML99_vec(v(1, 2, 3)), ML99_list(v(1, 2, 3))));
+        ML99_ASSERT(CMP_VEC(ML99_vec(v(ITEMS_1_TO_20)), ML99_list(v(ITEMS_1_TO_20))));
+        ML99_ASSERT(CMP_VEC(ML99_vecEmpty(), ML99_nil()));
+        ML99_ASSERT(CMP_VEC(v(ML99_VEC_EMPTY()), ML99_nil()));
+    }
+
+    // ML99_vecFromList, ML99_vecToList
+    {
+        ML99_ASSERT(CMP_VEC(ML99_vecFromList(ML99_nil()), ML99_nil()));
+        ML99_ASSERT(CMP_VEC(ML99_vecFromList(ML99_list(v(1, 2, 3))), ML99_list(v(1, 2, 3))));
+        ML99_ASSERT(
+            CMP_VEC(ML99_vecFromList(ML99_sizedList(v(1, 2, 3))), ML99_list(v(1, 2, 3))));
+        ML99_ASSERT_EQ(ML99_vecLen(ML99_vecFromList(ML99_list(v(ITEMS_1_TO_20)))), v(20));
+    }
+
+    // ML99_vecLen, ML99_VEC_LEN
+    {
+        ML99_ASSERT_EQ(ML99_vecLen(ML99_vecEmpty()), v(0));
+        ML99_ASSERT_EQ(ML99_vecLen(ML99_vec(v(1, 2, 3))), v(3));
+        ML99_ASSERT_EQ(ML99_vecLen(ML99_vec(v(ITEMS_1_TO_20))), v(20));
+
+        ML99_ASSERT_UNEVAL(ML99_VEC_LEN((3, 1, 2, 3)) == 3);
+    }
+
+    // ML99_vecIsEmpty, ML99_VEC_IS_EMPTY
+    {
+        ML99_ASSERT(ML99_vecIsEmpty(ML99_vecEmpty()));
+        ML99_ASSERT(ML99_not(ML99_vecIsEmpty(ML99_vec(v(1, 2, 3)))));
+
+        ML99_ASSERT_UNEVAL(ML99_VEC_IS_EMPTY(ML99_VEC_EMPTY()));
+        ML99_ASSERT_UNEVAL(!ML99_VEC_IS_EMPTY((1, 5)));
+    }
+
+    // ML99_vecGet, ML99_VEC_GET
+    {
+        ML99_ASSERT_EQ(ML99_vecGet(v(0), ML99_vec(v(1, 2, 3))), v(1));
+        ML99_ASSERT_EQ(ML99_vecGet(v(2), ML99_vec(v(1, 2, 3))), v(3));
+        ML99_ASSERT_EQ(ML99_vecGet(v(17), ML99_vec(v(ITEMS_1_TO_20))), v(18));
+        ML99_ASSERT_EQ(ML99_vecGet(v(19), ML99_vec(v(ITEMS_1_TO_20))), v(20));
+
+        ML99_ASSERT_UNEVAL(ML99_VEC_GET(1, (3, 1, 2, 3)) == 2);
+    }
+
+    // ML99_vecMap
+    {
+#define F_IMPL(x) v(ML99_INC(x))
+#define F_ARITY   1
+
+        ML99_ASSERT(CMP_VEC(ML99_vecMap(v(F), ML99_vecEmpty()), ML99_nil()));
+        ML99_ASSERT(CMP_VEC(ML99_vecMap(v(F), ML99_vec(v(1, 2, 3))), ML99_list(v(2, 3, 4))));
+        ML99_ASSERT(CMP_VEC(
+            ML99_vecMap(v(F), ML99_vec(v(1, 2, 3, 4, 5, 6, 7, 8))),
+            ML99_list(v(2, 3, 4, 5, 6, 7, 8, 9))));
+        ML99_ASSERT(CMP_VEC(
+            ML99_vecMap(v(F), ML99_vec(v(ITEMS_1_TO_20))),
+            ML99_list(v(2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21))));
+
+#undef F_IMPL
+#undef F_ARITY
+    }
+
+    // ML99_vecFilter
+    {
+        ML99_ASSERT(
+            CMP_VEC(ML99_vecFilter(ML99_appl(v(ML99_lesser), v(3)), ML99_vecEmpty()), ML99_nil()));
+        ML99_ASSERT(CMP_VEC(
+            ML99_vecFilter(ML99_appl(v(ML99_lesser), v(3)), ML99_vec(v(1, 2, 3))),
+            ML99_nil()));
+        ML99_ASSERT(CMP_VEC(
+            ML99_vecFilter(ML99_appl(v(ML99_lesser), v(3)), ML99_vec(v(14, 0, 1, 7, 2, 65, 3, 10))),
+            ML99_list(v(14, 7, 65, 10))));
+        ML99_ASSERT(CMP_VEC(
+            ML99_vecFilter(ML99_appl(v(ML99_lesser), v(15)), ML99_vec(v(ITEMS_1_TO_20))),
+            ML99_list(v(16, 17, 18, 19, 20))));
+        ML99_ASSERT_EQ(
+            ML99_vecLen(
+                ML99_vecFilter(ML99_appl(v(ML99_greater), v(15)), ML99_vec(v(ITEMS_1_TO_20)))),
+            v(14));
+    }
+
+    // ML99_vecFoldl
+    {
+        ML99_ASSERT_EQ(ML99_vecFoldl(v(ML99_add), v(7), ML99_vecEmpty()), v(7));
+        ML99_ASSERT_EQ(ML99_vecFoldl(v(ML99_add), v(0), ML99_vec(v(1, 2, 3))), v(6));
+        ML99_ASSERT_EQ(ML99_vecFoldl(v(ML99_add), v(0), ML99_vec(v(ITEMS_1_TO_20))), v(210));
+        ML99_ASSERT_EQ(ML99_vecFoldl(v(ML99_sub), v(10), ML99_vec(v(1, 2, 3))), v(4));
+    }
+
+    // ML99_vecConcat
+    {
+        ML99_ASSERT(CMP_VEC(ML99_vecConcat(ML99_vecEmpty(), ML99_vecEmpty()), ML99_nil()));
+        ML99_ASSERT(
+            CMP_VEC(ML99_vecConcat(ML99_vecEmpty(), ML99_vec(v(1, 2))), ML99_list(v(1, 2))));
+        ML99_ASSERT(
+            CMP_VEC(ML99_vecConcat(ML99_vec(v(1, 2)), ML99_vecEmpty()), ML99_list(v(1, 2))));
+        ML99_ASSERT(CMP_VEC(
+            ML99_vecConcat(ML99_vec(v(1, 2, 3)), ML99_vec(v(4, 5))),
+            ML99_list(v(1, 2, 3, 4, 5))));
+        ML99_ASSERT_EQ(
+            ML99_vecLen(ML99_vecConcat(ML99_vec(v(ITEMS_1_TO_20)), ML99_vec(v(ITEMS_1_TO_20)))),
+            v(40));
+    }
+
+    // ML99_vecUnwrapCommaSep
+    {
+        ML99_ASSERT_EMPTY(ML99_vecUnwrapCommaSep(ML99_vecEmpty()));
+        ML99_ASSERT_EQ(ML99_variadicsCount(ML99_vecUnwrapCommaSep(ML99_vec(v(1, 2, 3)))), v(3));
+    }
+
+#undef ITEMS_1_TO_20
+#undef CMP_VEC
+}